@@ -40,6 +40,7 @@
 #include <Nazara/Core/ApplicationBase.hpp>
 #include <Nazara/Core/ApplicationComponent.hpp>
 #include <Nazara/Core/ApplicationUpdater.hpp>
+#include <Nazara/Core/ArchiveBuilder.hpp>
 #include <Nazara/Core/Buffer.hpp>
 #include <Nazara/Core/BufferMapper.hpp>
 #include <Nazara/Core/ByteArray.hpp>
@@ -50,6 +51,7 @@
 #include <Nazara/Core/CommandLineParameters.hpp>
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/CubemapParams.hpp>
+#include <Nazara/Core/DeltaEncoding.hpp>
 #include <Nazara/Core/DynLib.hpp>
 #include <Nazara/Core/EmptyStream.hpp>
 #include <Nazara/Core/EntitySystemAppComponent.hpp>
@@ -126,6 +128,7 @@
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Core/TimerManager.hpp>
 #include <Nazara/Core/Timestamp.hpp>
+#include <Nazara/Core/TransformHierarchy.hpp>
 #include <Nazara/Core/TriangleIterator.hpp>
 #include <Nazara/Core/Unicode.hpp>
 #include <Nazara/Core/UniformBuffer.hpp>
@@ -136,11 +139,13 @@
 #include <Nazara/Core/VertexMapper.hpp>
 #include <Nazara/Core/VertexStruct.hpp>
 #include <Nazara/Core/VirtualDirectory.hpp>
+#include <Nazara/Core/VirtualDirectoryArchiveResolver.hpp>
 #include <Nazara/Core/VirtualDirectoryFilesystemResolver.hpp>
 
 #ifdef NAZARA_ENTT
 
 #include <Nazara/Core/Components.hpp>
+#include <Nazara/Core/EnttParallel.hpp>
 #include <Nazara/Core/EnttSystemGraph.hpp>
 #include <Nazara/Core/EnttWorld.hpp>
 #include <Nazara/Core/Systems.hpp>
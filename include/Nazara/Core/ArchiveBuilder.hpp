@@ -0,0 +1,60 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_ARCHIVEBUILDER_HPP
+#define NAZARA_CORE_ARCHIVEBUILDER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Enums.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <filesystem>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_CORE_API ArchiveBuilder
+	{
+		public:
+			inline ArchiveBuilder();
+			ArchiveBuilder(const ArchiveBuilder&) = delete;
+			ArchiveBuilder(ArchiveBuilder&&) noexcept = default;
+			~ArchiveBuilder() = default;
+
+			bool AddDirectory(const std::filesystem::path& directoryPath, ArchiveCompression compression = ArchiveCompression::None);
+			void AddFile(std::string path, ByteArray content, ArchiveCompression compression = ArchiveCompression::None);
+			void AddFile(std::string path, std::filesystem::path filePath, ArchiveCompression compression = ArchiveCompression::None);
+
+			inline UInt32 GetAlignment() const;
+			inline std::size_t GetFileCount() const;
+
+			bool Save(const std::filesystem::path& archivePath) const;
+
+			inline void SetAlignment(UInt32 alignment);
+
+			ArchiveBuilder& operator=(const ArchiveBuilder&) = delete;
+			ArchiveBuilder& operator=(ArchiveBuilder&&) noexcept = default;
+
+			static constexpr UInt32 DefaultAlignment = 16;
+
+		private:
+			struct PendingFile
+			{
+				std::string path;
+				std::variant<ByteArray, std::filesystem::path> content;
+				ArchiveCompression compression;
+			};
+
+			std::vector<PendingFile> m_files;
+			UInt32 m_alignment;
+	};
+}
+
+#include <Nazara/Core/ArchiveBuilder.inl>
+
+#endif // NAZARA_CORE_ARCHIVEBUILDER_HPP
@@ -0,0 +1,36 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <bit>
+
+namespace Nz
+{
+	inline ArchiveBuilder::ArchiveBuilder() :
+	m_alignment(DefaultAlignment)
+	{
+	}
+
+	inline UInt32 ArchiveBuilder::GetAlignment() const
+	{
+		return m_alignment;
+	}
+
+	inline std::size_t ArchiveBuilder::GetFileCount() const
+	{
+		return m_files.size();
+	}
+
+	/*!
+	* \brief Sets the alignment of file data in the archive
+	*
+	* \param alignment Alignment in bytes, must be a power of two
+	*
+	* \remark Aligning files to the page size (4096) allows them to be mapped individually, at the cost of padding
+	*/
+	inline void ArchiveBuilder::SetAlignment(UInt32 alignment)
+	{
+		NazaraAssertMsg(std::has_single_bit(alignment), "alignment must be a power of two");
+		m_alignment = alignment;
+	}
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_DELTAENCODING_HPP
+#define NAZARA_CORE_DELTAENCODING_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Export.hpp>
+
+namespace Nz
+{
+	class ByteArray;
+
+	NAZARA_CORE_API bool ApplyDelta(const ByteArray& reference, const ByteArray& delta, ByteArray& data);
+	NAZARA_CORE_API void ComputeDelta(const ByteArray& reference, const ByteArray& data, ByteArray& delta);
+}
+
+#endif // NAZARA_CORE_DELTAENCODING_HPP
@@ -0,0 +1,25 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_ENTTPARALLEL_HPP
+#define NAZARA_CORE_ENTTPARALLEL_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <entt/entt.hpp>
+
+namespace Nz
+{
+	constexpr std::size_t EnttParallelDefaultGrainSize = 512;
+
+	template<typename View, typename F> void EnttParallelForEach(TaskScheduler* taskScheduler, const View& view, F&& func, std::size_t grainSize = EnttParallelDefaultGrainSize);
+
+	inline TaskScheduler* GetEnttTaskScheduler(const entt::registry& registry);
+}
+
+#include <Nazara/Core/EnttParallel.inl>
+
+#endif // NAZARA_CORE_ENTTPARALLEL_HPP
@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <tuple>
+
+namespace Nz
+{
+	/*!
+	* \brief Calls func for every entity of an entt view, splitting the view into chunks processed concurrently by the task scheduler
+	*
+	* \param taskScheduler Task scheduler used to process the chunks, nullptr processes the whole view on the calling thread
+	* \param view View to iterate, func is called with the entity followed by a reference to each of its components (empty types excluded) like view.each()
+	* \param func Callback called concurrently from multiple threads, it must only access the entity it is given
+	* \param grainSize Minimum number of entities processed by a single chunk, views smaller than that are processed on the calling thread
+	*
+	* \remark Entities must not be created, destroyed or get components added/removed while the view is iterated, since this is not thread-safe
+	* \remark Signals shouldn't be triggered from func, defer them and trigger them from the calling thread once this function returns
+	*/
+	template<typename View, typename F>
+	void EnttParallelForEach(TaskScheduler* taskScheduler, const View& view, F&& func, std::size_t grainSize)
+	{
+		// Iterate the leading storage (the smallest one) and filter out entities missing from the other ones, like entt does
+		const auto* leadingStorage = view.handle();
+		if (!leadingStorage)
+			return;
+
+		auto ProcessRange = [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				auto entity = (*leadingStorage)[i];
+				if (!view.contains(entity))
+					continue;
+
+				std::apply([&](auto&&... components)
+				{
+					func(entity, std::forward<decltype(components)>(components)...);
+				}, view.get(entity));
+			}
+		};
+
+		std::size_t entityCount = leadingStorage->size();
+		if (!taskScheduler || entityCount <= grainSize)
+			ProcessRange(0, entityCount);
+		else
+			taskScheduler->ParallelFor(0, entityCount, grainSize, ProcessRange);
+	}
+
+	/*!
+	* \brief Returns the task scheduler systems of this registry should use, if any
+	*
+	* \remark The task scheduler is registered in the registry context by EnttSystemGraph::SetTaskScheduler
+	*/
+	inline TaskScheduler* GetEnttTaskScheduler(const entt::registry& registry)
+	{
+		if (TaskScheduler* const* taskScheduler = registry.ctx().find<TaskScheduler*>())
+			return *taskScheduler;
+
+		return nullptr;
+	}
+}
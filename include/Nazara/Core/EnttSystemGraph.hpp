@@ -10,9 +10,13 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Core/Export.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
+#include <NazaraUtils/TypeList.hpp>
 #include <entt/entt.hpp>
 #include <functional>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -21,6 +25,8 @@ namespace Nz
 	class NAZARA_CORE_API EnttSystemGraph
 	{
 		public:
+			struct SystemTiming;
+
 			inline EnttSystemGraph(entt::registry& registry);
 			EnttSystemGraph(const EnttSystemGraph&) = delete;
 			EnttSystemGraph(EnttSystemGraph&&) = delete;
@@ -30,10 +36,17 @@ namespace Nz
 
 			inline void Clear();
 
+			inline Time GetCriticalPathTime() const;
 			template<typename T> T& GetSystem() const;
+			inline const std::vector<SystemTiming>& GetSystemTimings() const;
+			inline TaskScheduler* GetTaskScheduler() const;
 
 			template<typename T> void RemoveSystem();
 
+			std::string ReportTimings() const;
+
+			inline void SetTaskScheduler(TaskScheduler* taskScheduler);
+
 			template<typename T> T* TryGetSystem() const;
 
 			void Update();
@@ -42,6 +55,15 @@ namespace Nz
 			EnttSystemGraph& operator=(const EnttSystemGraph&) = delete;
 			EnttSystemGraph& operator=(EnttSystemGraph&&) = delete;
 
+			struct SystemTiming
+			{
+				std::string_view systemName;
+				Time duration;
+				Time startTime; //< relative to the beginning of the update
+				bool isOnCriticalPath;
+				bool isParallel; //< was dispatched on the task scheduler
+			};
+
 		private:
 			struct NAZARA_CORE_API NodeBase
 			{
@@ -50,7 +72,13 @@ namespace Nz
 				virtual bool HasUpdate() const = 0;
 				virtual void Update(Time elapsedTime) = 0;
 
+				bool ConflictsWith(const NodeBase& node) const;
+
+				std::string_view name;
+				std::vector<entt::id_type> readComponents;
+				std::vector<entt::id_type> writeComponents;
 				Int64 executionOrder;
+				bool allowConcurrent;
 			};
 
 			template<typename T, bool CanUpdate>
@@ -64,12 +92,30 @@ namespace Nz
 				T system;
 			};
 
+			struct ExecutionNode
+			{
+				NodeBase* node;
+				std::vector<std::size_t> dependencies; //< indices of previous nodes accessing the same components
+				std::size_t batchIndex;
+			};
+
+			void BuildExecutionGraph();
+			void ComputeCriticalPath();
+			void RunNode(std::size_t nodeIndex, Time elapsedTime, Time updateStartTime);
+			void UpdateBatch(std::size_t firstNode, std::size_t lastNode, Time elapsedTime, Time updateStartTime);
+
 			std::unordered_map<entt::id_type, std::size_t /*nodeIndex*/> m_systemToNodes;
-			std::vector<NodeBase*> m_orderedNodes;
+			std::vector<ExecutionNode> m_orderedNodes;
+			std::vector<SystemTiming> m_systemTimings;
+			std::vector<TaskScheduler::TaskHandle> m_dependencyHandles;
+			std::vector<TaskScheduler::TaskHandle> m_nodeTasks;
 			std::vector<std::unique_ptr<NodeBase>> m_nodes;
 			entt::registry& m_registry;
 			Nz::HighPrecisionClock m_clock;
+			TaskScheduler* m_taskScheduler;
+			Time m_criticalPathTime;
 			bool m_systemOrderUpdated;
+			bool m_warmedUp;
 	};
 }
 
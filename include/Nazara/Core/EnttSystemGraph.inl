@@ -15,6 +15,38 @@ namespace Nz
 		template<typename T>
 		struct EnttSystemGraphAllowConcurrent<T, std::void_t<decltype(T::AllowConcurrent)>> : std::bool_constant<T::AllowConcurrent> {};
 
+		template<typename>
+		struct EnttSystemGraphComponentList;
+
+		template<typename... Components>
+		struct EnttSystemGraphComponentList<TypeList<Components...>>
+		{
+			static std::vector<entt::id_type> Get()
+			{
+				return { entt::type_hash<Components>::value()... };
+			}
+		};
+
+		// Components the system reads and writes
+		template<typename, typename = void>
+		struct EnttSystemGraphComponents : std::false_type {};
+
+		template<typename T>
+		struct EnttSystemGraphComponents<T, std::void_t<typename T::Components>> : std::true_type
+		{
+			using List = typename T::Components;
+		};
+
+		// Components the system only reads
+		template<typename, typename = void>
+		struct EnttSystemGraphReadOnlyComponents : std::false_type {};
+
+		template<typename T>
+		struct EnttSystemGraphReadOnlyComponents<T, std::void_t<typename T::ReadOnlyComponents>> : std::true_type
+		{
+			using List = typename T::ReadOnlyComponents;
+		};
+
 		template<typename, typename = void>
 		struct EnttSystemGraphExecutionOrder : std::integral_constant<Int64, 0> {};
 
@@ -50,7 +82,9 @@ namespace Nz
 
 	inline EnttSystemGraph::EnttSystemGraph(entt::registry& registry) :
 	m_registry(registry),
-	m_systemOrderUpdated(true)
+	m_taskScheduler(nullptr),
+	m_systemOrderUpdated(true),
+	m_warmedUp(false)
 	{
 	}
 
@@ -68,6 +102,19 @@ namespace Nz
 
 		auto nodePtr = std::make_unique<Node<T, CanUpdate>>(m_registry, std::forward<Args>(args)...);
 		nodePtr->executionOrder = Detail::EnttSystemGraphExecutionOrder<T>();
+		nodePtr->name = entt::type_name<T>::value();
+
+		// Systems can only run concurrently if they declare which components they're accessing
+		constexpr bool HasComponents = Detail::EnttSystemGraphComponents<T>();
+		constexpr bool HasReadOnlyComponents = Detail::EnttSystemGraphReadOnlyComponents<T>();
+
+		if constexpr (HasComponents)
+			nodePtr->writeComponents = Detail::EnttSystemGraphComponentList<typename Detail::EnttSystemGraphComponents<T>::List>::Get();
+
+		if constexpr (HasReadOnlyComponents)
+			nodePtr->readComponents = Detail::EnttSystemGraphComponentList<typename Detail::EnttSystemGraphReadOnlyComponents<T>::List>::Get();
+
+		nodePtr->allowConcurrent = Detail::EnttSystemGraphAllowConcurrent<T>() && (HasComponents || HasReadOnlyComponents);
 
 		T& system = nodePtr->system;
 
@@ -88,10 +135,17 @@ namespace Nz
 
 		m_nodes.clear();
 		m_orderedNodes.clear();
+		m_systemTimings.clear();
 		m_systemToNodes.clear();
+		m_criticalPathTime = Time::Zero();
 		m_systemOrderUpdated = true;
 	}
 
+	inline Time EnttSystemGraph::GetCriticalPathTime() const
+	{
+		return m_criticalPathTime;
+	}
+
 	template<typename T>
 	T& EnttSystemGraph::GetSystem() const
 	{
@@ -102,6 +156,19 @@ namespace Nz
 		return *system;
 	}
 
+	/*!
+	* \brief Returns the duration of every system during the last update, in execution order
+	*/
+	inline auto EnttSystemGraph::GetSystemTimings() const -> const std::vector<SystemTiming>&
+	{
+		return m_systemTimings;
+	}
+
+	inline TaskScheduler* EnttSystemGraph::GetTaskScheduler() const
+	{
+		return m_taskScheduler;
+	}
+
 	template<typename T>
 	void EnttSystemGraph::RemoveSystem()
 	{
@@ -114,6 +181,24 @@ namespace Nz
 		m_systemOrderUpdated = false;
 	}
 
+	/*!
+	* \brief Sets the task scheduler used to run systems concurrently
+	*
+	* Systems declaring the components they access (through a Components and/or a ReadOnlyComponents type list) and which don't disable AllowConcurrent
+	* are run on the task scheduler, two systems accessing the same component (with at least one of them writing it) are never run at the same time
+	* and keep their execution order.
+	* Other systems are run on the calling thread after every previous system finished, and before any following system starts.
+	*
+	* The task scheduler is also registered in the registry context, for systems to split their own work (see GetEnttTaskScheduler).
+	*
+	* \param taskScheduler Task scheduler used to dispatch systems, nullptr runs every system sequentially on the calling thread (in execution order)
+	*/
+	inline void EnttSystemGraph::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_taskScheduler = taskScheduler;
+		m_registry.ctx().insert_or_assign(taskScheduler);
+	}
+
 	template<typename T>
 	T* Nz::EnttSystemGraph::TryGetSystem() const
 	{
@@ -32,9 +32,13 @@ namespace Nz
 			entt::registry& GetRegistry();
 			const entt::registry& GetRegistry() const;
 			template<typename T> T& GetSystem() const;
+			inline EnttSystemGraph& GetSystemGraph();
+			inline const EnttSystemGraph& GetSystemGraph() const;
 
 			template<typename T> void RemoveSystem();
 
+			inline void SetTaskScheduler(TaskScheduler* taskScheduler);
+
 			template<typename T> T* TryGetSystem() const;
 
 			void Update(Time elapsedTime) override;
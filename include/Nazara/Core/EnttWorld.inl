@@ -4,12 +4,6 @@
 
 namespace Nz
 {
-	inline EnttWorld::EnttWorld() :
-	m_systemGraph(m_registry)
-	{
-		m_registry.ctx().emplace<EnttWorld*>(this);
-	}
-
 	template<typename T, typename... Args>
 	T& EnttWorld::AddSystem(Args&&... args)
 	{
@@ -47,12 +41,27 @@ namespace Nz
 		return m_systemGraph.GetSystem<T>();
 	}
 
+	inline EnttSystemGraph& EnttWorld::GetSystemGraph()
+	{
+		return m_systemGraph;
+	}
+
+	inline const EnttSystemGraph& EnttWorld::GetSystemGraph() const
+	{
+		return m_systemGraph;
+	}
+
 	template<typename T>
 	void EnttWorld::RemoveSystem()
 	{
 		return m_systemGraph.RemoveSystem<T>();
 	}
 
+	inline void EnttWorld::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_systemGraph.SetTaskScheduler(taskScheduler);
+	}
+
 	template<typename T>
 	T* EnttWorld::TryGetSystem() const
 	{
@@ -27,6 +27,14 @@ namespace Nz
 		Max = Static
 	};
 
+	enum class ArchiveCompression
+	{
+		None,
+		LZ4,
+
+		Max = LZ4
+	};
+
 	enum class BlendEquation
 	{
 		Add,
@@ -67,6 +75,7 @@ namespace Nz
 	enum class BufferType
 	{
 		Index,
+		Indirect,
 		Vertex,
 		Storage,
 		Uniform,
@@ -273,17 +282,20 @@ namespace Nz
 
 	enum class OpenMode
 	{
-		NotOpen,    //< File is not open
-
-		Append,     //< Disables writing to existing content, all write operations are performed at the end
-		Defer,      //< Defers file opening until a read/write operation is performed on it
-		Lock,       //< Prevents file modification by other handles while it's open
-		MustExist,  //< Fails if the file doesn't exists, even if opened in write mode
-		Read,       //< Allows read operations
-		Text,       //< Opens in text mode (converts system line endings from/to \n)
-		Truncate,   //< Creates the file if it doesn't exist and empties it otherwise
-		Unbuffered, //< Each read/write operations are performed directly using system calls (very slow)
-		Write,      //< Allows write operations, creates the file if it doesn't exist
+		NotOpen,          //< File is not open
+
+		Append,           //< Disables writing to existing content, all write operations are performed at the end
+		Defer,            //< Defers file opening until a read/write operation is performed on it
+		Lock,             //< Prevents file modification by other handles while it's open
+		MemoryMapped,     //< Maps the file content in memory instead of reading it through system calls (read-only)
+		MustExist,        //< Fails if the file doesn't exists, even if opened in write mode
+		RandomAccess,     //< Hints the system that the file will be accessed randomly
+		Read,             //< Allows read operations
+		SequentialAccess, //< Hints the system that the file will be read sequentially
+		Text,             //< Opens in text mode (converts system line endings from/to \n)
+		Truncate,         //< Creates the file if it doesn't exist and empties it otherwise
+		Unbuffered,       //< Each read/write operations are performed directly using system calls (very slow)
+		Write,            //< Allows write operations, creates the file if it doesn't exist
 
 		Max = Write
 	};
@@ -637,8 +649,9 @@ namespace Nz
 
 		// Predefined declarations for instancing
 		Matrix4,
+		Matrix4_Instance,
 
-		Max = Matrix4
+		Max = Matrix4_Instance
 	};
 
 	constexpr std::size_t VertexLayoutCount = static_cast<std::size_t>(VertexLayout::Max) + 1;
@@ -66,6 +66,7 @@ namespace Nz
 		private:
 			inline bool CheckFileOpening();
 			void FlushStream() override;
+			void* GetMemoryMappedPointer() const override;
 			std::size_t ReadBlock(void* buffer, std::size_t size) override;
 			bool SeekStreamCursor(UInt64 offset) override;
 			UInt64 TellStreamCursor() const override;
@@ -18,7 +18,8 @@ namespace Nz
 	class NAZARA_CORE_API VelocitySystem
 	{
 		public:
-			using Components = TypeList<class NodeComponent, class VelocityComponent>;
+			using Components = TypeList<class NodeComponent>;
+			using ReadOnlyComponents = TypeList<class DisabledComponent, class VelocityComponent>;
 
 			inline VelocitySystem(entt::registry& registry);
 			VelocitySystem(const VelocitySystem&) = delete;
@@ -9,35 +9,135 @@
 
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/Export.hpp>
-#include <functional>
+#include <NazaraUtils/FunctionRef.hpp>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
 #include <memory>
+#include <span>
+#include <type_traits>
 
 namespace Nz
 {
 	class NAZARA_CORE_API TaskScheduler
 	{
 		public:
-			using Task = std::function<void()>;
+			class Task;
+			class TaskGroup;
+			class TaskHandle;
 
 			TaskScheduler(unsigned int workerCount = 0);
 			TaskScheduler(const TaskScheduler&) = delete;
 			TaskScheduler(TaskScheduler&&) = delete;
 			~TaskScheduler();
 
-			void AddTask(Task&& task);
+			TaskHandle AddContinuation(const TaskHandle& predecessor, Task&& task, TaskGroup* group = nullptr);
+			TaskHandle AddTask(Task&& task, TaskGroup* group = nullptr);
+			TaskHandle AddTask(Task&& task, std::span<const TaskHandle> dependencies, TaskGroup* group = nullptr);
 
 			unsigned int GetWorkerCount() const;
 
+			template<typename F> void ParallelFor(std::size_t first, std::size_t last, std::size_t grainSize, F&& func);
+
 			void WaitForTasks();
+			void WaitForTasks(const TaskGroup& group);
 
 			TaskScheduler& operator=(const TaskScheduler&) = delete;
 			TaskScheduler& operator=(TaskScheduler&&) = delete;
 
 		private:
+			class TaskArena;
+			struct TaskNode;
+
+			void ParallelForImpl(std::size_t first, std::size_t last, std::size_t grainSize, FunctionRef<void(std::size_t begin, std::size_t end)> func);
+
 			struct Data;
 			class Worker;
 			std::unique_ptr<Data> m_data;
 	};
+
+	// Move-only type-erased functor (not a std::function anymore), see the constructor for storage rules
+	class TaskScheduler::Task
+	{
+		public:
+			static constexpr std::size_t InlineStorageSize = 56;
+
+			Task() = default;
+			template<std::invocable F> Task(F&& functor) requires (!std::is_same_v<std::remove_cvref_t<F>, Task>);
+			Task(const Task&) = delete;
+			inline Task(Task&& task) noexcept;
+			inline ~Task();
+
+			inline void Reset();
+
+			inline explicit operator bool() const;
+			inline void operator()();
+
+			Task& operator=(const Task&) = delete;
+			inline Task& operator=(Task&& task) noexcept;
+
+		private:
+			struct Operations
+			{
+				void(*invoke)(void* storage);
+				void(*relocate)(void* destination, void* source) noexcept;
+				void(*destroy)(void* storage) noexcept;
+			};
+
+			template<typename F> struct HeapOperations;
+			template<typename F> struct InlineOperations;
+
+			template<typename F> static constexpr bool IsStoredInline = sizeof(F) <= InlineStorageSize && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+
+			alignas(std::max_align_t) std::byte m_storage[InlineStorageSize];
+			const Operations* m_operations = nullptr;
+	};
+
+	class TaskScheduler::TaskGroup
+	{
+		friend TaskScheduler;
+
+		public:
+			TaskGroup() = default;
+			TaskGroup(const TaskGroup&) = delete;
+			TaskGroup(TaskGroup&&) = delete;
+			~TaskGroup() = default;
+
+			inline unsigned int GetRemainingTaskCount() const;
+
+			inline bool IsDone() const;
+
+			TaskGroup& operator=(const TaskGroup&) = delete;
+			TaskGroup& operator=(TaskGroup&&) = delete;
+
+		private:
+			std::atomic_uint m_remainingTasks = 0;
+	};
+
+	// Handles reference scheduler-owned memory, they must be reset or destroyed before the scheduler they come from
+	class NAZARA_CORE_API TaskScheduler::TaskHandle
+	{
+		friend TaskScheduler;
+
+		public:
+			TaskHandle() = default;
+			TaskHandle(const TaskHandle& handle);
+			inline TaskHandle(TaskHandle&& handle) noexcept;
+			~TaskHandle();
+
+			bool IsFinished() const;
+			inline bool IsValid() const;
+
+			void Reset();
+
+			TaskHandle& operator=(const TaskHandle& handle);
+			TaskHandle& operator=(TaskHandle&& handle) noexcept;
+
+		private:
+			explicit TaskHandle(TaskNode* node);
+
+			TaskNode* m_node = nullptr;
+	};
 }
 
 #include <Nazara/Core/TaskScheduler.inl>
@@ -2,7 +2,159 @@
 // This file is part of the "Nazara Engine - Core module"
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
+#include <Nazara/Core/Error.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
 
 namespace Nz
 {
+	/*!
+	* \brief Splits the [first, last) range into chunks and runs them on the workers, returns once every chunk has been processed
+	*
+	* \param first First index of the range
+	* \param last Index past the last index of the range
+	* \param grainSize Minimum number of indices processed by a single call of func, zero means it will be computed from the range size and worker count
+	* \param func Callback taking the bounds of a chunk (begin, end), it will be called concurrently from multiple threads
+	*
+	* \remark The range is split lazily (a worker only hands out half of its remaining range when its own queue is empty), to keep the task count low when workers are busy
+	* \remark The calling thread takes part in the processing
+	*/
+	template<typename F>
+	void TaskScheduler::ParallelFor(std::size_t first, std::size_t last, std::size_t grainSize, F&& func)
+	{
+		ParallelForImpl(first, last, grainSize, func);
+	}
+
+
+	template<typename F>
+	struct TaskScheduler::Task::HeapOperations
+	{
+		static void Invoke(void* storage)
+		{
+			(**static_cast<F**>(storage))();
+		}
+
+		static void Relocate(void* destination, void* source) noexcept
+		{
+			*static_cast<F**>(destination) = *static_cast<F**>(source);
+		}
+
+		static void Destroy(void* storage) noexcept
+		{
+			delete *static_cast<F**>(storage);
+		}
+
+		static constexpr Operations Table = { &Invoke, &Relocate, &Destroy };
+	};
+
+	template<typename F>
+	struct TaskScheduler::Task::InlineOperations
+	{
+		static void Invoke(void* storage)
+		{
+			(*static_cast<F*>(storage))();
+		}
+
+		static void Relocate(void* destination, void* source) noexcept
+		{
+			F* sourceFunctor = static_cast<F*>(source);
+			PlacementNew(static_cast<F*>(destination), std::move(*sourceFunctor));
+			PlacementDestroy(sourceFunctor);
+		}
+
+		static void Destroy(void* storage) noexcept
+		{
+			PlacementDestroy(static_cast<F*>(storage));
+		}
+
+		static constexpr Operations Table = { &Invoke, &Relocate, &Destroy };
+	};
+
+	/*!
+	* \brief Stores a functor in the task
+	*
+	* Functors up to InlineStorageSize bytes are stored inline (without any memory allocation), bigger ones are allocated on the heap.
+	*
+	* \remark Task used to be a std::function, it is now move-only: move-only functors can be stored but tasks can no longer be copied
+	*/
+	template<std::invocable F>
+	TaskScheduler::Task::Task(F&& functor) requires (!std::is_same_v<std::remove_cvref_t<F>, Task>)
+	{
+		using Functor = std::decay_t<F>;
+
+		if constexpr (IsStoredInline<Functor>)
+		{
+			PlacementNew(reinterpret_cast<Functor*>(&m_storage[0]), std::forward<F>(functor));
+			m_operations = &InlineOperations<Functor>::Table;
+		}
+		else
+		{
+			*reinterpret_cast<Functor**>(&m_storage[0]) = new Functor(std::forward<F>(functor));
+			m_operations = &HeapOperations<Functor>::Table;
+		}
+	}
+
+	inline TaskScheduler::Task::Task(Task&& task) noexcept :
+	m_operations(std::exchange(task.m_operations, nullptr))
+	{
+		if (m_operations)
+			m_operations->relocate(&m_storage[0], &task.m_storage[0]);
+	}
+
+	inline TaskScheduler::Task::~Task()
+	{
+		Reset();
+	}
+
+	inline void TaskScheduler::Task::Reset()
+	{
+		if (const Operations* operations = std::exchange(m_operations, nullptr))
+			operations->destroy(&m_storage[0]);
+	}
+
+	inline TaskScheduler::Task::operator bool() const
+	{
+		return m_operations != nullptr;
+	}
+
+	inline void TaskScheduler::Task::operator()()
+	{
+		NazaraAssertMsg(m_operations, "invalid task");
+		m_operations->invoke(&m_storage[0]);
+	}
+
+	inline auto TaskScheduler::Task::operator=(Task&& task) noexcept -> Task&
+	{
+		if (this != &task)
+		{
+			Reset();
+
+			m_operations = std::exchange(task.m_operations, nullptr);
+			if (m_operations)
+				m_operations->relocate(&m_storage[0], &task.m_storage[0]);
+		}
+
+		return *this;
+	}
+
+
+	inline unsigned int TaskScheduler::TaskGroup::GetRemainingTaskCount() const
+	{
+		return m_remainingTasks.load(std::memory_order_acquire);
+	}
+
+	inline bool TaskScheduler::TaskGroup::IsDone() const
+	{
+		return GetRemainingTaskCount() == 0;
+	}
+
+
+	inline TaskScheduler::TaskHandle::TaskHandle(TaskHandle&& handle) noexcept :
+	m_node(std::exchange(handle.m_node, nullptr))
+	{
+	}
+
+	inline bool TaskScheduler::TaskHandle::IsValid() const
+	{
+		return m_node != nullptr;
+	}
 }
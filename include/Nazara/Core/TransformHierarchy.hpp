@@ -0,0 +1,113 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_TRANSFORMHIERARCHY_HPP
+#define NAZARA_CORE_TRANSFORMHIERARCHY_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <Nazara/Math/Matrix4.hpp>
+#include <Nazara/Math/Quaternion.hpp>
+#include <Nazara/Math/Vector3.hpp>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Nz
+{
+	class TaskScheduler;
+
+	class NAZARA_CORE_API TransformHierarchy
+	{
+		public:
+			using TransformId = UInt32;
+
+			TransformHierarchy() = default;
+			TransformHierarchy(const TransformHierarchy&) = delete;
+			TransformHierarchy(TransformHierarchy&&) noexcept = default;
+			~TransformHierarchy() = default;
+
+			void Clear();
+
+			TransformId Create(TransformId parent = InvalidId, const Vector3f& position = Vector3f::Zero(), const Quaternionf& rotation = Quaternionf::Identity(), const Vector3f& scale = Vector3f::Unit());
+
+			void Destroy(TransformId transformId);
+
+			inline std::size_t GetDepthCount() const;
+			inline const Vector3f& GetGlobalPosition(TransformId transformId) const;
+			inline const Quaternionf& GetGlobalRotation(TransformId transformId) const;
+			inline const Vector3f& GetGlobalScale(TransformId transformId) const;
+			inline TransformId GetParent(TransformId transformId) const;
+			inline const Vector3f& GetPosition(TransformId transformId) const;
+			inline const Quaternionf& GetRotation(TransformId transformId) const;
+			inline const Vector3f& GetScale(TransformId transformId) const;
+			inline std::size_t GetTransformCount() const;
+			inline const Matrix4f& GetTransformMatrix(TransformId transformId) const;
+			inline std::span<const TransformId> GetUpdatedTransforms() const;
+
+			inline bool IsValid(TransformId transformId) const;
+
+			inline void Move(TransformId transformId, const Vector3f& movement);
+
+			inline void Rotate(TransformId transformId, const Quaternionf& rotation);
+
+			void SetParent(TransformId transformId, TransformId parent);
+			inline void SetPosition(TransformId transformId, const Vector3f& position);
+			inline void SetRotation(TransformId transformId, const Quaternionf& rotation);
+			inline void SetScale(TransformId transformId, const Vector3f& scale);
+			inline void SetTransform(TransformId transformId, const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale);
+
+			void Update(TaskScheduler* taskScheduler = nullptr, std::size_t grainSize = 1024);
+
+			TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+			TransformHierarchy& operator=(TransformHierarchy&&) noexcept = default;
+
+			static constexpr TransformId InvalidId = std::numeric_limits<TransformId>::max();
+
+		private:
+			inline UInt32 GetIndex(TransformId transformId) const;
+			inline void Invalidate(UInt32 index);
+			void LinkChild(TransformId transformId, TransformId parent);
+			void RebuildLayout();
+			void UnlinkChild(TransformId transformId);
+			void UpdateRange(UInt32 firstIndex, UInt32 lastIndex);
+
+			static constexpr UInt32 InvalidIndex = std::numeric_limits<UInt32>::max();
+
+			// Hierarchy links, indexed by transform id (stable)
+			struct Entry
+			{
+				TransformId parent;
+				TransformId firstChild;
+				TransformId nextSibling;
+				TransformId previousSibling;
+				UInt32 index; //< index in the SoA arrays, InvalidIndex for free entries
+			};
+
+			std::vector<Entry> m_entries;
+			std::vector<TransformId> m_freeIds;
+			std::vector<TransformId> m_updatedTransforms;
+			TransformId m_firstRoot = InvalidId;
+
+			// Transform data, indexed by transform index and sorted by depth (every parent comes before its children)
+			std::vector<Matrix4f> m_transformMatrices;
+			std::vector<Quaternionf> m_globalRotations;
+			std::vector<Quaternionf> m_rotations;
+			std::vector<TransformId> m_ids;
+			std::vector<UInt32> m_depthOffsets; //< first index of every depth level, followed by the transform count
+			std::vector<UInt32> m_parentIndices;
+			std::vector<UInt8> m_dirtyFlags;
+			std::vector<Vector3f> m_globalPositions;
+			std::vector<Vector3f> m_globalScales;
+			std::vector<Vector3f> m_positions;
+			std::vector<Vector3f> m_scales;
+			bool m_layoutInvalidated = false;
+	};
+}
+
+#include <Nazara/Core/TransformHierarchy.inl>
+
+#endif // NAZARA_CORE_TRANSFORMHIERARCHY_HPP
@@ -0,0 +1,143 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	inline std::size_t TransformHierarchy::GetDepthCount() const
+	{
+		return (!m_depthOffsets.empty()) ? m_depthOffsets.size() - 1 : 0;
+	}
+
+	/*!
+	* \brief Returns the global position of a transform, as computed by the last Update call
+	*/
+	inline const Vector3f& TransformHierarchy::GetGlobalPosition(TransformId transformId) const
+	{
+		return m_globalPositions[GetIndex(transformId)];
+	}
+
+	/*!
+	* \brief Returns the global rotation of a transform, as computed by the last Update call
+	*/
+	inline const Quaternionf& TransformHierarchy::GetGlobalRotation(TransformId transformId) const
+	{
+		return m_globalRotations[GetIndex(transformId)];
+	}
+
+	/*!
+	* \brief Returns the global scale of a transform, as computed by the last Update call
+	*/
+	inline const Vector3f& TransformHierarchy::GetGlobalScale(TransformId transformId) const
+	{
+		return m_globalScales[GetIndex(transformId)];
+	}
+
+	inline auto TransformHierarchy::GetParent(TransformId transformId) const -> TransformId
+	{
+		NazaraAssertMsg(IsValid(transformId), "invalid transform");
+		return m_entries[transformId].parent;
+	}
+
+	inline const Vector3f& TransformHierarchy::GetPosition(TransformId transformId) const
+	{
+		return m_positions[GetIndex(transformId)];
+	}
+
+	inline const Quaternionf& TransformHierarchy::GetRotation(TransformId transformId) const
+	{
+		return m_rotations[GetIndex(transformId)];
+	}
+
+	inline const Vector3f& TransformHierarchy::GetScale(TransformId transformId) const
+	{
+		return m_scales[GetIndex(transformId)];
+	}
+
+	inline std::size_t TransformHierarchy::GetTransformCount() const
+	{
+		return m_ids.size();
+	}
+
+	/*!
+	* \brief Returns the world matrix of a transform, as computed by the last Update call
+	*/
+	inline const Matrix4f& TransformHierarchy::GetTransformMatrix(TransformId transformId) const
+	{
+		return m_transformMatrices[GetIndex(transformId)];
+	}
+
+	/*!
+	* \brief Returns every transform whose global values changed during the last Update call (including children of modified transforms)
+	*
+	* This replaces the per-node invalidation signal of Node, listeners can process this list once per frame.
+	*/
+	inline auto TransformHierarchy::GetUpdatedTransforms() const -> std::span<const TransformId>
+	{
+		return m_updatedTransforms;
+	}
+
+	inline bool TransformHierarchy::IsValid(TransformId transformId) const
+	{
+		return transformId < m_entries.size() && m_entries[transformId].index != InvalidIndex;
+	}
+
+	inline void TransformHierarchy::Move(TransformId transformId, const Vector3f& movement)
+	{
+		UInt32 index = GetIndex(transformId);
+		m_positions[index] += m_rotations[index] * movement;
+		Invalidate(index);
+	}
+
+	inline void TransformHierarchy::Rotate(TransformId transformId, const Quaternionf& rotation)
+	{
+		UInt32 index = GetIndex(transformId);
+		m_rotations[index] = m_rotations[index] * rotation;
+		m_rotations[index].Normalize();
+		Invalidate(index);
+	}
+
+	inline void TransformHierarchy::SetPosition(TransformId transformId, const Vector3f& position)
+	{
+		UInt32 index = GetIndex(transformId);
+		m_positions[index] = position;
+		Invalidate(index);
+	}
+
+	inline void TransformHierarchy::SetRotation(TransformId transformId, const Quaternionf& rotation)
+	{
+		UInt32 index = GetIndex(transformId);
+		m_rotations[index] = rotation;
+		Invalidate(index);
+	}
+
+	inline void TransformHierarchy::SetScale(TransformId transformId, const Vector3f& scale)
+	{
+		UInt32 index = GetIndex(transformId);
+		m_scales[index] = scale;
+		Invalidate(index);
+	}
+
+	inline void TransformHierarchy::SetTransform(TransformId transformId, const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale)
+	{
+		UInt32 index = GetIndex(transformId);
+		m_positions[index] = position;
+		m_rotations[index] = rotation;
+		m_scales[index] = scale;
+		Invalidate(index);
+	}
+
+	inline UInt32 TransformHierarchy::GetIndex(TransformId transformId) const
+	{
+		NazaraAssertMsg(IsValid(transformId), "invalid transform");
+		return m_entries[transformId].index;
+	}
+
+	inline void TransformHierarchy::Invalidate(UInt32 index)
+	{
+		// Children are invalidated during Update, when their parent is found dirty
+		m_dirtyFlags[index] = 1;
+	}
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_VIRTUALDIRECTORYARCHIVERESOLVER_HPP
+#define NAZARA_CORE_VIRTUALDIRECTORYARCHIVERESOLVER_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Export.hpp>
+#include <Nazara/Core/VirtualDirectory.hpp>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace Nz
+{
+	class NAZARA_CORE_API VirtualDirectoryArchiveResolver : public VirtualDirectoryResolver
+	{
+		public:
+			struct Archive;
+
+			VirtualDirectoryArchiveResolver(std::shared_ptr<const Archive> archive, std::string_view directoryPath = {});
+			VirtualDirectoryArchiveResolver(const VirtualDirectoryArchiveResolver&) = delete;
+			VirtualDirectoryArchiveResolver(VirtualDirectoryArchiveResolver&&) = delete;
+			~VirtualDirectoryArchiveResolver() = default;
+
+			void ForEach(std::weak_ptr<VirtualDirectory> parent, FunctionRef<bool(std::string_view name, VirtualDirectory::Entry&& entry)> callback) const override;
+
+			inline const std::shared_ptr<const Archive>& GetArchive() const;
+
+			std::optional<VirtualDirectory::Entry> Resolve(std::weak_ptr<VirtualDirectory> parent, const std::string_view* parts, std::size_t partCount) const override;
+
+			VirtualDirectoryArchiveResolver& operator=(const VirtualDirectoryArchiveResolver&) = delete;
+			VirtualDirectoryArchiveResolver& operator=(VirtualDirectoryArchiveResolver&&) = delete;
+
+			static std::shared_ptr<VirtualDirectoryArchiveResolver> Open(const std::filesystem::path& archivePath);
+
+		private:
+			VirtualDirectory::Entry BuildEntry(std::weak_ptr<VirtualDirectory> parent, UInt32 entryIndex) const;
+
+			std::shared_ptr<const Archive> m_archive;
+			std::string m_directoryPath;
+			UInt32 m_childCount;
+			UInt32 m_childOffset;
+	};
+}
+
+#include <Nazara/Core/VirtualDirectoryArchiveResolver.inl>
+
+#endif // NAZARA_CORE_VIRTUALDIRECTORYARCHIVERESOLVER_HPP
@@ -17,7 +17,7 @@ namespace Nz
 	class NAZARA_CORE_API VirtualDirectoryFilesystemResolver : public VirtualDirectoryResolver
 	{
 		public:
-			inline VirtualDirectoryFilesystemResolver(std::filesystem::path physicalPath, OpenModeFlags fileOpenMode = OpenMode::Read | OpenMode::Defer);
+			inline VirtualDirectoryFilesystemResolver(std::filesystem::path physicalPath, OpenModeFlags fileOpenMode = OpenMode::Read | OpenMode::Defer, UInt64 memoryMappingThreshold = DefaultMemoryMappingThreshold);
 			VirtualDirectoryFilesystemResolver(const VirtualDirectoryFilesystemResolver&) = delete;
 			VirtualDirectoryFilesystemResolver(VirtualDirectoryFilesystemResolver&&) = delete;
 			~VirtualDirectoryFilesystemResolver() = default;
@@ -29,9 +29,14 @@ namespace Nz
 			VirtualDirectoryFilesystemResolver& operator=(const VirtualDirectoryFilesystemResolver&) = delete;
 			VirtualDirectoryFilesystemResolver& operator=(VirtualDirectoryFilesystemResolver&&) = delete;
 
+			static constexpr UInt64 DefaultMemoryMappingThreshold = 64 * 1024;
+
 		private:
+			std::shared_ptr<File> OpenFile(std::filesystem::path filePath, UInt64 fileSize) const;
+
 			std::filesystem::path m_physicalPath;
 			OpenModeFlags m_fileOpenMode;
+			UInt64 m_memoryMappingThreshold;
 	};
 }
 
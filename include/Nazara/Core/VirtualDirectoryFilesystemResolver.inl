@@ -5,9 +5,17 @@
 
 namespace Nz
 {
-	inline VirtualDirectoryFilesystemResolver::VirtualDirectoryFilesystemResolver(std::filesystem::path physicalPath, OpenModeFlags fileOpenMode) :
+	/*!
+	* \brief Constructs a resolver exposing a physical directory
+	*
+	* \param physicalPath Path of the directory
+	* \param fileOpenMode Open mode of the files
+	* \param memoryMappingThreshold Files at least this large are memory-mapped when opened read-only, zero disables memory mapping
+	*/
+	inline VirtualDirectoryFilesystemResolver::VirtualDirectoryFilesystemResolver(std::filesystem::path physicalPath, OpenModeFlags fileOpenMode, UInt64 memoryMappingThreshold) :
 	m_physicalPath(std::move(physicalPath)),
-	m_fileOpenMode(fileOpenMode)
+	m_fileOpenMode(fileOpenMode),
+	m_memoryMappingThreshold(memoryMappingThreshold)
 	{
 	}
 }
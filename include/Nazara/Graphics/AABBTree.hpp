@@ -0,0 +1,80 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_AABBTREE_HPP
+#define NAZARA_GRAPHICS_AABBTREE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Export.hpp>
+#include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <NazaraUtils/FunctionRef.hpp>
+#include <limits>
+#include <vector>
+
+namespace Nz
+{
+	// Dynamic bounding volume hierarchy of axis-aligned boxes, kept balanced using tree rotations
+	class NAZARA_GRAPHICS_API AABBTree
+	{
+		public:
+			AABBTree();
+			AABBTree(const AABBTree&) = delete;
+			AABBTree(AABBTree&&) noexcept = default;
+			~AABBTree() = default;
+
+			void Clear();
+
+			void Cull(const Frustumf& frustum, FunctionRef<void(std::size_t userData, bool isFullyInside)> callback) const;
+
+			inline const Boxf& GetFatAABB(UInt32 proxyId) const;
+			inline std::size_t GetHeight() const;
+			inline std::size_t GetProxyCount() const;
+			inline std::size_t GetUserData(UInt32 proxyId) const;
+
+			UInt32 Insert(const Boxf& aabb, std::size_t userData);
+
+			bool Move(UInt32 proxyId, const Boxf& aabb);
+
+			void Remove(UInt32 proxyId);
+
+			AABBTree& operator=(const AABBTree&) = delete;
+			AABBTree& operator=(AABBTree&&) noexcept = default;
+
+			static constexpr UInt32 InvalidProxy = std::numeric_limits<UInt32>::max();
+
+		private:
+			UInt32 AllocateNode();
+			UInt32 Balance(UInt32 nodeIndex);
+			void FreeNode(UInt32 nodeIndex);
+			void InsertLeaf(UInt32 leafIndex);
+			void RefitAncestors(UInt32 nodeIndex);
+			void RemoveLeaf(UInt32 leafIndex);
+
+			static inline float ComputeArea(const Boxf& box);
+			static inline Boxf Merge(const Boxf& lhs, const Boxf& rhs);
+
+			struct Node
+			{
+				inline bool IsLeaf() const;
+
+				Boxf aabb;
+				std::size_t userData;
+				UInt32 children[2];
+				UInt32 parent; //< next free node for free nodes
+				Int32 height; //< 0 for leaves, -1 for free nodes
+			};
+
+			std::vector<Node> m_nodes;
+			std::size_t m_proxyCount;
+			UInt32 m_freeList;
+			UInt32 m_root;
+	};
+}
+
+#include <Nazara/Graphics/AABBTree.inl>
+
+#endif // NAZARA_GRAPHICS_AABBTREE_HPP
@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/Error.hpp>
+
+namespace Nz
+{
+	/*!
+	* \brief Returns the box stored in the tree for a proxy, which may be larger than the box it was inserted or moved with
+	*/
+	inline const Boxf& AABBTree::GetFatAABB(UInt32 proxyId) const
+	{
+		NazaraAssertMsg(proxyId < m_nodes.size() && m_nodes[proxyId].IsLeaf(), "invalid proxy");
+		return m_nodes[proxyId].aabb;
+	}
+
+	inline std::size_t AABBTree::GetHeight() const
+	{
+		return (m_root != InvalidProxy) ? SafeCast<std::size_t>(m_nodes[m_root].height) : 0;
+	}
+
+	inline std::size_t AABBTree::GetProxyCount() const
+	{
+		return m_proxyCount;
+	}
+
+	inline std::size_t AABBTree::GetUserData(UInt32 proxyId) const
+	{
+		NazaraAssertMsg(proxyId < m_nodes.size() && m_nodes[proxyId].IsLeaf(), "invalid proxy");
+		return m_nodes[proxyId].userData;
+	}
+
+	inline float AABBTree::ComputeArea(const Boxf& box)
+	{
+		return 2.f * (box.width * box.height + box.height * box.depth + box.depth * box.width);
+	}
+
+	inline Boxf AABBTree::Merge(const Boxf& lhs, const Boxf& rhs)
+	{
+		Boxf box = lhs;
+		box.ExtendTo(rhs);
+
+		return box;
+	}
+
+	inline bool AABBTree::Node::IsLeaf() const
+	{
+		return height == 0;
+	}
+}
@@ -8,6 +8,7 @@
 #define NAZARA_GRAPHICS_BAKEDFRAMEGRAPH_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Time.hpp>
 #include <Nazara/Graphics/Export.hpp>
 #include <Nazara/Graphics/FrameGraphStructs.hpp>
 #include <Nazara/Graphics/FramePass.hpp>
@@ -23,13 +24,16 @@
 namespace Nz
 {
 	class RenderResources;
+	class TaskScheduler;
 
 	class NAZARA_GRAPHICS_API BakedFrameGraph
 	{
 		friend class FrameGraph;
 
 		public:
-			BakedFrameGraph() = default;
+			struct RecordingStats;
+
+			BakedFrameGraph();
 			BakedFrameGraph(const BakedFrameGraph&) = delete;
 			BakedFrameGraph(BakedFrameGraph&&) noexcept = default;
 			~BakedFrameGraph() = default;
@@ -37,13 +41,25 @@ namespace Nz
 			void Execute(RenderResources& renderResources);
 
 			const std::shared_ptr<Texture>& GetAttachmentTexture(std::size_t attachmentIndex) const;
+			inline const RecordingStats& GetRecordingStats() const;
 			const std::shared_ptr<RenderPass>& GetRenderPass(std::size_t passIndex) const;
 
 			bool Resize(RenderResources& renderResources, std::span<Vector2ui> viewerTargetSizes);
 
+			inline void SetTaskScheduler(TaskScheduler* taskScheduler);
+
 			BakedFrameGraph& operator=(const BakedFrameGraph&) = delete;
 			BakedFrameGraph& operator=(BakedFrameGraph&&) noexcept = default;
 
+			struct RecordingStats
+			{
+				std::size_t concurrentPassCount = 0; //< passes recorded on the task scheduler
+				std::size_t recordedPassCount = 0;
+				Time concurrentRecordingTime = Time::Zero(); //< part of recordingTime spent on the task scheduler
+				Time recordingTime = Time::Zero(); //< sum of the recording time of every pass
+				Time wallTime = Time::Zero(); //< time Execute spent recording passes
+			};
+
 		private:
 			struct PassData;
 			struct TextureData;
@@ -52,6 +68,8 @@ namespace Nz
 
 			BakedFrameGraph(std::vector<PassData> passes, std::vector<TextureData> textures, AttachmentIdToTextureId attachmentIdToTextureMapping, PassIdToPhysicalPassIndex passIdToPhysicalPassMapping);
 
+			void RecordPass(PassData& passData, CommandPool& commandPool, RenderResources& renderResources);
+
 			struct TextureBarrier
 			{
 				std::size_t textureId;
@@ -80,6 +98,7 @@ namespace Nz
 				std::vector<TextureBarrier> invalidationBarriers;
 				FramePass::ExecutionCallback executionCallback;
 				Recti renderRect;
+				bool allowConcurrentRecording = false;
 				bool forceCommandBufferRegeneration = true;
 			};
 
@@ -89,11 +108,17 @@ namespace Nz
 			};
 
 			std::shared_ptr<CommandPool> m_commandPool;
+			std::vector<std::shared_ptr<CommandPool>> m_concurrentCommandPools;
+			std::vector<std::size_t> m_concurrentPasses;
+			std::vector<std::size_t> m_localPasses;
 			std::vector<PassData> m_passes;
 			std::vector<TextureData> m_textures;
+			std::vector<Time> m_concurrentRecordingTimes;
 			std::vector<Vector2ui> m_viewerSizes;
 			AttachmentIdToTextureId m_attachmentToTextureMapping;
 			PassIdToPhysicalPassIndex m_passIdToPhysicalPassMapping;
+			RecordingStats m_recordingStats;
+			TaskScheduler* m_taskScheduler;
 			unsigned int m_height;
 			unsigned int m_width;
 	};
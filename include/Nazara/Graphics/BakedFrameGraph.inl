@@ -5,4 +5,19 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Returns statistics about command buffers recorded by the last Execute call
+	*/
+	inline auto BakedFrameGraph::GetRecordingStats() const -> const RecordingStats&
+	{
+		return m_recordingStats;
+	}
+
+	/*!
+	* \brief Sets the task scheduler used to record passes allowing it concurrently, or nullptr to record every pass on the calling thread
+	*/
+	inline void BakedFrameGraph::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_taskScheduler = taskScheduler;
+	}
 }
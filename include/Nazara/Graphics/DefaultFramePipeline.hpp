@@ -9,6 +9,7 @@
 
 #include <Nazara/Graphics/DefaultFramePipeline.hpp>
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/AABBTree.hpp>
 #include <Nazara/Graphics/BakedFrameGraph.hpp>
 #include <Nazara/Graphics/Camera.hpp>
 #include <Nazara/Graphics/DebugDrawPipelinePass.hpp>
@@ -24,6 +25,7 @@
 #include <Nazara/Graphics/RenderQueue.hpp>
 #include <Nazara/Graphics/RenderQueueRegistry.hpp>
 #include <Nazara/Graphics/TransferInterface.hpp>
+#include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
 #include <NazaraUtils/MemoryPool.hpp>
 #include <memory>
@@ -38,6 +40,7 @@ namespace Nz
 	class LightShadowData;
 	class RenderFrame;
 	class RenderTarget;
+	class TaskScheduler;
 
 	class NAZARA_GRAPHICS_API DefaultFramePipeline : public FramePipeline
 	{
@@ -51,6 +54,9 @@ namespace Nz
 
 			void ForEachRegisteredMaterialInstance(FunctionRef<void(const MaterialInstance& materialInstance)> callback) override;
 
+			inline const BakedFrameGraph::RecordingStats& GetRecordingStats() const;
+
+			std::size_t QueueFrustumCull(const Frustumf& frustum, UInt32 mask) override;
 			void QueueTransfer(TransferInterface* transfer) override;
 
 			std::size_t RegisterLight(const Light* light, UInt32 renderMask) override;
@@ -59,12 +65,15 @@ namespace Nz
 			std::size_t RegisterViewer(PipelineViewer* viewerInstance, Int32 renderOrder) override;
 			std::size_t RegisterWorldInstance(WorldInstancePtr worldInstance) override;
 
+			const std::vector<FramePipelinePass::VisibleRenderable>& RetrieveFrustumCull(std::size_t frustumCullIndex, std::size_t& visibilityHash) const override;
 			const Light* RetrieveLight(std::size_t lightIndex) const override;
 			const LightShadowData* RetrieveLightShadowData(std::size_t lightIndex) const override;
 			const Texture* RetrieveLightShadowmap(std::size_t lightIndex, const AbstractViewer* viewer) const override;
 
 			void Render(RenderResources& renderResources) override;
 
+			void SetTaskScheduler(TaskScheduler* taskScheduler) override;
+
 			void UnregisterLight(std::size_t lightIndex) override;
 			void UnregisterRenderable(std::size_t renderableIndex) override;
 			void UnregisterSkeleton(std::size_t skeletonIndex) override;
@@ -81,15 +90,47 @@ namespace Nz
 			DefaultFramePipeline& operator=(DefaultFramePipeline&&) = delete;
 
 		private:
+			struct CullingScratch;
 			struct ViewerData;
 
 			BakedFrameGraph BuildFrameGraph();
 
+			void FrustumCull(const Frustumf& frustum, UInt32 mask, CullingScratch& scratch, std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t& visibilityHash) const;
+			void ProcessFrustumCulls();
+
 			void RegisterMaterialInstance(MaterialInstance* materialPass);
 			void UnregisterMaterialInstance(MaterialInstance* material);
+			void UpdateCullingData();
+			void UpdateRenderableBounds(std::size_t renderableIndex);
 
 			static std::size_t BuildMergePass(FrameGraph& frameGraph, std::span<ViewerData*> targetViewers);
 
+			// Renderables to test against the frustum, stored as a structure of arrays for Frustum::CullBoxes
+			struct CullingScratch
+			{
+				inline void Clear();
+				inline void Push(std::size_t renderableIndex, const Boxf& aabb);
+
+				std::vector<float> x;
+				std::vector<float> y;
+				std::vector<float> z;
+				std::vector<float> width;
+				std::vector<float> height;
+				std::vector<float> depth;
+				std::vector<std::size_t> renderableIndices;
+				std::vector<UInt64> insideMask;
+				std::vector<UInt64> visibilityMask;
+			};
+
+			struct FrustumCullData
+			{
+				CullingScratch scratch;
+				Frustumf frustum;
+				std::size_t visibilityHash;
+				std::vector<FramePipelinePass::VisibleRenderable> visibleRenderables;
+				UInt32 mask;
+			};
+
 			struct LightData
 			{
 				std::unique_ptr<LightShadowData> shadowData;
@@ -112,10 +153,13 @@ namespace Nz
 				std::size_t skeletonInstanceIndex;
 				std::size_t worldInstanceIndex;
 				const InstancedRenderable* renderable;
+				BoundingVolumef worldBoundingVolume;
 				Recti scissorBox;
+				UInt32 cullingProxy;
 				UInt32 renderMask = 0;
 				UInt8 generation;
 
+				NazaraSlot(InstancedRenderable, OnAABBUpdate, onAABBUpdate);
 				NazaraSlot(InstancedRenderable, OnElementInvalidated, onElementInvalidated);
 				NazaraSlot(InstancedRenderable, OnMaterialInvalidated, onMaterialInvalidated);
 			};
@@ -138,6 +182,7 @@ namespace Nz
 				{
 					Bitset<UInt64> visibleLights;
 					Frustumf frustum;
+					std::size_t frustumCullIndex;
 				};
 
 				std::size_t finalColorAttachment;
@@ -157,6 +202,7 @@ namespace Nz
 
 			struct WorldInstanceData
 			{
+				std::vector<std::size_t> renderables;
 				WorldInstancePtr worldInstance;
 
 				NazaraSlot(TransferInterface, OnTransferRequired, onTransferRequired);
@@ -165,10 +211,15 @@ namespace Nz
 			std::unordered_map<const RenderTarget*, RenderTargetData> m_renderTargets;
 			std::unordered_map<MaterialInstance*, MaterialInstanceData> m_materialInstances;
 			mutable std::vector<FramePipelinePass::VisibleRenderable> m_visibleRenderables;
+			mutable CullingScratch m_cullingScratch;
+			std::vector<FrustumCullData> m_frustumCulls;
 			std::vector<ViewerData*> m_orderedViewers;
 			ankerl::unordered_dense::set<TransferInterface*> m_transferSet;
+			AABBTree m_cullingTree;
 			BakedFrameGraph m_bakedFrameGraph;
 			Bitset<UInt64> m_activeLights;
+			Bitset<UInt64> m_invalidatedRenderables;
+			Bitset<UInt64> m_invalidatedWorldInstances;
 			Bitset<UInt64> m_removedLightInstances;
 			Bitset<UInt64> m_removedSkeletonInstances;
 			Bitset<UInt64> m_removedViewerInstances;
@@ -181,6 +232,8 @@ namespace Nz
 			MemoryPool<SkeletonInstanceData> m_skeletonInstances;
 			MemoryPool<ViewerData> m_viewerPool;
 			MemoryPool<WorldInstanceData> m_worldInstances;
+			TaskScheduler* m_taskScheduler;
+			std::size_t m_frustumCullCount;
 			UInt8 m_generationCounter;
 			bool m_rebuildFrameGraph;
 	};
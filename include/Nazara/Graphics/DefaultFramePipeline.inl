@@ -5,4 +5,33 @@
 
 namespace Nz
 {
+	/*!
+	* \brief Returns statistics about command buffers recorded during the last Render call
+	*/
+	inline auto DefaultFramePipeline::GetRecordingStats() const -> const BakedFrameGraph::RecordingStats&
+	{
+		return m_bakedFrameGraph.GetRecordingStats();
+	}
+
+	inline void DefaultFramePipeline::CullingScratch::Clear()
+	{
+		x.clear();
+		y.clear();
+		z.clear();
+		width.clear();
+		height.clear();
+		depth.clear();
+		renderableIndices.clear();
+	}
+
+	inline void DefaultFramePipeline::CullingScratch::Push(std::size_t renderableIndex, const Boxf& aabb)
+	{
+		x.push_back(aabb.x);
+		y.push_back(aabb.y);
+		z.push_back(aabb.z);
+		width.push_back(aabb.width);
+		height.push_back(aabb.height);
+		depth.push_back(aabb.depth);
+		renderableIndices.push_back(renderableIndex);
+	}
 }
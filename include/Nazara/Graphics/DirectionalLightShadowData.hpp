@@ -13,6 +13,7 @@
 #include <Nazara/Graphics/LightShadowData.hpp>
 #include <Nazara/Graphics/RasterPipelinePass.hpp>
 #include <Nazara/Graphics/ShadowViewer.hpp>
+#include <Nazara/Math/Frustum.hpp>
 #include <NazaraUtils/FixedVector.hpp>
 #include <NazaraUtils/SparsePtr.hpp>
 #include <unordered_map>
@@ -39,6 +40,7 @@ namespace Nz
 
 			inline bool IsShadowStabilizationEnabled() const;
 
+			void PrepareCulling(const AbstractViewer* viewer) override;
 			void PrepareRendering(RenderResources& renderResources, const AbstractViewer* viewer) override;
 
 			void RegisterMaterialInstance(const MaterialInstance& matInstance) override;
@@ -71,6 +73,7 @@ namespace Nz
 			{
 				std::optional<RasterPipelinePass> depthPass;
 				std::size_t attachmentIndex;
+				std::size_t frustumCullIndex;
 				Matrix4f viewProjMatrix;
 				ShadowViewer viewer;
 				float distance;
@@ -79,6 +82,7 @@ namespace Nz
 			struct PerViewerData
 			{
 				FixedVector<CascadeData, 8> cascades;
+				Frustumf viewerFrustum;
 				std::size_t textureArrayAttachmentIndex;
 			};
 
@@ -43,6 +43,7 @@ namespace Nz
 			virtual void PrepareEnd(RenderResources& currentFrame, ElementRendererData& rendererData);
 			virtual void Render(const ViewerInstance& viewerInstance, ElementRendererData& rendererData, CommandBufferBuilder& commandBuffer, std::size_t elementCount, const Pointer<const RenderElement>* elements) = 0;
 			virtual void Reset(ElementRendererData& rendererData, RenderResources& renderResources);
+			virtual void Update(RenderResources& currentFrame, ElementRendererData& rendererData);
 
 			struct RenderStates
 			{
@@ -14,9 +14,7 @@
 #include <Nazara/Graphics/FramePipelinePass.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/RenderElement.hpp>
-#include <Nazara/Graphics/RenderElementOwner.hpp>
-#include <Nazara/Graphics/RenderQueue.hpp>
-#include <Nazara/Graphics/RenderQueueRegistry.hpp>
+#include <Nazara/Graphics/RenderElementCache.hpp>
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Renderer/UploadPool.hpp>
 
@@ -83,20 +81,20 @@ namespace Nz
 			std::shared_ptr<RenderBuffer> m_lightDataBuffer;
 			std::string m_passName;
 			std::vector<std::unique_ptr<ElementRendererData>> m_elementRendererData;
-			std::vector<RenderElementOwner> m_renderElements;
 			std::unordered_map<const MaterialInstance*, MaterialPassEntry> m_materialInstances;
 			std::vector<RenderableLight<DirectionalLight>> m_directionalLights;
 			std::vector<RenderableLight<PointLight>> m_pointLights;
 			std::vector<RenderableLight<SpotLight>> m_spotLights;
 			ElementRenderer::RenderStates m_renderState;
-			RenderQueue<const RenderElement*> m_renderQueue;
-			RenderQueueRegistry m_renderQueueRegistry;
+			RenderElementCache m_elementCache;
 			AbstractViewer* m_viewer;
 			ElementRendererRegistry& m_elementRegistry;
 			FramePipeline& m_pipeline;
 			UploadPool::Allocation* m_pendingLightUploadAllocation;
+			bool m_hasDistanceSortedElements;
 			bool m_rebuildCommandBuffer;
 			bool m_rebuildElements;
+			bool m_sortElements;
 	};
 }
 
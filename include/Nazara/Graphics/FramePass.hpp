@@ -55,6 +55,8 @@ namespace Nz
 			inline std::size_t AddInput(std::size_t attachmentId);
 			inline std::size_t AddOutput(std::size_t attachmentId);
 
+			inline bool AllowsConcurrentRecording() const;
+
 			template<typename F> void ForEachAttachment(F&& func, bool singleDSInputOutputCall = true) const;
 
 			inline const CommandCallback& GetCommandCallback() const;
@@ -68,6 +70,7 @@ namespace Nz
 			inline std::size_t GetPassId() const;
 
 			inline void SetCommandCallback(CommandCallback callback);
+			inline void SetConcurrentRecording(bool allowConcurrentRecording);
 			inline void SetClearColor(std::size_t outputIndex, const std::optional<Color>& color);
 			inline void SetDepthStencilClear(float depth, UInt32 stencil);
 			inline void SetDepthStencilInput(std::size_t attachmentId);
@@ -116,6 +119,7 @@ namespace Nz
 			std::vector<Output> m_outputs;
 			CommandCallback m_commandCallback;
 			ExecutionCallback m_executionCallback;
+			bool m_allowConcurrentRecording;
 	};
 }
 
@@ -10,7 +10,8 @@ namespace Nz
 	m_depthStencilInput(InvalidAttachmentId),
 	m_depthStencilOutput(InvalidAttachmentId),
 	m_passId(passId),
-	m_name(std::move(name))
+	m_name(std::move(name)),
+	m_allowConcurrentRecording(false)
 	{
 	}
 
@@ -35,6 +36,12 @@ namespace Nz
 
 		return outputIndex;
 	}
+
+	inline bool FramePass::AllowsConcurrentRecording() const
+	{
+		return m_allowConcurrentRecording;
+	}
+
 	template<typename F>
 	void FramePass::ForEachAttachment(F&& func, bool singleDSInputOutputCall) const
 	{
@@ -108,6 +115,16 @@ namespace Nz
 		m_commandCallback = std::move(callback);
 	}
 
+	/*!
+	* \brief Allows the command callback to be called from a worker thread, concurrently with the callbacks of other passes
+	*
+	* Only enable this when the command callback only reads state which was prepared beforehand, as other passes may be recorded at the same time.
+	*/
+	inline void FramePass::SetConcurrentRecording(bool allowConcurrentRecording)
+	{
+		m_allowConcurrentRecording = allowConcurrentRecording;
+	}
+
 	inline void FramePass::SetClearColor(std::size_t outputIndex, const std::optional<Color>& color)
 	{
 		assert(outputIndex < m_outputs.size());
@@ -25,6 +25,7 @@ namespace Nz
 	class MaterialInstance;
 	class PipelineViewer;
 	class RenderResources;
+	class TaskScheduler;
 
 	class NAZARA_GRAPHICS_API FramePipeline
 	{
@@ -39,6 +40,7 @@ namespace Nz
 
 			virtual void ForEachRegisteredMaterialInstance(FunctionRef<void(const MaterialInstance& materialInstance)> callback) = 0;
 
+			virtual std::size_t QueueFrustumCull(const Frustumf& frustum, UInt32 mask);
 			virtual void QueueTransfer(TransferInterface* transfer) = 0;
 
 			virtual std::size_t RegisterLight(const Light* light, UInt32 renderMask) = 0;
@@ -47,12 +49,15 @@ namespace Nz
 			virtual std::size_t RegisterViewer(PipelineViewer* viewerInstance, Int32 renderOrder) = 0;
 			virtual std::size_t RegisterWorldInstance(WorldInstancePtr worldInstance) = 0;
 
+			virtual const std::vector<FramePipelinePass::VisibleRenderable>& RetrieveFrustumCull(std::size_t frustumCullIndex, std::size_t& visibilityHash) const;
 			virtual const Light* RetrieveLight(std::size_t lightIndex) const = 0;
 			virtual const LightShadowData* RetrieveLightShadowData(std::size_t lightIndex) const = 0;
 			virtual const Texture* RetrieveLightShadowmap(std::size_t lightIndex, const AbstractViewer* viewer) const = 0;
 
 			virtual void Render(RenderResources& renderResources) = 0;
 
+			virtual void SetTaskScheduler(TaskScheduler* taskScheduler);
+
 			virtual void UnregisterLight(std::size_t lightIndex) = 0;
 			virtual void UnregisterRenderable(std::size_t renderableIndex) = 0;
 			virtual void UnregisterSkeleton(std::size_t skeletonIndex) = 0;
@@ -71,6 +76,16 @@ namespace Nz
 			NazaraSignal(OnTransfer, FramePipeline* /*pipeline*/, RenderResources& /*renderResources*/, CommandBufferBuilder& /*builder*/);
 
 			static constexpr std::size_t NoSkeletonInstance = std::numeric_limits<std::size_t>::max();
+
+		private:
+			struct QueuedFrustumCull
+			{
+				Frustumf frustum;
+				UInt32 mask;
+			};
+
+			std::vector<QueuedFrustumCull> m_queuedFrustumCulls;
+			mutable bool m_queuedFrustumCullsRetrieved = false;
 	};
 }
 
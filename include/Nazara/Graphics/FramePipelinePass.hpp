@@ -105,6 +105,7 @@ namespace Nz
 				const WorldInstance* worldInstance;
 				Recti scissorBox;
 				UInt32 renderMask;
+				UInt8 generation; //< changes when a renderable is registered again, as addresses may be reused
 			};
 
 			static constexpr std::size_t InvalidAttachmentIndex = std::numeric_limits<std::size_t>::max();
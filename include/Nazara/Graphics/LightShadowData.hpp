@@ -30,6 +30,7 @@ namespace Nz
 
 			inline bool IsPerViewer() const;
 
+			virtual void PrepareCulling(const AbstractViewer* viewer);
 			virtual void PrepareRendering(RenderResources& renderResources, [[maybe_unused]] const AbstractViewer* viewer) = 0;
 
 			virtual void RegisterMaterialInstance(const MaterialInstance& matInstance) = 0;
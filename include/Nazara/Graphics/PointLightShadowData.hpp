@@ -13,6 +13,7 @@
 #include <Nazara/Graphics/LightShadowData.hpp>
 #include <Nazara/Graphics/RasterPipelinePass.hpp>
 #include <Nazara/Graphics/ShadowViewer.hpp>
+#include <Nazara/Math/Frustum.hpp>
 #include <array>
 
 namespace Nz
@@ -28,6 +29,7 @@ namespace Nz
 			PointLightShadowData(PointLightShadowData&&) = delete;
 			~PointLightShadowData() = default;
 
+			void PrepareCulling(const AbstractViewer* viewer) override;
 			void PrepareRendering(RenderResources& renderResources, const AbstractViewer* viewer) override;
 
 			void RegisterMaterialInstance(const MaterialInstance& matInstance) override;
@@ -49,6 +51,8 @@ namespace Nz
 			{
 				std::optional<RasterPipelinePass> depthPass;
 				std::size_t attachmentIndex;
+				std::size_t frustumCullIndex;
+				Frustumf frustum;
 				ShadowViewer viewer;
 			};
 
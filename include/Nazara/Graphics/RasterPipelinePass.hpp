@@ -15,9 +15,7 @@
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/MaterialPass.hpp>
 #include <Nazara/Graphics/RenderElement.hpp>
-#include <Nazara/Graphics/RenderElementOwner.hpp>
-#include <Nazara/Graphics/RenderQueue.hpp>
-#include <Nazara/Graphics/RenderQueueRegistry.hpp>
+#include <Nazara/Graphics/RenderElementCache.hpp>
 #include <Nazara/Math/Frustum.hpp>
 
 namespace Nz
@@ -67,16 +65,16 @@ namespace Nz
 			std::size_t m_lastVisibilityHash;
 			std::string m_passName;
 			std::vector<std::unique_ptr<ElementRendererData>> m_elementRendererData;
-			std::vector<RenderElementOwner> m_renderElements;
 			std::unordered_map<const MaterialInstance*, MaterialPassEntry> m_materialInstances;
-			RenderQueue<const RenderElement*> m_renderQueue;
-			RenderQueueRegistry m_renderQueueRegistry;
+			RenderElementCache m_elementCache;
 			AbstractViewer* m_viewer;
 			ElementRendererRegistry& m_elementRegistry;
 			FramePipeline& m_pipeline;
 			UInt32 m_renderMask;
+			bool m_hasDistanceSortedElements;
 			bool m_rebuildCommandBuffer;
 			bool m_rebuildElements;
+			bool m_sortElements;
 	};
 }
 
@@ -18,8 +18,10 @@ namespace Nz
 	m_elementRegistry(passData.elementRegistry),
 	m_pipeline(passData.pipeline),
 	m_renderMask(renderMask),
+	m_hasDistanceSortedElements(false),
 	m_rebuildCommandBuffer(false),
-	m_rebuildElements(false)
+	m_rebuildElements(false),
+	m_sortElements(false)
 	{
 	}
 
@@ -31,6 +31,9 @@ namespace Nz
 
 			virtual void Register(RenderQueueRegistry& registry) const = 0;
 
+			// Sorting score bit set by elements sorted by distance, only their score depends on the frustum and may change between frames
+			static constexpr UInt64 SortByDistanceScoreFlag = UInt64(1) << 55;
+
 		private:
 			UInt8 m_elementType;
 	};
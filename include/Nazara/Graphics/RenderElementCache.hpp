@@ -0,0 +1,93 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_GRAPHICS_RENDERELEMENTCACHE_HPP
+#define NAZARA_GRAPHICS_RENDERELEMENTCACHE_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Graphics/Export.hpp>
+#include <Nazara/Graphics/FramePipelinePass.hpp>
+#include <Nazara/Graphics/RenderElementOwner.hpp>
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <Nazara/Graphics/RenderQueueRegistry.hpp>
+#include <Nazara/Graphics/Thirdparty/ankerl/unordered_dense.h>
+#include <NazaraUtils/FunctionRef.hpp>
+#include <vector>
+
+namespace Nz
+{
+	class ElementRendererRegistry;
+	class InstancedRenderable;
+	class RenderElement;
+	class RenderResources;
+	class SkeletonInstance;
+	class WorldInstance;
+
+	// Keeps the render elements of visible renderables across frames, only building elements of renderables becoming visible
+	class NAZARA_GRAPHICS_API RenderElementCache
+	{
+		public:
+			using BuildCallback = FunctionRef<void(const FramePipelinePass::VisibleRenderable& visibleRenderable, std::vector<RenderElementOwner>& elements)>;
+			using ReleaseCallback = FunctionRef<void(std::vector<RenderElementOwner>&& elements)>;
+
+			RenderElementCache();
+			RenderElementCache(const RenderElementCache&) = delete;
+			RenderElementCache(RenderElementCache&&) = delete;
+			~RenderElementCache() = default;
+
+			void Clear(RenderResources& renderResources);
+			void Clear(ReleaseCallback releaseCallback);
+
+			inline std::size_t GetElementCount() const;
+			inline RenderQueue<const RenderElement*>& GetRenderQueue();
+			inline const RenderQueue<const RenderElement*>& GetRenderQueue() const;
+			inline const RenderQueueRegistry& GetRenderQueueRegistry() const;
+
+			bool Update(ElementRendererRegistry& elementRegistry, std::size_t passIndex, UInt32 renderMask, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, RenderResources& renderResources, bool rebuild);
+			bool Update(UInt32 renderMask, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, bool rebuild, BuildCallback buildCallback, ReleaseCallback releaseCallback);
+
+			RenderElementCache& operator=(const RenderElementCache&) = delete;
+			RenderElementCache& operator=(RenderElementCache&&) = delete;
+
+		private:
+			void BuildRenderQueue();
+			void RegisterElements();
+
+			struct RenderableKey
+			{
+				inline bool operator==(const RenderableKey& rhs) const;
+
+				const InstancedRenderable* instancedRenderable;
+				const SkeletonInstance* skeletonInstance;
+				const WorldInstance* worldInstance;
+				UInt8 generation;
+			};
+
+			struct RenderableKeyHasher
+			{
+				inline std::size_t operator()(const RenderableKey& key) const;
+			};
+
+			struct RenderableEntry
+			{
+				std::vector<RenderElementOwner> elements;
+				UInt64 lastUpdate = 0;
+				bool isVisibleMultipleTimes = false;
+			};
+
+			std::size_t m_elementCount;
+			std::size_t m_removedElementCount;
+			std::vector<RenderableKey> m_removedRenderables;
+			ankerl::unordered_dense::map<RenderableKey, RenderableEntry, RenderableKeyHasher> m_renderables;
+			RenderQueue<const RenderElement*> m_renderQueue;
+			RenderQueueRegistry m_renderQueueRegistry;
+			UInt64 m_updateCounter;
+	};
+}
+
+#include <Nazara/Graphics/RenderElementCache.inl>
+
+#endif // NAZARA_GRAPHICS_RENDERELEMENTCACHE_HPP
@@ -0,0 +1,43 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <NazaraUtils/Algorithm.hpp>
+
+namespace Nz
+{
+	inline std::size_t RenderElementCache::GetElementCount() const
+	{
+		return m_elementCount;
+	}
+
+	inline RenderQueue<const RenderElement*>& RenderElementCache::GetRenderQueue()
+	{
+		return m_renderQueue;
+	}
+
+	inline const RenderQueue<const RenderElement*>& RenderElementCache::GetRenderQueue() const
+	{
+		return m_renderQueue;
+	}
+
+	inline const RenderQueueRegistry& RenderElementCache::GetRenderQueueRegistry() const
+	{
+		return m_renderQueueRegistry;
+	}
+
+	inline bool RenderElementCache::RenderableKey::operator==(const RenderableKey& rhs) const
+	{
+		return instancedRenderable == rhs.instancedRenderable && skeletonInstance == rhs.skeletonInstance && worldInstance == rhs.worldInstance && generation == rhs.generation;
+	}
+
+	inline std::size_t RenderElementCache::RenderableKeyHasher::operator()(const RenderableKey& key) const
+	{
+		std::size_t seed = std::hash<const InstancedRenderable*>{}(key.instancedRenderable);
+		HashCombine(seed, key.skeletonInstance);
+		HashCombine(seed, key.worldInstance);
+		HashCombine(seed, key.generation);
+
+		return seed;
+	}
+}
@@ -28,7 +28,7 @@ namespace Nz
 
 			void Insert(RenderData&& data);
 
-			template<typename IndexFunc> void Sort(IndexFunc&& func);
+			template<typename KeyFunc> void Sort(KeyFunc&& func);
 
 			// STL API
 			inline const_iterator begin() const;
@@ -40,7 +40,18 @@ namespace Nz
 			RenderQueue& operator=(RenderQueue&&) noexcept = default;
 
 		private:
+			struct SortEntry
+			{
+				UInt64 key;
+				UInt32 index;
+			};
+
+			static void RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& buffer);
+
 			std::vector<RenderData> m_data;
+			std::vector<RenderData> m_sortedData;
+			std::vector<SortEntry> m_sortBuffer;
+			std::vector<SortEntry> m_sortEntries;
 	};
 }
 
@@ -2,7 +2,9 @@
 // This file is part of the "Nazara Engine - Graphics module"
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
+#include <NazaraUtils/Algorithm.hpp>
 #include <algorithm>
+#include <array>
 
 namespace Nz
 {
@@ -18,14 +20,43 @@ namespace Nz
 		m_data.emplace_back(std::move(data));
 	}
 
+	/*!
+	* \brief Sorts the queue by ascending keys
+	*
+	* The key function is called exactly once per element, keys are then sorted using a radix sort (which is stable).
+	* If the elements are already in key order, the queue is left untouched.
+	*
+	* \param func Function returning the UInt64 sorting key of an element
+	*/
 	template<typename RenderData>
-	template<typename IndexFunc>
-	void RenderQueue<RenderData>::Sort(IndexFunc&& func)
+	template<typename KeyFunc>
+	void RenderQueue<RenderData>::Sort(KeyFunc&& func)
 	{
-		std::sort(m_data.begin(), m_data.end(), [&](const RenderData& lhs, const RenderData& rhs)
+		std::size_t elementCount = m_data.size();
+
+		bool isSorted = true;
+		m_sortEntries.resize(elementCount);
+		for (std::size_t i = 0; i < elementCount; ++i)
 		{
-			return func(lhs) < func(rhs);
-		});
+			SortEntry& entry = m_sortEntries[i];
+			entry.key = func(m_data[i]);
+			entry.index = SafeCast<UInt32>(i);
+
+			if (i > 0 && entry.key < m_sortEntries[i - 1].key)
+				isSorted = false;
+		}
+
+		if (isSorted)
+			return;
+
+		RadixSort(m_sortEntries, m_sortBuffer);
+
+		m_sortedData.clear();
+		m_sortedData.reserve(elementCount);
+		for (const SortEntry& entry : m_sortEntries)
+			m_sortedData.push_back(std::move(m_data[entry.index]));
+
+		std::swap(m_data, m_sortedData);
 	}
 
 	template<typename RenderData>
@@ -51,4 +82,57 @@ namespace Nz
 	{
 		return m_data.size();
 	}
+
+	template<typename RenderData>
+	void RenderQueue<RenderData>::RadixSort(std::vector<SortEntry>& entries, std::vector<SortEntry>& buffer)
+	{
+		constexpr std::size_t RadixBits = 8;
+		constexpr std::size_t BucketCount = 1 << RadixBits;
+		constexpr std::size_t PassCount = sizeof(UInt64) * 8 / RadixBits;
+
+		std::size_t entryCount = entries.size();
+
+		// Small queues are faster to sort by comparison (sorting by index as well keeps the result identical to a stable sort)
+		if (entryCount <= 64)
+		{
+			std::sort(entries.begin(), entries.end(), [](const SortEntry& lhs, const SortEntry& rhs)
+			{
+				return (lhs.key != rhs.key) ? lhs.key < rhs.key : lhs.index < rhs.index;
+			});
+			return;
+		}
+
+		// Build every histogram in a single pass
+		std::array<std::array<UInt32, BucketCount>, PassCount> histograms = {};
+		for (const SortEntry& entry : entries)
+		{
+			for (std::size_t pass = 0; pass < PassCount; ++pass)
+				histograms[pass][(entry.key >> (pass * RadixBits)) & (BucketCount - 1)]++;
+		}
+
+		buffer.resize(entryCount);
+
+		// Least significant digit first, skipping digits shared by every key
+		for (std::size_t pass = 0; pass < PassCount; ++pass)
+		{
+			std::array<UInt32, BucketCount>& histogram = histograms[pass];
+
+			std::size_t firstDigit = (entries.front().key >> (pass * RadixBits)) & (BucketCount - 1);
+			if (histogram[firstDigit] == entryCount)
+				continue;
+
+			UInt32 offset = 0;
+			for (UInt32& bucketCount : histogram)
+			{
+				UInt32 count = bucketCount;
+				bucketCount = offset;
+				offset += count;
+			}
+
+			for (const SortEntry& entry : entries)
+				buffer[histogram[(entry.key >> (pass * RadixBits)) & (BucketCount - 1)]++] = entry;
+
+			std::swap(entries, buffer);
+		}
+	}
 }
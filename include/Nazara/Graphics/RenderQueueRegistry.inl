@@ -12,6 +12,7 @@ namespace Nz
 		m_renderLayers.clear();
 		m_renderLayerRegistry.clear();
 		m_pipelineRegistry.clear();
+		m_skeletonRegistry.clear();
 		m_vertexBufferRegistry.clear();
 		m_vertexDeclarationRegistry.clear();
 	}
@@ -66,14 +67,18 @@ namespace Nz
 
 	inline void RenderQueueRegistry::Finalize()
 	{
+		// Layer indices follow layer order, they're only reassigned when a new layer was registered
+		if (!m_renderLayerRegistry.empty())
+			return;
+
 		for (int renderLayer : m_renderLayers)
 			m_renderLayerRegistry.emplace(renderLayer, m_renderLayerRegistry.size());
 	}
 
 	inline void RenderQueueRegistry::RegisterLayer(int renderLayer)
 	{
-		assert(m_renderLayerRegistry.empty());
-		m_renderLayers.insert(renderLayer);
+		if (m_renderLayers.insert(renderLayer).second)
+			m_renderLayerRegistry.clear();
 	}
 
 	inline void RenderQueueRegistry::RegisterMaterialInstance(const MaterialInstance* materialInstance)
@@ -19,13 +19,14 @@
 namespace Nz
 {
 	class MaterialInstance;
+	class MaterialPipeline;
 	class RenderPipeline;
 	class ShaderBinding;
 
 	class RenderSubmesh : public RenderElement
 	{
 		public:
-			inline RenderSubmesh(int renderLayer, std::shared_ptr<MaterialInstance> materialInstance, MaterialPassFlags materialFlags, std::shared_ptr<RenderPipeline> renderPipeline, const WorldInstance& worldInstance, const SkeletonInstance* skeletonInstance, std::size_t indexCount, IndexType indexType, std::shared_ptr<RenderBuffer> indexBuffer, std::shared_ptr<RenderBuffer> vertexBuffer, const Recti& scissorBox);
+			inline RenderSubmesh(int renderLayer, std::shared_ptr<MaterialInstance> materialInstance, MaterialPassFlags materialFlags, std::shared_ptr<MaterialPipeline> materialPipeline, std::shared_ptr<RenderPipeline> renderPipeline, const WorldInstance& worldInstance, const SkeletonInstance* skeletonInstance, std::size_t indexCount, IndexType indexType, std::shared_ptr<RenderBuffer> indexBuffer, std::shared_ptr<RenderBuffer> vertexBuffer, const Recti& scissorBox);
 			~RenderSubmesh() = default;
 
 			inline UInt64 ComputeSortingScore(const Frustumf& frustum, const RenderQueueRegistry& registry) const override;
@@ -33,6 +34,7 @@ namespace Nz
 			inline const RenderBuffer* GetIndexBuffer() const;
 			inline std::size_t GetIndexCount() const;
 			inline IndexType GetIndexType() const;
+			inline const RenderPipeline* GetInstancedRenderPipeline() const;
 			inline const MaterialInstance& GetMaterialInstance() const;
 			inline const RenderPipeline* GetRenderPipeline() const;
 			inline const Recti& GetScissorBox() const;
@@ -49,6 +51,8 @@ namespace Nz
 			std::shared_ptr<RenderBuffer> m_vertexBuffer;
 			std::shared_ptr<MaterialInstance> m_materialInstance;
 			std::shared_ptr<RenderPipeline> m_renderPipeline;
+			mutable std::shared_ptr<MaterialPipeline> m_materialPipeline;
+			mutable std::shared_ptr<RenderPipeline> m_instancedRenderPipeline;
 			std::size_t m_indexCount;
 			const SkeletonInstance* m_skeletonInstance;
 			const WorldInstance& m_worldInstance;
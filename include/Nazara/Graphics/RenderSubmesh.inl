@@ -4,15 +4,17 @@
 
 #include <Nazara/Graphics/Algorithm.hpp>
 #include <Nazara/Graphics/MaterialPass.hpp>
+#include <Nazara/Graphics/MaterialPipeline.hpp>
 
 namespace Nz
 {
-	inline RenderSubmesh::RenderSubmesh(int renderLayer, std::shared_ptr<MaterialInstance> materialInstance, MaterialPassFlags materialFlags, std::shared_ptr<RenderPipeline> renderPipeline, const WorldInstance& worldInstance, const SkeletonInstance* skeletonInstance, std::size_t indexCount, IndexType indexType, std::shared_ptr<RenderBuffer> indexBuffer, std::shared_ptr<RenderBuffer> vertexBuffer, const Recti& scissorBox) :
+	inline RenderSubmesh::RenderSubmesh(int renderLayer, std::shared_ptr<MaterialInstance> materialInstance, MaterialPassFlags materialFlags, std::shared_ptr<MaterialPipeline> materialPipeline, std::shared_ptr<RenderPipeline> renderPipeline, const WorldInstance& worldInstance, const SkeletonInstance* skeletonInstance, std::size_t indexCount, IndexType indexType, std::shared_ptr<RenderBuffer> indexBuffer, std::shared_ptr<RenderBuffer> vertexBuffer, const Recti& scissorBox) :
 	RenderElement(BasicRenderElement::Submesh),
 	m_indexBuffer(std::move(indexBuffer)),
 	m_vertexBuffer(std::move(vertexBuffer)),
 	m_materialInstance(std::move(materialInstance)),
 	m_renderPipeline(std::move(renderPipeline)),
+	m_materialPipeline(std::move(materialPipeline)),
 	m_indexCount(indexCount),
 	m_skeletonInstance(skeletonInstance),
 	m_worldInstance(worldInstance),
@@ -92,6 +94,19 @@ namespace Nz
 		return m_indexType;
 	}
 
+	inline const RenderPipeline* RenderSubmesh::GetInstancedRenderPipeline() const
+	{
+		// The instanced pipeline is only built the first time it's needed
+		if (m_materialPipeline)
+		{
+			const auto& vertexBuffers = m_renderPipeline->GetPipelineInfo().vertexBuffers;
+			m_instancedRenderPipeline = m_materialPipeline->GetInstancedRenderPipeline(vertexBuffers.data(), vertexBuffers.size());
+			m_materialPipeline.reset();
+		}
+
+		return m_instancedRenderPipeline.get();
+	}
+
 	inline const MaterialInstance& RenderSubmesh::GetMaterialInstance() const
 	{
 		return *m_materialInstance;
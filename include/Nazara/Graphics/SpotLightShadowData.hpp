@@ -12,6 +12,7 @@
 #include <Nazara/Graphics/LightShadowData.hpp>
 #include <Nazara/Graphics/RasterPipelinePass.hpp>
 #include <Nazara/Graphics/ShadowViewer.hpp>
+#include <Nazara/Math/Frustum.hpp>
 
 namespace Nz
 {
@@ -28,6 +29,7 @@ namespace Nz
 
 			inline const ViewerInstance& GetViewerInstance() const;
 
+			void PrepareCulling([[maybe_unused]] const AbstractViewer* viewer) override;
 			void PrepareRendering(RenderResources& renderResources, [[maybe_unused]] const AbstractViewer* viewer) override;
 
 			void RegisterMaterialInstance(const MaterialInstance& matInstance) override;
@@ -47,6 +49,8 @@ namespace Nz
 
 			std::optional<RasterPipelinePass> m_depthPass;
 			std::size_t m_attachmentIndex;
+			std::size_t m_frustumCullIndex;
+			Frustumf m_frustum;
 			FramePipeline& m_pipeline;
 			const SpotLight& m_light;
 			ShadowViewer m_viewer;
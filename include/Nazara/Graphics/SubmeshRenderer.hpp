@@ -11,8 +11,12 @@
 #include <Nazara/Graphics/ElementRenderer.hpp>
 #include <Nazara/Graphics/RenderResourceReferences.hpp>
 #include <Nazara/Graphics/RenderSubmesh.hpp>
+#include <Nazara/Math/Matrix4.hpp>
 #include <Nazara/Math/Rect.hpp>
 #include <Nazara/Renderer/ShaderBinding.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace Nz
 {
@@ -29,13 +33,17 @@ namespace Nz
 
 			std::unique_ptr<ElementRendererData> InstanciateData() override;
 			void Prepare(const ViewerInstance& viewerInstance, ElementRendererData& rendererData, RenderResources& renderResources, std::size_t elementCount, const Pointer<const RenderElement>* elements, SparsePtr<const RenderStates> renderStates) override;
+			void PrepareEnd(RenderResources& renderResources, ElementRendererData& rendererData) override;
 			void Render(const ViewerInstance& viewerInstance, ElementRendererData& rendererData, CommandBufferBuilder& commandBuffer, std::size_t elementCount, const Pointer<const RenderElement>* elements) override;
 			void Reset(ElementRendererData& rendererData, RenderResources& renderResources) override;
+			void Update(RenderResources& renderResources, ElementRendererData& rendererData) override;
 
 		private:
 			struct PoolData
 			{
 				std::vector<RenderResourceReferences> references;
+				std::vector<std::shared_ptr<RenderBuffer>> indirectBuffers;
+				std::vector<std::shared_ptr<RenderBuffer>> instanceBuffers;
 			};
 
 			std::shared_ptr<PoolData> m_pool;
@@ -54,8 +62,13 @@ namespace Nz
 			const ShaderBinding* shaderBinding;
 			std::size_t firstIndex;
 			std::size_t indexCount;
+			std::size_t instanceCount;
+			UInt64 indirectOffset;
+			UInt64 instanceOffset;
 			IndexType indexType;
 			Recti scissorBox;
+			UInt32 drawCount; //< when not zero, the draw call is an indirect draw of drawCount commands starting at indirectOffset
+			bool useInstanceBuffer; //< world matrices are read from the instance buffer starting at instanceOffset (or using the first instance of indirect commands)
 		};
 
 		struct DrawCallIndices
@@ -66,8 +79,13 @@ namespace Nz
 
 		std::optional<RenderResourceReferences> references;
 		std::unordered_map<const RenderSubmesh*, DrawCallIndices> drawCallPerElement;
+		std::shared_ptr<RenderBuffer> indirectBuffer;
+		std::shared_ptr<RenderBuffer> instanceBuffer;
+		std::vector<const WorldInstance*> instances;
 		std::vector<DrawCall> drawCalls;
+		std::vector<Matrix4f> instanceMatrices;
 		std::vector<ShaderBindingPtr> shaderBindings;
+		std::vector<UInt8> indirectCommands;
 	};
 }
 
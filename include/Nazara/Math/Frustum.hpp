@@ -7,6 +7,8 @@
 #ifndef NAZARA_MATH_FRUSTUM_HPP
 #define NAZARA_MATH_FRUSTUM_HPP
 
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/Export.hpp>
 #include <Nazara/Math/Angle.hpp>
 #include <Nazara/Math/BoundingVolume.hpp>
 #include <Nazara/Math/Enums.hpp>
@@ -27,6 +29,8 @@ namespace Nz
 	class Frustum
 	{
 		public:
+			struct BoxBatch;
+
 			constexpr Frustum() = default;
 			constexpr explicit Frustum(const EnumArray<FrustumPlane, Plane<T>>& planes);
 			template<typename U> constexpr explicit Frustum(const Frustum<U>& frustum);
@@ -36,6 +40,8 @@ namespace Nz
 			constexpr Vector3<T> ComputeCorner(BoxCorner corner) const;
 			constexpr EnumArray<BoxCorner, Vector3<T>> ComputeCorners() const;
 
+			void CullBoxes(const BoxBatch& boxes, UInt64* visibilityMask, UInt64* insideMask = nullptr) const;
+
 			constexpr bool Contains(const BoundingVolume<T>& volume) const;
 			constexpr bool Contains(const Box<T>& box) const;
 			constexpr bool Contains(const OrientedBox<T>& orientedBox) const;
@@ -76,6 +82,18 @@ namespace Nz
 			template<typename U> friend bool Serialize(SerializationContext& context, const Frustum<U>& frustum, TypeTag<Frustum<U>>);
 			template<typename U> friend bool Deserialize(SerializationContext& context, Frustum<U>* frustum, TypeTag<Frustum<U>>);
 
+			// Axis-aligned boxes (position and lengths, like Box) stored as a structure of arrays
+			struct BoxBatch
+			{
+				const T* x;
+				const T* y;
+				const T* z;
+				const T* width;
+				const T* height;
+				const T* depth;
+				std::size_t count;
+			};
+
 		private:
 			EnumArray<FrustumPlane, Plane<T>> m_planes;
 	};
@@ -83,6 +101,12 @@ namespace Nz
 	using Frustumd = Frustum<double>;
 	using Frustumf = Frustum<float>;
 
+	namespace Detail
+	{
+		// SIMD part of Frustum<float>::CullBoxes, picks the widest instruction set supported by the CPU at runtime and returns the number of processed boxes
+		NAZARA_CORE_API std::size_t CullBoxesSIMD(const Plane<float>* planes, std::size_t planeCount, const Frustum<float>::BoxBatch& boxes, UInt64* visibilityMask, UInt64* insideMask);
+	}
+
 	template<typename T> std::ostream& operator<<(std::ostream& out, const Nz::Frustum<T>& frustum);
 }
 
@@ -8,11 +8,40 @@
 
 #include <NazaraUtils/EnumArray.hpp>
 #include <NazaraUtils/MathUtils.hpp>
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <sstream>
 
 namespace Nz
 {
+	namespace Detail
+	{
+		// Performs the same operations (in the same order) as Frustum::Intersect(Box) so results match
+		template<typename T>
+		IntersectionSide ClassifyBox(const Plane<T>* planes, std::size_t planeCount, const Vector3<T>& position, const Vector3<T>& lengths)
+		{
+			Vector3<T> center = position + lengths / T(2.0);
+			Vector3<T> extents = lengths * T(0.5);
+
+			IntersectionSide side = IntersectionSide::Inside;
+			for (std::size_t i = 0; i < planeCount; ++i)
+			{
+				const Plane<T>& plane = planes[i];
+
+				Vector3<T> projectedExtents = extents * plane.normal.GetAbs();
+				T radius = projectedExtents.x + projectedExtents.y + projectedExtents.z;
+
+				T distance = plane.SignedDistance(center);
+				if (distance < -radius)
+					return IntersectionSide::Outside;
+				else if (distance < radius)
+					side = IntersectionSide::Intersecting;
+			}
+
+			return side;
+		}
+	}
 
 	/*!
 	* \ingroup math
@@ -101,6 +130,60 @@ namespace Nz
 		};
 	}
 
+	/*!
+	* \brief Tests a batch of boxes against the frustum
+	*
+	* Bit i of the visibility mask is set if the box i isn't outside of the frustum, giving the same result as Intersect(Box) != IntersectionSide::Outside.
+	* Float boxes are tested several at once using SIMD instructions when the CPU supports them (AVX, SSE2 or NEON).
+	*
+	* \param boxes Boxes to test, as a structure of arrays of their position and lengths
+	* \param visibilityMask Array of at least (boxes.count + 63) / 64 elements receiving the visibility of every box, bits past boxes.count are cleared
+	* \param insideMask Optional array of the same size as visibilityMask, receiving whether every box is fully inside the frustum (Intersect(Box) == IntersectionSide::Inside)
+	*
+	* \remark Results are the same as Intersect(Box) as long as the compiler doesn't contract its multiply-adds into fused multiply-adds
+	*/
+	template<typename T>
+	void Frustum<T>::CullBoxes(const BoxBatch& boxes, UInt64* visibilityMask, UInt64* insideMask) const
+	{
+		std::size_t maskSize = (boxes.count + 63) / 64;
+		std::fill(visibilityMask, visibilityMask + maskSize, UInt64(0));
+		if (insideMask)
+			std::fill(insideMask, insideMask + maskSize, UInt64(0));
+
+		std::array<Plane<T>, 6> planes;
+		for (std::size_t i = 0; i < planes.size(); ++i)
+			planes[i] = m_planes[static_cast<FrustumPlane>(i)];
+
+		std::size_t planeCount = (HasInfiniteFarPlane()) ? 5 : 6;
+
+		std::size_t firstBox = 0;
+		if constexpr (std::is_same_v<T, float>)
+			firstBox = Detail::CullBoxesSIMD(planes.data(), planeCount, boxes, visibilityMask, insideMask);
+
+		// Remaining boxes (or every box if SIMD isn't available)
+		for (std::size_t i = firstBox; i < boxes.count; ++i)
+		{
+			Vector3<T> position(boxes.x[i], boxes.y[i], boxes.z[i]);
+			Vector3<T> lengths(boxes.width[i], boxes.height[i], boxes.depth[i]);
+
+			switch (Detail::ClassifyBox(planes.data(), planeCount, position, lengths))
+			{
+				case IntersectionSide::Inside:
+					if (insideMask)
+						insideMask[i / 64] |= UInt64(1) << (i % 64);
+
+					[[fallthrough]];
+
+				case IntersectionSide::Intersecting:
+					visibilityMask[i / 64] |= UInt64(1) << (i % 64);
+					break;
+
+				case IntersectionSide::Outside:
+					break;
+			}
+		}
+	}
+
 	/*!
 	* \brief Checks whether or not a bounding volume is contained in the frustum
 	* \return true if the bounding volume is entirely in the frustum
@@ -33,13 +33,18 @@
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
 #include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetLZCompressor.hpp>
 #include <Nazara/Network/ENetPacket.hpp>
+#include <Nazara/Network/ENetPacketAllocator.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
 #include <Nazara/Network/Enums.hpp>
 #include <Nazara/Network/Export.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/Network.hpp>
 #include <Nazara/Network/SocketHandle.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
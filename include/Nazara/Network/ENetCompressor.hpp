@@ -24,6 +24,7 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Network/Export.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <vector>
 
 namespace Nz
 {
@@ -37,6 +38,9 @@ namespace Nz
 
 			virtual std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) = 0;
 			virtual std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) = 0;
+
+		protected:
+			static const UInt8* GatherInput(const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, std::vector<UInt8>& scratch);
 	};
 }
 
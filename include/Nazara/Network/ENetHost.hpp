@@ -21,14 +21,15 @@
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Clock.hpp>
 #include <Nazara/Network/ENetCompressor.hpp>
+#include <Nazara/Network/ENetPacketAllocator.hpp>
 #include <Nazara/Network/ENetPeer.hpp>
 #include <Nazara/Network/ENetProtocol.hpp>
 #include <Nazara/Network/IpAddress.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/SocketPoller.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
 #include <NazaraUtils/Flags.hpp>
-#include <NazaraUtils/MemoryPool.hpp>
 #include <random>
 
 namespace Nz
@@ -44,12 +45,15 @@ namespace Nz
 			ENetHost(ENetHost&&) = default;
 			inline ~ENetHost();
 
-			ENetPacketRef AllocatePacket(ENetPacketFlags flags);
+			inline ENetPacketRef AllocatePacket(ENetPacketFlags flags);
 			inline ENetPacketRef AllocatePacket(ENetPacketFlags flags, ByteArray&& payload);
+			inline ENetPacketRef AllocatePacket(ENetPacketFlags flags, std::size_t size);
+			inline ENetPacketRef AllocatePacket(ENetPacketFlags flags, const void* data, std::size_t size);
 
 			inline void AllowsIncomingConnections(bool allow = true);
 
 			void Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet);
+			void Broadcast(UInt8 channelId, ENetPacketRef packet);
 
 			bool CheckEvents(ENetEvent* event);
 
@@ -63,21 +67,32 @@ namespace Nz
 
 			inline bool DoesAllowIncomingConnections() const;
 
+			inline void EnablePortReuse(bool reusePort = true);
+
 			void Flush();
 
 			inline IpAddress GetBoundAddress() const;
+			inline const ENetPacketAllocator::Stats& GetPacketAllocatorStats() const;
 			inline UInt32 GetServiceTime() const;
 			inline UInt32 GetTotalReceivedPackets() const;
 			inline UInt64 GetTotalReceivedData() const;
 			inline UInt64 GetTotalSentData() const;
 			inline UInt32 GetTotalSentPackets() const;
 
+			inline bool IsReusingPort() const;
+
+			inline bool OwnsPeer(const ENetPeer* peer) const;
+
+			bool RegisterWakeupSocket(AbstractSocket& socket);
+
 			int Service(ENetEvent* event, UInt32 timeout);
 
 			inline void SetCompressor(std::unique_ptr<ENetCompressor>&& compressor);
 
 			void SimulateNetwork(double packetLossProbability, UInt16 minDelay, UInt16 maxDelay);
 
+			void UnregisterWakeupSocket(AbstractSocket& socket);
+
 			ENetHost& operator=(const ENetHost&) = delete;
 			ENetHost& operator=(ENetHost&&) = default;
 
@@ -89,6 +104,8 @@ namespace Nz
 
 			bool DispatchIncomingCommands(ENetEvent* event);
 
+			int FlushOutgoingDatagrams(ENetEvent* event);
+
 			ENetPeer* HandleConnect(ENetProtocolHeader* header, ENetProtocol* command);
 			bool HandleIncomingCommands(ENetEvent* event);
 
@@ -110,6 +127,16 @@ namespace Nz
 			static bool Initialize();
 			static void Uninitialize();
 
+			struct DatagramBatch
+			{
+				std::vector<ENetPeer*> peers; //< destination peer of outgoing datagrams
+				std::vector<NetBuffer> buffers;
+				std::vector<NetDatagram> datagrams;
+				std::vector<UInt8> data;
+				std::size_t count = 0;
+				std::size_t offset = 0;
+			};
+
 			struct PendingIncomingPacket
 			{
 				ByteArray data;
@@ -140,12 +167,14 @@ namespace Nz
 			std::size_t m_receivedDataLength;
 			std::uniform_int_distribution<UInt16> m_packetDelayDistribution;
 			std::unique_ptr<ENetCompressor> m_compressor;
+			DatagramBatch m_incomingDatagrams;
+			DatagramBatch m_outgoingDatagrams;
 			std::vector<ENetPeer> m_peers;
 			std::vector<PendingIncomingPacket> m_pendingIncomingPackets;
 			std::vector<PendingOutgoingPacket> m_pendingOutgoingPackets;
 			MovablePtr<UInt8> m_receivedData;
 			Bitset<UInt64> m_dispatchQueue;
-			MemoryPool<ENetPacket> m_packetPool;
+			ENetPacketAllocator m_packetAllocator;
 			IpAddress m_address;
 			IpAddress m_receivedAddress;
 			SocketPoller m_poller;
@@ -164,6 +193,7 @@ namespace Nz
 			UInt64 m_totalReceivedData;
 			bool m_allowsIncomingConnections;
 			bool m_continueSending;
+			bool m_isReusingPort;
 			bool m_isUsingDualStack;
 			bool m_isSimulationEnabled;
 			bool m_recalculateBandwidthLimits;
@@ -7,7 +7,7 @@
 namespace Nz
 {
 	inline ENetHost::ENetHost() :
-	m_packetPool(sizeof(ENetPacket)),
+	m_isReusingPort(false),
 	m_isUsingDualStack(false),
 	m_isSimulationEnabled(false)
 	{
@@ -18,12 +18,30 @@ namespace Nz
 		Destroy();
 	}
 
+	inline ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags)
+	{
+		return m_packetAllocator.Allocate(flags);
+	}
+
 	inline ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags, ByteArray&& payload)
 	{
-		ENetPacketRef ref = AllocatePacket(flags);
-		ref->data = std::move(payload);
+		return m_packetAllocator.Allocate(flags, std::move(payload));
+	}
+
+	/*!
+	* \brief Allocates a packet with a zero-initialized payload of size bytes, reusing a pooled buffer when possible
+	*/
+	inline ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags, std::size_t size)
+	{
+		return m_packetAllocator.Allocate(flags, size);
+	}
 
-		return ref;
+	/*!
+	* \brief Allocates a packet holding a copy of data, reusing a pooled buffer when possible
+	*/
+	inline ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags, const void* data, std::size_t size)
+	{
+		return m_packetAllocator.Allocate(flags, data, size);
 	}
 
 	inline void ENetHost::AllowsIncomingConnections(bool allow)
@@ -72,11 +90,34 @@ namespace Nz
 		return m_allowsIncomingConnections;
 	}
 
+	/*!
+	* \brief Allows the socket to be bound on a port already used by other sockets, must be called before Create
+	*
+	* \remark The system balances incoming datagrams between those sockets, use IsReusingPort to check if it's supported
+	*/
+	inline void ENetHost::EnablePortReuse(bool reusePort)
+	{
+		m_isReusingPort = reusePort;
+	}
+
+	/*!
+	* \brief Gets the address the host is bound to, including the port picked by the system if it was created with port zero
+	*/
 	inline IpAddress ENetHost::GetBoundAddress() const
 	{
 		return m_address;
 	}
 
+	/*!
+	* \brief Gets the packet allocator statistics
+	*
+	* Once traffic reaches a steady state, bufferAllocations should stop growing as payload buffers are recycled.
+	*/
+	inline const ENetPacketAllocator::Stats& ENetHost::GetPacketAllocatorStats() const
+	{
+		return m_packetAllocator.GetStats();
+	}
+
 	inline UInt32 ENetHost::GetServiceTime() const
 	{
 		return m_serviceTime;
@@ -102,6 +143,21 @@ namespace Nz
 		return m_totalSentPackets;
 	}
 
+	inline bool ENetHost::IsReusingPort() const
+	{
+		return m_socket.IsReusePortEnabled();
+	}
+
+	/*!
+	* \brief Checks if a peer belongs to this host
+	*
+	* Peers are stored contiguously and never move until the host is destroyed.
+	*/
+	inline bool ENetHost::OwnsPeer(const ENetPeer* peer) const
+	{
+		return !m_peers.empty() && peer >= &m_peers.front() && peer <= &m_peers.back();
+	}
+
 	inline void ENetHost::SetCompressor(std::unique_ptr<ENetCompressor>&& compressor)
 	{
 		m_compressor = std::move(compressor);
@@ -0,0 +1,34 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETLZCOMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETLZCOMPRESSOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <array>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetLZCompressor : public ENetCompressor
+	{
+		public:
+			ENetLZCompressor() = default;
+			~ENetLZCompressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+			static constexpr std::size_t HashBits = 12;
+
+		private:
+			std::array<UInt16, 1 << HashBits> m_hashTable;
+			std::vector<UInt8> m_inputBuffer;
+	};
+}
+
+#endif // NAZARA_NETWORK_ENETLZCOMPRESSOR_HPP
@@ -10,12 +10,13 @@
 #include <NazaraUtils/Prerequisites.hpp>
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Network/Export.hpp>
-#include <NazaraUtils/MemoryPool.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
 #include <NazaraUtils/Signal.hpp>
 
 namespace Nz
 {
+	class ENetPacketAllocator;
+
 	enum class ENetPacketFlag
 	{
 		Reliable,
@@ -48,8 +49,8 @@ namespace Nz
 	{
 		ENetPacketRef() = default;
 
-		ENetPacketRef(MemoryPool<ENetPacket>* pool, ENetPacket* packet) :
-		m_pool(pool)
+		ENetPacketRef(ENetPacketAllocator* allocator, ENetPacket* packet) :
+		m_allocator(allocator)
 		{
 			Reset(packet);
 		}
@@ -58,7 +59,7 @@ namespace Nz
 		ENetPacketRef()
 		{
 			Reset(packet);
-			m_pool = packet.m_pool;
+			m_allocator = packet.m_allocator;
 		}
 
 		ENetPacketRef(ENetPacketRef&&) noexcept = default;
@@ -83,13 +84,13 @@ namespace Nz
 		ENetPacketRef& operator=(const ENetPacketRef& packet)
 		{
 			Reset(packet);
-			m_pool = packet.m_pool;
+			m_allocator = packet.m_allocator;
 			return *this;
 		}
 
 		ENetPacketRef& operator=(ENetPacketRef&&) noexcept = default;
 
-		MovablePtr<MemoryPool<ENetPacket>> m_pool;
+		MovablePtr<ENetPacketAllocator> m_allocator;
 		MovablePtr<ENetPacket> m_packet;
 	};
 }
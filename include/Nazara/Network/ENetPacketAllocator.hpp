@@ -0,0 +1,70 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETPACKETALLOCATOR_HPP
+#define NAZARA_NETWORK_ENETPACKETALLOCATOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetPacket.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <NazaraUtils/MemoryPool.hpp>
+#include <array>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetPacketAllocator
+	{
+		public:
+			struct Stats;
+
+			ENetPacketAllocator();
+			ENetPacketAllocator(const ENetPacketAllocator&) = delete;
+			ENetPacketAllocator(ENetPacketAllocator&&) noexcept = default;
+			~ENetPacketAllocator() = default;
+
+			ENetPacketRef Allocate(ENetPacketFlags flags);
+			ENetPacketRef Allocate(ENetPacketFlags flags, std::size_t size);
+			ENetPacketRef Allocate(ENetPacketFlags flags, const void* data, std::size_t size);
+			ENetPacketRef Allocate(ENetPacketFlags flags, ByteArray&& payload);
+
+			inline const Stats& GetStats() const;
+
+			void Release(ENetPacket* packet);
+
+			ENetPacketAllocator& operator=(const ENetPacketAllocator&) = delete;
+			ENetPacketAllocator& operator=(ENetPacketAllocator&&) noexcept = default;
+
+			struct Stats
+			{
+				std::size_t activePackets = 0;  //< packets currently referenced
+				std::size_t pooledBuffers = 0;  //< payload buffers waiting to be reused
+				std::size_t pooledMemory = 0;   //< capacity of the pooled payload buffers, in bytes
+				UInt64 bufferAllocations = 0;   //< payload buffers allocated from the heap
+				UInt64 bufferReuses = 0;        //< payload buffers taken from the pool
+				UInt64 discardedBuffers = 0;    //< payload buffers freed because their size class was full or too large
+			};
+
+			static constexpr std::size_t MaxPooledBuffersPerClass = 128;
+			static constexpr std::size_t MaxSizeClassBits = 16; //< 64KiB, larger payloads aren't pooled
+			static constexpr std::size_t MinSizeClassBits = 6;  //< 64B
+
+		private:
+			ByteArray AcquireBuffer(std::size_t size);
+			void RecycleBuffer(ByteArray&& buffer);
+
+			static constexpr std::size_t SizeClassCount = MaxSizeClassBits - MinSizeClassBits + 1;
+
+			std::array<std::vector<ByteArray>, SizeClassCount> m_freeBuffers;
+			MemoryPool<ENetPacket> m_packetPool;
+			Stats m_stats;
+	};
+}
+
+#include <Nazara/Network/ENetPacketAllocator.inl>
+
+#endif // NAZARA_NETWORK_ENETPACKETALLOCATOR_HPP
@@ -30,7 +30,9 @@ namespace Nz
 		ENetHost_DefaultMaximumPacketSize  = 32 * 1024 * 1024,
 		ENetHost_DefaultMaximumWaitingData = 32 * 1024 * 1024,
 		ENetHost_DefaultMTU                = 1400,
+		ENetHost_ReceiveBatchSize          = 32,
 		ENetHost_ReceiveBufferSize         = 256 * 1024,
+		ENetHost_SendBatchSize             = 32,
 		ENetHost_SendBufferSize            = 256 * 1024,
 
 		ENetPeer_DefaultPacketThrottle      = 32,
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
+#define NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetCompressor.hpp>
+#include <array>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Nz
+{
+	class NAZARA_NETWORK_API ENetRangeCoderCompressor : public ENetCompressor
+	{
+		public:
+			struct Dictionary;
+
+			inline ENetRangeCoderCompressor(std::shared_ptr<const Dictionary> dictionary = nullptr);
+			~ENetRangeCoderCompressor() = default;
+
+			std::size_t Compress(const ENetPeer* peer, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize) override;
+			std::size_t Decompress(const ENetPeer* peer, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize) override;
+
+			inline const std::shared_ptr<const Dictionary>& GetDictionary() const;
+
+			static std::shared_ptr<Dictionary> TrainDictionary(std::span<const ByteArray> samples);
+
+			static constexpr std::size_t ContextCount = 256;
+			static constexpr std::size_t ProbabilityBits = 11;
+
+			// Initial bit probabilities of the order-1 model, both peers must use the same dictionary
+			struct Dictionary
+			{
+				std::array<UInt16, ContextCount * 256> probabilities;
+			};
+
+		private:
+			UInt16* GetContext(UInt8 previousByte);
+			void ResetModel();
+
+			std::array<UInt16, ContextCount * 256> m_probabilities;
+			std::array<UInt32, ContextCount> m_contextGenerations;
+			std::shared_ptr<const Dictionary> m_dictionary;
+			std::vector<UInt8> m_inputBuffer;
+			UInt32 m_generation;
+	};
+}
+
+#include <Nazara/Network/ENetRangeCoderCompressor.inl>
+
+#endif // NAZARA_NETWORK_ENETRANGECODERCOMPRESSOR_HPP
@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <utility>
+
+namespace Nz
+{
+	/*!
+	* \brief Constructs a range coder compressor
+	*
+	* \param dictionary Optional dictionary trained on sample traffic (see TrainDictionary), both peers must use the same one
+	*
+	* \remark Without a dictionary, each datagram is coded with an order-0 model learned from scratch, a dictionary enables a trained order-1 model
+	*/
+	inline ENetRangeCoderCompressor::ENetRangeCoderCompressor(std::shared_ptr<const Dictionary> dictionary) :
+	m_dictionary(std::move(dictionary)),
+	m_generation(0)
+	{
+		m_contextGenerations.fill(0);
+	}
+
+	inline auto ENetRangeCoderCompressor::GetDictionary() const -> const std::shared_ptr<const Dictionary>&
+	{
+		return m_dictionary;
+	}
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_ENETSHARDEDHOST_HPP
+#define NAZARA_NETWORK_ENETSHARDEDHOST_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetPacket.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/Export.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <memory>
+
+namespace Nz
+{
+	class ENetPeer;
+
+	struct ENetShardedEvent
+	{
+		ENetEventType type;
+		ENetPeer*     peer; //< owned by a shard thread, only pass it back to the host
+		IpAddress     address;
+		UInt8         channelId;
+		UInt32        data;
+		ByteArray     packet;
+	};
+
+	class NAZARA_NETWORK_API ENetShardedHost
+	{
+		public:
+			inline ENetShardedHost();
+			ENetShardedHost(const ENetShardedHost&) = delete;
+			ENetShardedHost(ENetShardedHost&&) noexcept;
+			~ENetShardedHost();
+
+			void Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet);
+
+			bool Create(const IpAddress& listenAddress, std::size_t peerCount, std::size_t channelCount = 0, unsigned int shardCount = 0);
+			void Destroy();
+
+			void Disconnect(ENetPeer* peer, UInt32 data = 0);
+
+			inline const IpAddress& GetBoundAddress() const;
+			inline unsigned int GetShardCount() const;
+
+			bool PollEvent(ENetShardedEvent* event);
+
+			void Send(ENetPeer* peer, UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet);
+
+			ENetShardedHost& operator=(const ENetShardedHost&) = delete;
+			ENetShardedHost& operator=(ENetShardedHost&&) noexcept;
+
+		private:
+			struct Command;
+			struct Data;
+			class Shard;
+
+			Shard* FindPeerShard(const ENetPeer* peer) const;
+
+			std::unique_ptr<Data> m_data;
+			IpAddress m_boundAddress;
+			unsigned int m_shardCount;
+	};
+}
+
+#include <Nazara/Network/ENetShardedHost.inl>
+
+#endif // NAZARA_NETWORK_ENETSHARDEDHOST_HPP
@@ -0,0 +1,25 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+
+namespace Nz
+{
+	inline ENetShardedHost::ENetShardedHost() :
+	m_shardCount(0)
+	{
+	}
+
+	/*!
+	* \brief Gets the address the shards are listening on, with the port they share
+	*/
+	inline const IpAddress& ENetShardedHost::GetBoundAddress() const
+	{
+		return m_boundAddress;
+	}
+
+	inline unsigned int ENetShardedHost::GetShardCount() const
+	{
+		return m_shardCount;
+	}
+}
@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_NETWORK_NETDATAGRAM_HPP
+#define NAZARA_NETWORK_NETDATAGRAM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Network/IpAddress.hpp>
+#include <Nazara/Network/NetBuffer.hpp>
+#include <cstddef>
+
+namespace Nz
+{
+	// One datagram of a batch, address is the sender when receiving and the destination when sending
+	struct NetDatagram
+	{
+		IpAddress address;
+		NetBuffer* buffers;
+		std::size_t bufferCount;
+		std::size_t dataLength; //< bytes received or sent
+	};
+}
+
+#endif // NAZARA_NETWORK_NETDATAGRAM_HPP
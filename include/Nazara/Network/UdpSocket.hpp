@@ -14,6 +14,7 @@
 namespace Nz
 {
 	struct NetBuffer;
+	struct NetDatagram;
 
 	class NAZARA_NETWORK_API UdpSocket : public AbstractSocket
 	{
@@ -29,18 +30,22 @@ namespace Nz
 			inline bool Create(NetProtocol protocol);
 
 			void EnableBroadcasting(bool broadcasting);
+			void EnableReusePort(bool reusePort);
 
 			inline IpAddress GetBoundAddress() const;
 			inline UInt16 GetBoundPort() const;
 
 			inline bool IsBroadcastingEnabled() const;
+			inline bool IsReusePortEnabled() const;
 
 			std::size_t QueryMaxDatagramSize();
 
 			bool Receive(void* buffer, std::size_t size, IpAddress* from, std::size_t* received);
+			bool ReceiveDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received);
 			bool ReceiveMultiple(NetBuffer* buffers, std::size_t bufferCount, IpAddress* from, std::size_t* received);
 
 			bool Send(const IpAddress& to, const void* buffer, std::size_t size, std::size_t* sent);
+			bool SendDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent);
 			bool SendMultiple(const IpAddress& to, const NetBuffer* buffers, std::size_t bufferCount, std::size_t* sent);
 
 			UdpSocket& operator=(const UdpSocket& udpSocket) = delete;
@@ -52,6 +57,7 @@ namespace Nz
 
 			IpAddress m_boundAddress;
 			bool m_isBroadCastingEnabled;
+			bool m_isReusePortEnabled;
 	};
 }
 
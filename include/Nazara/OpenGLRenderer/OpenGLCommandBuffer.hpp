@@ -17,8 +17,9 @@
 #include <Nazara/Renderer/CommandBuffer.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <NazaraUtils/TypeList.hpp>
+#include <array>
 #include <optional>
-#include <variant>
+#include <string_view>
 #include <vector>
 
 namespace Nz
@@ -60,6 +61,8 @@ namespace Nz
 
 			inline void Draw(UInt32 vertexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0);
 			inline void DrawIndexed(UInt32 indexCount, UInt32 instanceCount = 1, UInt32 firstIndex = 0, UInt32 vertexOffset = 0, UInt32 firstInstance = 0);
+			inline void DrawIndexedIndirect(GLuint indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride, GLuint countBuffer = 0, UInt64 countOffset = 0);
+			inline void DrawIndirect(GLuint indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride, GLuint countBuffer = 0, UInt64 countOffset = 0);
 
 			inline void EndDebugRegion();
 
@@ -83,11 +86,18 @@ namespace Nz
 			OpenGLCommandBuffer& operator=(OpenGLCommandBuffer&&) = delete;
 
 		private:
+			struct CommandHeader;
 			struct DrawStates;
+			struct ReplayStates;
+			struct ShaderBindingEntry;
 			struct ShaderBindings;
 
 #define NAZARA_OPENGL_FOREACH_COMMANDS(cb, lastCb) \
 	cb(BeginDebugRegionCommand) \
+	cb(BindIndexBufferCommand) \
+	cb(BindRenderPipelineCommand) \
+	cb(BindRenderShaderBindingCommand) \
+	cb(BindVertexBufferCommand) \
 	cb(BlitTextureCommand) \
 	cb(BlitTextureToWindowCommand) \
 	cb(BuildTextureMipmapsCommand) \
@@ -97,10 +107,14 @@ namespace Nz
 	cb(DispatchCommand) \
 	cb(DrawCommand) \
 	cb(DrawIndexedCommand) \
+	cb(DrawIndexedIndirectCommand) \
+	cb(DrawIndirectCommand) \
 	cb(EndDebugRegionCommand) \
 	cb(InsertDebugLabelCommand) \
 	cb(MemoryBarrier) \
-	lastCb(SetFrameBufferCommand) \
+	cb(SetFrameBufferCommand) \
+	cb(SetScissorCommand) \
+	lastCb(SetViewportCommand) \
 
 #define NAZARA_OPENGL_COMMAND_CALLBACK(Command) struct Command;
 			NAZARA_OPENGL_FOREACH_COMMANDS(NAZARA_OPENGL_COMMAND_CALLBACK, NAZARA_OPENGL_COMMAND_CALLBACK)
@@ -116,30 +130,85 @@ namespace Nz
 
 			>;
 
-			void ApplyBindings(const GL::Context& context, const ShaderBindings& bindings);
-			void ApplyStates(const GL::Context& context, const DrawStates& states);
-
-			inline void Execute(const GL::Context* context, const BeginDebugRegionCommand& command);
-			inline void Execute(const GL::Context* context, const BlitTextureCommand& command);
-			inline void Execute(const GL::Context* context, const BlitTextureToWindowCommand& command);
-			inline void Execute(const GL::Context* context, const BuildTextureMipmapsCommand& command);
-			inline void Execute(const GL::Context* context, const CopyBufferCommand& command);
-			inline void Execute(const GL::Context* context, const CopyBufferFromMemoryCommand& command);
-			inline void Execute(const GL::Context* context, const CopyTextureCommand& command);
-			inline void Execute(const GL::Context* context, const DispatchCommand& command);
-			inline void Execute(const GL::Context* context, const DrawCommand& command);
-			inline void Execute(const GL::Context* context, const DrawIndexedCommand& command);
-			inline void Execute(const GL::Context* context, const EndDebugRegionCommand& command);
-			inline void Execute(const GL::Context* context, const InsertDebugLabelCommand& command);
-			inline void Execute(const GL::Context* context, const MemoryBarrier& command);
-			inline void Execute(const GL::Context*& context, const SetFrameBufferCommand& command);
+			template<typename T> T& AppendCommand(std::size_t trailingSize = 0);
+			void AppendDebugCommand(bool beginRegion, std::string_view text, const Color& color);
+
+			void ApplyBindings(const GL::Context& context, const ShaderBindingEntry* bindings, std::size_t bindingCount);
+			void BindVertexArray(const GL::Context& context, const DrawStates& states);
+
+			inline void Execute(const GL::Context* context, ReplayStates& states, const BeginDebugRegionCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const BindIndexBufferCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const BindRenderPipelineCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const BindRenderShaderBindingCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const BindVertexBufferCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const BlitTextureCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const BlitTextureToWindowCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const BuildTextureMipmapsCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const CopyBufferCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const CopyBufferFromMemoryCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const CopyTextureCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const DispatchCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const DrawCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const DrawIndexedCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const DrawIndexedIndirectCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const DrawIndirectCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const EndDebugRegionCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const InsertDebugLabelCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const MemoryBarrier& command);
+			inline void Execute(const GL::Context*& context, ReplayStates& states, const SetFrameBufferCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const SetScissorCommand& command);
+			inline void Execute(const GL::Context* context, ReplayStates& states, const SetViewportCommand& command);
+
+			inline void InvalidateRecordedStates();
+
+			void RecordDrawStates();
 
 			void Release() override;
 
+			template<typename T> static const T& GetCommand(const CommandHeader& header);
+			template<typename T> static const UInt8* GetTrailingData(const T& command);
+			template<typename T> static UInt8* GetTrailingData(T& command);
+
+			static constexpr std::size_t CommandAlignment = 8;
+
+			// Commands are stored in a linear stream, each one being a header followed by the command and its optional trailing data
+			struct CommandHeader
+			{
+				UInt32 type;
+				UInt32 size; //< including the header and trailing data
+			};
+
 			struct BeginDebugRegionCommand
 			{
-				std::string regionName;
 				Color color;
+				UInt32 regionNameSize; //< followed by the region name
+			};
+
+			struct BindIndexBufferCommand
+			{
+				GLuint indexBuffer;
+				IndexType indexType;
+				UInt64 offset;
+			};
+
+			struct BindRenderPipelineCommand
+			{
+				const OpenGLRenderPipeline* pipeline;
+				bool shouldFlipY;
+			};
+
+			struct BindRenderShaderBindingCommand
+			{
+				const OpenGLRenderPipelineLayout* pipelineLayout;
+				const OpenGLShaderBinding* shaderBinding;
+				UInt32 set;
+			};
+
+			struct BindVertexBufferCommand
+			{
+				GLuint vertexBuffer;
+				UInt32 binding;
+				UInt64 offset;
 			};
 
 			struct BlitTextureCommand
@@ -196,15 +265,21 @@ namespace Nz
 				UInt64 targetOffset;
 			};
 
+			struct ShaderBindingEntry
+			{
+				const OpenGLRenderPipelineLayout* pipelineLayout = nullptr;
+				const OpenGLShaderBinding* shaderBinding = nullptr;
+			};
+
 			struct ShaderBindings
 			{
-				std::vector<std::pair<const OpenGLRenderPipelineLayout*, const OpenGLShaderBinding*>> shaderBindings;
+				std::vector<ShaderBindingEntry> shaderBindings;
 			};
 
 			struct DispatchCommand
 			{
-				ComputeStates states;
-				ShaderBindings bindings;
+				const OpenGLComputePipeline* pipeline;
+				UInt32 bindingCount; //< followed by the shader bindings
 				UInt32 numGroupsX;
 				UInt32 numGroupsY;
 				UInt32 numGroupsZ;
@@ -215,13 +290,13 @@ namespace Nz
 				struct VertexBuffer
 				{
 					GLuint vertexBuffer = 0;
-					UInt64 offset;
+					UInt64 offset = 0;
 				};
 
 				GLuint indexBuffer = 0;
 				const OpenGLRenderPipeline* pipeline = nullptr;
-				UInt64 indexBufferOffset;
-				IndexType indexBufferType;
+				UInt64 indexBufferOffset = 0;
+				IndexType indexBufferType = IndexType::U16;
 				std::optional<Recti> scissorRegion;
 				std::optional<Recti> viewportRegion;
 				std::vector<VertexBuffer> vertexBuffers;
@@ -230,8 +305,6 @@ namespace Nz
 
 			struct DrawCommand
 			{
-				DrawStates states;
-				ShaderBindings bindings;
 				UInt32 firstInstance;
 				UInt32 firstVertex;
 				UInt32 instanceCount;
@@ -240,8 +313,6 @@ namespace Nz
 
 			struct DrawIndexedCommand
 			{
-				DrawStates states;
-				ShaderBindings bindings;
 				UInt32 baseVertex;
 				UInt32 firstIndex;
 				UInt32 firstInstance;
@@ -249,14 +320,35 @@ namespace Nz
 				UInt32 instanceCount;
 			};
 
+			// countBuffer is zero when drawCount is the actual draw count, otherwise drawCount is the maximum draw count
+			struct DrawIndexedIndirectCommand
+			{
+				GLuint countBuffer;
+				GLuint indirectBuffer;
+				UInt64 countOffset;
+				UInt64 offset;
+				UInt32 drawCount;
+				UInt32 stride;
+			};
+
+			struct DrawIndirectCommand
+			{
+				GLuint countBuffer;
+				GLuint indirectBuffer;
+				UInt64 countOffset;
+				UInt64 offset;
+				UInt32 drawCount;
+				UInt32 stride;
+			};
+
 			struct EndDebugRegionCommand
 			{
 			};
 
 			struct InsertDebugLabelCommand
 			{
-				std::string label;
 				Color color;
+				UInt32 labelSize; //< followed by the label
 			};
 
 			struct MemoryBarrier
@@ -264,6 +356,12 @@ namespace Nz
 				GLbitfield barriers;
 			};
 
+			struct ReplayStates
+			{
+				DrawStates drawStates;
+				bool isVertexArrayDirty = true;
+			};
+
 			struct SetFrameBufferCommand
 			{
 				std::array<CommandBufferBuilder::ClearValues, 16> clearValues; //< TODO: Remove hard limit?
@@ -271,18 +369,29 @@ namespace Nz
 				const OpenGLRenderPass* renderpass;
 			};
 
-			using CommandData = TypeListInstantiate<CommandList, std::variant>;
+			struct SetScissorCommand
+			{
+				Recti scissorRegion;
+			};
+
+			struct SetViewportCommand
+			{
+				Recti viewportRegion;
+			};
 
 			ComputeStates m_currentComputeStates;
 			DrawStates m_currentDrawStates;
+			DrawStates m_recordedDrawStates;
 			ShaderBindings m_currentComputeShaderBindings;
 			ShaderBindings m_currentGraphicsShaderBindings;
-			std::optional<MemoryBarrier> m_pendingBarrier;
+			ShaderBindings m_recordedGraphicsShaderBindings;
 			std::size_t m_bindingIndex;
+			std::size_t m_lastCommandOffset;
 			std::size_t m_maxColorBufferCount;
 			std::size_t m_poolIndex;
-			std::vector<CommandData> m_commands;
+			std::vector<UInt8> m_commandStream;
 			OpenGLCommandPool* m_owner;
+			bool m_areRecordedStatesValid;
 	};
 }
 
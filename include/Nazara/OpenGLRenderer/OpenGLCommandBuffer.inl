@@ -3,32 +3,38 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/OpenGLRenderer/OpenGLFramebuffer.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+#include <NazaraUtils/MathUtils.hpp>
+#include <NazaraUtils/MemoryHelper.hpp>
 #include <cassert>
+#include <cstring>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 
 namespace Nz
 {
 	inline OpenGLCommandBuffer::OpenGLCommandBuffer() :
+	m_lastCommandOffset(MaxValue()),
 	m_maxColorBufferCount(0),
-	m_owner(nullptr)
+	m_owner(nullptr),
+	m_areRecordedStatesValid(false)
 	{
 	}
 
 	inline OpenGLCommandBuffer::OpenGLCommandBuffer(OpenGLCommandPool& owner, std::size_t poolIndex, std::size_t bindingIndex) :
 	m_bindingIndex(bindingIndex),
+	m_lastCommandOffset(MaxValue()),
 	m_maxColorBufferCount(0),
 	m_poolIndex(poolIndex),
-	m_owner(&owner)
+	m_owner(&owner),
+	m_areRecordedStatesValid(false)
 	{
 	}
 
 	inline void OpenGLCommandBuffer::BeginDebugRegion(std::string_view regionName, const Color& color)
 	{
-		BeginDebugRegionCommand beginDebugRegion;
-		beginDebugRegion.color = color;
-		beginDebugRegion.regionName = regionName;
-
-		m_commands.emplace_back(std::move(beginDebugRegion));
+		AppendDebugCommand(true, regionName, color);
 	}
 
 	inline void OpenGLCommandBuffer::BindComputePipeline(const OpenGLComputePipeline* pipeline)
@@ -41,7 +47,7 @@ namespace Nz
 		if (set >= m_currentComputeShaderBindings.shaderBindings.size())
 			m_currentComputeShaderBindings.shaderBindings.resize(set + 1);
 
-		m_currentComputeShaderBindings.shaderBindings[set] = std::make_pair(&pipelineLayout, binding);
+		m_currentComputeShaderBindings.shaderBindings[set] = ShaderBindingEntry{ &pipelineLayout, binding };
 	}
 
 	inline void OpenGLCommandBuffer::BindIndexBuffer(GLuint indexBuffer, IndexType indexType, UInt64 offset)
@@ -61,7 +67,7 @@ namespace Nz
 		if (set >= m_currentGraphicsShaderBindings.shaderBindings.size())
 			m_currentGraphicsShaderBindings.shaderBindings.resize(set + 1);
 
-		m_currentGraphicsShaderBindings.shaderBindings[set] = std::make_pair(&pipelineLayout, binding);
+		m_currentGraphicsShaderBindings.shaderBindings[set] = ShaderBindingEntry{ &pipelineLayout, binding };
 	}
 
 	inline void OpenGLCommandBuffer::BindVertexBuffer(UInt32 binding, GLuint vertexBuffer, UInt64 offset)
@@ -76,75 +82,75 @@ namespace Nz
 
 	inline void OpenGLCommandBuffer::BlitTexture(const OpenGLTexture& source, const Boxui& sourceBox, const OpenGLTexture& target, const Boxui& targetBox, SamplerFilter filter)
 	{
-		BlitTextureCommand blitTexture = {
+		InvalidateRecordedStates();
+
+		AppendCommand<BlitTextureCommand>() = {
 			&source,
 			&target,
 			sourceBox,
 			targetBox,
 			filter
 		};
-
-		m_commands.emplace_back(std::move(blitTexture));
 	}
 
 	inline void OpenGLCommandBuffer::BlitTextureToWindow(const OpenGLTexture& source, const Boxui& sourceBox, const Boxui& targetBox, SamplerFilter filter)
 	{
-		BlitTextureToWindowCommand blitTexture = {
+		InvalidateRecordedStates();
+
+		AppendCommand<BlitTextureToWindowCommand>() = {
 			&source,
 			sourceBox,
 			targetBox,
 			filter
 		};
-
-		m_commands.emplace_back(std::move(blitTexture));
 	}
 
 	inline void OpenGLCommandBuffer::BuildMipmaps(OpenGLTexture& texture, UInt8 baseLevel, UInt8 levelCount)
 	{
-		BuildTextureMipmapsCommand buildMipmaps = {
+		InvalidateRecordedStates();
+
+		AppendCommand<BuildTextureMipmapsCommand>() = {
 			&texture,
 			baseLevel,
 			levelCount
 		};
-
-		m_commands.emplace_back(std::move(buildMipmaps));
 	}
 
 	inline void OpenGLCommandBuffer::CopyBuffer(GLuint source, GLuint target, UInt64 size, UInt64 sourceOffset, UInt64 targetOffset)
 	{
-		CopyBufferCommand copyBuffer = {
+		InvalidateRecordedStates();
+
+		AppendCommand<CopyBufferCommand>() = {
 			source,
 			target,
 			size,
 			sourceOffset,
 			targetOffset
 		};
-
-		m_commands.emplace_back(std::move(copyBuffer));
 	}
 
 	inline void OpenGLCommandBuffer::CopyBuffer(const UploadPool::Allocation& allocation, GLuint target, UInt64 size, UInt64 sourceOffset, UInt64 targetOffset)
 	{
-		CopyBufferFromMemoryCommand copyBuffer = {
+		InvalidateRecordedStates();
+
+		AppendCommand<CopyBufferFromMemoryCommand>() = {
 			static_cast<const UInt8*>(allocation.mappedPtr) + sourceOffset,
 			target,
 			size,
 			targetOffset
 		};
-
-		m_commands.emplace_back(std::move(copyBuffer));
 	}
 
 	inline void OpenGLCommandBuffer::CopyTexture(const OpenGLTexture& source, const Boxui& sourceBox, const OpenGLTexture& target, const Vector3ui& targetPoint)
 	{
-		CopyTextureCommand copyTexture = {
+		InvalidateRecordedStates();
+
+		AppendCommand<CopyTextureCommand>() = {
 			&source,
 			&target,
 			sourceBox,
 			targetPoint
 		};
-
-		m_commands.emplace_back(std::move(copyTexture));
 	}
 
 	inline void OpenGLCommandBuffer::Dispatch(UInt32 numGroupsX, UInt32 numGroupsY, UInt32 numGroupsZ)
@@ -152,14 +158,21 @@ namespace Nz
 		if (!m_currentComputeStates.pipeline)
 			throw std::runtime_error("no pipeline bound");
 
-		DispatchCommand dispatch;
-		dispatch.bindings = m_currentComputeShaderBindings;
-		dispatch.states = m_currentComputeStates;
+		// Compute pipelines and bindings override graphics states
+		InvalidateRecordedStates();
+
+		const auto& shaderBindings = m_currentComputeShaderBindings.shaderBindings;
+		std::size_t bindingSize = shaderBindings.size() * sizeof(ShaderBindingEntry);
+
+		DispatchCommand& dispatch = AppendCommand<DispatchCommand>(bindingSize);
+		dispatch.pipeline = m_currentComputeStates.pipeline;
+		dispatch.bindingCount = SafeCast<UInt32>(shaderBindings.size());
 		dispatch.numGroupsX = numGroupsX;
 		dispatch.numGroupsY = numGroupsY;
 		dispatch.numGroupsZ = numGroupsZ;
 
-		m_commands.emplace_back(std::move(dispatch));
+		if (bindingSize > 0)
+			std::memcpy(GetTrailingData(dispatch), shaderBindings.data(), bindingSize);
 	}
 
 	inline void OpenGLCommandBuffer::Draw(UInt32 vertexCount, UInt32 instanceCount, UInt32 firstVertex, UInt32 firstInstance)
@@ -167,15 +180,13 @@ namespace Nz
 		if (!m_currentDrawStates.pipeline)
 			throw std::runtime_error("no pipeline bound");
 
-		DrawCommand draw;
-		draw.bindings = m_currentGraphicsShaderBindings;
-		draw.states = m_currentDrawStates;
+		RecordDrawStates();
+
+		DrawCommand& draw = AppendCommand<DrawCommand>();
 		draw.firstInstance = firstInstance;
 		draw.firstVertex = firstVertex;
 		draw.instanceCount = instanceCount;
 		draw.vertexCount = vertexCount;
-
-		m_commands.emplace_back(std::move(draw));
 	}
 
 	inline void OpenGLCommandBuffer::DrawIndexed(UInt32 indexCount, UInt32 instanceCount, UInt32 firstIndex, UInt32 vertexOffset, UInt32 firstInstance)
@@ -183,30 +194,60 @@ namespace Nz
 		if (!m_currentDrawStates.pipeline)
 			throw std::runtime_error("no pipeline bound");
 
-		DrawIndexedCommand draw;
-		draw.bindings = m_currentGraphicsShaderBindings;
-		draw.states = m_currentDrawStates;
+		RecordDrawStates();
+
+		DrawIndexedCommand& draw = AppendCommand<DrawIndexedCommand>();
 		draw.firstIndex = firstIndex;
 		draw.firstInstance = firstInstance;
 		draw.indexCount = indexCount;
 		draw.instanceCount = instanceCount;
 		draw.baseVertex = vertexOffset;
+	}
+
+	inline void OpenGLCommandBuffer::DrawIndexedIndirect(GLuint indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride, GLuint countBuffer, UInt64 countOffset)
+	{
+		if (!m_currentDrawStates.pipeline)
+			throw std::runtime_error("no pipeline bound");
+
+		// Indirect commands are relative to the start of the index buffer, its offset cannot be applied on their first index
+		if (m_currentDrawStates.indexBufferOffset != 0)
+			throw std::runtime_error("indirect indexed draws don't support index buffer offsets");
+
+		RecordDrawStates();
+
+		DrawIndexedIndirectCommand& draw = AppendCommand<DrawIndexedIndirectCommand>();
+		draw.countBuffer = countBuffer;
+		draw.countOffset = countOffset;
+		draw.drawCount = drawCount;
+		draw.indirectBuffer = indirectBuffer;
+		draw.offset = offset;
+		draw.stride = stride;
+	}
+
+	inline void OpenGLCommandBuffer::DrawIndirect(GLuint indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride, GLuint countBuffer, UInt64 countOffset)
+	{
+		if (!m_currentDrawStates.pipeline)
+			throw std::runtime_error("no pipeline bound");
+
+		RecordDrawStates();
 
-		m_commands.emplace_back(std::move(draw));
+		DrawIndirectCommand& draw = AppendCommand<DrawIndirectCommand>();
+		draw.countBuffer = countBuffer;
+		draw.countOffset = countOffset;
+		draw.drawCount = drawCount;
+		draw.indirectBuffer = indirectBuffer;
+		draw.offset = offset;
+		draw.stride = stride;
 	}
 
 	inline void OpenGLCommandBuffer::EndDebugRegion()
 	{
-		m_commands.emplace_back(EndDebugRegionCommand{});
+		AppendCommand<EndDebugRegionCommand>();
 	}
 
 	inline void OpenGLCommandBuffer::InsertDebugLabel(std::string_view label, const Color& color)
 	{
-		InsertDebugLabelCommand debugLabelCommand;
-		debugLabelCommand.color = color;
-		debugLabelCommand.label = label;
-
-		m_commands.emplace_back(std::move(debugLabelCommand));
+		AppendDebugCommand(false, label, color);
 	}
 
 	inline std::size_t OpenGLCommandBuffer::GetBindingIndex() const
@@ -228,36 +269,43 @@ namespace Nz
 	inline void OpenGLCommandBuffer::InsertMemoryBarrier(GLbitfield barriers)
 	{
 		// Merge with previous barrier, if any (may happen because memory barriers are not relative to a texture with OpenGL)
-		if (!m_commands.empty() && std::holds_alternative<MemoryBarrier>(m_commands.back()))
+		if (m_lastCommandOffset != MaxValue())
 		{
-			MemoryBarrier& memBarrier = std::get<MemoryBarrier>(m_commands.back());
-			memBarrier.barriers |= barriers;
+			UInt8* lastCommandPtr = &m_commandStream[m_lastCommandOffset];
+			if (reinterpret_cast<const CommandHeader*>(lastCommandPtr)->type == TypeListFind<CommandList, MemoryBarrier>)
+			{
+				MemoryBarrier* memBarrier = std::launder(reinterpret_cast<MemoryBarrier*>(lastCommandPtr + sizeof(CommandHeader)));
+				memBarrier->barriers |= barriers;
+				return;
+			}
 		}
-		else
-		{
-			MemoryBarrier memBarrier;
-			memBarrier.barriers = barriers;
 
-			m_commands.emplace_back(std::move(memBarrier));
-		}
+		AppendCommand<MemoryBarrier>().barriers = barriers;
 	}
 
 	inline void OpenGLCommandBuffer::SetFramebuffer(const OpenGLFramebuffer& framebuffer, const OpenGLRenderPass& renderPass, const CommandBufferBuilder::ClearValues* clearValues, std::size_t clearValueCount)
 	{
 		m_maxColorBufferCount = std::max(m_maxColorBufferCount, framebuffer.GetColorBufferCount());
 
-		SetFrameBufferCommand setFramebuffer;
+		// Clearing attachments resets some states and window framebuffers have their own context
+		InvalidateRecordedStates();
+
+		SetFrameBufferCommand& setFramebuffer = AppendCommand<SetFrameBufferCommand>();
 		setFramebuffer.framebuffer = &framebuffer;
 		setFramebuffer.renderpass = &renderPass;
 
 		assert(clearValueCount < setFramebuffer.clearValues.size());
 		std::copy(clearValues, clearValues + clearValueCount, setFramebuffer.clearValues.begin());
 
-		m_commands.emplace_back(std::move(setFramebuffer));
-
 		m_currentDrawStates.shouldFlipY = (framebuffer.GetType() == FramebufferType::Window);
 	}
 
+	inline void OpenGLCommandBuffer::InvalidateRecordedStates()
+	{
+		// Makes the next draw record all of its states, for commands changing OpenGL states behind our back
+		m_areRecordedStatesValid = false;
+	}
+
 	inline void OpenGLCommandBuffer::SetScissor(const Recti& scissorRegion)
 	{
 		m_currentDrawStates.scissorRegion = scissorRegion;
@@ -267,4 +315,41 @@ namespace Nz
 	{
 		m_currentDrawStates.viewportRegion = viewportRegion;
 	}
+
+	template<typename T>
+	T& OpenGLCommandBuffer::AppendCommand(std::size_t trailingSize)
+	{
+		static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "commands are stored in raw memory");
+		static_assert(alignof(T) <= CommandAlignment);
+		static_assert(sizeof(CommandHeader) % CommandAlignment == 0);
+
+		std::size_t commandSize = sizeof(CommandHeader) + AlignPow2(sizeof(T), CommandAlignment) + AlignPow2(trailingSize, CommandAlignment);
+
+		m_lastCommandOffset = m_commandStream.size();
+		m_commandStream.resize(m_lastCommandOffset + commandSize);
+
+		UInt8* commandPtr = &m_commandStream[m_lastCommandOffset];
+		PlacementNew(reinterpret_cast<CommandHeader*>(commandPtr), CommandHeader{ UInt32(TypeListFind<CommandList, T>), SafeCast<UInt32>(commandSize) });
+
+		return *PlacementNew(reinterpret_cast<T*>(commandPtr + sizeof(CommandHeader)));
+	}
+
+	template<typename T>
+	const T& OpenGLCommandBuffer::GetCommand(const CommandHeader& header)
+	{
+		assert(header.type == TypeListFind<CommandList, T>);
+		return *std::launder(reinterpret_cast<const T*>(reinterpret_cast<const UInt8*>(&header) + sizeof(CommandHeader)));
+	}
+
+	template<typename T>
+	const UInt8* OpenGLCommandBuffer::GetTrailingData(const T& command)
+	{
+		return reinterpret_cast<const UInt8*>(&command) + AlignPow2(sizeof(T), CommandAlignment);
+	}
+
+	template<typename T>
+	UInt8* OpenGLCommandBuffer::GetTrailingData(T& command)
+	{
+		return reinterpret_cast<UInt8*>(&command) + AlignPow2(sizeof(T), CommandAlignment);
+	}
 }
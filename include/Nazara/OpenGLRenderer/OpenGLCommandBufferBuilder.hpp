@@ -49,6 +49,10 @@ namespace Nz
 
 			void Draw(UInt32 vertexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0) override;
 			void DrawIndexed(UInt32 indexCount, UInt32 instanceCount = 1, UInt32 firstIndex = 0, UInt32 vertexOffset = 0, UInt32 firstInstance = 0) override;
+			void DrawIndexedIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride = sizeof(DrawIndexedIndirectCommand)) override;
+			void DrawIndexedIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride = sizeof(DrawIndexedIndirectCommand)) override;
+			void DrawIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride = sizeof(DrawIndirectCommand)) override;
+			void DrawIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride = sizeof(DrawIndirectCommand)) override;
 
 			void EndDebugRegion() override;
 			void EndRenderPass() override;
@@ -22,6 +22,7 @@ namespace Nz::GL
 		struct Attribs
 		{
 			GLuint vertexBuffer;
+			GLuint divisor;
 			GLint size;
 			GLenum type;
 			GLboolean normalized;
@@ -24,6 +24,9 @@ namespace Nz::GL
 				if (lAttrib.vertexBuffer != rAttrib.vertexBuffer)
 					return false;
 
+				if (lAttrib.divisor != rAttrib.divisor)
+					return false;
+
 				if (lAttrib.size != rAttrib.size)
 					return false;
 
@@ -60,6 +63,7 @@ namespace Nz::GL
 
 				HashCombine(seed, bindingIndex);
 				HashCombine(seed, attrib.vertexBuffer);
+				HashCombine(seed, attrib.divisor);
 				HashCombine(seed, attrib.size);
 				HashCombine(seed, attrib.type);
 				HashCombine(seed, attrib.normalized);
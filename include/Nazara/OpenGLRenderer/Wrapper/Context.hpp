@@ -38,7 +38,9 @@ namespace Nz::GL
 		Array,
 		CopyRead,
 		CopyWrite,
+		DrawIndirect,
 		ElementArray,
+		Parameter,
 		PixelPack,
 		PixelUnpack,
 		Storage,
@@ -56,6 +58,7 @@ namespace Nz::GL
 
 	enum class Extension
 	{
+		BaseInstance,
 		ClipControl,
 		ComputeShader,
 		DebugOutput,
@@ -178,6 +178,10 @@ NAZARA_OPENGLRENDERER_GL_FUNCTION(100, glPolygonMode, PFNGLPOLYGONMODEPROC)
 // OpenGL 3.2 - OpenGL ES 3.2
 NAZARA_OPENGLRENDERER_GL_GLES_FUNCTION(320, 320, glDrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)
 
+// OpenGL 4.0 - OpenGL ES 3.1
+NAZARA_OPENGLRENDERER_GL_GLES_FUNCTION(400, 310, glDrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC)
+NAZARA_OPENGLRENDERER_GL_GLES_FUNCTION(400, 310, glDrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC)
+
 // OpenGL 4.1 - GL_EXT_vertex_attrib_64bit
 NAZARA_OPENGLRENDERER_GL_FUNCTION(410, glVertexAttribLPointer, PFNGLVERTEXATTRIBLPOINTERPROC)
 
@@ -202,12 +206,20 @@ NAZARA_OPENGLRENDERER_GL_GLES_FUNCTION(430, 320, glObjectLabel, PFNGLOBJECTLABEL
 NAZARA_OPENGLRENDERER_GL_GLES_FUNCTION(430, 320, glPopDebugGroup, PFNGLPOPDEBUGGROUPPROC)
 NAZARA_OPENGLRENDERER_GL_GLES_FUNCTION(430, 320, glPushDebugGroup, PFNGLPUSHDEBUGGROUPPROC)
 
+// OpenGL 4.3 - GL_ARB_multi_draw_indirect/GL_EXT_multi_draw_indirect
+NAZARA_OPENGLRENDERER_GL_FUNCTION(430, glMultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC)
+NAZARA_OPENGLRENDERER_GL_FUNCTION(430, glMultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC)
+
 // OpenGL 4.3 - GL_ARB_texture_view
 NAZARA_OPENGLRENDERER_GL_FUNCTION(430, glTextureView, PFNGLTEXTUREVIEWPROC)
 
 // OpenGL 4.5 - GL_ARB_clip_control/GL_EXT_clip_control
 NAZARA_OPENGLRENDERER_GL_FUNCTION(450, glClipControl, PFNGLCLIPCONTROLPROC)
 
+// OpenGL 4.6 - GL_ARB_indirect_parameters
+NAZARA_OPENGLRENDERER_GL_FUNCTION(460, glMultiDrawArraysIndirectCount, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)
+NAZARA_OPENGLRENDERER_GL_FUNCTION(460, glMultiDrawElementsIndirectCount, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)
+
 // OpenGL 4.6 - GL_ARB_spirv_extensions
 NAZARA_OPENGLRENDERER_GL_FUNCTION(460, glSpecializeShader, PFNGLSPECIALIZESHADERPROC)
 
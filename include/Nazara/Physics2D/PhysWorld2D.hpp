@@ -8,6 +8,7 @@
 #define NAZARA_PHYSICS2D_PHYSWORLD2D_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Color.hpp>
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Math/Angle.hpp>
@@ -50,8 +51,10 @@ namespace Nz
 			struct DebugDrawOptions;
 			struct NearestQueryResult;
 			struct RaycastHit;
+			struct Settings;
 
 			PhysWorld2D();
+			PhysWorld2D(const Settings& settings);
 			PhysWorld2D(const PhysWorld2D&) = delete;
 			PhysWorld2D(PhysWorld2D&&) = delete;
 			~PhysWorld2D();
@@ -64,6 +67,9 @@ namespace Nz
 			std::size_t GetIterationCount() const;
 			std::size_t GetMaxStepCount() const;
 			Time GetStepSize() const;
+			unsigned int GetThreadCount() const;
+
+			inline bool IsMultithreaded() const;
 
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, RigidBody2D** nearestBody = nullptr);
 			bool NearestBodyQuery(const Vector2f& from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, NearestQueryResult* result);
@@ -78,12 +84,19 @@ namespace Nz
 			void RegisterCallbacks(unsigned int collisionId, ContactCallbacks callbacks);
 			void RegisterCallbacks(unsigned int collisionIdA, unsigned int collisionIdB, ContactCallbacks callbacks);
 
+			bool RestoreState(const ByteArray& state);
+			bool RestoreState(const ByteArray& stateDelta, const ByteArray& referenceState);
+
+			void SaveState(ByteArray& state);
+			void SaveState(ByteArray& stateDelta, const ByteArray& referenceState);
+
 			void SetDamping(float dampingValue);
 			void SetGravity(const Vector2f& gravity);
 			void SetIterationCount(std::size_t iterationCount);
 			void SetMaxStepCount(std::size_t maxStepCount);
 			void SetSleepTime(Time sleepTime);
 			void SetStepSize(Time stepSize);
+			void SetThreadCount(unsigned int threadCount);
 
 			void Step(Time timestep);
 
@@ -133,6 +146,11 @@ namespace Nz
 				float fraction;
 			};
 
+			struct Settings
+			{
+				unsigned int threadCount = 1; //< more than one enables the multithreaded solver, 0 = as many threads as the solver supports
+			};
+
 			NazaraSignal(OnPhysWorld2DPreStep, const PhysWorld2D* /*physWorld*/, float /*invStepCount*/);
 			NazaraSignal(OnPhysWorld2DPostStep, const PhysWorld2D* /*physWorld*/, float /*invStepCount*/);
 
@@ -153,6 +171,8 @@ namespace Nz
 			std::vector<RigidBody2D*> m_bodies;
 			cpSpace* m_handle;
 			Bitset<UInt64> m_freeBodyIndices;
+			ByteArray m_stateBuffer;
+			bool m_isMultithreaded;
 			Time m_stepSize;
 			Time m_timestepAccumulator;
 	};
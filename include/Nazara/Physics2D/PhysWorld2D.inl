@@ -6,6 +6,11 @@
 
 namespace Nz
 {
+	inline bool PhysWorld2D::IsMultithreaded() const
+	{
+		return m_isMultithreaded;
+	}
+
 	inline UInt32 PhysWorld2D::RegisterBody(RigidBody2D& rigidBody)
 	{
 		std::size_t bodyIndex = m_freeBodyIndices.FindFirst();
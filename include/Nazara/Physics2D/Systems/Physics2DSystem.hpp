@@ -24,14 +24,16 @@ namespace Nz
 		using ContactStartCallback = std::function<bool(PhysWorld2D& world, PhysArbiter2D& arbiter, entt::handle entityA, entt::handle entityB, void* userdata)>;
 
 		public:
+			static constexpr bool AllowConcurrent = false;
 			static constexpr Int64 ExecutionOrder = 0;
 			using Components = TypeList<RigidBody2DComponent, class NodeComponent>;
 
 			struct ContactCallbacks;
 			struct NearestQueryResult;
 			struct RaycastHit;
+			using Settings = PhysWorld2D::Settings;
 
-			Physics2DSystem(entt::registry& registry);
+			Physics2DSystem(entt::registry& registry, const Settings& settings = Settings{});
 			Physics2DSystem(const Physics2DSystem&) = delete;
 			Physics2DSystem(Physics2DSystem&&) = delete;
 			~Physics2DSystem();
@@ -8,8 +8,10 @@
 #define NAZARA_PHYSICS3D_PHYSWORLD3D_HPP
 
 #include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/Time.hpp>
 #include <Nazara/Math/Box.hpp>
+#include <Nazara/Math/Matrix4.hpp>
 #include <Nazara/Math/Vector3.hpp>
 #include <Nazara/Physics3D/Export.hpp>
 #include <Nazara/Physics3D/PhysFilter3D.hpp>
@@ -17,6 +19,7 @@
 #include <NazaraUtils/MovablePtr.hpp>
 #include <atomic>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace JPH
@@ -34,6 +37,7 @@ namespace Nz
 	class PhysCharacter3DImpl;
 	class PhysWorld3DStepListener;
 	class RigidBody3D;
+	class TaskScheduler;
 	struct PhysContact3D;
 	struct PhysContactResponse3D;
 
@@ -43,9 +47,11 @@ namespace Nz
 		friend RigidBody3D;
 
 		public:
+			struct CollisionRequest;
 			struct ContactListener;
 			struct PointCollisionInfo;
 			struct RaycastHit;
+			struct RaycastRequest;
 			struct Settings;
 			struct ShapeCollisionInfo;
 
@@ -54,9 +60,12 @@ namespace Nz
 			PhysWorld3D(PhysWorld3D&& ph) = delete;
 			~PhysWorld3D();
 
+			void CollectSimulatedBodies(std::vector<UInt32>& bodyIndices);
+
 			bool CollisionQuery(const Vector3f& point, const FunctionRef<std::optional<float>(const PointCollisionInfo& collisionInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool CollisionQuery(const Collider3D& collider, const Matrix4f& colliderTransform, const FunctionRef<std::optional<float>(const ShapeCollisionInfo& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool CollisionQuery(const Collider3D& collider, const Matrix4f& colliderTransform, const Vector3f& colliderScale, const FunctionRef<std::optional<float>(const ShapeCollisionInfo& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
+			std::size_t CollisionQuery(std::span<const CollisionRequest> requests, std::span<ShapeCollisionInfo> hits, TaskScheduler* taskScheduler = nullptr, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
 			UInt32 GetActiveBodyCount() const;
 			Boxf GetBoundingBox() const;
@@ -71,11 +80,18 @@ namespace Nz
 
 			bool RaycastQuery(const Vector3f& from, const Vector3f& to, const FunctionRef<std::optional<float>(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool RaycastQueryFirst(const Vector3f& from, const Vector3f& to, const FunctionRef<void(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
+			std::size_t RaycastQueryFirst(std::span<const RaycastRequest> requests, std::span<RaycastHit> hits, TaskScheduler* taskScheduler = nullptr, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
 			void RefreshBodies();
 
 			inline void RegisterStepListener(PhysWorld3DStepListener* stepListener);
 
+			bool RestoreState(const ByteArray& state);
+			bool RestoreState(const ByteArray& stateDelta, const ByteArray& referenceState);
+
+			void SaveState(ByteArray& state);
+			void SaveState(ByteArray& stateDelta, const ByteArray& referenceState);
+
 			void SetContactListener(std::unique_ptr<ContactListener> contactListener);
 			void SetGravity(const Vector3f& gravity);
 			inline void SetMaxStepCount(std::size_t maxStepCount);
@@ -90,6 +106,13 @@ namespace Nz
 
 			static Settings BuildDefaultSettings();
 
+			struct CollisionRequest
+			{
+				const Collider3D* collider;
+				Matrix4f transform;
+				Vector3f scale = Vector3f::Unit();
+			};
+
 			struct ContactListener
 			{
 				virtual ~ContactListener();
@@ -115,6 +138,12 @@ namespace Nz
 				UInt32 subShapeID;
 			};
 
+			struct RaycastRequest
+			{
+				Vector3f from;
+				Vector3f to;
+			};
+
 			struct Settings
 			{
 				std::unique_ptr<PhysBroadphaseLayerInterface3D> broadphaseLayerInterface; //< mandatory
@@ -172,9 +201,12 @@ namespace Nz
 			std::size_t m_maxStepCount;
 			std::shared_ptr<PhysCharacter3DImpl> m_defaultCharacterImpl;
 			std::unique_ptr<std::atomic_uint64_t[]> m_activeBodies;
+			std::unique_ptr<std::atomic_uint64_t[]> m_deactivatedBodies;
 			std::unique_ptr<std::uint64_t[]> m_registeredBodies;
 			std::unique_ptr<JoltWorld> m_world;
+			std::size_t m_bodyBlockCount;
 			std::vector<PhysWorld3DStepListener*> m_stepListeners;
+			ByteArray m_stateBuffer;
 			Time m_stepSize;
 			Time m_timestepAccumulator;
 	};
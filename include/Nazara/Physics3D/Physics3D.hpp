@@ -15,11 +15,12 @@
 namespace JPH
 {
 	class JobSystem;
-	class JobSystemThreadPool;
 }
 
 namespace Nz
 {
+	class TaskScheduler;
+
 	class NAZARA_PHYSICS3D_API Physics3D : public ModuleBase<Physics3D>
 	{
 		friend ModuleBase;
@@ -27,18 +28,28 @@ namespace Nz
 		public:
 			using Dependencies = TypeList<Core>;
 
-			struct Config {};
+			struct Config
+			{
+				// Task scheduler running physics jobs (must outlive the module), Jolt own thread pool is used if none is set
+				TaskScheduler* taskScheduler = nullptr;
+			};
 
-			Physics3D(Config /*config*/);
+			Physics3D(Config config);
 			~Physics3D();
 
-			JPH::JobSystem& GetThreadPool();
+			JPH::JobSystem& GetJobSystem();
+			inline TaskScheduler* GetTaskScheduler() const;
+
+			void SetTaskScheduler(TaskScheduler* taskScheduler);
 
 		private:
-			std::unique_ptr<JPH::JobSystemThreadPool> m_threadPool;
+			std::unique_ptr<JPH::JobSystem> m_jobSystem;
+			TaskScheduler* m_taskScheduler;
 
 			static Physics3D* s_instance;
 	};
 }
 
+#include <Nazara/Physics3D/Physics3D.inl>
+
 #endif // NAZARA_PHYSICS3D_HPP
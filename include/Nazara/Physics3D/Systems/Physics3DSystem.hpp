@@ -15,6 +15,7 @@
 #include <Nazara/Physics3D/Components/RigidBody3DComponent.hpp>
 #include <NazaraUtils/TypeList.hpp>
 #include <entt/entt.hpp>
+#include <span>
 #include <vector>
 
 namespace Nz
@@ -22,6 +23,7 @@ namespace Nz
 	class NAZARA_PHYSICS3D_API Physics3DSystem
 	{
 		public:
+			static constexpr bool AllowConcurrent = false;
 			static constexpr Int64 ExecutionOrder = 0;
 			using Components = TypeList<PhysCharacter3DComponent, RigidBody3DComponent, class NodeComponent>;
 
@@ -29,6 +31,8 @@ namespace Nz
 			struct PointCollisionInfo;
 			struct RaycastHit;
 			struct ShapeCollisionInfo;
+			using CollisionRequest = PhysWorld3D::CollisionRequest;
+			using RaycastRequest = PhysWorld3D::RaycastRequest;
 			using Settings = PhysWorld3D::Settings;
 
 			Physics3DSystem(entt::registry& registry, Settings&& settings = PhysWorld3D::BuildDefaultSettings());
@@ -39,6 +43,7 @@ namespace Nz
 			bool CollisionQuery(const Vector3f& point, const FunctionRef<std::optional<float>(const PointCollisionInfo& collisionInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool CollisionQuery(const Collider3D& collider, const Matrix4f& colliderTransform, const FunctionRef<std::optional<float>(const ShapeCollisionInfo& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool CollisionQuery(const Collider3D& collider, const Matrix4f& colliderTransform, const Vector3f& colliderScale, const FunctionRef<std::optional<float>(const ShapeCollisionInfo& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
+			std::size_t CollisionQuery(std::span<const CollisionRequest> requests, std::span<ShapeCollisionInfo> hits, std::span<PhysWorld3D::ShapeCollisionInfo> scratchHits, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
 			inline PhysWorld3D& GetPhysWorld();
 			inline const PhysWorld3D& GetPhysWorld() const;
@@ -46,6 +51,7 @@ namespace Nz
 
 			bool RaycastQuery(const Vector3f& from, const Vector3f& to, const FunctionRef<std::optional<float>(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 			bool RaycastQueryFirst(const Vector3f& from, const Vector3f& to, const FunctionRef<void(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
+			std::size_t RaycastQueryFirst(std::span<const RaycastRequest> requests, std::span<RaycastHit> hits, std::span<PhysWorld3D::RaycastHit> scratchHits, const PhysBroadphaseLayerFilter3D* broadphaseFilter = nullptr, const PhysObjectLayerFilter3D* objectLayerFilter = nullptr, const PhysBodyFilter3D* bodyFilter = nullptr);
 
 			void SetContactListener(std::unique_ptr<ContactListener> contactListener);
 
@@ -86,10 +92,22 @@ namespace Nz
 			void OnCharacterConstruct(entt::registry& registry, entt::entity entity);
 			void OnCharacterDestruct(entt::registry& registry, entt::entity entity);
 
-			template<typename T> void ReplicateEntities();
+			void ReplicateEntities();
+			template<typename T> void ReplicateEntity(entt::entity entity, T& bodyComponent, NodeComponent& nodeComponent, bool invalidateNode);
+
+			struct ParallelReplication
+			{
+				NodeComponent* nodeComponent;
+				PhysCharacter3DComponent* characterComponent;
+				RigidBody3DComponent* rigidBodyComponent;
+				entt::entity entity;
+			};
 
 			std::size_t m_stepCount;
 			std::vector<entt::entity> m_bodyIndicesToEntity;
+			std::vector<entt::entity> m_serialReplications;
+			std::vector<ParallelReplication> m_parallelReplications;
+			std::vector<UInt32> m_simulatedBodies;
 			entt::registry& m_registry;
 			entt::observer m_characterConstructObserver;
 			entt::observer m_rigidBodyConstructObserver;
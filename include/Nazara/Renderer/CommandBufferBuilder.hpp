@@ -33,6 +33,8 @@ namespace Nz
 	{
 		public:
 			struct ClearValues;
+			struct DrawIndexedIndirectCommand;
+			struct DrawIndirectCommand;
 
 			CommandBufferBuilder() = default;
 			CommandBufferBuilder(const CommandBufferBuilder&) = delete;
@@ -66,6 +68,10 @@ namespace Nz
 
 			virtual void Draw(UInt32 vertexCount, UInt32 instanceCount = 1, UInt32 firstVertex = 0, UInt32 firstInstance = 0) = 0;
 			virtual void DrawIndexed(UInt32 indexCount, UInt32 instanceCount = 1, UInt32 firstIndex = 0, UInt32 vertexOffset = 0, UInt32 firstInstance = 0) = 0;
+			virtual void DrawIndexedIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride = sizeof(DrawIndexedIndirectCommand)) = 0;
+			virtual void DrawIndexedIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride = sizeof(DrawIndexedIndirectCommand)) = 0;
+			virtual void DrawIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride = sizeof(DrawIndirectCommand)) = 0;
+			virtual void DrawIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride = sizeof(DrawIndirectCommand)) = 0;
 
 			virtual void Dispatch(UInt32 workgroupX, UInt32 workgroupY, UInt32 workgroupZ) = 0;
 
@@ -97,6 +103,24 @@ namespace Nz
 				float depth = 1.f;
 				UInt32 stencil = 0;
 			};
+
+			// Layouts of the commands read from indirect buffers, they match VkDrawIndexedIndirectCommand/VkDrawIndirectCommand (and OpenGL ones)
+			struct DrawIndexedIndirectCommand
+			{
+				UInt32 indexCount;
+				UInt32 instanceCount;
+				UInt32 firstIndex;
+				Int32 vertexOffset;
+				UInt32 firstInstance;
+			};
+
+			struct DrawIndirectCommand
+			{
+				UInt32 vertexCount;
+				UInt32 instanceCount;
+				UInt32 firstVertex;
+				UInt32 firstInstance;
+			};
 	};
 }
 
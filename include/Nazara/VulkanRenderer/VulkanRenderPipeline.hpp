@@ -14,6 +14,7 @@
 #include <Nazara/VulkanRenderer/Wrapper/Device.hpp>
 #include <Nazara/VulkanRenderer/Wrapper/Pipeline.hpp>
 #include <NazaraUtils/MovablePtr.hpp>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -96,6 +97,7 @@ namespace Nz
 			};
 
 			std::string m_debugName;
+			mutable std::mutex m_pipelineMutex; //< Get can be called concurrently by passes recorded on multiple threads
 			mutable std::unordered_map<std::pair<VkRenderPass, std::size_t>, PipelineData, PipelineHasher> m_pipelines;
 			MovablePtr<Vk::Device> m_device;
 			mutable CreateInfo m_pipelineCreateInfo;
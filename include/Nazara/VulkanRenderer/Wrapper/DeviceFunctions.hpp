@@ -160,6 +160,11 @@ NAZARA_VULKANRENDERER_DEVICE_EXT_BEGIN(VK_KHR_display_swapchain)
 	NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkCreateSharedSwapchainsKHR)
 NAZARA_VULKANRENDERER_DEVICE_EXT_END()
 
+NAZARA_VULKANRENDERER_DEVICE_EXT_BEGIN(VK_KHR_draw_indirect_count)
+	NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkCmdDrawIndexedIndirectCountKHR)
+	NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkCmdDrawIndirectCountKHR)
+NAZARA_VULKANRENDERER_DEVICE_EXT_END()
+
 NAZARA_VULKANRENDERER_DEVICE_EXT_BEGIN(VK_KHR_surface)
 	NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkDestroySurfaceKHR)
 	NAZARA_VULKANRENDERER_DEVICE_FUNCTION(vkGetPhysicalDeviceSurfaceCapabilitiesKHR)
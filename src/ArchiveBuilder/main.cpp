@@ -0,0 +1,54 @@
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/CommandLineParameters.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/StringExt.hpp>
+#include <NazaraUtils/PathUtils.hpp>
+#include <bit>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+int main(int argc, char* argv[])
+{
+	Nz::CommandLineParameters params = Nz::CommandLineParameters::Parse(argc, argv);
+
+	std::string_view inputPath;
+	std::string_view outputPath;
+	if (params.HasFlag("help") || !params.GetParameter("input", &inputPath) || !params.GetParameter("output", &outputPath))
+	{
+		std::cout << "Packs every file of a directory in an archive readable by Nz::VirtualDirectoryArchiveResolver\n\n";
+		std::cout << "Usage: NazaraArchiveBuilder --input=<directory> --output=<archive> [--compress] [--alignment=<bytes>]\n";
+		std::cout << "  --compress          compress files using LZ4 (files are only stored compressed if it makes them smaller)\n";
+		std::cout << "  --alignment=<bytes> alignment of file data in the archive, must be a power of two (default: " << Nz::ArchiveBuilder::DefaultAlignment << ")\n";
+		return params.HasFlag("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	Nz::Modules<Nz::Core> nazara;
+
+	Nz::ArchiveBuilder builder;
+
+	std::string_view alignmentStr;
+	if (params.GetParameter("alignment", &alignmentStr))
+	{
+		bool ok;
+		long long alignment = Nz::StringToNumber(alignmentStr, 10, &ok);
+		if (!ok || alignment <= 0 || alignment > std::numeric_limits<Nz::UInt32>::max() || !std::has_single_bit(static_cast<Nz::UInt32>(alignment)))
+		{
+			std::cerr << "invalid alignment " << alignmentStr << " (must be a power of two)\n";
+			return EXIT_FAILURE;
+		}
+
+		builder.SetAlignment(static_cast<Nz::UInt32>(alignment));
+	}
+
+	Nz::ArchiveCompression compression = (params.HasFlag("compress")) ? Nz::ArchiveCompression::LZ4 : Nz::ArchiveCompression::None;
+	if (!builder.AddDirectory(Nz::Utf8Path(inputPath), compression))
+		return EXIT_FAILURE;
+
+	if (!builder.Save(Nz::Utf8Path(outputPath)))
+		return EXIT_FAILURE;
+
+	std::cout << "packed " << builder.GetFileCount() << " file(s) into " << outputPath << "\n";
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,308 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/Formats/ArchiveConstants.hpp>
+#include <NazaraUtils/PathUtils.hpp>
+#include <lz4.h>
+#include <lz4hc.h>
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <map>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		std::string NormalizePath(std::string path)
+		{
+			std::replace(path.begin(), path.end(), '\\', '/');
+
+			std::size_t first = path.find_first_not_of("/");
+			if (first == std::string::npos)
+				return {};
+
+			std::size_t last = path.find_last_not_of("/");
+			return path.substr(first, last - first + 1);
+		}
+
+		std::string_view GetParentPath(std::string_view path)
+		{
+			std::size_t separator = path.find_last_of('/');
+			if (separator == std::string_view::npos)
+				return {};
+
+			return path.substr(0, separator);
+		}
+
+		UInt64 AlignOffset(UInt64 offset, UInt64 alignment)
+		{
+			return (offset + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \class Nz::ArchiveBuilder
+	* \brief Core class that builds archives readable by VirtualDirectoryArchiveResolver
+	*/
+
+	/*!
+	* \brief Adds every file of a directory (recursively) to the archive
+	* \return True if the directory was successfully traversed
+	*
+	* \param directoryPath Directory whose content will be at the root of the archive
+	* \param compression Compression to apply to the files
+	*
+	* \remark Files are only read when saving the archive
+	*/
+	bool ArchiveBuilder::AddDirectory(const std::filesystem::path& directoryPath, ArchiveCompression compression)
+	{
+		std::error_code ec;
+		std::filesystem::recursive_directory_iterator it(directoryPath, ec);
+		if (ec)
+		{
+			NazaraError("failed to open directory {0}: {1}", directoryPath, ec.message());
+			return false;
+		}
+
+		for (const std::filesystem::directory_entry& entry : it)
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			AddFile(PathToString(entry.path().lexically_relative(directoryPath)), entry.path(), compression);
+		}
+
+		return true;
+	}
+
+	void ArchiveBuilder::AddFile(std::string path, ByteArray content, ArchiveCompression compression)
+	{
+		m_files.push_back({ std::move(path), std::move(content), compression });
+	}
+
+	void ArchiveBuilder::AddFile(std::string path, std::filesystem::path filePath, ArchiveCompression compression)
+	{
+		m_files.push_back({ std::move(path), std::move(filePath), compression });
+	}
+
+	/*!
+	* \brief Writes the archive to a file
+	* \return True if the archive was successfully written
+	*
+	* Directories are deduced from file paths. Compressed files are stored uncompressed if compression doesn't make them smaller.
+	*
+	* \param archivePath Path of the archive to write
+	*/
+	bool ArchiveBuilder::Save(const std::filesystem::path& archivePath) const
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		struct EntryInfo
+		{
+			ArchiveEntryType type;
+			const PendingFile* file = nullptr;
+			std::vector<UInt32> children;
+			UInt32 index;
+		};
+
+		// Sorted map so that entries (and thus children lists) are ordered by path
+		std::map<std::string, EntryInfo, std::less<>> entries;
+		for (const PendingFile& file : m_files)
+		{
+			std::string path = NormalizePath(file.path);
+			if (path.empty())
+			{
+				NazaraError("invalid archive path \"{0}\"", file.path);
+				return false;
+			}
+
+			if (path.size() > std::numeric_limits<UInt16>::max())
+			{
+				NazaraError("archive path \"{0}\" is too long", path);
+				return false;
+			}
+
+			if (auto it = entries.find(path); it != entries.end())
+			{
+				if (it->second.type == ArchiveEntryType::Directory)
+					NazaraError("\"{0}\" is both a file and a directory", path);
+				else
+					NazaraError("\"{0}\" is present twice in the archive", path);
+
+				return false;
+			}
+
+			for (std::string_view parent = GetParentPath(path); !parent.empty(); parent = GetParentPath(parent))
+			{
+				auto parentIt = entries.find(parent);
+				if (parentIt == entries.end())
+					entries.emplace(std::string(parent), EntryInfo{ ArchiveEntryType::Directory });
+				else if (parentIt->second.type != ArchiveEntryType::Directory)
+				{
+					NazaraError("\"{0}\" is both a file and a directory", parent);
+					return false;
+				}
+			}
+
+			entries.emplace(std::move(path), EntryInfo{ ArchiveEntryType::File, &file });
+		}
+
+		UInt32 entryIndex = 0;
+		for (auto& [path, entry] : entries)
+			entry.index = entryIndex++;
+
+		std::vector<UInt32> rootChildren;
+		for (auto& [path, entry] : entries)
+		{
+			std::string_view parent = GetParentPath(path);
+			if (parent.empty())
+				rootChildren.push_back(entry.index);
+			else
+				entries.find(parent)->second.children.push_back(entry.index);
+		}
+
+		// Build tables
+		ArchiveHeader header = {};
+		header.magic = Archive_Magic;
+		header.version = Archive_Version;
+		header.entryCount = SafeCast<UInt32>(entries.size());
+		header.bucketCount = std::bit_ceil(std::max<UInt32>(header.entryCount * 2, 1));
+		header.alignment = m_alignment;
+
+		std::vector<ArchiveEntry> entryTable(entries.size());
+		std::vector<UInt32> bucketTable(header.bucketCount, 0);
+		std::vector<UInt32> childrenTable = std::move(rootChildren);
+		std::string stringTable;
+
+		header.rootChildOffset = 0;
+		header.rootChildCount = SafeCast<UInt32>(childrenTable.size());
+
+		for (auto& [path, entry] : entries)
+		{
+			ArchiveEntry& archiveEntry = entryTable[entry.index];
+			archiveEntry.pathHash = ArchivePathHash(path);
+			archiveEntry.pathOffset = SafeCast<UInt32>(stringTable.size());
+			archiveEntry.pathLength = SafeCast<UInt16>(path.size());
+			archiveEntry.type = entry.type;
+			archiveEntry.compression = SafeCast<UInt8>(ArchiveCompression::None);
+
+			stringTable += path;
+
+			if (entry.type == ArchiveEntryType::Directory)
+			{
+				archiveEntry.dataOffset = childrenTable.size();
+				archiveEntry.size = entry.children.size();
+				childrenTable.insert(childrenTable.end(), entry.children.begin(), entry.children.end());
+			}
+
+			std::size_t bucketIndex = archiveEntry.pathHash & (header.bucketCount - 1);
+			while (bucketTable[bucketIndex] != 0)
+				bucketIndex = (bucketIndex + 1) & (header.bucketCount - 1);
+
+			bucketTable[bucketIndex] = entry.index + 1;
+		}
+
+		header.childCount = SafeCast<UInt32>(childrenTable.size());
+		header.entryTableOffset = sizeof(ArchiveHeader);
+		header.bucketTableOffset = header.entryTableOffset + entryTable.size() * sizeof(ArchiveEntry);
+		header.childrenTableOffset = header.bucketTableOffset + bucketTable.size() * sizeof(UInt32);
+		header.stringTableOffset = header.childrenTableOffset + childrenTable.size() * sizeof(UInt32);
+		header.stringTableSize = stringTable.size();
+
+		File archive(archivePath);
+		if (!archive.Open(OpenMode::Write | OpenMode::Truncate | OpenMode::Unbuffered))
+		{
+			NazaraError("failed to open {0}", archivePath);
+			return false;
+		}
+
+		// File data comes after the tables, which are written last once data offsets are known
+		UInt64 dataOffset = header.stringTableOffset + header.stringTableSize;
+
+		std::vector<UInt8> padding(m_alignment, 0);
+		std::vector<UInt8> compressedData;
+		for (auto& [path, entry] : entries)
+		{
+			if (entry.type != ArchiveEntryType::File)
+				continue;
+
+			ByteArray content;
+			if (const ByteArray* data = std::get_if<ByteArray>(&entry.file->content))
+				content = *data;
+			else
+			{
+				const std::filesystem::path& filePath = std::get<std::filesystem::path>(entry.file->content);
+
+				std::optional<std::vector<UInt8>> fileContent = File::ReadWhole(filePath);
+				if (!fileContent)
+				{
+					NazaraError("failed to read {0}", filePath);
+					return false;
+				}
+
+				content = ByteArray(std::move(*fileContent));
+			}
+
+			ArchiveEntry& archiveEntry = entryTable[entry.index];
+			archiveEntry.size = content.GetSize();
+
+			const void* storedData = content.GetConstBuffer();
+			UInt64 storedSize = content.GetSize();
+			if (entry.file->compression == ArchiveCompression::LZ4 && content.GetSize() > 0 && content.GetSize() <= LZ4_MAX_INPUT_SIZE)
+			{
+				int inputSize = static_cast<int>(content.GetSize());
+				compressedData.resize(LZ4_compressBound(inputSize));
+
+				int compressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(content.GetConstBuffer()), reinterpret_cast<char*>(compressedData.data()), inputSize, static_cast<int>(compressedData.size()), LZ4HC_CLEVEL_DEFAULT);
+				if (compressedSize > 0 && static_cast<UInt64>(compressedSize) < content.GetSize())
+				{
+					storedData = compressedData.data();
+					storedSize = static_cast<UInt64>(compressedSize);
+					archiveEntry.compression = SafeCast<UInt8>(ArchiveCompression::LZ4);
+				}
+			}
+
+			UInt64 alignedOffset = AlignOffset(dataOffset, m_alignment);
+			if (!archive.SetCursorPos(dataOffset) || archive.Write(padding.data(), alignedOffset - dataOffset) != alignedOffset - dataOffset)
+			{
+				NazaraError("failed to write archive");
+				return false;
+			}
+
+			if (storedSize > 0 && archive.Write(storedData, storedSize) != storedSize)
+			{
+				NazaraError("failed to write archive");
+				return false;
+			}
+
+			archiveEntry.dataOffset = alignedOffset;
+			archiveEntry.storedSize = storedSize;
+
+			dataOffset = alignedOffset + storedSize;
+		}
+
+		auto WriteTable = [&](const void* data, std::size_t size)
+		{
+			return size == 0 || archive.Write(data, size) == size;
+		};
+
+		if (!archive.SetCursorPos(0) ||
+		    !WriteTable(&header, sizeof(header)) ||
+		    !WriteTable(entryTable.data(), entryTable.size() * sizeof(ArchiveEntry)) ||
+		    !WriteTable(bucketTable.data(), bucketTable.size() * sizeof(UInt32)) ||
+		    !WriteTable(childrenTable.data(), childrenTable.size() * sizeof(UInt32)) ||
+		    !WriteTable(stringTable.data(), stringTable.size()))
+		{
+			NazaraError("failed to write archive");
+			return false;
+		}
+
+		return true;
+	}
+}
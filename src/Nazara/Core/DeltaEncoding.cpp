@@ -0,0 +1,197 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/DeltaEncoding.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Unchanged runs shorter than this are cheaper to store as literals than to split the literal run
+		constexpr std::size_t MinCopyLength = 4;
+
+		void WriteVarInt(ByteArray& output, UInt64 value)
+		{
+			while (value >= 0x80)
+			{
+				output.PushBack(static_cast<UInt8>(value | 0x80));
+				value >>= 7;
+			}
+
+			output.PushBack(static_cast<UInt8>(value));
+		}
+
+		bool ReadVarInt(const UInt8*& ptr, const UInt8* end, UInt64& value)
+		{
+			value = 0;
+			for (unsigned int shift = 0; shift < 64; shift += 7)
+			{
+				if (ptr == end)
+					return false;
+
+				UInt8 byte = *ptr++;
+				value |= UInt64(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+					return true;
+			}
+
+			return false;
+		}
+
+		std::size_t CountEqualBytes(const UInt8* lhs, const UInt8* rhs, std::size_t maxLength)
+		{
+			std::size_t length = 0;
+			while (length + sizeof(UInt64) <= maxLength)
+			{
+				UInt64 lhsWord, rhsWord;
+				std::memcpy(&lhsWord, lhs + length, sizeof(UInt64));
+				std::memcpy(&rhsWord, rhs + length, sizeof(UInt64));
+				if (lhsWord != rhsWord)
+					break;
+
+				length += sizeof(UInt64);
+			}
+
+			while (length < maxLength && lhs[length] == rhs[length])
+				length++;
+
+			return length;
+		}
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Rebuilds data from a reference and a delta computed by ComputeDelta
+	* \return True if the delta could be applied
+	*
+	* \param reference Reference the delta was computed against
+	* \param delta Delta to apply
+	* \param data Output data
+	*
+	* \see ComputeDelta
+	*/
+	bool ApplyDelta(const ByteArray& reference, const ByteArray& delta, ByteArray& data)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		const UInt8* ptr = delta.GetConstBuffer();
+		const UInt8* end = ptr + delta.GetSize();
+
+		UInt64 dataSize;
+		if (!ReadVarInt(ptr, end, dataSize))
+		{
+			NazaraError("invalid delta: failed to read data size");
+			return false;
+		}
+
+		// Every byte of data comes either from the reference or from the delta
+		if (dataSize > reference.GetSize() + delta.GetSize())
+		{
+			NazaraError("invalid delta: data size is too big ({0})", dataSize);
+			return false;
+		}
+
+		data.Resize(dataSize);
+
+		std::size_t copyableSize = std::min<std::size_t>(reference.GetSize(), dataSize);
+
+		std::size_t offset = 0;
+		while (offset < dataSize)
+		{
+			UInt64 copyLength;
+			UInt64 literalLength;
+			if (!ReadVarInt(ptr, end, copyLength) || !ReadVarInt(ptr, end, literalLength))
+			{
+				NazaraError("invalid delta: unexpected end of data");
+				return false;
+			}
+
+			if (copyLength > copyableSize - std::min(offset, copyableSize) || literalLength > dataSize - offset - copyLength || literalLength > UInt64(end - ptr))
+			{
+				NazaraError("invalid delta: run out of bounds at offset {0}", offset);
+				return false;
+			}
+
+			if (copyLength == 0 && literalLength == 0)
+			{
+				NazaraError("invalid delta: empty run at offset {0}", offset);
+				return false;
+			}
+
+			std::memcpy(data.GetBuffer() + offset, reference.GetConstBuffer() + offset, copyLength);
+			offset += copyLength;
+
+			std::memcpy(data.GetBuffer() + offset, ptr, literalLength);
+			offset += literalLength;
+			ptr += literalLength;
+		}
+
+		if (ptr != end)
+		{
+			NazaraError("invalid delta: {0} trailing bytes", end - ptr);
+			return false;
+		}
+
+		return true;
+	}
+
+	/*!
+	* \ingroup core
+	* \brief Computes a compact delta of data against a reference
+	*
+	* The delta stores the bytes of data which differ from the reference at the same offset, which makes it well suited for successive snapshots of the same state (where most bytes stay the same between snapshots).
+	*
+	* \param reference Reference data (may be of a different size than data)
+	* \param data Data to encode
+	* \param delta Output delta (cleared before use)
+	*
+	* \see ApplyDelta
+	*/
+	void ComputeDelta(const ByteArray& reference, const ByteArray& data, ByteArray& delta)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		delta.Clear(true);
+		WriteVarInt(delta, data.GetSize());
+
+		const UInt8* referencePtr = reference.GetConstBuffer();
+		const UInt8* dataPtr = data.GetConstBuffer();
+
+		std::size_t dataSize = data.GetSize();
+		std::size_t commonSize = std::min(reference.GetSize(), dataSize);
+
+		std::size_t offset = 0;
+		while (offset < dataSize)
+		{
+			std::size_t copyLength = (offset < commonSize) ? CountEqualBytes(referencePtr + offset, dataPtr + offset, commonSize - offset) : 0;
+			offset += copyLength;
+
+			// Literal run goes on until a long enough unchanged run is found
+			std::size_t literalStart = offset;
+			while (offset < dataSize)
+			{
+				if (offset < commonSize && referencePtr[offset] == dataPtr[offset])
+				{
+					std::size_t equalLength = CountEqualBytes(referencePtr + offset, dataPtr + offset, std::min(commonSize - offset, MinCopyLength));
+					if (equalLength >= MinCopyLength || offset + equalLength == dataSize)
+						break;
+
+					offset += equalLength;
+				}
+				else
+					offset++;
+			}
+
+			std::size_t literalLength = offset - literalStart;
+
+			WriteVarInt(delta, copyLength);
+			WriteVarInt(delta, literalLength);
+			delta.Append(dataPtr + literalStart, literalLength);
+		}
+	}
+}
@@ -3,11 +3,49 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/EnttSystemGraph.hpp>
+#include <Nazara/Core/Format.hpp>
+#include <algorithm>
+#include <limits>
 
 namespace Nz
 {
 	EnttSystemGraph::NodeBase::~NodeBase() = default;
 
+	bool EnttSystemGraph::NodeBase::ConflictsWith(const NodeBase& node) const
+	{
+		if (!allowConcurrent || !node.allowConcurrent)
+			return true;
+
+		auto Contains = [](const std::vector<entt::id_type>& components, entt::id_type component)
+		{
+			return std::find(components.begin(), components.end(), component) != components.end();
+		};
+
+		// Two systems conflict as soon as one of them writes a component the other accesses
+		for (entt::id_type component : writeComponents)
+		{
+			if (Contains(node.writeComponents, component) || Contains(node.readComponents, component))
+				return true;
+		}
+
+		for (entt::id_type component : readComponents)
+		{
+			if (Contains(node.writeComponents, component))
+				return true;
+		}
+
+		return false;
+	}
+
+	std::string EnttSystemGraph::ReportTimings() const
+	{
+		std::string report = Format("{0} systems, critical path: {1}us (* marks systems on the critical path)\n", m_systemTimings.size(), m_criticalPathTime.AsMicroseconds());
+		for (const SystemTiming& systemTiming : m_systemTimings)
+			report += Format("{0} {1}: {2}us (started at {3}us){4}\n", (systemTiming.isOnCriticalPath) ? '*' : ' ', systemTiming.systemName, systemTiming.duration.AsMicroseconds(), systemTiming.startTime.AsMicroseconds(), (systemTiming.isParallel) ? "" : " [sequential]");
+
+		return report;
+	}
+
 	void EnttSystemGraph::Update()
 	{
 		return Update(m_clock.Restart());
@@ -17,23 +55,167 @@ namespace Nz
 	{
 		if (!m_systemOrderUpdated)
 		{
-			m_orderedNodes.clear();
-			m_orderedNodes.reserve(m_nodes.size());
-			for (auto& nodePtr : m_nodes)
+			BuildExecutionGraph();
+			m_systemOrderUpdated = true;
+		}
+
+		Time updateStartTime = GetElapsedNanoseconds();
+
+		// First update after a change runs sequentially, as entt storages are created lazily (on first access) which isn't thread-safe
+		if (!m_taskScheduler || !m_warmedUp)
+		{
+			for (std::size_t i = 0; i < m_orderedNodes.size(); ++i)
 			{
-				if (nodePtr->HasUpdate())
-					m_orderedNodes.emplace_back(nodePtr.get());
+				RunNode(i, elapsedTime, updateStartTime);
+				m_systemTimings[i].isParallel = false;
 			}
 
-			std::sort(m_orderedNodes.begin(), m_orderedNodes.end(), [](const NodeBase* a, const NodeBase* b)
+			m_warmedUp = true;
+		}
+		else
+		{
+			std::size_t batchStart = 0;
+			for (std::size_t i = 1; i <= m_orderedNodes.size(); ++i)
 			{
-				return a->executionOrder < b->executionOrder;
-			});
+				if (i == m_orderedNodes.size() || m_orderedNodes[i].batchIndex != m_orderedNodes[batchStart].batchIndex)
+				{
+					UpdateBatch(batchStart, i, elapsedTime, updateStartTime);
+					batchStart = i;
+				}
+			}
+		}
 
-			m_systemOrderUpdated = true;
+		ComputeCriticalPath();
+	}
+
+	void EnttSystemGraph::BuildExecutionGraph()
+	{
+		m_orderedNodes.clear();
+		m_orderedNodes.reserve(m_nodes.size());
+		for (auto& nodePtr : m_nodes)
+		{
+			if (nodePtr->HasUpdate())
+				m_orderedNodes.push_back({ nodePtr.get(), {}, 0 });
+		}
+
+		std::stable_sort(m_orderedNodes.begin(), m_orderedNodes.end(), [](const ExecutionNode& a, const ExecutionNode& b)
+		{
+			return a.node->executionOrder < b.node->executionOrder;
+		});
+
+		// Systems which can't run concurrently split the graph into batches, a batch being either a single sequential system or a set of concurrent systems
+		std::size_t batchIndex = 0;
+		for (std::size_t i = 0; i < m_orderedNodes.size(); ++i)
+		{
+			ExecutionNode& executionNode = m_orderedNodes[i];
+			if (i > 0 && (!executionNode.node->allowConcurrent || !m_orderedNodes[i - 1].node->allowConcurrent))
+				batchIndex++;
+
+			executionNode.batchIndex = batchIndex;
+
+			// Systems accessing the same components have to keep their execution order
+			for (std::size_t j = 0; j < i; ++j)
+			{
+				if (executionNode.node->ConflictsWith(*m_orderedNodes[j].node))
+					executionNode.dependencies.push_back(j);
+			}
+		}
+
+		m_systemTimings.resize(m_orderedNodes.size());
+		for (std::size_t i = 0; i < m_orderedNodes.size(); ++i)
+		{
+			SystemTiming& systemTiming = m_systemTimings[i];
+			systemTiming.systemName = m_orderedNodes[i].node->name;
+			systemTiming.duration = Time::Zero();
+			systemTiming.startTime = Time::Zero();
+			systemTiming.isOnCriticalPath = false;
+			systemTiming.isParallel = false;
 		}
 
-		for (NodeBase* node : m_orderedNodes)
-			node->Update(elapsedTime);
+		m_warmedUp = false;
+	}
+
+	void EnttSystemGraph::ComputeCriticalPath()
+	{
+		m_criticalPathTime = Time::Zero();
+		if (m_orderedNodes.empty())
+			return;
+
+		// Longest path through the dependency graph, weighted by system durations
+		constexpr std::size_t InvalidIndex = std::numeric_limits<std::size_t>::max();
+
+		std::vector<Time> pathTimes(m_orderedNodes.size());
+		std::vector<std::size_t> pathPredecessors(m_orderedNodes.size(), InvalidIndex);
+
+		std::size_t lastNodeIndex = 0;
+		for (std::size_t i = 0; i < m_orderedNodes.size(); ++i)
+		{
+			Time longestDependencyPath = Time::Zero();
+			for (std::size_t dependencyIndex : m_orderedNodes[i].dependencies)
+			{
+				if (pathPredecessors[i] == InvalidIndex || pathTimes[dependencyIndex] > longestDependencyPath)
+				{
+					longestDependencyPath = pathTimes[dependencyIndex];
+					pathPredecessors[i] = dependencyIndex;
+				}
+			}
+
+			pathTimes[i] = longestDependencyPath + m_systemTimings[i].duration;
+			if (pathTimes[i] > pathTimes[lastNodeIndex])
+				lastNodeIndex = i;
+
+			m_systemTimings[i].isOnCriticalPath = false;
+		}
+
+		m_criticalPathTime = pathTimes[lastNodeIndex];
+		for (std::size_t nodeIndex = lastNodeIndex; nodeIndex != InvalidIndex; nodeIndex = pathPredecessors[nodeIndex])
+			m_systemTimings[nodeIndex].isOnCriticalPath = true;
+	}
+
+	void EnttSystemGraph::RunNode(std::size_t nodeIndex, Time elapsedTime, Time updateStartTime)
+	{
+		Time startTime = GetElapsedNanoseconds();
+		m_orderedNodes[nodeIndex].node->Update(elapsedTime);
+		Time endTime = GetElapsedNanoseconds();
+
+		SystemTiming& systemTiming = m_systemTimings[nodeIndex];
+		systemTiming.startTime = startTime - updateStartTime;
+		systemTiming.duration = endTime - startTime;
+	}
+
+	void EnttSystemGraph::UpdateBatch(std::size_t firstNode, std::size_t lastNode, Time elapsedTime, Time updateStartTime)
+	{
+		if (lastNode - firstNode == 1)
+		{
+			RunNode(firstNode, elapsedTime, updateStartTime);
+			m_systemTimings[firstNode].isParallel = false;
+			return;
+		}
+
+		m_nodeTasks.resize(lastNode - firstNode);
+
+		TaskScheduler::TaskGroup taskGroup;
+		for (std::size_t i = firstNode; i < lastNode; ++i)
+		{
+			// Dependencies from previous batches are already satisfied
+			m_dependencyHandles.clear();
+			for (std::size_t dependencyIndex : m_orderedNodes[i].dependencies)
+			{
+				if (dependencyIndex >= firstNode)
+					m_dependencyHandles.push_back(m_nodeTasks[dependencyIndex - firstNode]);
+			}
+
+			m_systemTimings[i].isParallel = true;
+			m_nodeTasks[i - firstNode] = m_taskScheduler->AddTask([this, i, elapsedTime, updateStartTime]
+			{
+				RunNode(i, elapsedTime, updateStartTime);
+			}, m_dependencyHandles, &taskGroup);
+		}
+
+		m_dependencyHandles.clear();
+		m_taskScheduler->WaitForTasks(taskGroup);
+
+		// Release task handles before the next update
+		m_nodeTasks.clear();
 	}
 }
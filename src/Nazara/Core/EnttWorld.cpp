@@ -3,9 +3,24 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/EnttWorld.hpp>
+#include <Nazara/Core/ApplicationBase.hpp>
+#include <Nazara/Core/TaskSchedulerAppComponent.hpp>
 
 namespace Nz
 {
+	EnttWorld::EnttWorld() :
+	m_systemGraph(m_registry)
+	{
+		m_registry.ctx().emplace<EnttWorld*>(this);
+
+		// Run systems on the application task scheduler if there's one
+		if (ApplicationBase* app = ApplicationBase::Instance())
+		{
+			if (TaskSchedulerAppComponent* taskScheduler = app->TryGetComponent<TaskSchedulerAppComponent>())
+				m_systemGraph.SetTaskScheduler(taskScheduler);
+		}
+	}
+
 	void EnttWorld::Update(Time elapsedTime)
 	{
 		m_systemGraph.Update(elapsedTime);
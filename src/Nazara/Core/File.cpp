@@ -91,6 +91,7 @@ namespace Nz
 			m_impl.reset();
 
 			m_openMode = OpenMode::NotOpen;
+			m_streamOptions &= ~StreamOption::MemoryMapped;
 		}
 	}
 
@@ -168,6 +169,8 @@ namespace Nz
 	* \param openMode Flag for file
 	*
 	* \remark Produces a NazaraError if OS error to open a file
+	* \remark OpenMode::MemoryMapped maps the whole file in memory (read-only), its content is then available through GetMappedPointer without any copy
+	* \remark When combined with OpenMode::Defer, the file is only mapped on first access
 	*/
 
 	bool File::Open(OpenModeFlags openMode)
@@ -183,7 +186,12 @@ namespace Nz
 		m_openMode = openMode;
 		if (m_openMode.Test(OpenMode::Defer))
 		{
-			// defer opening until a read/write operation is performed
+			// defer opening until a read/write operation is performed (or the mapped pointer is retrieved)
+			if (m_openMode.Test(OpenMode::MemoryMapped))
+				m_streamOptions |= StreamOption::MemoryMapped;
+			else
+				m_streamOptions &= ~StreamOption::MemoryMapped;
+
 			return true;
 		}
 
@@ -197,7 +205,17 @@ namespace Nz
 
 		m_impl = std::move(impl);
 
-		EnableBuffering(!m_openMode.Test(OpenMode::Unbuffered));
+		// Memory-mapped files are read straight from the mapping, buffering would only add a copy
+		if (m_impl->IsMemoryMapped())
+		{
+			m_streamOptions |= StreamOption::MemoryMapped;
+			EnableBuffering(false);
+		}
+		else
+		{
+			m_streamOptions &= ~StreamOption::MemoryMapped;
+			EnableBuffering(!m_openMode.Test(OpenMode::Unbuffered));
+		}
 
 		if (m_openMode & OpenMode::Text)
 			m_streamOptions |= StreamOption::Text;
@@ -329,6 +347,26 @@ namespace Nz
 		m_impl->Flush();
 	}
 
+	/*!
+	* \brief Gets the pointer to the file content when it's memory-mapped
+	* \return Pointer to the mapped content, or nullptr if the file is empty
+	*
+	* \remark The mapping is read-only, writing through it is undefined behavior
+	* \remark Deferred files are mapped by this call, nullptr is returned if this fails
+	*/
+	void* File::GetMemoryMappedPointer() const
+	{
+		if (!IsOpen() && m_openMode.Test(OpenMode::Defer))
+		{
+			if (!const_cast<File*>(this)->CheckFileOpening())
+				return nullptr;
+		}
+
+		NazaraAssertMsg(IsOpen(), "File is not open");
+
+		return const_cast<void*>(m_impl->GetMappedPointer());
+	}
+
 	/*!
 	* \brief Reads blocks
 	* \return Number of blocks read
@@ -0,0 +1,89 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_CORE_FORMATS_ARCHIVECONSTANTS_HPP
+#define NAZARA_CORE_FORMATS_ARCHIVECONSTANTS_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <string_view>
+
+namespace Nz
+{
+	/*
+	Archive layout (all fields are stored in the endianness of the machine which built the archive, the magic is used to detect mismatches):
+	- ArchiveHeader
+	- ArchiveEntry[entryCount], sorted by path
+	- UInt32 buckets[bucketCount], open addressing hash table (linear probing) of entry index + 1 (0 means empty)
+	- UInt32 children[], entry indices of each directory children (root children come first)
+	- path strings (not null-terminated, '/' separated, relative to the archive root)
+	- file data, each entry starting on a multiple of the header alignment
+	*/
+
+	constexpr UInt32 Archive_Magic = 0x4B505A4E; //< "NZPK"
+	constexpr UInt32 Archive_MagicSwapped = 0x4E5A504B; //< magic read from an archive built with the other endianness
+	constexpr UInt16 Archive_Version = 1;
+
+	enum class ArchiveEntryType : UInt8
+	{
+		Directory,
+		File
+	};
+
+	struct ArchiveHeader
+	{
+		UInt32 magic;
+		UInt16 version;
+		UInt16 reserved;
+		UInt32 entryCount;
+		UInt32 bucketCount;        //< power of two
+		UInt32 rootChildOffset;    //< offset in the children table
+		UInt32 rootChildCount;
+		UInt32 alignment;
+		UInt32 childCount;         //< size of the children table
+		UInt64 entryTableOffset;
+		UInt64 bucketTableOffset;
+		UInt64 childrenTableOffset;
+		UInt64 stringTableOffset;
+		UInt64 stringTableSize;
+	};
+
+	static_assert(sizeof(ArchiveHeader) == 72);
+
+	struct ArchiveEntry
+	{
+		UInt64 pathHash;
+		UInt64 dataOffset;   //< file: data offset in the archive, directory: offset in the children table
+		UInt64 storedSize;   //< file: size of the stored (maybe compressed) data
+		UInt64 size;         //< file: uncompressed size, directory: child count
+		UInt32 pathOffset;   //< offset in the string table
+		UInt16 pathLength;
+		ArchiveEntryType type;
+		UInt8 compression;   //< ArchiveCompression
+	};
+
+	static_assert(sizeof(ArchiveEntry) == 40);
+
+	// FNV-1a, hashed incrementally so paths split in parts don't have to be joined
+	constexpr UInt64 ArchivePathHashSeed = 14695981039346656037ull;
+
+	constexpr UInt64 ArchivePathHashAppend(UInt64 hash, std::string_view str)
+	{
+		for (char c : str)
+		{
+			hash ^= static_cast<UInt8>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	constexpr UInt64 ArchivePathHash(std::string_view path)
+	{
+		return ArchivePathHashAppend(ArchivePathHashSeed, path);
+	}
+}
+
+#endif // NAZARA_CORE_FORMATS_ARCHIVECONSTANTS_HPP
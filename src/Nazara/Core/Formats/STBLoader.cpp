@@ -10,6 +10,7 @@
 #include <NazaraUtils/Endianness.hpp>
 #include <frozen/string.h>
 #include <frozen/unordered_set.h>
+#include <limits>
 
 #define STB_IMAGE_STATIC
 #define STB_IMAGE_IMPLEMENTATION
@@ -50,16 +51,43 @@ namespace Nz
 		{
 			UInt64 streamPos = stream.GetCursorPos();
 
+			// Decode memory-mapped streams in place instead of copying them through callbacks
+			const stbi_uc* memory = nullptr;
+			int memorySize = 0;
+			if (stream.IsMemoryMapped())
+			{
+				UInt64 streamSize = stream.GetSize();
+				const void* mappedPtr = stream.GetMappedPointer();
+				if (mappedPtr && streamPos < streamSize && streamSize - streamPos <= static_cast<UInt64>(std::numeric_limits<int>::max()))
+				{
+					memory = static_cast<const stbi_uc*>(mappedPtr) + streamPos;
+					memorySize = static_cast<int>(streamSize - streamPos);
+				}
+			}
+
 			int width, height, bpp;
-			if (!stbi_info_from_callbacks(&s_stbiCallbacks, &stream, &width, &height, &bpp))
-				return Err(ResourceLoadingError::Unrecognized);
+			if (memory)
+			{
+				if (!stbi_info_from_memory(memory, memorySize, &width, &height, &bpp))
+					return Err(ResourceLoadingError::Unrecognized);
+			}
+			else
+			{
+				if (!stbi_info_from_callbacks(&s_stbiCallbacks, &stream, &width, &height, &bpp))
+					return Err(ResourceLoadingError::Unrecognized);
 
-			stream.SetCursorPos(streamPos);
+				stream.SetCursorPos(streamPos);
+			}
 
 			// Load everything as RGBA8 and then convert using the Image::Convert method
 			// This is because of a STB bug when loading some JPG images with default settings
 
-			UInt8* ptr = stbi_load_from_callbacks(&s_stbiCallbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
+			UInt8* ptr;
+			if (memory)
+				ptr = stbi_load_from_memory(memory, memorySize, &width, &height, &bpp, STBI_rgb_alpha);
+			else
+				ptr = stbi_load_from_callbacks(&s_stbiCallbacks, &stream, &width, &height, &bpp, STBI_rgb_alpha);
+
 			if (!ptr)
 			{
 				NazaraError("failed to load image: {0}", std::string(stbi_failure_reason()));
@@ -0,0 +1,239 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Math module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Math/Frustum.hpp>
+#include <Nazara/Core/HardwareInfo.hpp>
+#include <cmath>
+
+#if defined(NAZARA_ARCH_x86) || defined(NAZARA_ARCH_x86_64)
+#include <immintrin.h>
+
+// AVX kernel is compiled for AVX regardless of the compiler flags, and only called if the CPU (and OS) supports it
+#if defined(NAZARA_COMPILER_MSVC)
+#define NAZARA_FRUSTUM_AVX_SUPPORT
+#define NAZARA_FRUSTUM_AVX_FUNCTION
+#elif defined(NAZARA_COMPILER_CLANG) || defined(NAZARA_COMPILER_GCC)
+#define NAZARA_FRUSTUM_AVX_SUPPORT
+#define NAZARA_FRUSTUM_AVX_FUNCTION __attribute__((target("avx")))
+#endif
+
+#if defined(NAZARA_ARCH_x86_64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NAZARA_FRUSTUM_SSE_SUPPORT
+#endif
+
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define NAZARA_FRUSTUM_NEON_SUPPORT
+#endif
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Every kernel performs the same operations (in the same order) as Frustum::Intersect(Box), without fused multiply-adds
+		// Bits are only set in the masks (which are cleared by the caller)
+
+#ifdef NAZARA_FRUSTUM_AVX_SUPPORT
+		bool IsAVXSupported()
+		{
+			if (!HardwareInfo::IsCpuidSupported())
+				return false;
+
+			UInt32 registers[4];
+			HardwareInfo::Cpuid(0, 0, registers);
+			if (registers[0] < 1)
+				return false;
+
+			HardwareInfo::Cpuid(1, 0, registers);
+
+			// AVX has to be supported by the CPU and its registers saved by the OS (OSXSAVE and XCR0 bits 1 and 2)
+			constexpr UInt32 AVXBit = 1U << 28;
+			constexpr UInt32 OSXSaveBit = 1U << 27;
+			if ((registers[2] & (AVXBit | OSXSaveBit)) != (AVXBit | OSXSaveBit))
+				return false;
+
+#if defined(NAZARA_COMPILER_MSVC)
+			UInt64 xcr0 = _xgetbv(0);
+#else
+			UInt32 xcr0Low, xcr0High;
+			asm volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+			UInt64 xcr0 = (UInt64(xcr0High) << 32) | xcr0Low;
+#endif
+
+			return (xcr0 & 0x6) == 0x6;
+		}
+
+		// Tests 8 boxes at once, returns the number of processed boxes
+		NAZARA_FRUSTUM_AVX_FUNCTION std::size_t CullBoxesAVX(const Plane<float>* planes, std::size_t planeCount, const Frustum<float>::BoxBatch& boxes, UInt64* visibilityMask, UInt64* insideMask)
+		{
+			const __m256 half = _mm256_set1_ps(0.5f);
+			const __m256 signMask = _mm256_set1_ps(-0.f);
+
+			std::size_t i = 0;
+			for (; i + 8 <= boxes.count; i += 8)
+			{
+				__m256 lengthX = _mm256_loadu_ps(boxes.width + i);
+				__m256 lengthY = _mm256_loadu_ps(boxes.height + i);
+				__m256 lengthZ = _mm256_loadu_ps(boxes.depth + i);
+
+				__m256 extentX = _mm256_mul_ps(lengthX, half);
+				__m256 extentY = _mm256_mul_ps(lengthY, half);
+				__m256 extentZ = _mm256_mul_ps(lengthZ, half);
+
+				__m256 centerX = _mm256_add_ps(_mm256_loadu_ps(boxes.x + i), extentX);
+				__m256 centerY = _mm256_add_ps(_mm256_loadu_ps(boxes.y + i), extentY);
+				__m256 centerZ = _mm256_add_ps(_mm256_loadu_ps(boxes.z + i), extentZ);
+
+				__m256 outside = _mm256_setzero_ps();
+				__m256 intersecting = _mm256_setzero_ps();
+				for (std::size_t j = 0; j < planeCount; ++j)
+				{
+					const Plane<float>& plane = planes[j];
+
+					__m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(extentX, _mm256_set1_ps(std::abs(plane.normal.x))), _mm256_mul_ps(extentY, _mm256_set1_ps(std::abs(plane.normal.y)))), _mm256_mul_ps(extentZ, _mm256_set1_ps(std::abs(plane.normal.z))));
+					__m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.normal.x), centerX), _mm256_mul_ps(_mm256_set1_ps(plane.normal.y), centerY)), _mm256_mul_ps(_mm256_set1_ps(plane.normal.z), centerZ)), _mm256_set1_ps(plane.distance));
+
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, _mm256_xor_ps(radius, signMask), _CMP_LT_OQ));
+					intersecting = _mm256_or_ps(intersecting, _mm256_cmp_ps(distance, radius, _CMP_LT_OQ));
+				}
+
+				UInt64 outsideBits = static_cast<UInt64>(_mm256_movemask_ps(outside));
+				visibilityMask[i / 64] |= (~outsideBits & 0xFF) << (i % 64);
+				if (insideMask)
+					insideMask[i / 64] |= (~(outsideBits | static_cast<UInt64>(_mm256_movemask_ps(intersecting))) & 0xFF) << (i % 64);
+			}
+
+			return i;
+		}
+#endif
+
+#ifdef NAZARA_FRUSTUM_SSE_SUPPORT
+		// Tests 4 boxes at once, returns the number of processed boxes
+		std::size_t CullBoxesSSE(const Plane<float>* planes, std::size_t planeCount, const Frustum<float>::BoxBatch& boxes, UInt64* visibilityMask, UInt64* insideMask)
+		{
+			const __m128 half = _mm_set1_ps(0.5f);
+			const __m128 signMask = _mm_set1_ps(-0.f);
+
+			std::size_t i = 0;
+			for (; i + 4 <= boxes.count; i += 4)
+			{
+				__m128 lengthX = _mm_loadu_ps(boxes.width + i);
+				__m128 lengthY = _mm_loadu_ps(boxes.height + i);
+				__m128 lengthZ = _mm_loadu_ps(boxes.depth + i);
+
+				__m128 extentX = _mm_mul_ps(lengthX, half);
+				__m128 extentY = _mm_mul_ps(lengthY, half);
+				__m128 extentZ = _mm_mul_ps(lengthZ, half);
+
+				__m128 centerX = _mm_add_ps(_mm_loadu_ps(boxes.x + i), extentX);
+				__m128 centerY = _mm_add_ps(_mm_loadu_ps(boxes.y + i), extentY);
+				__m128 centerZ = _mm_add_ps(_mm_loadu_ps(boxes.z + i), extentZ);
+
+				__m128 outside = _mm_setzero_ps();
+				__m128 intersecting = _mm_setzero_ps();
+				for (std::size_t j = 0; j < planeCount; ++j)
+				{
+					const Plane<float>& plane = planes[j];
+
+					__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(extentX, _mm_set1_ps(std::abs(plane.normal.x))), _mm_mul_ps(extentY, _mm_set1_ps(std::abs(plane.normal.y)))), _mm_mul_ps(extentZ, _mm_set1_ps(std::abs(plane.normal.z))));
+					__m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal.x), centerX), _mm_mul_ps(_mm_set1_ps(plane.normal.y), centerY)), _mm_mul_ps(_mm_set1_ps(plane.normal.z), centerZ)), _mm_set1_ps(plane.distance));
+
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_xor_ps(radius, signMask)));
+					intersecting = _mm_or_ps(intersecting, _mm_cmplt_ps(distance, radius));
+				}
+
+				UInt64 outsideBits = static_cast<UInt64>(_mm_movemask_ps(outside));
+				visibilityMask[i / 64] |= (~outsideBits & 0xF) << (i % 64);
+				if (insideMask)
+					insideMask[i / 64] |= (~(outsideBits | static_cast<UInt64>(_mm_movemask_ps(intersecting))) & 0xF) << (i % 64);
+			}
+
+			return i;
+		}
+#endif
+
+#ifdef NAZARA_FRUSTUM_NEON_SUPPORT
+		UInt64 GetLaneBits(uint32x4_t mask)
+		{
+			UInt64 bits = 0;
+			bits |= static_cast<UInt64>(vgetq_lane_u32(mask, 0) != 0) << 0;
+			bits |= static_cast<UInt64>(vgetq_lane_u32(mask, 1) != 0) << 1;
+			bits |= static_cast<UInt64>(vgetq_lane_u32(mask, 2) != 0) << 2;
+			bits |= static_cast<UInt64>(vgetq_lane_u32(mask, 3) != 0) << 3;
+
+			return bits;
+		}
+
+		// Tests 4 boxes at once, returns the number of processed boxes
+		std::size_t CullBoxesNEON(const Plane<float>* planes, std::size_t planeCount, const Frustum<float>::BoxBatch& boxes, UInt64* visibilityMask, UInt64* insideMask)
+		{
+			const float32x4_t half = vdupq_n_f32(0.5f);
+
+			std::size_t i = 0;
+			for (; i + 4 <= boxes.count; i += 4)
+			{
+				float32x4_t lengthX = vld1q_f32(boxes.width + i);
+				float32x4_t lengthY = vld1q_f32(boxes.height + i);
+				float32x4_t lengthZ = vld1q_f32(boxes.depth + i);
+
+				float32x4_t extentX = vmulq_f32(lengthX, half);
+				float32x4_t extentY = vmulq_f32(lengthY, half);
+				float32x4_t extentZ = vmulq_f32(lengthZ, half);
+
+				float32x4_t centerX = vaddq_f32(vld1q_f32(boxes.x + i), extentX);
+				float32x4_t centerY = vaddq_f32(vld1q_f32(boxes.y + i), extentY);
+				float32x4_t centerZ = vaddq_f32(vld1q_f32(boxes.z + i), extentZ);
+
+				uint32x4_t outside = vdupq_n_u32(0);
+				uint32x4_t intersecting = vdupq_n_u32(0);
+				for (std::size_t j = 0; j < planeCount; ++j)
+				{
+					const Plane<float>& plane = planes[j];
+
+					float32x4_t radius = vaddq_f32(vaddq_f32(vmulq_n_f32(extentX, std::abs(plane.normal.x)), vmulq_n_f32(extentY, std::abs(plane.normal.y))), vmulq_n_f32(extentZ, std::abs(plane.normal.z)));
+					float32x4_t distance = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(centerX, plane.normal.x), vmulq_n_f32(centerY, plane.normal.y)), vmulq_n_f32(centerZ, plane.normal.z)), vdupq_n_f32(plane.distance));
+
+					outside = vorrq_u32(outside, vcltq_f32(distance, vnegq_f32(radius)));
+					intersecting = vorrq_u32(intersecting, vcltq_f32(distance, radius));
+				}
+
+				UInt64 outsideBits = GetLaneBits(outside);
+				visibilityMask[i / 64] |= (~outsideBits & 0xF) << (i % 64);
+				if (insideMask)
+					insideMask[i / 64] |= (~(outsideBits | GetLaneBits(intersecting)) & 0xF) << (i % 64);
+			}
+
+			return i;
+		}
+#endif
+	}
+
+	namespace Detail
+	{
+		std::size_t CullBoxesSIMD(const Plane<float>* planes, std::size_t planeCount, const Frustum<float>::BoxBatch& boxes, UInt64* visibilityMask, UInt64* insideMask)
+		{
+			NAZARA_USE_ANONYMOUS_NAMESPACE
+
+#ifdef NAZARA_FRUSTUM_AVX_SUPPORT
+			static const bool hasAVX = IsAVXSupported();
+			if (hasAVX)
+				return CullBoxesAVX(planes, planeCount, boxes, visibilityMask, insideMask);
+#endif
+
+#if defined(NAZARA_FRUSTUM_SSE_SUPPORT)
+			return CullBoxesSSE(planes, planeCount, boxes, visibilityMask, insideMask);
+#elif defined(NAZARA_FRUSTUM_NEON_SUPPORT)
+			return CullBoxesNEON(planes, planeCount, boxes, visibilityMask, insideMask);
+#else
+			NazaraUnused(planes);
+			NazaraUnused(planeCount);
+			NazaraUnused(boxes);
+			NazaraUnused(visibilityMask);
+			NazaraUnused(insideMask);
+
+			return 0;
+#endif
+		}
+	}
+}
@@ -9,9 +9,13 @@
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
 #include <NazaraUtils/PathUtils.hpp>
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
+#include <limits>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 #ifdef NAZARA_PLATFORM_BSD
@@ -26,7 +30,11 @@
 namespace Nz::PlatformImpl
 {
 	FileImpl::FileImpl(const File* /*parent*/) :
+	m_mappedCursor(0),
+	m_mappedSize(0),
+	m_mappedData(nullptr),
 	m_fileDescriptor(-1),
+	m_isMemoryMapped(false),
 	m_endOfFile(false),
 	m_endOfFileUpdated(true)
 	{
@@ -34,12 +42,18 @@ namespace Nz::PlatformImpl
 
 	FileImpl::~FileImpl()
 	{
+		if (m_mappedData)
+			munmap(m_mappedData, static_cast<std::size_t>(m_mappedSize));
+
 		if (m_fileDescriptor != -1)
 			close(m_fileDescriptor);
 	}
 
 	bool FileImpl::EndOfFile() const
 	{
+		if (m_isMemoryMapped)
+			return m_mappedCursor >= m_mappedSize;
+
 		if (!m_endOfFileUpdated)
 		{
 			struct stat64 fileSize;
@@ -55,18 +69,37 @@ namespace Nz::PlatformImpl
 
 	void FileImpl::Flush()
 	{
+		if (m_isMemoryMapped)
+			return;
+
 		if (fsync(m_fileDescriptor) == -1)
 			NazaraError("unable to flush file: {0}", Error::GetLastSystemError());
 	}
 
 	UInt64 FileImpl::GetCursorPos() const
 	{
+		if (m_isMemoryMapped)
+			return m_mappedCursor;
+
 		off64_t position = lseek64(m_fileDescriptor, 0, SEEK_CUR);
 		return static_cast<UInt64>(position);
 	}
 
+	const void* FileImpl::GetMappedPointer() const
+	{
+		return m_mappedData;
+	}
+
+	bool FileImpl::IsMemoryMapped() const
+	{
+		return m_isMemoryMapped;
+	}
+
 	bool FileImpl::Open(const std::filesystem::path& filePath, OpenModeFlags mode)
 	{
+		if (mode.Test(OpenMode::MemoryMapped))
+			return MapFile(filePath, mode);
+
 		int flags;
 		mode_t permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH;
 
@@ -124,12 +157,29 @@ namespace Nz::PlatformImpl
 			closeOnError.Reset();
 		}
 
+#ifdef POSIX_FADV_SEQUENTIAL
+		if (mode.Test(OpenMode::SequentialAccess))
+			posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+		else if (mode.Test(OpenMode::RandomAccess))
+			posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_RANDOM);
+#endif
+
 		m_fileDescriptor = fileDescriptor;
 		return true;
 	}
 
 	std::size_t FileImpl::Read(void* buffer, std::size_t size)
 	{
+		if (m_isMemoryMapped)
+		{
+			std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, m_mappedSize - std::min(m_mappedCursor, m_mappedSize)));
+			if (readSize > 0)
+				std::memcpy(buffer, &m_mappedData[m_mappedCursor], readSize);
+
+			m_mappedCursor += readSize;
+			return readSize;
+		}
+
 		ssize_t read = SafeRead(m_fileDescriptor, buffer, size);
 		if (read < 0)
 		{
@@ -165,6 +215,23 @@ namespace Nz::PlatformImpl
 				return false;
 		}
 
+		if (m_isMemoryMapped)
+		{
+			Int64 base;
+			switch (moveMethod)
+			{
+				case SEEK_CUR: base = static_cast<Int64>(m_mappedCursor); break;
+				case SEEK_END: base = static_cast<Int64>(m_mappedSize); break;
+				default:       base = 0; break;
+			}
+
+			if (base + offset < 0)
+				return false;
+
+			m_mappedCursor = std::min(static_cast<UInt64>(base + offset), m_mappedSize);
+			return true;
+		}
+
 		m_endOfFileUpdated = false;
 
 		return lseek64(m_fileDescriptor, offset, moveMethod) != -1;
@@ -172,11 +239,17 @@ namespace Nz::PlatformImpl
 
 	bool FileImpl::SetSize(UInt64 size)
 	{
+		if (m_isMemoryMapped)
+			return false;
+
 		return ftruncate64(m_fileDescriptor, size) != 0;
 	}
 
 	std::size_t FileImpl::Write(const void* buffer, std::size_t size)
 	{
+		if (m_isMemoryMapped)
+			return 0;
+
 		ssize_t written = SafeWrite(m_fileDescriptor, buffer, size);
 		if (written < 0)
 		{
@@ -188,4 +261,71 @@ namespace Nz::PlatformImpl
 
 		return static_cast<std::size_t>(written);
 	}
+
+	bool FileImpl::MapFile(const std::filesystem::path& filePath, OpenModeFlags mode)
+	{
+		if (mode.Test(OpenMode::Write))
+		{
+			NazaraError("memory-mapped files are read-only");
+			return false;
+		}
+
+		int fileDescriptor = open64(Nz::PathToString(filePath).data(), O_RDONLY);
+		if (fileDescriptor == -1)
+			return false;
+
+		CallOnExit closeFile([&] { close(fileDescriptor); });
+
+		struct stat64 fileStat;
+		if (fstat64(fileDescriptor, &fileStat) == -1)
+			return false;
+
+		UInt64 fileSize = static_cast<UInt64>(fileStat.st_size);
+		if (fileSize > std::numeric_limits<std::size_t>::max())
+		{
+			NazaraError("file is too large to be memory-mapped");
+			return false;
+		}
+
+		// mmap doesn't support empty mappings, empty files are "mapped" to a null pointer
+		if (fileSize > 0)
+		{
+			void* mappedData = mmap(nullptr, static_cast<std::size_t>(fileSize), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (mappedData == MAP_FAILED)
+				return false;
+
+			if (mode.Test(OpenMode::SequentialAccess))
+				madvise(mappedData, static_cast<std::size_t>(fileSize), MADV_SEQUENTIAL);
+			else if (mode.Test(OpenMode::RandomAccess))
+				madvise(mappedData, static_cast<std::size_t>(fileSize), MADV_RANDOM);
+
+			m_mappedData = static_cast<UInt8*>(mappedData);
+		}
+
+		m_mappedSize = fileSize;
+		m_mappedCursor = 0;
+		m_isMemoryMapped = true;
+
+		// The mapping stays valid once the file is closed, only keep the descriptor if we need it to hold the lock
+		if (mode.Test(OpenMode::Lock))
+		{
+			struct flock lock;
+			lock.l_type = F_RDLCK;
+			lock.l_start = 0;
+			lock.l_whence = SEEK_SET;
+			lock.l_len = 0;
+			lock.l_pid = getpid();
+
+			if (fcntl(fileDescriptor, F_SETLK, &lock) == -1)
+			{
+				NazaraError("unable to place a lock on the file");
+				return false;
+			}
+
+			closeFile.Reset();
+			m_fileDescriptor = fileDescriptor;
+		}
+
+		return true;
+	}
 }
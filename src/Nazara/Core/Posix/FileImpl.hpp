@@ -34,6 +34,8 @@ namespace Nz::PlatformImpl
 			bool EndOfFile() const;
 			void Flush();
 			UInt64 GetCursorPos() const;
+			const void* GetMappedPointer() const;
+			bool IsMemoryMapped() const;
 			bool Open(const std::filesystem::path& filePath, OpenModeFlags mode);
 			std::size_t Read(void* buffer, std::size_t size);
 			bool SetCursorPos(CursorPosition pos, Int64 offset);
@@ -44,7 +46,13 @@ namespace Nz::PlatformImpl
 			FileImpl& operator=(FileImpl&&) = delete; ///TODO
 
 		private:
+			bool MapFile(const std::filesystem::path& filePath, OpenModeFlags mode);
+
+			UInt64 m_mappedCursor;
+			UInt64 m_mappedSize;
+			UInt8* m_mappedData;
 			int m_fileDescriptor;
+			bool m_isMemoryMapped;
 			mutable bool m_endOfFile;
 			mutable bool m_endOfFileUpdated;
 	};
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/Systems/LifetimeSystem.hpp>
+#include <Nazara/Core/EnttParallel.hpp>
 #include <Nazara/Core/Components/DisabledComponent.hpp>
 #include <Nazara/Core/Components/LifetimeComponent.hpp>
 
@@ -11,9 +12,15 @@ namespace Nz
 	void LifetimeSystem::Update(Time elapsedTime)
 	{
 		auto view = m_registry.view<LifetimeComponent>(entt::exclude<DisabledComponent>);
-		for (auto [entity, lifetimeComponent] : view.each())
+
+		EnttParallelForEach(GetEnttTaskScheduler(m_registry), view, [elapsedTime](entt::entity /*entity*/, LifetimeComponent& lifetimeComponent)
 		{
 			lifetimeComponent.DecreaseLifetime(elapsedTime);
+		});
+
+		// Destroying entities isn't thread-safe, do it once every lifetime has been updated
+		for (auto [entity, lifetimeComponent] : view.each())
+		{
 			if (!lifetimeComponent.IsAlive())
 				m_registry.destroy(entity);
 		}
@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Core/Systems/VelocitySystem.hpp>
+#include <Nazara/Core/EnttParallel.hpp>
 #include <Nazara/Core/Components/DisabledComponent.hpp>
 #include <Nazara/Core/Components/NodeComponent.hpp>
 #include <Nazara/Core/Components/VelocityComponent.hpp>
@@ -14,10 +15,27 @@ namespace Nz
 		float delta = elapsedTime.AsSeconds();
 
 		auto view = m_registry.view<NodeComponent, VelocityComponent>(entt::exclude<DisabledComponent>);
-		for (auto [entity, nodeComponent, velocityComponent] : view.each())
+
+		TaskScheduler* taskScheduler = GetEnttTaskScheduler(m_registry);
+		if (!taskScheduler || view.size_hint() <= EnttParallelDefaultGrainSize)
 		{
-			NazaraUnused(entity);
-			nodeComponent.Move(velocityComponent.GetLinearVelocity() * delta);
+			for (auto [entity, nodeComponent, velocityComponent] : view.each())
+			{
+				NazaraUnused(entity);
+				nodeComponent.Move(velocityComponent.GetLinearVelocity() * delta);
+			}
+
+			return;
 		}
+
+		// Move nodes concurrently without invalidating them, as invalidation triggers signals which must be handled on this thread
+		EnttParallelForEach(taskScheduler, view, [delta](entt::entity /*entity*/, NodeComponent& nodeComponent, const VelocityComponent& velocityComponent)
+		{
+			nodeComponent.Move(velocityComponent.GetLinearVelocity() * delta, Node::Invalidation::DontInvalidate);
+		});
+
+		// Then invalidate them from this thread, in the same order as a sequential update would
+		for (entt::entity entity : view)
+			view.get<NodeComponent>(entity).Invalidate();
 	}
 }
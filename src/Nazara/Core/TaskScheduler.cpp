@@ -7,11 +7,14 @@
 #include <Nazara/Core/ThreadExt.hpp>
 #include <NazaraUtils/StackArray.hpp>
 #include <concurrentqueue.h>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <new>
 #include <random>
 #include <semaphore>
 #include <thread>
+#include <vector>
 
 namespace Nz
 {
@@ -25,13 +28,253 @@ namespace Nz
 #else
 		constexpr std::size_t hardware_destructive_interference_size = 64;
 #endif
+
+		// Chase-Lev work-stealing deque (see "Correct and Efficient Work-Stealing for Weak Memory Models", Lê et al. 2013)
+		// The owner pushes and pops at the bottom (LIFO, for cache locality) while thieves steal from the top (FIFO, oldest and usually biggest tasks)
+		template<typename T>
+		class WorkStealingDeque
+		{
+			public:
+				WorkStealingDeque(Int64 initialCapacity = 256)
+				{
+					NazaraAssertMsg(initialCapacity > 0 && (initialCapacity & (initialCapacity - 1)) == 0, "capacity must be a power of two");
+
+					m_buffers.push_back(std::make_unique<Buffer>(initialCapacity));
+					m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+				}
+
+				bool IsEmpty() const
+				{
+					Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+					Int64 top = m_top.load(std::memory_order_relaxed);
+					return bottom <= top;
+				}
+
+				// Owner only
+				T* Pop()
+				{
+					Int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+					Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+					m_bottom.store(bottom, std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					Int64 top = m_top.load(std::memory_order_relaxed);
+
+					if (top > bottom)
+					{
+						// Deque was empty
+						m_bottom.store(bottom + 1, std::memory_order_relaxed);
+						return nullptr;
+					}
+
+					T* value = buffer->Load(bottom);
+					if (top == bottom)
+					{
+						// Last element, race against thieves
+						if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+							value = nullptr;
+
+						m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					}
+
+					return value;
+				}
+
+				// Owner only
+				void Push(T* value)
+				{
+					Int64 bottom = m_bottom.load(std::memory_order_relaxed);
+					Int64 top = m_top.load(std::memory_order_acquire);
+					Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+					if (bottom - top > buffer->mask)
+						buffer = Grow(buffer, top, bottom);
+
+					buffer->Store(bottom, value);
+					std::atomic_thread_fence(std::memory_order_release);
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				}
+
+				T* Steal()
+				{
+					Int64 top = m_top.load(std::memory_order_acquire);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					Int64 bottom = m_bottom.load(std::memory_order_acquire);
+					if (top >= bottom)
+						return nullptr;
+
+					Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+					T* value = buffer->Load(top);
+					if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						return nullptr; //< lost the race to the owner or another thief
+
+					return value;
+				}
+
+			private:
+				struct Buffer
+				{
+					Buffer(Int64 capacity) :
+					mask(capacity - 1),
+					elements(std::make_unique<std::atomic<T*>[]>(capacity))
+					{
+					}
+
+					T* Load(Int64 index) const
+					{
+						return elements[index & mask].load(std::memory_order_relaxed);
+					}
+
+					void Store(Int64 index, T* value)
+					{
+						elements[index & mask].store(value, std::memory_order_relaxed);
+					}
+
+					Int64 mask;
+					std::unique_ptr<std::atomic<T*>[]> elements;
+				};
+
+				Buffer* Grow(Buffer* buffer, Int64 top, Int64 bottom)
+				{
+					auto newBuffer = std::make_unique<Buffer>((buffer->mask + 1) * 2);
+					for (Int64 i = top; i < bottom; ++i)
+						newBuffer->Store(i, buffer->Load(i));
+
+					// Previous buffers are kept alive as thieves may still be reading from them
+					Buffer* newBufferPtr = newBuffer.get();
+					m_buffers.push_back(std::move(newBuffer));
+					m_buffer.store(newBufferPtr, std::memory_order_release);
+
+					return newBufferPtr;
+				}
+
+				alignas(hardware_destructive_interference_size) std::atomic<Int64> m_top = 0;
+				alignas(hardware_destructive_interference_size) std::atomic<Int64> m_bottom = 0;
+				std::atomic<Buffer*> m_buffer;
+				std::vector<std::unique_ptr<Buffer>> m_buffers;
+		};
 	}
 
+	struct TaskScheduler::TaskNode
+	{
+		struct ContinuationLink
+		{
+			TaskNode* task;
+			ContinuationLink* next;
+		};
+
+		static inline ContinuationLink s_finishedTag;
+
+		Task task;
+		std::atomic<ContinuationLink*> continuations; //< lock-free list of tasks waiting on this one, s_finishedTag once executed
+		std::atomic_uint pendingDependencies;
+		std::atomic_uint refCount;
+		std::vector<ContinuationLink> dependencyLinks; //< links inserted in our dependencies continuation lists (capacity is kept when reusing nodes)
+		TaskArena* arena;
+		TaskGroup* group;
+		TaskNode* nextFree;
+	};
+
+	// Fixed-size node allocator, nodes are never given back to the system while the scheduler lives
+	// Allocation is only allowed from the owner thread but nodes can be freed from any thread (they're then sent back to the owner through a lock-free list)
+	class TaskScheduler::TaskArena
+	{
+		public:
+			TaskArena() = default;
+			TaskArena(const TaskArena&) = delete;
+			TaskArena(TaskArena&&) = delete;
+			~TaskArena() = default;
+
+			TaskNode* Allocate()
+			{
+				if (!m_freeList)
+				{
+					// Retrieve nodes freed by other threads
+					m_freeList = m_remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+					if (!m_freeList)
+						AllocateChunk();
+				}
+
+				TaskNode* node = m_freeList;
+				m_freeList = node->nextFree;
+
+				return node;
+			}
+
+			void Free(TaskNode* node)
+			{
+				NazaraAssertMsg(node->arena == this, "node doesn't belong to this arena");
+
+				if (s_localArena == this)
+				{
+					node->nextFree = m_freeList;
+					m_freeList = node;
+				}
+				else
+				{
+					TaskNode* head = m_remoteFreeList.load(std::memory_order_relaxed);
+					do
+					{
+						node->nextFree = head;
+					}
+					while (!m_remoteFreeList.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+				}
+			}
+
+			void MakeLocal()
+			{
+				s_localArena = this;
+			}
+
+			TaskArena& operator=(const TaskArena&) = delete;
+			TaskArena& operator=(TaskArena&&) = delete;
+
+		private:
+			void AllocateChunk()
+			{
+				constexpr std::size_t ChunkSize = 256;
+
+				auto& chunk = m_chunks.emplace_back(std::make_unique<TaskNode[]>(ChunkSize));
+				for (std::size_t i = 0; i < ChunkSize; ++i)
+				{
+					TaskNode& node = chunk[i];
+					node.arena = this;
+					node.nextFree = m_freeList;
+					m_freeList = &node;
+				}
+			}
+
+			static inline thread_local TaskArena* s_localArena = nullptr;
+
+			std::atomic<TaskNode*> m_remoteFreeList = nullptr;
+			std::vector<std::unique_ptr<TaskNode[]>> m_chunks;
+			TaskNode* m_freeList = nullptr;
+	};
+
 	struct TaskScheduler::Data
 	{
+		struct RangeContext
+		{
+			FunctionRef<void(std::size_t begin, std::size_t end)> func;
+			TaskGroup group;
+			std::size_t grainSize;
+		};
+
+		TaskNode* AllocateTask(Task&& task, TaskGroup* group);
+		void DiscardTask(TaskNode* node);
+		void ExecuteTask(TaskNode* node);
+		Worker* GetLocalWorker();
+		void ProcessRange(RangeContext& context, std::size_t begin, std::size_t end);
+		void ReleaseTask(TaskNode* node);
+		bool RunPendingTask(Worker* localWorker);
+		void ScheduleTask(TaskNode* node);
+		void SubmitTask(TaskNode* node, std::span<const TaskHandle> dependencies);
+
+		std::atomic_uint nextWorkerIndex = 0;
 		std::atomic_uint remainingTasks = 0;
-		std::size_t nextWorkerIndex = 0;
+		std::condition_variable groupCondition;
+		std::mutex externalArenaMutex;
+		std::mutex groupMutex;
 		std::vector<Worker> workers;
+		TaskArena externalArena; //< used to allocate tasks from non-worker threads
 		unsigned int workerCount;
 	};
 
@@ -61,20 +304,56 @@ namespace Nz
 
 			~Worker() = default; // WaitForExit has to be called before destroying worker
 
-			void AddTask(TaskScheduler::Task&& task)
+			void AddTask(TaskNode* task)
+			{
+				m_inbox.enqueue(task);
+			}
+
+			// Owner only
+			void AddLocalTask(TaskNode* task)
+			{
+				m_tasks.Push(task);
+			}
+
+			TaskArena& GetArena()
 			{
-				m_tasks.enqueue(std::move(task));
-				WakeUp();
+				return m_arena;
 			}
 
-			void NotifyTaskCompletion()
+			TaskScheduler::Data& GetData()
 			{
-				if (--m_data.remainingTasks == 0)
-					m_data.remainingTasks.notify_one();
+				return m_data;
+			}
+
+			unsigned int GetWorkerIndex() const
+			{
+				return m_workerIndex;
+			}
+
+			bool IsIdle() const
+			{
+				return m_isIdle.load(std::memory_order_relaxed);
+			}
+
+			bool IsQueueEmpty() const
+			{
+				return m_tasks.IsEmpty();
+			}
+
+			// Owner only
+			TaskNode* PopTask()
+			{
+				if (TaskNode* task = m_tasks.Pop())
+					return task;
+
+				return DequeueInbox();
 			}
 
 			void Run()
 			{
+				s_currentWorker = this;
+				m_arena.MakeLocal();
+
 				// Wait until task scheduler started
 				m_notifier.wait(false);
 				m_notifier.clear();
@@ -95,8 +374,8 @@ namespace Nz
 				while (m_running.load(std::memory_order_relaxed))
 				{
 					// Get a task
-					TaskScheduler::Task task;
-					if (!m_tasks.try_dequeue(task))
+					TaskNode* task = PopTask();
+					if (!task)
 					{
 						for (unsigned int workerIndex : randomWorkerIndices)
 						{
@@ -107,18 +386,18 @@ namespace Nz
 					}
 
 					if (task)
-					{
-						task();
-
-						NotifyTaskCompletion();
-					}
+						m_data.ExecuteTask(task);
 					else
 					{
 						// Wait for tasks if we don't have any right now
+						m_isIdle.store(true, std::memory_order_relaxed);
 						m_notifier.wait(false);
 						m_notifier.clear();
+						m_isIdle.store(false, std::memory_order_relaxed);
 					}
 				}
+
+				s_currentWorker = nullptr;
 			}
 
 			void RequestShutdown()
@@ -128,11 +407,12 @@ namespace Nz
 					m_notifier.notify_one();
 			}
 
-			TaskScheduler::Task StealTask()
+			TaskNode* StealTask()
 			{
-				TaskScheduler::Task task;
-				m_tasks.try_dequeue(task);
-				return task;
+				if (TaskNode* task = m_tasks.Steal())
+					return task;
+
+				return DequeueInbox();
 			}
 
 			void WaitForExit()
@@ -154,17 +434,270 @@ namespace Nz
 				NAZARA_UNREACHABLE();
 			}
 
+			static inline thread_local Worker* s_currentWorker = nullptr;
+
 		private:
+			TaskNode* DequeueInbox()
+			{
+				TaskNode* task;
+				if (!m_inbox.try_dequeue(task))
+					return nullptr;
+
+				return task;
+			}
+
+			std::atomic_bool m_isIdle = false;
 			std::atomic_bool m_running;
 			std::atomic_flag m_notifier;
 			std::thread m_thread; //< std::jthread is not yet widely implemented
-			moodycamel::ConcurrentQueue<TaskScheduler::Task> m_tasks;
+			moodycamel::ConcurrentQueue<TaskNode*> m_inbox; //< tasks submitted from other threads
+			TaskArena m_arena;
 			TaskScheduler::Data& m_data;
+			WorkStealingDeque<TaskNode> m_tasks;
 			unsigned int m_workerIndex;
 	};
 
 	NAZARA_WARNING_POP()
 
+	auto TaskScheduler::Data::AllocateTask(Task&& task, TaskGroup* group) -> TaskNode*
+	{
+		TaskNode* node;
+		if (Worker* localWorker = GetLocalWorker())
+			node = localWorker->GetArena().Allocate();
+		else
+		{
+			std::lock_guard lock(externalArenaMutex);
+			node = externalArena.Allocate();
+		}
+
+		node->task = std::move(task);
+		node->continuations.store(nullptr, std::memory_order_relaxed);
+		node->pendingDependencies.store(1, std::memory_order_relaxed); //< prevents the task from being scheduled while its dependencies are registered
+		node->refCount.store(1, std::memory_order_relaxed); //< the scheduler owns a reference until the task is executed
+		node->dependencyLinks.clear();
+		node->group = group;
+
+		remainingTasks++;
+		if (group)
+			group->m_remainingTasks++;
+
+		return node;
+	}
+
+	void TaskScheduler::Data::DiscardTask(TaskNode* node)
+	{
+		// Same bookkeeping as ExecuteTask without running anything, continuations waiting on a discarded task can't run either
+		// (they aren't in any queue, so this is the only way to release them)
+		std::vector<TaskNode*> discardedTasks;
+		discardedTasks.push_back(node);
+
+		while (!discardedTasks.empty())
+		{
+			TaskNode* task = discardedTasks.back();
+			discardedTasks.pop_back();
+
+			task->task.Reset();
+
+			TaskNode::ContinuationLink* link = task->continuations.exchange(&TaskNode::s_finishedTag, std::memory_order_acq_rel);
+			while (link)
+			{
+				TaskNode::ContinuationLink* nextLink = link->next;
+				TaskNode* continuation = link->task;
+				if (--continuation->pendingDependencies == 0)
+					discardedTasks.push_back(continuation);
+
+				link = nextLink;
+			}
+
+			if (TaskGroup* group = task->group)
+			{
+				if (--group->m_remainingTasks == 0)
+				{
+					{
+						std::lock_guard lock(groupMutex);
+					}
+					groupCondition.notify_all();
+				}
+			}
+
+			ReleaseTask(task);
+
+			if (--remainingTasks == 0)
+				remainingTasks.notify_all();
+		}
+	}
+
+	void TaskScheduler::Data::ExecuteTask(TaskNode* node)
+	{
+		node->task();
+		node->task.Reset(); //< release captured resources as soon as possible
+
+		// Continuations are part of the remaining task count, schedule them before signaling our own completion
+		TaskNode::ContinuationLink* link = node->continuations.exchange(&TaskNode::s_finishedTag, std::memory_order_acq_rel);
+		while (link)
+		{
+			// Links are owned by the continuation, which may be executed (and reused) as soon as we schedule it
+			TaskNode::ContinuationLink* nextLink = link->next;
+			TaskNode* continuation = link->task;
+			if (--continuation->pendingDependencies == 0)
+				ScheduleTask(continuation);
+
+			link = nextLink;
+		}
+
+		if (TaskGroup* group = node->group)
+		{
+			if (--group->m_remainingTasks == 0)
+			{
+				// Don't touch the group past this point, it may be destroyed by its waiter as soon as it sees a zero count
+				{
+					std::lock_guard lock(groupMutex);
+				}
+				groupCondition.notify_all();
+			}
+		}
+
+		ReleaseTask(node);
+
+		if (--remainingTasks == 0)
+			remainingTasks.notify_one();
+	}
+
+	auto TaskScheduler::Data::GetLocalWorker() -> Worker*
+	{
+		Worker* worker = Worker::s_currentWorker;
+		if (!worker || &worker->GetData() != this)
+			return nullptr;
+
+		return worker;
+	}
+
+	void TaskScheduler::Data::ProcessRange(RangeContext& context, std::size_t begin, std::size_t end)
+	{
+		Worker* localWorker = GetLocalWorker();
+		while (begin < end)
+		{
+			// Lazy binary splitting: only give away half of the remaining range when our queue is empty,
+			// which means the previous half was stolen (or we're not a worker and can't know if others are idle)
+			if (end - begin > context.grainSize && (!localWorker || localWorker->IsQueueEmpty()))
+			{
+				std::size_t middle = begin + (end - begin) / 2;
+				ScheduleTask(AllocateTask([this, &context, middle, end]
+				{
+					ProcessRange(context, middle, end);
+				}, &context.group));
+
+				end = middle;
+				continue;
+			}
+
+			std::size_t chunkEnd = std::min(begin + context.grainSize, end);
+			context.func(begin, chunkEnd);
+			begin = chunkEnd;
+		}
+	}
+
+	void TaskScheduler::Data::ReleaseTask(TaskNode* node)
+	{
+		if (--node->refCount == 0)
+			node->arena->Free(node);
+	}
+
+	bool TaskScheduler::Data::RunPendingTask(Worker* localWorker)
+	{
+		TaskNode* task = nullptr;
+		if (localWorker)
+			task = localWorker->PopTask();
+
+		if (!task)
+		{
+			for (Worker& worker : workers)
+			{
+				task = worker.StealTask();
+				if (task)
+					break;
+			}
+		}
+
+		if (!task)
+			return false;
+
+		ExecuteTask(task);
+		return true;
+	}
+
+	void TaskScheduler::Data::ScheduleTask(TaskNode* node)
+	{
+		unsigned int workerIndex = nextWorkerIndex.fetch_add(1, std::memory_order_relaxed) % workerCount;
+		if (Worker* localWorker = GetLocalWorker())
+		{
+			// Keep the task close to us (it's most likely related to what we're doing) and wake up someone to steal it if we're busy
+			localWorker->AddLocalTask(node);
+			if (workerCount == 1)
+				return;
+
+			// Waking ourselves is pointless, prefer a sleeping worker and fallback on any other worker (idle state is only a hint)
+			unsigned int localIndex = localWorker->GetWorkerIndex();
+			unsigned int wakeUpIndex = (workerIndex != localIndex) ? workerIndex : (workerIndex + 1) % workerCount;
+			for (unsigned int i = 0; i < workerCount; ++i)
+			{
+				unsigned int candidateIndex = (workerIndex + i) % workerCount;
+				if (candidateIndex != localIndex && workers[candidateIndex].IsIdle())
+				{
+					wakeUpIndex = candidateIndex;
+					break;
+				}
+			}
+
+			workers[wakeUpIndex].WakeUp();
+		}
+		else
+		{
+			Worker& worker = workers[workerIndex];
+			worker.AddTask(node);
+			worker.WakeUp();
+		}
+	}
+
+	void TaskScheduler::Data::SubmitTask(TaskNode* node, std::span<const TaskHandle> dependencies)
+	{
+		// Links must not move once inserted in a list
+		node->dependencyLinks.reserve(dependencies.size());
+
+		for (const TaskHandle& dependency : dependencies)
+		{
+			TaskNode* dependencyNode = dependency.m_node;
+			if (!dependencyNode)
+				continue;
+
+			TaskNode::ContinuationLink* head = dependencyNode->continuations.load(std::memory_order_acquire);
+			if (head == &TaskNode::s_finishedTag)
+				continue;
+
+			TaskNode::ContinuationLink& link = node->dependencyLinks.emplace_back();
+			link.task = node;
+
+			node->pendingDependencies++;
+			do
+			{
+				if (head == &TaskNode::s_finishedTag)
+				{
+					// Dependency finished in the meantime
+					node->pendingDependencies--;
+					node->dependencyLinks.pop_back();
+					break;
+				}
+
+				link.next = head;
+			}
+			while (!dependencyNode->continuations.compare_exchange_weak(head, &link, std::memory_order_acq_rel, std::memory_order_acquire));
+		}
+
+		if (--node->pendingDependencies == 0)
+			ScheduleTask(node);
+	}
+
+
 	TaskScheduler::TaskScheduler(unsigned int workerCount)
 	{
 		if (workerCount == 0)
@@ -190,17 +723,34 @@ namespace Nz
 		// Wait until all threads exited before deleting workers (to avoid data-race where a worker could be freed while another tries to steal their task)
 		for (Worker& worker : m_data->workers)
 			worker.WaitForExit();
+
+		// Free tasks which were never executed, along with the continuations waiting on them
+		for (Worker& worker : m_data->workers)
+		{
+			while (TaskNode* task = worker.PopTask())
+				m_data->DiscardTask(task);
+		}
+	}
+
+	auto TaskScheduler::AddContinuation(const TaskHandle& predecessor, Task&& task, TaskGroup* group) -> TaskHandle
+	{
+		return AddTask(std::move(task), std::span(&predecessor, 1), group);
+	}
+
+	auto TaskScheduler::AddTask(Task&& task, TaskGroup* group) -> TaskHandle
+	{
+		return AddTask(std::move(task), std::span<const TaskHandle>{}, group);
 	}
 
-	void TaskScheduler::AddTask(Task&& task)
+	auto TaskScheduler::AddTask(Task&& task, std::span<const TaskHandle> dependencies, TaskGroup* group) -> TaskHandle
 	{
-		m_data->remainingTasks++;
+		TaskNode* node = m_data->AllocateTask(std::move(task), group);
 
-		Worker& worker = m_data->workers[m_data->nextWorkerIndex++];
-		worker.AddTask(std::move(task));
+		// Reference the task before submitting it, as it may be executed and released right away
+		TaskHandle handle(node);
+		m_data->SubmitTask(node, dependencies);
 
-		if (m_data->nextWorkerIndex >= m_data->workers.size())
-			m_data->nextWorkerIndex = 0;
+		return handle;
 	}
 
 	unsigned int TaskScheduler::GetWorkerCount() const
@@ -211,7 +761,7 @@ namespace Nz
 	void TaskScheduler::WaitForTasks()
 	{
 		// Wait until remaining task counter reaches 0
-		for (;;) 
+		for (;;)
 		{
 			// Load and test current value
 			unsigned int remainingTasks = m_data->remainingTasks.load();
@@ -223,4 +773,106 @@ namespace Nz
 			m_data->remainingTasks.wait(remainingTasks);
 		}
 	}
+
+	void TaskScheduler::WaitForTasks(const TaskGroup& group)
+	{
+		Worker* localWorker = m_data->GetLocalWorker();
+
+		// Help executing tasks while the group isn't done
+		while (!group.IsDone())
+		{
+			if (m_data->RunPendingTask(localWorker))
+				continue;
+
+			if (localWorker)
+			{
+				// A worker can't go to sleep here as the tasks we're waiting on may be stuck behind us
+				std::this_thread::yield();
+			}
+			else
+			{
+				std::unique_lock lock(m_data->groupMutex);
+				m_data->groupCondition.wait(lock, [&] { return group.IsDone(); });
+			}
+		}
+	}
+
+	void TaskScheduler::ParallelForImpl(std::size_t first, std::size_t last, std::size_t grainSize, FunctionRef<void(std::size_t begin, std::size_t end)> func)
+	{
+		if (first >= last)
+			return;
+
+		std::size_t count = last - first;
+		if (grainSize == 0)
+			grainSize = std::max<std::size_t>(count / (m_data->workerCount * 8), 1);
+
+		if (count <= grainSize)
+		{
+			func(first, last);
+			return;
+		}
+
+		Data::RangeContext context{ func, {}, grainSize };
+		m_data->ProcessRange(context, first, last);
+
+		WaitForTasks(context.group);
+	}
+
+
+	TaskScheduler::TaskHandle::TaskHandle(TaskNode* node) :
+	m_node(node)
+	{
+		if (m_node)
+			m_node->refCount++;
+	}
+
+	TaskScheduler::TaskHandle::TaskHandle(const TaskHandle& handle) :
+	TaskHandle(handle.m_node)
+	{
+	}
+
+	TaskScheduler::TaskHandle::~TaskHandle()
+	{
+		Reset();
+	}
+
+	bool TaskScheduler::TaskHandle::IsFinished() const
+	{
+		NazaraAssertMsg(m_node, "invalid task handle");
+		return m_node->continuations.load(std::memory_order_acquire) == &TaskNode::s_finishedTag;
+	}
+
+	void TaskScheduler::TaskHandle::Reset()
+	{
+		if (TaskNode* node = std::exchange(m_node, nullptr))
+		{
+			if (--node->refCount == 0)
+				node->arena->Free(node);
+		}
+	}
+
+	auto TaskScheduler::TaskHandle::operator=(const TaskHandle& handle) -> TaskHandle&
+	{
+		if (this != &handle)
+		{
+			Reset();
+
+			m_node = handle.m_node;
+			if (m_node)
+				m_node->refCount++;
+		}
+
+		return *this;
+	}
+
+	auto TaskScheduler::TaskHandle::operator=(TaskHandle&& handle) noexcept -> TaskHandle&
+	{
+		if (this != &handle)
+		{
+			Reset();
+			m_node = std::exchange(handle.m_node, nullptr);
+		}
+
+		return *this;
+	}
 }
@@ -0,0 +1,342 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/TransformHierarchy.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <NazaraUtils/Algorithm.hpp>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		template<typename T>
+		void Permute(std::vector<T>& values, const std::vector<UInt32>& oldIndices)
+		{
+			std::vector<T> permutedValues(values.size());
+			for (std::size_t i = 0; i < oldIndices.size(); ++i)
+				permutedValues[i] = values[oldIndices[i]];
+
+			values = std::move(permutedValues);
+		}
+	}
+
+	void TransformHierarchy::Clear()
+	{
+		m_entries.clear();
+		m_freeIds.clear();
+		m_updatedTransforms.clear();
+		m_firstRoot = InvalidId;
+
+		m_transformMatrices.clear();
+		m_globalRotations.clear();
+		m_rotations.clear();
+		m_ids.clear();
+		m_depthOffsets.clear();
+		m_parentIndices.clear();
+		m_dirtyFlags.clear();
+		m_globalPositions.clear();
+		m_globalScales.clear();
+		m_positions.clear();
+		m_scales.clear();
+		m_layoutInvalidated = false;
+	}
+
+	/*!
+	* \brief Creates a new transform
+	*
+	* \param parent Parent of the transform, InvalidId to create a root transform
+	* \param position Local position
+	* \param rotation Local rotation
+	* \param scale Local scale
+	*
+	* \return Identifier of the transform, which stays valid until the transform is destroyed
+	*/
+	auto TransformHierarchy::Create(TransformId parent, const Vector3f& position, const Quaternionf& rotation, const Vector3f& scale) -> TransformId
+	{
+		NazaraAssertMsg(parent == InvalidId || IsValid(parent), "invalid parent");
+
+		TransformId transformId;
+		if (!m_freeIds.empty())
+		{
+			transformId = m_freeIds.back();
+			m_freeIds.pop_back();
+		}
+		else
+		{
+			transformId = SafeCast<TransformId>(m_entries.size());
+			m_entries.emplace_back();
+		}
+
+		// Append the transform, depth ordering will be restored by the next update
+		UInt32 index = SafeCast<UInt32>(m_ids.size());
+
+		Entry& entry = m_entries[transformId];
+		entry.firstChild = InvalidId;
+		entry.index = index;
+
+		m_transformMatrices.push_back(Matrix4f::Identity());
+		m_globalRotations.push_back(rotation);
+		m_rotations.push_back(rotation);
+		m_ids.push_back(transformId);
+		m_parentIndices.push_back(InvalidIndex);
+		m_dirtyFlags.push_back(1);
+		m_globalPositions.push_back(position);
+		m_globalScales.push_back(scale);
+		m_positions.push_back(position);
+		m_scales.push_back(scale);
+
+		LinkChild(transformId, parent);
+		m_layoutInvalidated = true;
+
+		return transformId;
+	}
+
+	/*!
+	* \brief Destroys a transform, its children become root transforms (keeping their local values)
+	*/
+	void TransformHierarchy::Destroy(TransformId transformId)
+	{
+		UInt32 index = GetIndex(transformId);
+
+		TransformId childId = m_entries[transformId].firstChild;
+		while (childId != InvalidId)
+		{
+			TransformId nextChildId = m_entries[childId].nextSibling;
+
+			UnlinkChild(childId);
+			LinkChild(childId, InvalidId);
+			Invalidate(m_entries[childId].index);
+
+			childId = nextChildId;
+		}
+
+		UnlinkChild(transformId);
+
+		// Swap with the last transform
+		UInt32 lastIndex = SafeCast<UInt32>(m_ids.size() - 1);
+		if (index != lastIndex)
+		{
+			m_transformMatrices[index] = m_transformMatrices[lastIndex];
+			m_globalRotations[index] = m_globalRotations[lastIndex];
+			m_rotations[index] = m_rotations[lastIndex];
+			m_ids[index] = m_ids[lastIndex];
+			m_parentIndices[index] = m_parentIndices[lastIndex];
+			m_dirtyFlags[index] = m_dirtyFlags[lastIndex];
+			m_globalPositions[index] = m_globalPositions[lastIndex];
+			m_globalScales[index] = m_globalScales[lastIndex];
+			m_positions[index] = m_positions[lastIndex];
+			m_scales[index] = m_scales[lastIndex];
+
+			m_entries[m_ids[index]].index = index;
+		}
+
+		m_transformMatrices.pop_back();
+		m_globalRotations.pop_back();
+		m_rotations.pop_back();
+		m_ids.pop_back();
+		m_parentIndices.pop_back();
+		m_dirtyFlags.pop_back();
+		m_globalPositions.pop_back();
+		m_globalScales.pop_back();
+		m_positions.pop_back();
+		m_scales.pop_back();
+
+		m_entries[transformId].index = InvalidIndex;
+		m_freeIds.push_back(transformId);
+
+		m_layoutInvalidated = true;
+	}
+
+	/*!
+	* \brief Changes the parent of a transform, keeping its local values
+	*
+	* \param transformId Transform to reparent
+	* \param parent New parent, InvalidId to make it a root transform
+	*/
+	void TransformHierarchy::SetParent(TransformId transformId, TransformId parent)
+	{
+		NazaraAssertMsg(IsValid(transformId), "invalid transform");
+		NazaraAssertMsg(parent == InvalidId || IsValid(parent), "invalid parent");
+
+		Entry& entry = m_entries[transformId];
+		if (entry.parent == parent)
+			return;
+
+#ifdef NAZARA_DEBUG
+		for (TransformId ancestorId = parent; ancestorId != InvalidId; ancestorId = m_entries[ancestorId].parent)
+			NazaraAssertMsg(ancestorId != transformId, "a transform cannot be its own ancestor");
+#endif
+
+		UnlinkChild(transformId);
+		LinkChild(transformId, parent);
+		Invalidate(entry.index);
+
+		m_layoutInvalidated = true;
+	}
+
+	/*!
+	* \brief Computes the global values and world matrix of every modified transform (and of their children)
+	*
+	* Transforms are processed one depth level at a time, in a linear pass over the transform arrays.
+	* Transforms of a same level are independent and get split between the workers of the task scheduler.
+	*
+	* \param taskScheduler Task scheduler used to process depth levels concurrently, nullptr processes everything on the calling thread
+	* \param grainSize Minimum number of transforms processed by a single task, smaller levels are processed on the calling thread
+	*/
+	void TransformHierarchy::Update(TaskScheduler* taskScheduler, std::size_t grainSize)
+	{
+		if (m_layoutInvalidated)
+		{
+			RebuildLayout();
+			m_layoutInvalidated = false;
+		}
+
+		for (std::size_t depth = 0; depth < GetDepthCount(); ++depth)
+		{
+			UInt32 firstIndex = m_depthOffsets[depth];
+			UInt32 lastIndex = m_depthOffsets[depth + 1];
+
+			if (taskScheduler && lastIndex - firstIndex > grainSize)
+			{
+				taskScheduler->ParallelFor(firstIndex, lastIndex, grainSize, [this](std::size_t begin, std::size_t end)
+				{
+					UpdateRange(SafeCast<UInt32>(begin), SafeCast<UInt32>(end));
+				});
+			}
+			else
+				UpdateRange(firstIndex, lastIndex);
+		}
+
+		m_updatedTransforms.clear();
+		for (std::size_t i = 0; i < m_dirtyFlags.size(); ++i)
+		{
+			if (m_dirtyFlags[i])
+			{
+				m_updatedTransforms.push_back(m_ids[i]);
+				m_dirtyFlags[i] = 0;
+			}
+		}
+	}
+
+	void TransformHierarchy::LinkChild(TransformId transformId, TransformId parent)
+	{
+		TransformId& firstSibling = (parent != InvalidId) ? m_entries[parent].firstChild : m_firstRoot;
+
+		Entry& entry = m_entries[transformId];
+		entry.parent = parent;
+		entry.previousSibling = InvalidId;
+		entry.nextSibling = firstSibling;
+
+		if (firstSibling != InvalidId)
+			m_entries[firstSibling].previousSibling = transformId;
+
+		firstSibling = transformId;
+	}
+
+	void TransformHierarchy::RebuildLayout()
+	{
+		// Breadth-first traversal, giving an order where every depth level is contiguous
+		std::vector<UInt32> oldIndices;
+		oldIndices.reserve(m_ids.size());
+
+		std::vector<TransformId> orderedIds;
+		orderedIds.reserve(m_ids.size());
+
+		for (TransformId rootId = m_firstRoot; rootId != InvalidId; rootId = m_entries[rootId].nextSibling)
+			orderedIds.push_back(rootId);
+
+		m_depthOffsets.clear();
+		m_depthOffsets.push_back(0);
+
+		std::size_t levelStart = 0;
+		while (levelStart < orderedIds.size())
+		{
+			std::size_t levelEnd = orderedIds.size();
+			for (std::size_t i = levelStart; i < levelEnd; ++i)
+			{
+				for (TransformId childId = m_entries[orderedIds[i]].firstChild; childId != InvalidId; childId = m_entries[childId].nextSibling)
+					orderedIds.push_back(childId);
+			}
+
+			m_depthOffsets.push_back(SafeCast<UInt32>(levelEnd));
+			levelStart = levelEnd;
+		}
+
+		NazaraAssertMsg(orderedIds.size() == m_ids.size(), "hierarchy is corrupted");
+
+		for (TransformId transformId : orderedIds)
+			oldIndices.push_back(m_entries[transformId].index);
+
+		Permute(m_transformMatrices, oldIndices);
+		Permute(m_globalRotations, oldIndices);
+		Permute(m_rotations, oldIndices);
+		Permute(m_dirtyFlags, oldIndices);
+		Permute(m_globalPositions, oldIndices);
+		Permute(m_globalScales, oldIndices);
+		Permute(m_positions, oldIndices);
+		Permute(m_scales, oldIndices);
+		m_ids = std::move(orderedIds);
+
+		for (std::size_t i = 0; i < m_ids.size(); ++i)
+			m_entries[m_ids[i]].index = SafeCast<UInt32>(i);
+
+		for (std::size_t i = 0; i < m_ids.size(); ++i)
+		{
+			TransformId parent = m_entries[m_ids[i]].parent;
+			m_parentIndices[i] = (parent != InvalidId) ? m_entries[parent].index : InvalidIndex;
+		}
+	}
+
+	void TransformHierarchy::UnlinkChild(TransformId transformId)
+	{
+		Entry& entry = m_entries[transformId];
+		if (entry.previousSibling != InvalidId)
+			m_entries[entry.previousSibling].nextSibling = entry.nextSibling;
+		else if (entry.parent != InvalidId)
+			m_entries[entry.parent].firstChild = entry.nextSibling;
+		else
+			m_firstRoot = entry.nextSibling;
+
+		if (entry.nextSibling != InvalidId)
+			m_entries[entry.nextSibling].previousSibling = entry.previousSibling;
+
+		entry.parent = InvalidId;
+		entry.nextSibling = InvalidId;
+		entry.previousSibling = InvalidId;
+	}
+
+	void TransformHierarchy::UpdateRange(UInt32 firstIndex, UInt32 lastIndex)
+	{
+		// Parents are on the previous depth level, which is already up to date (including their dirty flag)
+		for (UInt32 i = firstIndex; i < lastIndex; ++i)
+		{
+			UInt32 parentIndex = m_parentIndices[i];
+			if (parentIndex != InvalidIndex)
+			{
+				if (!m_dirtyFlags[i] && !m_dirtyFlags[parentIndex])
+					continue;
+
+				const Quaternionf& parentRotation = m_globalRotations[parentIndex];
+				const Vector3f& parentScale = m_globalScales[parentIndex];
+
+				m_globalPositions[i] = parentRotation * (parentScale * m_positions[i]) + m_globalPositions[parentIndex];
+				m_globalRotations[i] = parentRotation * Quaternionf::Mirror(m_rotations[i], parentScale);
+				m_globalRotations[i].Normalize();
+				m_globalScales[i] = parentScale * m_scales[i];
+				m_dirtyFlags[i] = 1;
+			}
+			else
+			{
+				if (!m_dirtyFlags[i])
+					continue;
+
+				m_globalPositions[i] = m_positions[i];
+				m_globalRotations[i] = m_rotations[i];
+				m_globalScales[i] = m_scales[i];
+			}
+
+			m_transformMatrices[i] = Matrix4f::Transform(m_globalPositions[i], m_globalRotations[i], m_globalScales[i]);
+		}
+	}
+}
@@ -401,6 +401,32 @@ namespace Nz
 			});
 
 			NazaraAssertMsg(s_declarations[VertexLayout::Matrix4]->GetStride() == sizeof(Matrix4f), "Invalid stride for declaration VertexLayout::Matrix4");
+
+			// VertexLayout::Matrix4_Instance : Matrix4f (per instance)
+			s_declarations[VertexLayout::Matrix4_Instance] = NewDeclaration(VertexInputRate::Instance, {
+				{
+					VertexComponent::Userdata,
+					ComponentType::Float4,
+					0
+				},
+				{
+					VertexComponent::Userdata,
+					ComponentType::Float4,
+					1
+				},
+				{
+					VertexComponent::Userdata,
+					ComponentType::Float4,
+					2
+				},
+				{
+					VertexComponent::Userdata,
+					ComponentType::Float4,
+					3
+				}
+			});
+
+			NazaraAssertMsg(s_declarations[VertexLayout::Matrix4_Instance]->GetStride() == sizeof(Matrix4f), "Invalid stride for declaration VertexLayout::Matrix4_Instance");
 		}
 		catch (const std::exception& e)
 		{
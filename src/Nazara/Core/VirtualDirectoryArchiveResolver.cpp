@@ -0,0 +1,401 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Core module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Core/VirtualDirectoryArchiveResolver.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/MemoryView.hpp>
+#include <Nazara/Core/Formats/ArchiveConstants.hpp>
+#include <lz4.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace Nz
+{
+	struct VirtualDirectoryArchiveResolver::Archive
+	{
+		std::string_view GetPath(const ArchiveEntry& entry) const
+		{
+			return std::string_view(strings + entry.pathOffset, entry.pathLength);
+		}
+
+		template<typename F>
+		std::optional<UInt32> FindEntry(UInt64 pathHash, F&& comparePath) const
+		{
+			// Archive opening ensures every bucket is either empty or valid and that at least one bucket is empty, so this always ends
+			UInt32 bucketMask = header->bucketCount - 1;
+			for (UInt32 bucketIndex = static_cast<UInt32>(pathHash & bucketMask);; bucketIndex = (bucketIndex + 1) & bucketMask)
+			{
+				UInt32 entryIndex = buckets[bucketIndex];
+				if (entryIndex == 0)
+					return std::nullopt;
+
+				const ArchiveEntry& entry = entries[entryIndex - 1];
+				if (entry.pathHash == pathHash && comparePath(GetPath(entry)))
+					return entryIndex - 1;
+			}
+		}
+
+		File file;
+		const ArchiveEntry* entries;
+		const ArchiveHeader* header;
+		const UInt32* buckets;
+		const UInt32* children;
+		const UInt8* data;
+		const char* strings;
+		UInt64 size;
+	};
+
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		using Archive = VirtualDirectoryArchiveResolver::Archive;
+
+		// Stored files are read in-place from the mapped archive, which is kept alive by the stream
+		class ArchiveFileView final : public MemoryView
+		{
+			public:
+				ArchiveFileView(std::shared_ptr<const Archive> archive, const void* data, UInt64 size) :
+				MemoryView(data, size),
+				m_archive(std::move(archive))
+				{
+				}
+
+			private:
+				std::shared_ptr<const Archive> m_archive;
+		};
+
+		// Compressed files are only decompressed on first access, enumerating a directory doesn't cost anything
+		class ArchiveCompressedStream final : public Stream
+		{
+			public:
+				ArchiveCompressedStream(std::shared_ptr<const Archive> archive, const UInt8* compressedData, UInt64 compressedSize, UInt64 size) :
+				Stream(StreamOption::MemoryMapped, OpenMode::Read),
+				m_archive(std::move(archive)),
+				m_compressedData(compressedData),
+				m_compressedSize(compressedSize),
+				m_cursor(0),
+				m_size(size),
+				m_isDecompressed(false)
+				{
+				}
+
+				UInt64 GetSize() const override
+				{
+					return m_size;
+				}
+
+			private:
+				bool Decompress() const
+				{
+					if (m_isDecompressed)
+						return true;
+
+					m_content.Resize(m_size);
+					int decompressedSize = LZ4_decompress_safe(reinterpret_cast<const char*>(m_compressedData), reinterpret_cast<char*>(m_content.GetBuffer()), static_cast<int>(m_compressedSize), static_cast<int>(m_size));
+					if (decompressedSize < 0 || static_cast<UInt64>(decompressedSize) != m_size)
+					{
+						NazaraError("failed to decompress archive entry (corrupted data?)");
+						m_content.Clear();
+						return false;
+					}
+
+					m_isDecompressed = true;
+					m_archive.reset(); //< we no longer need the archive
+					return true;
+				}
+
+				void FlushStream() override
+				{
+				}
+
+				void* GetMemoryMappedPointer() const override
+				{
+					if (!Decompress())
+						return nullptr;
+
+					return m_content.GetBuffer();
+				}
+
+				std::size_t ReadBlock(void* buffer, std::size_t size) override
+				{
+					if (!Decompress())
+						return 0;
+
+					std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, m_size - m_cursor));
+					if (buffer && readSize > 0)
+						std::memcpy(buffer, m_content.GetBuffer() + m_cursor, readSize);
+
+					m_cursor += readSize;
+					return readSize;
+				}
+
+				bool SeekStreamCursor(UInt64 offset) override
+				{
+					m_cursor = std::min(offset, m_size);
+					return true;
+				}
+
+				UInt64 TellStreamCursor() const override
+				{
+					return m_cursor;
+				}
+
+				bool TestStreamEnd() const override
+				{
+					return m_cursor >= m_size;
+				}
+
+				std::size_t WriteBlock(const void* /*buffer*/, std::size_t /*size*/) override
+				{
+					return 0;
+				}
+
+				mutable ByteArray m_content;
+				mutable std::shared_ptr<const Archive> m_archive;
+				const UInt8* m_compressedData;
+				UInt64 m_compressedSize;
+				UInt64 m_cursor;
+				UInt64 m_size;
+				mutable bool m_isDecompressed;
+		};
+
+		bool IsRangeValid(UInt64 offset, UInt64 count, UInt64 elementSize, UInt64 totalSize)
+		{
+			return offset <= totalSize && count <= (totalSize - offset) / elementSize;
+		}
+	}
+
+	VirtualDirectoryArchiveResolver::VirtualDirectoryArchiveResolver(std::shared_ptr<const Archive> archive, std::string_view directoryPath) :
+	m_archive(std::move(archive)),
+	m_directoryPath(directoryPath),
+	m_childCount(0),
+	m_childOffset(0)
+	{
+		NazaraAssertMsg(m_archive, "invalid archive");
+
+		if (m_directoryPath.empty())
+		{
+			m_childCount = m_archive->header->rootChildCount;
+			m_childOffset = m_archive->header->rootChildOffset;
+		}
+		else
+		{
+			std::optional<UInt32> entryIndex = m_archive->FindEntry(ArchivePathHash(m_directoryPath), [&](std::string_view path) { return path == m_directoryPath; });
+			if (entryIndex)
+			{
+				const ArchiveEntry& entry = m_archive->entries[*entryIndex];
+				if (entry.type == ArchiveEntryType::Directory)
+				{
+					m_childCount = static_cast<UInt32>(entry.size);
+					m_childOffset = static_cast<UInt32>(entry.dataOffset);
+				}
+			}
+		}
+	}
+
+	void VirtualDirectoryArchiveResolver::ForEach(std::weak_ptr<VirtualDirectory> parent, FunctionRef<bool(std::string_view name, VirtualDirectory::Entry&& entry)> callback) const
+	{
+		for (UInt32 i = 0; i < m_childCount; ++i)
+		{
+			UInt32 entryIndex = m_archive->children[m_childOffset + i];
+
+			std::string_view entryName = m_archive->GetPath(m_archive->entries[entryIndex]);
+			if (std::size_t separatorPos = entryName.find_last_of('/'); separatorPos != entryName.npos)
+				entryName.remove_prefix(separatorPos + 1);
+
+			if (!callback(entryName, BuildEntry(parent, entryIndex)))
+				return;
+		}
+	}
+
+	std::optional<VirtualDirectory::Entry> VirtualDirectoryArchiveResolver::Resolve(std::weak_ptr<VirtualDirectory> parent, const std::string_view* parts, std::size_t partCount) const
+	{
+		if (partCount == 0)
+			return std::nullopt;
+
+		// Hash the full path without building it
+		UInt64 pathHash = ArchivePathHashSeed;
+		if (!m_directoryPath.empty())
+			pathHash = ArchivePathHashAppend(pathHash, m_directoryPath);
+
+		for (std::size_t i = 0; i < partCount; ++i)
+		{
+			if (i > 0 || !m_directoryPath.empty())
+				pathHash = ArchivePathHashAppend(pathHash, "/");
+
+			pathHash = ArchivePathHashAppend(pathHash, parts[i]);
+		}
+
+		auto ComparePath = [&](std::string_view path)
+		{
+			auto ConsumePrefix = [&](std::string_view prefix)
+			{
+				if (!path.starts_with(prefix))
+					return false;
+
+				path.remove_prefix(prefix.size());
+				return true;
+			};
+
+			if (!m_directoryPath.empty() && (!ConsumePrefix(m_directoryPath) || !ConsumePrefix("/")))
+				return false;
+
+			for (std::size_t i = 0; i < partCount; ++i)
+			{
+				if (i > 0 && !ConsumePrefix("/"))
+					return false;
+
+				if (!ConsumePrefix(parts[i]))
+					return false;
+			}
+
+			return path.empty();
+		};
+
+		std::optional<UInt32> entryIndex = m_archive->FindEntry(pathHash, ComparePath);
+		if (!entryIndex)
+			return std::nullopt;
+
+		return BuildEntry(std::move(parent), *entryIndex);
+	}
+
+	std::shared_ptr<VirtualDirectoryArchiveResolver> VirtualDirectoryArchiveResolver::Open(const std::filesystem::path& archivePath)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		std::shared_ptr<Archive> archive = std::make_shared<Archive>();
+		if (!archive->file.Open(archivePath, OpenMode::Read | OpenMode::MemoryMapped | OpenMode::RandomAccess))
+		{
+			NazaraError("failed to open archive {0}", archivePath);
+			return nullptr;
+		}
+
+		archive->data = static_cast<const UInt8*>(archive->file.GetMappedPointer());
+		archive->size = archive->file.GetSize();
+		if (!archive->data || archive->size < sizeof(ArchiveHeader))
+		{
+			NazaraError("{0} is not a valid archive (file is too small)", archivePath);
+			return nullptr;
+		}
+
+		const ArchiveHeader& header = *reinterpret_cast<const ArchiveHeader*>(archive->data);
+		if (header.magic != Archive_Magic)
+		{
+			if (header.magic == Archive_MagicSwapped)
+				NazaraError("{0} was built on a machine with a different endianness", archivePath);
+			else
+				NazaraError("{0} is not a valid archive (magic mismatch)", archivePath);
+
+			return nullptr;
+		}
+
+		if (header.version != Archive_Version)
+		{
+			NazaraError("{0} has an unsupported version ({1}, expected {2})", archivePath, header.version, Archive_Version);
+			return nullptr;
+		}
+
+		if (!std::has_single_bit(header.bucketCount) || header.bucketCount <= header.entryCount ||
+		    !IsRangeValid(header.entryTableOffset, header.entryCount, sizeof(ArchiveEntry), archive->size) ||
+		    !IsRangeValid(header.bucketTableOffset, header.bucketCount, sizeof(UInt32), archive->size) ||
+		    !IsRangeValid(header.childrenTableOffset, header.childCount, sizeof(UInt32), archive->size) ||
+		    !IsRangeValid(header.stringTableOffset, header.stringTableSize, 1, archive->size) ||
+		    header.entryTableOffset % alignof(ArchiveEntry) != 0 || header.bucketTableOffset % alignof(UInt32) != 0 || header.childrenTableOffset % alignof(UInt32) != 0 ||
+		    UInt64(header.rootChildOffset) + header.rootChildCount > header.childCount)
+		{
+			NazaraError("{0} is not a valid archive (corrupted header)", archivePath);
+			return nullptr;
+		}
+
+		archive->header = &header;
+		archive->entries = reinterpret_cast<const ArchiveEntry*>(archive->data + header.entryTableOffset);
+		archive->buckets = reinterpret_cast<const UInt32*>(archive->data + header.bucketTableOffset);
+		archive->children = reinterpret_cast<const UInt32*>(archive->data + header.childrenTableOffset);
+		archive->strings = reinterpret_cast<const char*>(archive->data + header.stringTableOffset);
+
+		// Validate everything once so lookups don't have to
+		for (UInt32 i = 0; i < header.entryCount; ++i)
+		{
+			const ArchiveEntry& entry = archive->entries[i];
+
+			bool isValid = UInt64(entry.pathOffset) + entry.pathLength <= header.stringTableSize;
+			switch (entry.type)
+			{
+				case ArchiveEntryType::Directory:
+					isValid = isValid && entry.dataOffset <= header.childCount && entry.size <= header.childCount - entry.dataOffset;
+					break;
+
+				case ArchiveEntryType::File:
+					isValid = isValid && IsRangeValid(entry.dataOffset, entry.storedSize, 1, archive->size) && entry.compression <= UnderlyingCast(ArchiveCompression::Max);
+					if (entry.compression == UnderlyingCast(ArchiveCompression::None))
+						isValid = isValid && entry.storedSize == entry.size;
+					else
+						isValid = isValid && entry.storedSize <= std::numeric_limits<int>::max() && entry.size <= std::numeric_limits<int>::max();
+					break;
+
+				default:
+					isValid = false;
+					break;
+			}
+
+			if (!isValid)
+			{
+				NazaraError("{0} is not a valid archive (corrupted entry #{1})", archivePath, i);
+				return nullptr;
+			}
+		}
+
+		for (UInt32 i = 0; i < header.childCount; ++i)
+		{
+			if (archive->children[i] >= header.entryCount)
+			{
+				NazaraError("{0} is not a valid archive (corrupted children table)", archivePath);
+				return nullptr;
+			}
+		}
+
+		// Lookups probe buckets until an empty one is found
+		bool hasEmptyBucket = false;
+		for (UInt32 i = 0; i < header.bucketCount; ++i)
+		{
+			UInt32 entryIndex = archive->buckets[i];
+			if (entryIndex == 0)
+				hasEmptyBucket = true;
+			else if (entryIndex > header.entryCount)
+			{
+				NazaraError("{0} is not a valid archive (corrupted bucket table)", archivePath);
+				return nullptr;
+			}
+		}
+
+		if (!hasEmptyBucket)
+		{
+			NazaraError("{0} is not a valid archive (bucket table has no empty bucket)", archivePath);
+			return nullptr;
+		}
+
+		return std::make_shared<VirtualDirectoryArchiveResolver>(std::move(archive));
+	}
+
+	VirtualDirectory::Entry VirtualDirectoryArchiveResolver::BuildEntry(std::weak_ptr<VirtualDirectory> parent, UInt32 entryIndex) const
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		const ArchiveEntry& entry = m_archive->entries[entryIndex];
+		if (entry.type == ArchiveEntryType::Directory)
+		{
+			VirtualDirectoryPtr virtualDir = std::make_shared<VirtualDirectory>(std::make_shared<VirtualDirectoryArchiveResolver>(m_archive, m_archive->GetPath(entry)), std::move(parent));
+			return VirtualDirectory::DirectoryEntry{ { std::move(virtualDir) } };
+		}
+
+		const UInt8* fileData = m_archive->data + entry.dataOffset;
+		if (entry.compression == UnderlyingCast(ArchiveCompression::LZ4))
+			return VirtualDirectory::FileEntry{ std::make_shared<ArchiveCompressedStream>(m_archive, fileData, entry.storedSize, entry.size) };
+
+		return VirtualDirectory::FileEntry{ std::make_shared<ArchiveFileView>(m_archive, fileData, entry.size) };
+	}
+}
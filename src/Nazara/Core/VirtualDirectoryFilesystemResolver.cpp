@@ -18,12 +18,15 @@ namespace Nz
 			VirtualDirectory::Entry entry;
 			if (physicalEntry.is_regular_file())
 			{
-				if (!callback(filename, VirtualDirectory::FileEntry{ std::make_shared<File>(physicalEntry.path(), m_fileOpenMode) }))
+				std::error_code ec;
+				UInt64 fileSize = physicalEntry.file_size(ec);
+
+				if (!callback(filename, VirtualDirectory::FileEntry{ OpenFile(physicalEntry.path(), (!ec) ? fileSize : 0) }))
 					return;
 			}
 			else if (physicalEntry.is_directory())
 			{
-				VirtualDirectoryPtr virtualDir = std::make_shared<VirtualDirectory>(std::make_shared<VirtualDirectoryFilesystemResolver>(physicalEntry.path()), parent);
+				VirtualDirectoryPtr virtualDir = std::make_shared<VirtualDirectory>(std::make_shared<VirtualDirectoryFilesystemResolver>(physicalEntry.path(), m_fileOpenMode, m_memoryMappingThreshold), parent);
 				if (!callback(filename, VirtualDirectory::DirectoryEntry{ { std::move(virtualDir) } }))
 					return;
 			}
@@ -40,13 +43,28 @@ namespace Nz
 
 		VirtualDirectory::Entry entry;
 		if (std::filesystem::is_regular_file(status))
-			return VirtualDirectory::FileEntry{ std::make_shared<File>(std::move(filePath), m_fileOpenMode) };
+		{
+			std::error_code ec;
+			UInt64 fileSize = std::filesystem::file_size(filePath, ec);
+
+			return VirtualDirectory::FileEntry{ OpenFile(std::move(filePath), (!ec) ? fileSize : 0) };
+		}
 		else if (std::filesystem::is_directory(status))
 		{
-			VirtualDirectoryPtr virtualDir = std::make_shared<VirtualDirectory>(std::make_shared<VirtualDirectoryFilesystemResolver>(std::move(filePath)), parent);
+			VirtualDirectoryPtr virtualDir = std::make_shared<VirtualDirectory>(std::make_shared<VirtualDirectoryFilesystemResolver>(std::move(filePath), m_fileOpenMode, m_memoryMappingThreshold), parent);
 			return VirtualDirectory::DirectoryEntry{ { std::move(virtualDir) } };
 		}
 		else
 			return std::nullopt; //< either not known or of a special type
 	}
+
+	std::shared_ptr<File> VirtualDirectoryFilesystemResolver::OpenFile(std::filesystem::path filePath, UInt64 fileSize) const
+	{
+		// Large read-only files are memory-mapped, letting VirtualDirectory::GetFileContent hand their content out without copying it
+		// (with OpenMode::Defer, which ForEach relies on, the mapping only happens on first access)
+		if (m_memoryMappingThreshold > 0 && fileSize >= m_memoryMappingThreshold && m_fileOpenMode.Test(OpenMode::Read) && !m_fileOpenMode.Test(OpenMode::Write))
+			return std::make_shared<File>(std::move(filePath), m_fileOpenMode | OpenMode::MemoryMapped);
+
+		return std::make_shared<File>(std::move(filePath), m_fileOpenMode);
+	}
 }
@@ -8,11 +8,20 @@
 #include <Nazara/Core/Win32/Win32Utils.hpp>
 #include <NazaraUtils/CallOnExit.hpp>
 #include <NazaraUtils/PathUtils.hpp>
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
 
 namespace Nz::PlatformImpl
 {
 	FileImpl::FileImpl(const File* parent) :
+	m_handle(INVALID_HANDLE_VALUE),
+	m_mappingHandle(nullptr),
+	m_mappedCursor(0),
+	m_mappedSize(0),
+	m_mappedData(nullptr),
+	m_isMemoryMapped(false),
 	m_endOfFile(false),
 	m_endOfFileUpdated(true)
 	{
@@ -21,12 +30,21 @@ namespace Nz::PlatformImpl
 
 	FileImpl::~FileImpl()
 	{
-		if (m_handle)
+		if (m_mappedData)
+			UnmapViewOfFile(m_mappedData);
+
+		if (m_mappingHandle)
+			CloseHandle(m_mappingHandle);
+
+		if (m_handle != INVALID_HANDLE_VALUE)
 			CloseHandle(m_handle);
 	}
 
 	bool FileImpl::EndOfFile() const
 	{
+		if (m_isMemoryMapped)
+			return m_mappedCursor >= m_mappedSize;
+
 		if (!m_endOfFileUpdated)
 		{
 			LARGE_INTEGER fileSize;
@@ -42,12 +60,18 @@ namespace Nz::PlatformImpl
 
 	void FileImpl::Flush()
 	{
+		if (m_isMemoryMapped)
+			return;
+
 		if (!FlushFileBuffers(m_handle))
 			NazaraError("Unable to flush file: {0}", Error::GetLastSystemError());
 	}
 
 	UInt64 FileImpl::GetCursorPos() const
 	{
+		if (m_isMemoryMapped)
+			return m_mappedCursor;
+
 		LARGE_INTEGER zero;
 		zero.QuadPart = 0;
 
@@ -57,8 +81,21 @@ namespace Nz::PlatformImpl
 		return position.QuadPart;
 	}
 
+	const void* FileImpl::GetMappedPointer() const
+	{
+		return m_mappedData;
+	}
+
+	bool FileImpl::IsMemoryMapped() const
+	{
+		return m_isMemoryMapped;
+	}
+
 	bool FileImpl::Open(const std::filesystem::path& filePath, OpenModeFlags mode)
 	{
+		if (mode.Test(OpenMode::MemoryMapped))
+			return MapFile(filePath, mode);
+
 		DWORD access = 0;
 		DWORD shareMode = FILE_SHARE_READ;
 		DWORD openMode = 0;
@@ -89,13 +126,29 @@ namespace Nz::PlatformImpl
 		if (!mode.Test(OpenMode::Lock))
 			shareMode |= FILE_SHARE_WRITE;
 
-		m_handle = CreateFileW(PathToWideTemp(filePath).data(), access, shareMode, nullptr, openMode, 0, nullptr);
+		DWORD flags = 0;
+		if (mode.Test(OpenMode::SequentialAccess))
+			flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+		else if (mode.Test(OpenMode::RandomAccess))
+			flags |= FILE_FLAG_RANDOM_ACCESS;
+
+		m_handle = CreateFileW(PathToWideTemp(filePath).data(), access, shareMode, nullptr, openMode, flags, nullptr);
 
 		return m_handle != INVALID_HANDLE_VALUE;
 	}
 
 	std::size_t FileImpl::Read(void* buffer, std::size_t size)
 	{
+		if (m_isMemoryMapped)
+		{
+			std::size_t readSize = static_cast<std::size_t>(std::min<UInt64>(size, m_mappedSize - std::min(m_mappedCursor, m_mappedSize)));
+			if (readSize > 0)
+				std::memcpy(buffer, &m_mappedData[m_mappedCursor], readSize);
+
+			m_mappedCursor += readSize;
+			return readSize;
+		}
+
 		//UInt64 oldCursorPos = GetCursorPos();
 
 		DWORD read = 0;
@@ -154,6 +207,23 @@ namespace Nz::PlatformImpl
 				return false;
 		}
 
+		if (m_isMemoryMapped)
+		{
+			Int64 base;
+			switch (moveMethod)
+			{
+				case FILE_CURRENT: base = static_cast<Int64>(m_mappedCursor); break;
+				case FILE_END:     base = static_cast<Int64>(m_mappedSize); break;
+				default:           base = 0; break;
+			}
+
+			if (base + offset < 0)
+				return false;
+
+			m_mappedCursor = std::min(static_cast<UInt64>(base + offset), m_mappedSize);
+			return true;
+		}
+
 		LARGE_INTEGER distance;
 		distance.QuadPart = offset;
 
@@ -164,6 +234,9 @@ namespace Nz::PlatformImpl
 
 	bool FileImpl::SetSize(UInt64 size)
 	{
+		if (m_isMemoryMapped)
+			return false;
+
 		UInt64 cursorPos = GetCursorPos();
 
 		CallOnExit resetCursor([this, cursorPos] ()
@@ -189,6 +262,9 @@ namespace Nz::PlatformImpl
 
 	std::size_t FileImpl::Write(const void* buffer, std::size_t size)
 	{
+		if (m_isMemoryMapped)
+			return 0;
+
 		DWORD written = 0;
 
 		LARGE_INTEGER cursorPos;
@@ -200,4 +276,55 @@ namespace Nz::PlatformImpl
 
 		return written;
 	}
+
+	bool FileImpl::MapFile(const std::filesystem::path& filePath, OpenModeFlags mode)
+	{
+		if (mode.Test(OpenMode::Write))
+		{
+			NazaraError("memory-mapped files are read-only");
+			return false;
+		}
+
+		DWORD shareMode = FILE_SHARE_READ;
+		if (!mode.Test(OpenMode::Lock))
+			shareMode |= FILE_SHARE_WRITE;
+
+		DWORD flags = 0;
+		if (mode.Test(OpenMode::SequentialAccess))
+			flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+		else if (mode.Test(OpenMode::RandomAccess))
+			flags |= FILE_FLAG_RANDOM_ACCESS;
+
+		m_handle = CreateFileW(PathToWideTemp(filePath).data(), GENERIC_READ, shareMode, nullptr, OPEN_EXISTING, flags, nullptr);
+		if (m_handle == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(m_handle, &fileSize))
+			return false;
+
+		if (static_cast<UInt64>(fileSize.QuadPart) > std::numeric_limits<std::size_t>::max())
+		{
+			NazaraError("file is too large to be memory-mapped");
+			return false;
+		}
+
+		// CreateFileMapping doesn't support empty files, they are "mapped" to a null pointer
+		if (fileSize.QuadPart > 0)
+		{
+			m_mappingHandle = CreateFileMappingW(m_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!m_mappingHandle)
+				return false;
+
+			m_mappedData = static_cast<UInt8*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+			if (!m_mappedData)
+				return false;
+		}
+
+		m_mappedSize = static_cast<UInt64>(fileSize.QuadPart);
+		m_mappedCursor = 0;
+		m_isMemoryMapped = true;
+
+		return true;
+	}
 }
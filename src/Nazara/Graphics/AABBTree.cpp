@@ -0,0 +1,380 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Graphics/AABBTree.hpp>
+#include <NazaraUtils/StackVector.hpp>
+#include <algorithm>
+
+namespace Nz
+{
+	AABBTree::AABBTree() :
+	m_proxyCount(0),
+	m_freeList(InvalidProxy),
+	m_root(InvalidProxy)
+	{
+	}
+
+	void AABBTree::Clear()
+	{
+		m_nodes.clear();
+		m_proxyCount = 0;
+		m_freeList = InvalidProxy;
+		m_root = InvalidProxy;
+	}
+
+	/*!
+	* \brief Calls the callback for every proxy whose box isn't outside of the frustum
+	*
+	* Subtrees fully inside the frustum are reported without further testing, which is signaled by isFullyInside.
+	* Proxies reported with isFullyInside set to false intersect the frustum with their fat box, the caller may want to perform a more precise test.
+	*
+	* \param frustum Frustum to test the boxes against
+	* \param callback Callback receiving the user data of every visible proxy
+	*/
+	void AABBTree::Cull(const Frustumf& frustum, FunctionRef<void(std::size_t userData, bool isFullyInside)> callback) const
+	{
+		if (m_root == InvalidProxy)
+			return;
+
+		auto ReportSubtree = [&](UInt32 subtreeRoot)
+		{
+			StackVector<UInt32> stack = NazaraStackVector(UInt32, m_nodes[subtreeRoot].height + 1);
+			stack.push_back(subtreeRoot);
+			while (!stack.empty())
+			{
+				const Node& node = m_nodes[stack.back()];
+				stack.pop_back();
+
+				if (node.IsLeaf())
+					callback(node.userData, true);
+				else
+				{
+					stack.push_back(node.children[0]);
+					stack.push_back(node.children[1]);
+				}
+			}
+		};
+
+		// Depth-first traversal needs at most one entry per level plus one
+		StackVector<UInt32> stack = NazaraStackVector(UInt32, m_nodes[m_root].height + 1);
+		stack.push_back(m_root);
+		while (!stack.empty())
+		{
+			UInt32 nodeIndex = stack.back();
+			stack.pop_back();
+
+			const Node& node = m_nodes[nodeIndex];
+			switch (frustum.Intersect(node.aabb))
+			{
+				case IntersectionSide::Inside:
+					ReportSubtree(nodeIndex);
+					break;
+
+				case IntersectionSide::Intersecting:
+				{
+					if (node.IsLeaf())
+						callback(node.userData, false);
+					else
+					{
+						stack.push_back(node.children[0]);
+						stack.push_back(node.children[1]);
+					}
+					break;
+				}
+
+				case IntersectionSide::Outside:
+					break;
+			}
+		}
+	}
+
+	/*!
+	* \brief Inserts a box in the tree
+	* \return Proxy identifier, which stays valid until removed
+	*
+	* \param aabb Box of the proxy, it is stored as-is (without any margin)
+	* \param userData Value reported by Cull for this proxy
+	*/
+	UInt32 AABBTree::Insert(const Boxf& aabb, std::size_t userData)
+	{
+		UInt32 proxyId = AllocateNode();
+
+		Node& node = m_nodes[proxyId];
+		node.aabb = aabb;
+		node.userData = userData;
+		node.height = 0;
+
+		InsertLeaf(proxyId);
+		m_proxyCount++;
+
+		return proxyId;
+	}
+
+	/*!
+	* \brief Updates the box of a proxy
+	* \return True if the proxy had to be moved in the tree
+	*
+	* Proxies are only reinserted when their new box isn't contained in the fat box stored in the tree.
+	* On reinsertion, the box is enlarged by a margin to prevent frequently moving proxies from being reinserted each time.
+	*
+	* \param proxyId Proxy to update
+	* \param aabb New box of the proxy
+	*/
+	bool AABBTree::Move(UInt32 proxyId, const Boxf& aabb)
+	{
+		NazaraAssertMsg(proxyId < m_nodes.size() && m_nodes[proxyId].IsLeaf(), "invalid proxy");
+
+		if (m_nodes[proxyId].aabb.Contains(aabb))
+			return false;
+
+		RemoveLeaf(proxyId);
+
+		Vector3f margin = aabb.GetLengths() * 0.1f;
+
+		Boxf& fatAABB = m_nodes[proxyId].aabb;
+		fatAABB = aabb;
+		fatAABB.x -= margin.x;
+		fatAABB.y -= margin.y;
+		fatAABB.z -= margin.z;
+		fatAABB.width += 2.f * margin.x;
+		fatAABB.height += 2.f * margin.y;
+		fatAABB.depth += 2.f * margin.z;
+
+		InsertLeaf(proxyId);
+		return true;
+	}
+
+	void AABBTree::Remove(UInt32 proxyId)
+	{
+		NazaraAssertMsg(proxyId < m_nodes.size() && m_nodes[proxyId].IsLeaf(), "invalid proxy");
+
+		RemoveLeaf(proxyId);
+		FreeNode(proxyId);
+		m_proxyCount--;
+	}
+
+	UInt32 AABBTree::AllocateNode()
+	{
+		UInt32 nodeIndex;
+		if (m_freeList != InvalidProxy)
+		{
+			nodeIndex = m_freeList;
+			m_freeList = m_nodes[nodeIndex].parent;
+		}
+		else
+		{
+			nodeIndex = SafeCast<UInt32>(m_nodes.size());
+			m_nodes.emplace_back();
+		}
+
+		Node& node = m_nodes[nodeIndex];
+		node.children[0] = InvalidProxy;
+		node.children[1] = InvalidProxy;
+		node.parent = InvalidProxy;
+		node.height = 0;
+
+		return nodeIndex;
+	}
+
+	UInt32 AABBTree::Balance(UInt32 nodeIndex)
+	{
+		// AVL-like rotation, see Erin Catto's b2DynamicTree
+		Node& a = m_nodes[nodeIndex];
+		if (a.IsLeaf() || a.height < 2)
+			return nodeIndex;
+
+		// Rotates child up, child being the higher child of A and otherChild the other one
+		auto Rotate = [&](std::size_t childSlot) -> UInt32
+		{
+			UInt32 childIndex = a.children[childSlot];
+			UInt32 otherChildIndex = a.children[1 - childSlot];
+
+			Node& child = m_nodes[childIndex];
+			Node& otherChild = m_nodes[otherChildIndex];
+
+			UInt32 fIndex = child.children[0];
+			UInt32 gIndex = child.children[1];
+			Node& f = m_nodes[fIndex];
+			Node& g = m_nodes[gIndex];
+
+			// Swap A and child
+			child.children[0] = nodeIndex;
+			child.parent = a.parent;
+			a.parent = childIndex;
+
+			if (child.parent != InvalidProxy)
+			{
+				Node& parent = m_nodes[child.parent];
+				if (parent.children[0] == nodeIndex)
+					parent.children[0] = childIndex;
+				else
+					parent.children[1] = childIndex;
+			}
+			else
+				m_root = childIndex;
+
+			// Keep the highest grandchild under child, give the other one to A
+			UInt32 keptIndex = (f.height > g.height) ? fIndex : gIndex;
+			UInt32 givenIndex = (f.height > g.height) ? gIndex : fIndex;
+			Node& kept = m_nodes[keptIndex];
+			Node& given = m_nodes[givenIndex];
+
+			child.children[1] = keptIndex;
+			a.children[childSlot] = givenIndex;
+			given.parent = nodeIndex;
+
+			a.aabb = Merge(otherChild.aabb, given.aabb);
+			child.aabb = Merge(a.aabb, kept.aabb);
+
+			a.height = 1 + std::max(otherChild.height, given.height);
+			child.height = 1 + std::max(a.height, kept.height);
+
+			return childIndex;
+		};
+
+		Int32 balance = m_nodes[a.children[1]].height - m_nodes[a.children[0]].height;
+		if (balance > 1)
+			return Rotate(1);
+		else if (balance < -1)
+			return Rotate(0);
+
+		return nodeIndex;
+	}
+
+	void AABBTree::FreeNode(UInt32 nodeIndex)
+	{
+		Node& node = m_nodes[nodeIndex];
+		node.parent = m_freeList;
+		node.height = -1;
+
+		m_freeList = nodeIndex;
+	}
+
+	void AABBTree::InsertLeaf(UInt32 leafIndex)
+	{
+		if (m_root == InvalidProxy)
+		{
+			m_root = leafIndex;
+			m_nodes[leafIndex].parent = InvalidProxy;
+			return;
+		}
+
+		// Find the best sibling using the surface area heuristic
+		Boxf leafAABB = m_nodes[leafIndex].aabb;
+
+		UInt32 nodeIndex = m_root;
+		while (!m_nodes[nodeIndex].IsLeaf())
+		{
+			const Node& node = m_nodes[nodeIndex];
+
+			float area = ComputeArea(node.aabb);
+			float combinedArea = ComputeArea(Merge(node.aabb, leafAABB));
+
+			// Cost of creating a new parent for this node and the new leaf
+			float cost = 2.f * combinedArea;
+
+			// Minimum cost of pushing the leaf further down the tree
+			float inheritanceCost = 2.f * (combinedArea - area);
+
+			float childCosts[2];
+			for (std::size_t i = 0; i < 2; ++i)
+			{
+				const Node& child = m_nodes[node.children[i]];
+
+				float childCost = ComputeArea(Merge(child.aabb, leafAABB));
+				if (!child.IsLeaf())
+					childCost -= ComputeArea(child.aabb);
+
+				childCosts[i] = childCost + inheritanceCost;
+			}
+
+			if (cost < childCosts[0] && cost < childCosts[1])
+				break;
+
+			nodeIndex = (childCosts[0] < childCosts[1]) ? node.children[0] : node.children[1];
+		}
+
+		UInt32 siblingIndex = nodeIndex;
+
+		// Create a new parent for the sibling and the leaf
+		UInt32 oldParentIndex = m_nodes[siblingIndex].parent;
+		UInt32 newParentIndex = AllocateNode();
+
+		Node& newParent = m_nodes[newParentIndex];
+		newParent.parent = oldParentIndex;
+		newParent.aabb = Merge(leafAABB, m_nodes[siblingIndex].aabb);
+		newParent.height = m_nodes[siblingIndex].height + 1;
+		newParent.children[0] = siblingIndex;
+		newParent.children[1] = leafIndex;
+
+		if (oldParentIndex != InvalidProxy)
+		{
+			Node& oldParent = m_nodes[oldParentIndex];
+			if (oldParent.children[0] == siblingIndex)
+				oldParent.children[0] = newParentIndex;
+			else
+				oldParent.children[1] = newParentIndex;
+		}
+		else
+			m_root = newParentIndex;
+
+		m_nodes[siblingIndex].parent = newParentIndex;
+		m_nodes[leafIndex].parent = newParentIndex;
+
+		RefitAncestors(newParentIndex);
+	}
+
+	void AABBTree::RefitAncestors(UInt32 nodeIndex)
+	{
+		while (nodeIndex != InvalidProxy)
+		{
+			nodeIndex = Balance(nodeIndex);
+
+			Node& node = m_nodes[nodeIndex];
+			const Node& firstChild = m_nodes[node.children[0]];
+			const Node& secondChild = m_nodes[node.children[1]];
+
+			node.height = 1 + std::max(firstChild.height, secondChild.height);
+			node.aabb = Merge(firstChild.aabb, secondChild.aabb);
+
+			nodeIndex = node.parent;
+		}
+	}
+
+	void AABBTree::RemoveLeaf(UInt32 leafIndex)
+	{
+		if (leafIndex == m_root)
+		{
+			m_root = InvalidProxy;
+			return;
+		}
+
+		UInt32 parentIndex = m_nodes[leafIndex].parent;
+		const Node& parent = m_nodes[parentIndex];
+
+		UInt32 grandParentIndex = parent.parent;
+		UInt32 siblingIndex = (parent.children[0] == leafIndex) ? parent.children[1] : parent.children[0];
+
+		// Replace the parent by the sibling
+		if (grandParentIndex != InvalidProxy)
+		{
+			Node& grandParent = m_nodes[grandParentIndex];
+			if (grandParent.children[0] == parentIndex)
+				grandParent.children[0] = siblingIndex;
+			else
+				grandParent.children[1] = siblingIndex;
+
+			m_nodes[siblingIndex].parent = grandParentIndex;
+			FreeNode(parentIndex);
+
+			RefitAncestors(grandParentIndex);
+		}
+		else
+		{
+			m_root = siblingIndex;
+			m_nodes[siblingIndex].parent = InvalidProxy;
+			FreeNode(parentIndex);
+		}
+	}
+}
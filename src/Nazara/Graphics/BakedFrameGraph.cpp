@@ -3,17 +3,25 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Graphics/BakedFrameGraph.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
+#include <algorithm>
 
 namespace Nz
 {
+	BakedFrameGraph::BakedFrameGraph() :
+	m_taskScheduler(nullptr)
+	{
+	}
+
 	BakedFrameGraph::BakedFrameGraph(std::vector<PassData> passes, std::vector<TextureData> textures, AttachmentIdToTextureId attachmentIdToTextureMapping, PassIdToPhysicalPassIndex passIdToPhysicalPassMapping) :
 	m_passes(std::move(passes)),
 	m_textures(std::move(textures)),
 	m_attachmentToTextureMapping(std::move(attachmentIdToTextureMapping)),
-	m_passIdToPhysicalPassMapping(std::move(passIdToPhysicalPassMapping))
+	m_passIdToPhysicalPassMapping(std::move(passIdToPhysicalPassMapping)),
+	m_taskScheduler(nullptr)
 	{
 		const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
 		m_commandPool = renderDevice->InstantiateCommandPool(QueueType::Graphics);
@@ -21,8 +29,16 @@ namespace Nz
 
 	void BakedFrameGraph::Execute(RenderResources& renderResources)
 	{
-		for (auto& passData : m_passes)
+		Time startTime = GetElapsedNanoseconds();
+
+		m_recordingStats = RecordingStats{};
+		m_concurrentPasses.clear();
+		m_localPasses.clear();
+
+		for (std::size_t passIndex = 0; passIndex < m_passes.size(); ++passIndex)
 		{
+			auto& passData = m_passes[passIndex];
+
 			bool regenerateCommandBuffer = (passData.forceCommandBufferRegeneration || passData.commandBuffer == nullptr);
 			if (passData.executionCallback)
 			{
@@ -51,47 +67,69 @@ namespace Nz
 			if (passData.commandBuffer)
 				renderResources.PushForRelease(std::move(passData.commandBuffer));
 
-			passData.commandBuffer = m_commandPool->BuildCommandBuffer([&](CommandBufferBuilder& builder)
-			{
-				for (auto& textureTransition : passData.invalidationBarriers)
-				{
-					const std::shared_ptr<Texture>& texture = m_textures[textureTransition.textureId].texture;
-					builder.TextureBarrier(textureTransition.srcStageMask, textureTransition.dstStageMask, textureTransition.srcAccessMask, textureTransition.dstAccessMask, textureTransition.oldLayout, textureTransition.newLayout, *texture);
-				}
+			if (m_taskScheduler && passData.allowConcurrentRecording)
+				m_concurrentPasses.push_back(passIndex);
+			else
+				m_localPasses.push_back(passIndex);
+		}
 
-				if (passData.framebuffer)
-					builder.BeginRenderPass(*passData.framebuffer, *passData.renderPass, passData.renderRect, passData.outputClearValues.data(), passData.outputClearValues.size());
+		// Dispatching a single pass would only add latency
+		if (m_concurrentPasses.size() == 1)
+		{
+			m_localPasses.push_back(m_concurrentPasses.front());
+			m_concurrentPasses.clear();
+		}
 
-				if (!passData.name.empty())
-					builder.BeginDebugRegion(passData.name, Color::Green());
+		m_recordingStats.concurrentPassCount = m_concurrentPasses.size();
+		m_recordingStats.recordedPassCount = m_concurrentPasses.size() + m_localPasses.size();
 
-				FramePassEnvironment env{
-					.frameGraph = *this,
-					.renderResources = renderResources,
-					.renderRect = passData.renderRect
-				};
+		// Passes are distributed between tasks, each one recording with its own command pool as a pool can't be used by multiple threads at once
+		TaskScheduler::TaskGroup taskGroup;
+		if (!m_concurrentPasses.empty())
+		{
+			std::size_t taskCount = std::min<std::size_t>(m_concurrentPasses.size(), std::max(m_taskScheduler->GetWorkerCount(), 1u));
+			if (m_concurrentCommandPools.size() < taskCount)
+			{
+				const std::shared_ptr<RenderDevice>& renderDevice = Graphics::Instance()->GetRenderDevice();
+				while (m_concurrentCommandPools.size() < taskCount)
+					m_concurrentCommandPools.push_back(renderDevice->InstantiateCommandPool(QueueType::Graphics));
+			}
 
-				bool first = true;
-				for (auto& subpass : passData.subpasses)
+			m_concurrentRecordingTimes.assign(taskCount, Time::Zero());
+			for (std::size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+			{
+				m_taskScheduler->AddTask([this, taskIndex, taskCount, &renderResources]
 				{
-					if (!first)
-						builder.NextSubpass();
+					Time taskStartTime = GetElapsedNanoseconds();
 
-					first = false;
+					CommandPool& commandPool = *m_concurrentCommandPools[taskIndex];
+					for (std::size_t i = taskIndex; i < m_concurrentPasses.size(); i += taskCount)
+						RecordPass(m_passes[m_concurrentPasses[i]], commandPool, renderResources);
 
-					subpass.commandCallback(builder, env);
-				}
+					m_concurrentRecordingTimes[taskIndex] = GetElapsedNanoseconds() - taskStartTime;
+				}, &taskGroup);
+			}
+		}
 
-				if (!passData.name.empty())
-					builder.EndDebugRegion();
+		// Record the other passes on this thread meanwhile
+		Time localStartTime = GetElapsedNanoseconds();
+		for (std::size_t passIndex : m_localPasses)
+			RecordPass(m_passes[passIndex], *m_commandPool, renderResources);
 
-				if (passData.framebuffer)
-					builder.EndRenderPass();
-			});
+		m_recordingStats.recordingTime = GetElapsedNanoseconds() - localStartTime;
 
-			passData.forceCommandBufferRegeneration = false;
+		if (!m_concurrentPasses.empty())
+		{
+			m_taskScheduler->WaitForTasks(taskGroup);
+
+			for (Time recordingTime : m_concurrentRecordingTimes)
+				m_recordingStats.concurrentRecordingTime += recordingTime;
+
+			m_recordingStats.recordingTime += m_recordingStats.concurrentRecordingTime;
 		}
 
+		m_recordingStats.wallTime = GetElapsedNanoseconds() - startTime;
+
 		//TODO: Submit all commands buffer at once
 		for (auto& passData : m_passes)
 		{
@@ -255,4 +293,47 @@ namespace Nz
 		m_viewerSizes.assign(viewerTargetSizes.begin(), viewerTargetSizes.end());
 		return true;
 	}
+
+	void BakedFrameGraph::RecordPass(PassData& passData, CommandPool& commandPool, RenderResources& renderResources)
+	{
+		passData.commandBuffer = commandPool.BuildCommandBuffer([&](CommandBufferBuilder& builder)
+		{
+			for (auto& textureTransition : passData.invalidationBarriers)
+			{
+				const std::shared_ptr<Texture>& texture = m_textures[textureTransition.textureId].texture;
+				builder.TextureBarrier(textureTransition.srcStageMask, textureTransition.dstStageMask, textureTransition.srcAccessMask, textureTransition.dstAccessMask, textureTransition.oldLayout, textureTransition.newLayout, *texture);
+			}
+
+			if (passData.framebuffer)
+				builder.BeginRenderPass(*passData.framebuffer, *passData.renderPass, passData.renderRect, passData.outputClearValues.data(), passData.outputClearValues.size());
+
+			if (!passData.name.empty())
+				builder.BeginDebugRegion(passData.name, Color::Green());
+
+			FramePassEnvironment env{
+				.frameGraph = *this,
+				.renderResources = renderResources,
+				.renderRect = passData.renderRect
+			};
+
+			bool first = true;
+			for (auto& subpass : passData.subpasses)
+			{
+				if (!first)
+					builder.NextSubpass();
+
+				first = false;
+
+				subpass.commandCallback(builder, env);
+			}
+
+			if (!passData.name.empty())
+				builder.EndDebugRegion();
+
+			if (passData.framebuffer)
+				builder.EndRenderPass();
+		});
+
+		passData.forceCommandBufferRegeneration = false;
+	}
 }
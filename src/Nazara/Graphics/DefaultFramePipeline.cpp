@@ -3,6 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Graphics/DefaultFramePipeline.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Graphics/FrameGraph.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/InstancedRenderable.hpp>
@@ -13,9 +14,23 @@
 #include <Nazara/Math/Frustum.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <NazaraUtils/StackVector.hpp>
+#include <algorithm>
+#include <bit>
 
 namespace Nz
 {
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Visible renderables are reported in tree order, which changes when renderables move in the tree, use an order-independent hash
+		std::size_t CombineVisibilityHash(std::size_t currentHash, std::size_t newHash)
+		{
+			UInt64 mixedHash = static_cast<UInt64>(newHash) * 0x9E3779B97F4A7C15ull;
+			mixedHash ^= mixedHash >> 32;
+
+			return currentHash + static_cast<std::size_t>(mixedHash);
+		}
+	}
+
 	DefaultFramePipeline::DefaultFramePipeline(ElementRendererRegistry& elementRegistry) :
 	m_elementRegistry(elementRegistry),
 	m_renderablePool(4096),
@@ -23,6 +38,8 @@ namespace Nz
 	m_skeletonInstances(1024),
 	m_viewerPool(8),
 	m_worldInstances(2048),
+	m_taskScheduler(nullptr),
+	m_frustumCullCount(0),
 	m_generationCounter(0),
 	m_rebuildFrameGraph(true)
 	{
@@ -36,39 +53,8 @@ namespace Nz
 
 	const std::vector<Nz::FramePipelinePass::VisibleRenderable>& DefaultFramePipeline::FrustumCull(const Frustumf& frustum, UInt32 mask, std::size_t& visibilityHash) const
 	{
-		auto CombineHash = [](std::size_t currentHash, std::size_t newHash)
-		{
-			return currentHash * 23 + newHash;
-		};
-
 		m_visibleRenderables.clear();
-		for (const RenderableData& renderableData : m_renderablePool)
-		{
-			if ((mask & renderableData.renderMask) == 0)
-				continue;
-
-			const WorldInstancePtr& worldInstance = m_worldInstances.RetrieveFromIndex(renderableData.worldInstanceIndex)->worldInstance;
-
-			// Get global AABB
-			BoundingVolumef boundingVolume(renderableData.renderable->GetAABB());
-			boundingVolume.Update(worldInstance->GetWorldMatrix());
-
-			if (frustum.Intersect(boundingVolume) == IntersectionSide::Outside)
-				continue;
-
-			auto& visibleRenderable = m_visibleRenderables.emplace_back();
-			visibleRenderable.instancedRenderable = renderableData.renderable;
-			visibleRenderable.renderMask = renderableData.renderMask;
-			visibleRenderable.scissorBox = renderableData.scissorBox;
-			visibleRenderable.worldInstance = worldInstance.get();
-
-			if (renderableData.skeletonInstanceIndex != NoSkeletonInstance)
-				visibleRenderable.skeletonInstance = m_skeletonInstances.RetrieveFromIndex(renderableData.skeletonInstanceIndex)->skeleton.get();
-			else
-				visibleRenderable.skeletonInstance = nullptr;
-
-			visibilityHash = CombineHash(visibilityHash, std::hash<const void*>()(&renderableData) + renderableData.generation);
-		}
+		FrustumCull(frustum, mask, m_cullingScratch, m_visibleRenderables, visibilityHash);
 
 		return m_visibleRenderables;
 	}
@@ -86,6 +72,24 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Queues a frustum culling, processed with every other queued culling of the frame during Render
+	* \return Index of the frustum culling, to retrieve its results with RetrieveFrustumCull once processed
+	*
+	* Cullings can only be queued before passes are prepared (i.e. by LightShadowData::PrepareCulling).
+	*/
+	std::size_t DefaultFramePipeline::QueueFrustumCull(const Frustumf& frustum, UInt32 mask)
+	{
+		if (m_frustumCullCount >= m_frustumCulls.size())
+			m_frustumCulls.emplace_back();
+
+		FrustumCullData& frustumCull = m_frustumCulls[m_frustumCullCount];
+		frustumCull.frustum = frustum;
+		frustumCull.mask = mask;
+
+		return m_frustumCullCount++;
+	}
+
 	void DefaultFramePipeline::QueueTransfer(TransferInterface* transfer)
 	{
 		m_transferSet.insert(transfer);
@@ -162,6 +166,17 @@ namespace Nz
 		renderableData->skeletonInstanceIndex = skeletonInstanceIndex;
 		renderableData->worldInstanceIndex = worldInstanceIndex;
 
+		// Compute world bounds once, they are only updated when the renderable AABB or its world instance changes
+		renderableData->cullingProxy = AABBTree::InvalidProxy;
+		UpdateRenderableBounds(renderableIndex);
+
+		m_worldInstances.RetrieveFromIndex(worldInstanceIndex)->renderables.push_back(renderableIndex);
+
+		renderableData->onAABBUpdate.Connect(instancedRenderable->OnAABBUpdate, [this, renderableIndex](InstancedRenderable* /*instancedRenderable*/, const Boxf& /*aabb*/)
+		{
+			m_invalidatedRenderables.UnboundedSet(renderableIndex);
+		});
+
 		renderableData->onElementInvalidated.Connect(instancedRenderable->OnElementInvalidated, [this, renderMask](InstancedRenderable* /*instancedRenderable*/)
 		{
 			// TODO: Invalidate only relevant viewers and passes
@@ -319,8 +334,10 @@ namespace Nz
 		std::size_t worldInstanceIndex;
 		WorldInstanceData& worldInstanceData = *m_worldInstances.Allocate(worldInstanceIndex);
 		worldInstanceData.worldInstance = std::move(worldInstance);
-		worldInstanceData.onTransferRequired.Connect(worldInstanceData.worldInstance->OnTransferRequired, [this](TransferInterface* transferInterface)
+		worldInstanceData.onTransferRequired.Connect(worldInstanceData.worldInstance->OnTransferRequired, [this, worldInstanceIndex](TransferInterface* transferInterface)
 		{
+			// World instances only require a transfer when their world matrix changes
+			m_invalidatedWorldInstances.UnboundedSet(worldInstanceIndex);
 			m_transferSet.insert(transferInterface);
 		});
 
@@ -329,6 +346,18 @@ namespace Nz
 		return worldInstanceIndex;
 	}
 
+	const std::vector<FramePipelinePass::VisibleRenderable>& DefaultFramePipeline::RetrieveFrustumCull(std::size_t frustumCullIndex, std::size_t& visibilityHash) const
+	{
+		NazaraAssertMsg(frustumCullIndex < m_frustumCullCount, "invalid frustum cull index");
+
+		const FrustumCullData& frustumCull = m_frustumCulls[frustumCullIndex];
+
+		// Visibility hashes are additive
+		visibilityHash += frustumCull.visibilityHash;
+
+		return frustumCull.visibleRenderables;
+	}
+
 	const Light* DefaultFramePipeline::RetrieveLight(std::size_t lightIndex) const
 	{
 		return m_lightPool.RetrieveFromIndex(lightIndex)->light;
@@ -381,9 +410,12 @@ namespace Nz
 		{
 			renderResources.PushForRelease(std::move(*m_worldInstances.RetrieveFromIndex(worldInstanceIndex)));
 			m_worldInstances.Free(worldInstanceIndex);
+			m_invalidatedWorldInstances.UnboundedReset(worldInstanceIndex);
 		}
 		m_removedWorldInstances.Clear();
 
+		UpdateCullingData();
+
 		bool frameGraphInvalidated = false;
 		if (m_rebuildFrameGraph)
 		{
@@ -433,7 +465,32 @@ namespace Nz
 
 		m_visibleShadowCastingLights.PerformsAND(m_activeLights, m_shadowCastingLights);
 
+		// Queue every frustum culling of the frame (viewers, shadow cascades and faces) so they can be processed concurrently
+		m_frustumCullCount = 0;
+
+		for (std::size_t i : m_visibleShadowCastingLights.IterBits())
+		{
+			LightData* lightData = m_lightPool.RetrieveFromIndex(i);
+			if (!lightData->shadowData->IsPerViewer())
+				lightData->shadowData->PrepareCulling(nullptr);
+		}
+
+		for (ViewerData* viewerData : m_orderedViewers)
+		{
+			for (std::size_t lightIndex : viewerData->frame.visibleLights.IterBits())
+			{
+				LightData* lightData = m_lightPool.RetrieveFromIndex(lightIndex);
+				if (lightData->shadowData && lightData->shadowData->IsPerViewer() && (viewerData->renderMask & lightData->renderMask) != 0)
+					lightData->shadowData->PrepareCulling(viewerData->viewer);
+			}
+
+			viewerData->frame.frustumCullIndex = QueueFrustumCull(viewerData->frame.frustum, viewerData->renderMask);
+		}
+
+		ProcessFrustumCulls();
+
 		// Shadow map handling (for active lights)
+		// Passes preparation allocates from shared resources (render resources, element pools) and stays on this thread
 		for (std::size_t i : m_visibleShadowCastingLights.IterBits())
 		{
 			LightData* lightData = m_lightPool.RetrieveFromIndex(i);
@@ -452,9 +509,8 @@ namespace Nz
 					lightData->shadowData->PrepareRendering(renderResources, viewerData->viewer);
 			}
 
-			// Frustum culling
 			std::size_t visibilityHash = 5;
-			const auto& visibleRenderables = FrustumCull(viewerData->frame.frustum, viewerData->renderMask, visibilityHash);
+			const auto& visibleRenderables = RetrieveFrustumCull(viewerData->frame.frustumCullIndex, visibilityHash);
 
 			FramePipelinePass::FrameData passData = {
 				&viewerData->frame.visibleLights,
@@ -486,10 +542,21 @@ namespace Nz
 			builder.EndDebugRegion();
 		}, QueueType::Transfer);
 
+		m_bakedFrameGraph.SetTaskScheduler(m_taskScheduler);
 		m_bakedFrameGraph.Execute(renderResources);
 		m_rebuildFrameGraph = false;
 	}
 
+	/*!
+	* \brief Sets the task scheduler used to process frustum cullings and to record command buffers concurrently
+	*
+	* \param taskScheduler Task scheduler to use, nullptr to process everything on the rendering thread
+	*/
+	void DefaultFramePipeline::SetTaskScheduler(TaskScheduler* taskScheduler)
+	{
+		m_taskScheduler = taskScheduler;
+	}
+
 	void DefaultFramePipeline::UnregisterLight(std::size_t lightIndex)
 	{
 		m_removedLightInstances.UnboundedSet(lightIndex);
@@ -524,6 +591,15 @@ namespace Nz
 			}
 		}
 
+		m_cullingTree.Remove(renderable.cullingProxy);
+		m_invalidatedRenderables.UnboundedReset(renderableIndex);
+
+		std::vector<std::size_t>& worldInstanceRenderables = m_worldInstances.RetrieveFromIndex(renderable.worldInstanceIndex)->renderables;
+		auto it = std::find(worldInstanceRenderables.begin(), worldInstanceRenderables.end(), renderableIndex);
+		assert(it != worldInstanceRenderables.end());
+		std::swap(*it, worldInstanceRenderables.back());
+		worldInstanceRenderables.pop_back();
+
 		m_renderablePool.Free(renderableIndex);
 	}
 
@@ -744,6 +820,119 @@ namespace Nz
 		return frameGraph.Bake();
 	}
 
+	void DefaultFramePipeline::FrustumCull(const Frustumf& frustum, UInt32 mask, CullingScratch& scratch, std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, std::size_t& visibilityHash) const
+	{
+		// Only reads registration data, allowing multiple cullings to run concurrently as long as they use their own scratch and output
+		auto AddVisibleRenderable = [&](const RenderableData& renderableData)
+		{
+			const WorldInstancePtr& worldInstance = m_worldInstances.RetrieveFromIndex(renderableData.worldInstanceIndex)->worldInstance;
+
+			auto& visibleRenderable = visibleRenderables.emplace_back();
+			visibleRenderable.generation = renderableData.generation;
+			visibleRenderable.instancedRenderable = renderableData.renderable;
+			visibleRenderable.renderMask = renderableData.renderMask;
+			visibleRenderable.scissorBox = renderableData.scissorBox;
+			visibleRenderable.worldInstance = worldInstance.get();
+
+			if (renderableData.skeletonInstanceIndex != NoSkeletonInstance)
+				visibleRenderable.skeletonInstance = m_skeletonInstances.RetrieveFromIndex(renderableData.skeletonInstanceIndex)->skeleton.get();
+			else
+				visibleRenderable.skeletonInstance = nullptr;
+
+			visibilityHash = CombineVisibilityHash(visibilityHash, std::hash<const void*>()(&renderableData) + renderableData.generation);
+		};
+
+		scratch.Clear();
+
+		// Renderables whose tree box intersects the frustum are tested again by batch, using their tight world AABB
+		m_cullingTree.Cull(frustum, [&](std::size_t renderableIndex, bool isFullyInside)
+		{
+			const RenderableData& renderableData = *m_renderablePool.RetrieveFromIndex(renderableIndex);
+			if ((mask & renderableData.renderMask) == 0)
+				return;
+
+			if (isFullyInside)
+			{
+				AddVisibleRenderable(renderableData);
+				return;
+			}
+
+			const BoundingVolumef& boundingVolume = renderableData.worldBoundingVolume;
+			switch (boundingVolume.extent)
+			{
+				case Extent::Finite:
+					scratch.Push(renderableIndex, boundingVolume.aabb);
+					break;
+
+				case Extent::Infinite:
+					AddVisibleRenderable(renderableData);
+					break;
+
+				case Extent::Null:
+					break;
+			}
+		});
+
+		std::size_t candidateCount = scratch.renderableIndices.size();
+		if (candidateCount > 0)
+		{
+			std::size_t maskSize = (candidateCount + 63) / 64;
+			scratch.insideMask.resize(maskSize);
+			scratch.visibilityMask.resize(maskSize);
+
+			Frustumf::BoxBatch boxBatch;
+			boxBatch.x = scratch.x.data();
+			boxBatch.y = scratch.y.data();
+			boxBatch.z = scratch.z.data();
+			boxBatch.width = scratch.width.data();
+			boxBatch.height = scratch.height.data();
+			boxBatch.depth = scratch.depth.data();
+			boxBatch.count = candidateCount;
+
+			frustum.CullBoxes(boxBatch, scratch.visibilityMask.data(), scratch.insideMask.data());
+
+			for (std::size_t wordIndex = 0; wordIndex < maskSize; ++wordIndex)
+			{
+				UInt64 insideBits = scratch.insideMask[wordIndex];
+				UInt64 visibleBits = scratch.visibilityMask[wordIndex];
+				while (visibleBits != 0)
+				{
+					unsigned int bitIndex = std::countr_zero(visibleBits);
+					visibleBits &= visibleBits - 1;
+
+					const RenderableData& renderableData = *m_renderablePool.RetrieveFromIndex(scratch.renderableIndices[wordIndex * 64 + bitIndex]);
+
+					// AABB fully inside means visible, otherwise finish with the oriented box (as Frustum::Intersect(BoundingVolume) does)
+					bool isInside = (insideBits & (UInt64(1) << bitIndex)) != 0;
+					if (!isInside && frustum.Intersect(renderableData.worldBoundingVolume.obb) == IntersectionSide::Outside)
+						continue;
+
+					AddVisibleRenderable(renderableData);
+				}
+			}
+		}
+	}
+
+	void DefaultFramePipeline::ProcessFrustumCulls()
+	{
+		auto ProcessRange = [this](std::size_t first, std::size_t last)
+		{
+			for (std::size_t i = first; i < last; ++i)
+			{
+				FrustumCullData& frustumCull = m_frustumCulls[i];
+				frustumCull.visibleRenderables.clear();
+				frustumCull.visibilityHash = 0;
+
+				FrustumCull(frustumCull.frustum, frustumCull.mask, frustumCull.scratch, frustumCull.visibleRenderables, frustumCull.visibilityHash);
+			}
+		};
+
+		if (m_taskScheduler && m_frustumCullCount > 1)
+			m_taskScheduler->ParallelFor(0, m_frustumCullCount, 1, ProcessRange);
+		else
+			ProcessRange(0, m_frustumCullCount);
+	}
+
 	std::size_t DefaultFramePipeline::BuildMergePass(FrameGraph& frameGraph, std::span<ViewerData*> targetViewers)
 	{
 		FramePass& mergePass = frameGraph.AddPass("Merge pass");
@@ -831,4 +1020,32 @@ namespace Nz
 		if (--materialInstanceData.usedCount == 0)
 			m_materialInstances.erase(it);
 	}
+
+	void DefaultFramePipeline::UpdateCullingData()
+	{
+		for (std::size_t worldInstanceIndex : m_invalidatedWorldInstances.IterBits())
+		{
+			for (std::size_t renderableIndex : m_worldInstances.RetrieveFromIndex(worldInstanceIndex)->renderables)
+				m_invalidatedRenderables.UnboundedSet(renderableIndex);
+		}
+		m_invalidatedWorldInstances.Clear();
+
+		for (std::size_t renderableIndex : m_invalidatedRenderables.IterBits())
+			UpdateRenderableBounds(renderableIndex);
+		m_invalidatedRenderables.Clear();
+	}
+
+	void DefaultFramePipeline::UpdateRenderableBounds(std::size_t renderableIndex)
+	{
+		RenderableData& renderableData = *m_renderablePool.RetrieveFromIndex(renderableIndex);
+		const WorldInstancePtr& worldInstance = m_worldInstances.RetrieveFromIndex(renderableData.worldInstanceIndex)->worldInstance;
+
+		renderableData.worldBoundingVolume = BoundingVolumef(renderableData.renderable->GetAABB());
+		renderableData.worldBoundingVolume.Update(worldInstance->GetWorldMatrix());
+
+		if (renderableData.cullingProxy == AABBTree::InvalidProxy)
+			renderableData.cullingProxy = m_cullingTree.Insert(renderableData.worldBoundingVolume.aabb, renderableIndex);
+		else
+			m_cullingTree.Move(renderableData.cullingProxy, renderableData.worldBoundingVolume.aabb);
+	}
 }
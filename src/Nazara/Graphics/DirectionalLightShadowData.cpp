@@ -39,13 +39,8 @@ namespace Nz
 		UpdatePerViewerStatus(true);
 	}
 
-	void DirectionalLightShadowData::PrepareRendering(RenderResources& renderResources, const AbstractViewer* viewer)
+	void DirectionalLightShadowData::PrepareCulling(const AbstractViewer* viewer)
 	{
-		// Push unregistered viewers data for release
-		for (auto& perViewerData : m_destructionQueue)
-			renderResources.PushForRelease(std::move(perViewerData));
-		m_destructionQueue.clear();
-
 		assert(viewer);
 		PerViewerData& viewerData = *Retrieve(m_viewerData, viewer);
 
@@ -90,7 +85,8 @@ namespace Nz
 		StackVector<Frustumf> frustums = NazaraStackVector(Frustumf, m_cascadeCount);
 		StackVector<float> frustumDists = NazaraStackVector(float, m_cascadeCount);
 
-		Frustumf frustum = Frustumf::Extract(viewProjMatrix, viewer->IsZReversed());
+		Frustumf& frustum = viewerData.viewerFrustum;
+		frustum = Frustumf::Extract(viewProjMatrix, viewer->IsZReversed());
 		if (frustum.HasInfiniteFarPlane())
 			frustum.UpdateFarPlaneDistance(nearPlane, farPlane);
 
@@ -129,17 +125,35 @@ namespace Nz
 
 			m_pipeline.QueueTransfer(&cascadeViewerInstance);
 
-			// Prepare depth pass
 			Frustumf lightFrustum = Frustumf::Extract(cascadeViewerInstance.GetViewProjMatrix());
 
 			//m_pipeline.GetDebugDrawer().DrawFrustum(lightFrustum, cascadeColors[cascadeIndex]);
 
+			cascade.frustumCullIndex = m_pipeline.QueueFrustumCull(lightFrustum, 0xFFFFFFFF);
+		}
+	}
+
+	void DirectionalLightShadowData::PrepareRendering(RenderResources& renderResources, const AbstractViewer* viewer)
+	{
+		// Push unregistered viewers data for release
+		for (auto& perViewerData : m_destructionQueue)
+			renderResources.PushForRelease(std::move(perViewerData));
+		m_destructionQueue.clear();
+
+		assert(viewer);
+		PerViewerData& viewerData = *Retrieve(m_viewerData, viewer);
+
+		// Prepare depth passes
+		for (std::size_t cascadeIndex = 0; cascadeIndex < m_cascadeCount; ++cascadeIndex)
+		{
+			CascadeData& cascade = viewerData.cascades[cascadeIndex];
+
 			std::size_t visibilityHash = 5U;
-			const auto& visibleRenderables = m_pipeline.FrustumCull(lightFrustum, 0xFFFFFFFF, visibilityHash);
+			const auto& visibleRenderables = m_pipeline.RetrieveFrustumCull(cascade.frustumCullIndex, visibilityHash);
 
 			FramePipelinePass::FrameData passData = {
 				nullptr,
-				frustum,
+				viewerData.viewerFrustum,
 				renderResources,
 				visibleRenderables,
 				visibilityHash
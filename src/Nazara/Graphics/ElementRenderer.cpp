@@ -20,5 +20,9 @@ namespace Nz
 	{
 	}
 
+	void ElementRenderer::Update(RenderResources& /*renderResources*/, ElementRendererData& /*rendererData*/)
+	{
+	}
+
 	ElementRendererData::~ElementRendererData() = default;
 }
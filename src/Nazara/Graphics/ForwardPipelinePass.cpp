@@ -28,8 +28,10 @@ namespace Nz
 	m_elementRegistry(passData.elementRegistry),
 	m_pipeline(passData.pipeline),
 	m_pendingLightUploadAllocation(nullptr),
+	m_hasDistanceSortedElements(false),
 	m_rebuildCommandBuffer(false),
-	m_rebuildElements(false)
+	m_rebuildElements(false),
+	m_sortElements(false)
 	{
 		Graphics* graphics = Graphics::Instance();
 		m_forwardPassIndex = graphics->GetMaterialPassRegistry().GetPassIndex("ForwardPass");
@@ -45,43 +47,35 @@ namespace Nz
 	{
 		NazaraAssertMsg(frameData.visibleLights, "visible lights must be valid");
 
-		if (m_lastVisibilityHash != frameData.visibilityHash || m_rebuildElements) //< FIXME
+		if (m_lastVisibilityHash != frameData.visibilityHash || m_rebuildElements)
 		{
-			frameData.renderResources.PushForRelease(std::move(m_renderElements));
-			m_renderElements.clear();
-
-			for (const auto& renderableData : frameData.visibleRenderables)
+			// Only elements of renderables whose visibility changed are built or released, unless elements were invalidated
+			if (m_elementCache.Update(m_elementRegistry, m_forwardPassIndex, MaxValue(), frameData.visibleRenderables, frameData.renderResources, m_rebuildElements))
 			{
-				InstancedRenderable::ElementData elementData{
-					&renderableData.scissorBox,
-					renderableData.skeletonInstance,
-					renderableData.worldInstance
-				};
-
-				renderableData.instancedRenderable->BuildElement(m_elementRegistry, elementData, m_forwardPassIndex, m_renderElements);
+				m_sortElements = true;
+				InvalidateElements();
 			}
 
-			m_renderQueueRegistry.Clear();
-			m_renderQueue.Clear();
+			m_lastVisibilityHash = frameData.visibilityHash;
+		}
 
-			for (const auto& renderElement : m_renderElements)
+		// Scores of elements not sorted by distance only depend on the registry, which only changes when elements are rebuilt
+		if (m_sortElements || m_hasDistanceSortedElements)
+		{
+			bool hasDistanceSortedElements = false;
+			m_elementCache.GetRenderQueue().Sort([&](const RenderElement* element)
 			{
-				renderElement->Register(m_renderQueueRegistry);
-				m_renderQueue.Insert(renderElement.GetElement());
-			}
+				UInt64 sortingScore = element->ComputeSortingScore(frameData.frustum, m_elementCache.GetRenderQueueRegistry());
+				if (sortingScore & RenderElement::SortByDistanceScoreFlag)
+					hasDistanceSortedElements = true;
 
-			m_renderQueueRegistry.Finalize();
+				return sortingScore;
+			});
 
-			m_lastVisibilityHash = frameData.visibilityHash;
-			InvalidateElements();
+			m_hasDistanceSortedElements = hasDistanceSortedElements;
+			m_sortElements = false;
 		}
 
-		// TODO: Don't sort every frame if no material pass requires distance sorting
-		m_renderQueue.Sort([&](const RenderElement* element)
-		{
-			return element->ComputeSortingScore(frameData.frustum, m_renderQueueRegistry);
-		});
-
 		PrepareLights(frameData.renderResources, frameData.frustum, *frameData.visibleLights);
 
 		if (m_rebuildElements)
@@ -99,7 +93,7 @@ namespace Nz
 
 			const ViewerInstance& viewerInstance = m_viewer->GetViewerInstance();
 
-			m_elementRegistry.ProcessRenderQueue(m_renderQueue, [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
+			m_elementRegistry.ProcessRenderQueue(m_elementCache.GetRenderQueue(), [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
 			{
 				ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
 				elementRenderer.Prepare(viewerInstance, *m_elementRendererData[elementType], frameData.renderResources, elementCount, elements, SparsePtr(&m_renderState, 0));
@@ -113,6 +107,15 @@ namespace Nz
 			m_rebuildCommandBuffer = true;
 			m_rebuildElements = false;
 		}
+		else
+		{
+			// Element renderers may have per-frame data to refresh even when elements didn't change (e.g. instance world matrices)
+			m_elementRegistry.ForEachElementRenderer([&](std::size_t elementType, ElementRenderer& elementRenderer)
+			{
+				if (elementType < m_elementRendererData.size() && m_elementRendererData[elementType])
+					elementRenderer.Update(frameData.renderResources, *m_elementRendererData[elementType]);
+			});
+		}
 	}
 
 	void ForwardPipelinePass::RegisterMaterialInstance(const MaterialInstance& materialInstance)
@@ -204,7 +207,7 @@ namespace Nz
 
 			const auto& viewerInstance = m_viewer->GetViewerInstance();
 
-			m_elementRegistry.ProcessRenderQueue(m_renderQueue, [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
+			m_elementRegistry.ProcessRenderQueue(m_elementCache.GetRenderQueue(), [&](std::size_t elementType, const Pointer<const RenderElement>* elements, std::size_t elementCount)
 			{
 				ElementRenderer& elementRenderer = m_elementRegistry.GetElementRenderer(elementType);
 				elementRenderer.Render(viewerInstance, *m_elementRendererData[elementType], builder, elementCount, elements);
@@ -213,6 +216,9 @@ namespace Nz
 			m_rebuildCommandBuffer = false;
 		});
 
+		// Element renderers only read data built during Prepare when rendering
+		forwardPass.SetConcurrentRecording(true);
+
 		return forwardPass;
 	}
 
@@ -75,6 +75,7 @@ namespace Nz
 			bakedPass.name = std::move(physicalPass.name);
 			bakedPass.renderPass = std::move(m_pending.renderPasses[renderPassIndex++]);
 			bakedPass.invalidationBarriers = std::move(physicalPass.textureBarrier);
+			bakedPass.allowConcurrentRecording = true;
 
 			for (auto& subpass : physicalPass.passes)
 			{
@@ -84,6 +85,10 @@ namespace Nz
 				auto& bakedSubpass = bakedPass.subpasses.emplace_back();
 				bakedSubpass.commandCallback = framePass.GetCommandCallback();
 
+				// Subpasses are recorded in the same command buffer
+				if (!framePass.AllowsConcurrentRecording())
+					bakedPass.allowConcurrentRecording = false;
+
 				const auto& colorOutputs = framePass.GetOutputs();
 				for (std::size_t i = 0; i < colorOutputs.size(); ++i)
 				{
@@ -7,4 +7,50 @@
 namespace Nz
 {
 	FramePipeline::~FramePipeline() = default;
+
+	/*!
+	* \brief Queues a frustum culling, whose results can be retrieved with RetrieveFrustumCull
+	* \return Index of the frustum culling
+	*
+	* The default implementation only stores the frustum, the culling is done by RetrieveFrustumCull (using FrustumCull).
+	* Queuing a culling after results were retrieved starts a new batch (indices of the previous batch are no longer valid).
+	*/
+	std::size_t FramePipeline::QueueFrustumCull(const Frustumf& frustum, UInt32 mask)
+	{
+		if (m_queuedFrustumCullsRetrieved)
+		{
+			m_queuedFrustumCulls.clear();
+			m_queuedFrustumCullsRetrieved = false;
+		}
+
+		auto& frustumCull = m_queuedFrustumCulls.emplace_back();
+		frustumCull.frustum = frustum;
+		frustumCull.mask = mask;
+
+		return m_queuedFrustumCulls.size() - 1;
+	}
+
+	/*!
+	* \brief Retrieves the results of a frustum culling queued with QueueFrustumCull
+	*
+	* The default implementation performs the culling using FrustumCull, the returned list is only valid until the next culling.
+	*/
+	const std::vector<FramePipelinePass::VisibleRenderable>& FramePipeline::RetrieveFrustumCull(std::size_t frustumCullIndex, std::size_t& visibilityHash) const
+	{
+		NazaraAssertMsg(frustumCullIndex < m_queuedFrustumCulls.size(), "invalid frustum cull index");
+
+		m_queuedFrustumCullsRetrieved = true;
+
+		const QueuedFrustumCull& frustumCull = m_queuedFrustumCulls[frustumCullIndex];
+		return FrustumCull(frustumCull.frustum, frustumCull.mask, visibilityHash);
+	}
+
+	/*!
+	* \brief Sets the task scheduler the pipeline can use to split its work
+	*
+	* The default implementation ignores it.
+	*/
+	void FramePipeline::SetTaskScheduler(TaskScheduler* /*taskScheduler*/)
+	{
+	}
 }
@@ -8,6 +8,17 @@ namespace Nz
 {
 	LightShadowData::~LightShadowData() = default;
 
+	/*!
+	* \brief Computes the views of the shadow maps and queues their frustum culling to the pipeline
+	*
+	* Called every frame before PrepareRendering, queued frustum cullings are processed (possibly concurrently) in-between.
+	*
+	* \param viewer Viewer the shadow maps are rendered for, nullptr for shadow data which isn't per-viewer
+	*/
+	void LightShadowData::PrepareCulling(const AbstractViewer* /*viewer*/)
+	{
+	}
+
 	void LightShadowData::RegisterViewer(const AbstractViewer* /*viewer*/)
 	{
 	}
@@ -4,6 +4,7 @@
 
 #include <Nazara/Graphics/Material.hpp>
 #include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/VertexDeclaration.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/MaterialInstance.hpp>
 #include <Nazara/Graphics/PredefinedShaderStructs.hpp>
@@ -136,55 +137,64 @@ namespace Nz
 				{
 					using namespace nzsl::Ast::Literals;
 
-					if (vertexBuffers.empty())
-						return;
-
-					const VertexDeclaration& vertexDeclaration = *vertexBuffers.front().declaration;
-					const auto& components = vertexDeclaration.GetComponents();
-
+					// Vertex locations are assigned sequentially across vertex buffers (as done by the render pipeline)
 					Int32 locationIndex = 0;
-					for (const auto& component : components)
+					for (const auto& vertexBuffer : vertexBuffers)
 					{
-						switch (component.component)
-						{
-							case VertexComponent::Color:
-								config.optionValues["VertexColorLoc"_opt] = locationIndex;
-								break;
-
-							case VertexComponent::Normal:
-								config.optionValues["VertexNormalLoc"_opt] = locationIndex;
-								break;
-
-							case VertexComponent::Position:
-								config.optionValues["VertexPositionLoc"_opt] = locationIndex;
-								break;
-
-							case VertexComponent::SizeSinCos:
-								config.optionValues["VertexSizeRotLocation"_opt] = locationIndex;
-								break;
-
-							case VertexComponent::Tangent:
-								config.optionValues["VertexTangentLoc"_opt] = locationIndex;
-								break;
+						const VertexDeclaration& vertexDeclaration = *vertexBuffer.declaration;
+						const auto& components = vertexDeclaration.GetComponents();
 
-							case VertexComponent::TexCoord:
-								config.optionValues["VertexUvLoc"_opt] = locationIndex;
-								break;
-
-							case VertexComponent::JointIndices:
-								config.optionValues["VertexJointIndicesLoc"_opt] = locationIndex;
-								break;
-
-							case VertexComponent::JointWeights:
-								config.optionValues["VertexJointWeightsLoc"_opt] = locationIndex;
-								break;
-
-							case VertexComponent::Unused:
-							case VertexComponent::Userdata:
-								break;
+						// Per-instance world matrices (see SubmeshRenderer)
+						if (vertexBuffer.declaration == VertexDeclaration::Get(VertexLayout::Matrix4_Instance))
+						{
+							config.optionValues["InstanceWorldMatrixLoc"_opt] = locationIndex;
+							locationIndex += SafeCast<Int32>(components.size());
+							continue;
 						}
 
-						++locationIndex;
+						for (const auto& component : components)
+						{
+							switch (component.component)
+							{
+								case VertexComponent::Color:
+									config.optionValues["VertexColorLoc"_opt] = locationIndex;
+									break;
+
+								case VertexComponent::Normal:
+									config.optionValues["VertexNormalLoc"_opt] = locationIndex;
+									break;
+
+								case VertexComponent::Position:
+									config.optionValues["VertexPositionLoc"_opt] = locationIndex;
+									break;
+
+								case VertexComponent::SizeSinCos:
+									config.optionValues["VertexSizeRotLocation"_opt] = locationIndex;
+									break;
+
+								case VertexComponent::Tangent:
+									config.optionValues["VertexTangentLoc"_opt] = locationIndex;
+									break;
+
+								case VertexComponent::TexCoord:
+									config.optionValues["VertexUvLoc"_opt] = locationIndex;
+									break;
+
+								case VertexComponent::JointIndices:
+									config.optionValues["VertexJointIndicesLoc"_opt] = locationIndex;
+									break;
+
+								case VertexComponent::JointWeights:
+									config.optionValues["VertexJointWeightsLoc"_opt] = locationIndex;
+									break;
+
+								case VertexComponent::Unused:
+								case VertexComponent::Userdata:
+									break;
+							}
+
+							++locationIndex;
+						}
 					}
 				});
 			}
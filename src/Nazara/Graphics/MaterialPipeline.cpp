@@ -5,9 +5,11 @@
 #include <Nazara/Graphics/MaterialPipeline.hpp>
 #include <Nazara/Core/File.hpp>
 #include <Nazara/Core/Log.hpp>
+#include <Nazara/Core/VertexDeclaration.hpp>
 #include <Nazara/Graphics/Graphics.hpp>
 #include <Nazara/Graphics/MaterialPass.hpp>
 #include <Nazara/Graphics/UberShader.hpp>
+#include <algorithm>
 
 namespace Nz
 {
@@ -18,6 +20,36 @@ namespace Nz
 	* \brief Graphics class used to contains all rendering states that are not allowed to change individually on rendering devices
 	*/
 
+	/*!
+	* \brief Retrieve (and generate if required) a pipeline rendering multiple instances per draw call
+	* \return Instanced render pipeline, or a null pointer if the shaders of this pipeline don't support instancing
+	*
+	* The instanced pipeline takes an additional per-instance vertex buffer (using VertexLayout::Matrix4_Instance and bound right after the given vertex buffers) holding the world matrix of each instance.
+	*
+	* \param vertexBuffers Vertex buffers used by the non-instanced pipeline
+	* \param vertexBufferCount Vertex buffer count
+	*
+	* \see SupportsInstancing
+	*/
+	const std::shared_ptr<RenderPipeline>& MaterialPipeline::GetInstancedRenderPipeline(const RenderPipelineInfo::VertexBufferData* vertexBuffers, std::size_t vertexBufferCount) const
+	{
+		static std::shared_ptr<RenderPipeline> noPipeline;
+		if (!SupportsInstancing())
+			return noPipeline;
+
+		std::size_t instanceBinding = 0;
+		for (std::size_t i = 0; i < vertexBufferCount; ++i)
+			instanceBinding = std::max(instanceBinding, vertexBuffers[i].binding + 1);
+
+		std::vector<RenderPipelineInfo::VertexBufferData> instancedVertexBuffers(vertexBuffers, vertexBuffers + vertexBufferCount);
+		instancedVertexBuffers.push_back({
+			instanceBinding,
+			VertexDeclaration::Get(VertexLayout::Matrix4_Instance)
+		});
+
+		return GetRenderPipeline(instancedVertexBuffers.data(), instancedVertexBuffers.size());
+	}
+
 	/*!
 	* \brief Retrieve (and generate if required) a pipeline instance using shader flags without applying it
 	*
@@ -71,6 +103,27 @@ namespace Nz
 		return m_renderPipelines.emplace_back(Graphics::Instance()->GetRenderDevice()->InstantiateRenderPipeline(std::move(renderPipelineInfo)));
 	}
 
+	/*!
+	* \brief Checks if the shaders of this pipeline can take their world matrix from a per-instance vertex buffer
+	* \return True if every shader supports instancing
+	*/
+	bool MaterialPipeline::SupportsInstancing() const
+	{
+		bool hasShader = false;
+		for (const auto& shader : m_pipelineInfo.shaders)
+		{
+			if (!shader.uberShader)
+				continue;
+
+			if (!shader.uberShader->HasOption("InstanceWorldMatrixLoc"))
+				return false;
+
+			hasShader = true;
+		}
+
+		return hasShader;
+	}
+
 	/*!
 	* \brief Returns a reference to a MaterialPipeline built with MaterialPipelineInfo
 	*
@@ -98,7 +98,7 @@ namespace Nz
 		});
 	}
 
-	void PointLightShadowData::PrepareRendering(RenderResources& renderResources, [[maybe_unused]] const AbstractViewer* viewer)
+	void PointLightShadowData::PrepareCulling([[maybe_unused]] const AbstractViewer* viewer)
 	{
 		assert(viewer == nullptr);
 
@@ -106,14 +106,23 @@ namespace Nz
 		{
 			const Matrix4f& viewProjMatrix = direction.viewer.GetViewerInstance().GetViewProjMatrix();
 
-			Frustumf frustum = Frustumf::Extract(viewProjMatrix);
+			direction.frustum = Frustumf::Extract(viewProjMatrix);
+			direction.frustumCullIndex = m_pipeline.QueueFrustumCull(direction.frustum, 0xFFFFFFFF);
+		}
+	}
 
+	void PointLightShadowData::PrepareRendering(RenderResources& renderResources, [[maybe_unused]] const AbstractViewer* viewer)
+	{
+		assert(viewer == nullptr);
+
+		for (DirectionData& direction : m_directions)
+		{
 			std::size_t visibilityHash = 5U;
-			const auto& visibleRenderables = m_pipeline.FrustumCull(frustum, 0xFFFFFFFF, visibilityHash);
+			const auto& visibleRenderables = m_pipeline.RetrieveFrustumCull(direction.frustumCullIndex, visibilityHash);
 
 			FramePipelinePass::FrameData passData = {
 				nullptr,
-				frustum,
+				direction.frustum,
 				renderResources,
 				visibleRenderables,
 				visibilityHash
@@ -18,6 +18,7 @@ namespace Nz
 		switch (bufferType)
 		{
 			case BufferType::Index:
+			case BufferType::Indirect:
 			case BufferType::Vertex:
 			case BufferType::Upload:
 				break; // TODO
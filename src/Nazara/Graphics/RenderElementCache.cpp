@@ -0,0 +1,217 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Graphics module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Graphics/RenderElementCache.hpp>
+#include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <Nazara/Graphics/RenderElement.hpp>
+#include <Nazara/Renderer/RenderResources.hpp>
+
+namespace Nz
+{
+	RenderElementCache::RenderElementCache() :
+	m_elementCount(0),
+	m_removedElementCount(0),
+	m_updateCounter(0)
+	{
+	}
+
+	void RenderElementCache::Clear(RenderResources& renderResources)
+	{
+		Clear([&](std::vector<RenderElementOwner>&& elements)
+		{
+			renderResources.PushForRelease(std::move(elements));
+		});
+	}
+
+	void RenderElementCache::Clear(ReleaseCallback releaseCallback)
+	{
+		for (auto&& [key, entry] : m_renderables)
+		{
+			if (!entry.elements.empty())
+				releaseCallback(std::move(entry.elements));
+		}
+
+		m_renderables.clear();
+		m_renderQueue.Clear();
+		m_renderQueueRegistry.Clear();
+		m_elementCount = 0;
+		m_removedElementCount = 0;
+	}
+
+	/*!
+	* \brief Updates the cached elements to match the visible renderables
+	* \return True if the set of elements changed, meaning the render queue has to be sorted and prepared again
+	*
+	* Only renderables which weren't visible during the last update get their elements built, and elements of renderables which are no longer visible are released.
+	* Registry indices of kept elements stay the same, unused indices are only reclaimed when more elements were removed than there are elements left.
+	*
+	* \param elementRegistry Registry used to build elements
+	* \param passIndex Material pass index elements are built for
+	* \param renderMask Renderables not matching this mask are ignored
+	* \param visibleRenderables Renderables to build elements for
+	* \param renderResources Render resources which will release the elements of renderables no longer visible
+	* \param rebuild Rebuilds every element instead of reusing cached ones, for when elements were invalidated
+	*/
+	bool RenderElementCache::Update(ElementRendererRegistry& elementRegistry, std::size_t passIndex, UInt32 renderMask, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, RenderResources& renderResources, bool rebuild)
+	{
+		auto BuildElements = [&](const FramePipelinePass::VisibleRenderable& renderableData, std::vector<RenderElementOwner>& elements)
+		{
+			InstancedRenderable::ElementData elementData{
+				&renderableData.scissorBox,
+				renderableData.skeletonInstance,
+				renderableData.worldInstance
+			};
+
+			renderableData.instancedRenderable->BuildElement(elementRegistry, elementData, passIndex, elements);
+		};
+
+		auto ReleaseElements = [&](std::vector<RenderElementOwner>&& elements)
+		{
+			renderResources.PushForRelease(std::move(elements));
+		};
+
+		return Update(renderMask, visibleRenderables, rebuild, BuildElements, ReleaseElements);
+	}
+
+	/*!
+	* \brief Updates the cached elements to match the visible renderables, using callbacks to build and release elements
+	* \return True if the set of elements changed
+	*
+	* Renderables are identified by their instanced renderable, skeleton instance, world instance and generation, a renderable registered again at the same address is therefore treated as a new one.
+	*
+	* \param renderMask Renderables not matching this mask are ignored
+	* \param visibleRenderables Renderables to build elements for
+	* \param rebuild Rebuilds every element instead of reusing cached ones
+	* \param buildCallback Callback appending the elements of a renderable
+	* \param releaseCallback Callback taking ownership of elements which are no longer used
+	*/
+	bool RenderElementCache::Update(UInt32 renderMask, const std::vector<FramePipelinePass::VisibleRenderable>& visibleRenderables, bool rebuild, BuildCallback buildCallback, ReleaseCallback releaseCallback)
+	{
+		m_updateCounter++;
+
+		auto BuildElements = [&](const FramePipelinePass::VisibleRenderable& renderableData, RenderableEntry& entry)
+		{
+			std::size_t firstElement = entry.elements.size();
+			buildCallback(renderableData, entry.elements);
+
+			m_elementCount += entry.elements.size() - firstElement;
+		};
+
+		auto GetKey = [](const FramePipelinePass::VisibleRenderable& renderableData)
+		{
+			return RenderableKey{ renderableData.instancedRenderable, renderableData.skeletonInstance, renderableData.worldInstance, renderableData.generation };
+		};
+
+		if (!rebuild)
+		{
+			bool hasChanged = false;
+			for (const auto& renderableData : visibleRenderables)
+			{
+				if ((renderMask & renderableData.renderMask) == 0)
+					continue;
+
+				auto [it, inserted] = m_renderables.try_emplace(GetKey(renderableData));
+				RenderableEntry& entry = it->second;
+				if (inserted)
+				{
+					BuildElements(renderableData, entry);
+					for (const auto& renderElement : entry.elements)
+						renderElement->Register(m_renderQueueRegistry);
+
+					hasChanged = true;
+				}
+				else if (entry.lastUpdate == m_updateCounter || entry.isVisibleMultipleTimes)
+				{
+					// Renderable is (or was) visible more than once, which can't be told apart by diffing
+					rebuild = true;
+					break;
+				}
+
+				entry.lastUpdate = m_updateCounter;
+			}
+
+			if (!rebuild)
+			{
+				for (auto&& [key, entry] : m_renderables)
+				{
+					if (entry.lastUpdate == m_updateCounter)
+						continue;
+
+					m_elementCount -= entry.elements.size();
+					m_removedElementCount += entry.elements.size();
+
+					if (!entry.elements.empty())
+						releaseCallback(std::move(entry.elements));
+
+					m_removedRenderables.push_back(key);
+				}
+
+				if (!m_removedRenderables.empty())
+				{
+					for (const RenderableKey& key : m_removedRenderables)
+						m_renderables.erase(key);
+
+					m_removedRenderables.clear();
+					hasChanged = true;
+				}
+
+				if (!hasChanged)
+					return false;
+
+				// Registries only grow as elements are added, compact them once they're mostly made of removed elements
+				if (m_removedElementCount > m_elementCount)
+					RegisterElements();
+			}
+		}
+
+		if (rebuild)
+		{
+			Clear(releaseCallback);
+
+			for (const auto& renderableData : visibleRenderables)
+			{
+				if ((renderMask & renderableData.renderMask) == 0)
+					continue;
+
+				RenderableEntry& entry = m_renderables[GetKey(renderableData)];
+				if (entry.lastUpdate == m_updateCounter)
+					entry.isVisibleMultipleTimes = true;
+
+				BuildElements(renderableData, entry);
+
+				entry.lastUpdate = m_updateCounter;
+			}
+
+			RegisterElements();
+		}
+
+		m_renderQueueRegistry.Finalize();
+		BuildRenderQueue();
+
+		return true;
+	}
+
+	void RenderElementCache::BuildRenderQueue()
+	{
+		// Rebuilding the queue is only a matter of copying pointers, the queue has to be sorted again anyway
+		m_renderQueue.Clear();
+		for (auto&& [key, entry] : m_renderables)
+		{
+			for (const auto& renderElement : entry.elements)
+				m_renderQueue.Insert(renderElement.GetElement());
+		}
+	}
+
+	void RenderElementCache::RegisterElements()
+	{
+		m_renderQueueRegistry.Clear();
+		for (auto&& [key, entry] : m_renderables)
+		{
+			for (const auto& renderElement : entry.elements)
+				renderElement->Register(m_renderQueueRegistry);
+		}
+
+		m_removedElementCount = 0;
+	}
+}
@@ -60,20 +60,26 @@ namespace Nz
 		});
 	}
 
-	void SpotLightShadowData::PrepareRendering(RenderResources& renderResources, [[maybe_unused]] const AbstractViewer* viewer)
+	void SpotLightShadowData::PrepareCulling([[maybe_unused]] const AbstractViewer* viewer)
 	{
 		assert(viewer == nullptr);
 
 		const Matrix4f& viewProjMatrix = m_viewer.GetViewerInstance().GetViewProjMatrix();
 
-		Frustumf frustum = Frustumf::Extract(viewProjMatrix);
+		m_frustum = Frustumf::Extract(viewProjMatrix);
+		m_frustumCullIndex = m_pipeline.QueueFrustumCull(m_frustum, 0xFFFFFFFF);
+	}
+
+	void SpotLightShadowData::PrepareRendering(RenderResources& renderResources, [[maybe_unused]] const AbstractViewer* viewer)
+	{
+		assert(viewer == nullptr);
 
 		std::size_t visibilityHash = 5U;
-		const auto& visibleRenderables = m_pipeline.FrustumCull(frustum, 0xFFFFFFFF, visibilityHash);
+		const auto& visibleRenderables = m_pipeline.RetrieveFrustumCull(m_frustumCullIndex, visibilityHash);
 
 		FramePipelinePass::FrameData passData = {
 			nullptr,
-			frustum,
+			m_frustum,
 			renderResources,
 			visibleRenderables,
 			visibilityHash
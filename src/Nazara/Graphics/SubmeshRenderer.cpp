@@ -11,9 +11,102 @@
 #include <Nazara/Graphics/ViewerInstance.hpp>
 #include <Nazara/Renderer/CommandBufferBuilder.hpp>
 #include <Nazara/Renderer/RenderResources.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
 
 namespace Nz
 {
+	namespace
+	{
+		constexpr UInt64 MinIndirectBufferSize = 4 * 1024;
+		constexpr UInt64 MinInstanceBufferSize = 64 * 1024;
+
+		std::shared_ptr<RenderBuffer> AcquireBuffer(std::vector<std::shared_ptr<RenderBuffer>>& bufferPool, BufferType bufferType, UInt64 size, UInt64 minSize)
+		{
+			// Pooled buffers too small for this frame are dropped, they will be replaced by bigger ones
+			while (!bufferPool.empty())
+			{
+				std::shared_ptr<RenderBuffer> buffer = std::move(bufferPool.back());
+				bufferPool.pop_back();
+
+				if (buffer->GetSize() >= size)
+					return buffer;
+			}
+
+			RenderDevice& renderDevice = *Graphics::Instance()->GetRenderDevice();
+			return renderDevice.InstantiateBuffer(bufferType, std::max(std::bit_ceil(size), minSize), BufferUsage::DeviceLocal | BufferUsage::Write);
+		}
+
+		void AppendIndirectCommand(std::vector<UInt8>& indirectCommands, const SubmeshRendererData::DrawCall& drawCall)
+		{
+			UInt32 firstInstance = SafeCast<UInt32>(drawCall.instanceOffset / sizeof(Matrix4f));
+
+			std::size_t offset = indirectCommands.size();
+			if (drawCall.indexBuffer)
+			{
+				CommandBufferBuilder::DrawIndexedIndirectCommand command;
+				command.firstIndex = SafeCast<UInt32>(drawCall.firstIndex);
+				command.firstInstance = firstInstance;
+				command.indexCount = SafeCast<UInt32>(drawCall.indexCount);
+				command.instanceCount = SafeCast<UInt32>(drawCall.instanceCount);
+				command.vertexOffset = 0;
+
+				indirectCommands.resize(offset + sizeof(command));
+				std::memcpy(&indirectCommands[offset], &command, sizeof(command));
+			}
+			else
+			{
+				CommandBufferBuilder::DrawIndirectCommand command;
+				command.firstInstance = firstInstance;
+				command.firstVertex = SafeCast<UInt32>(drawCall.firstIndex);
+				command.instanceCount = SafeCast<UInt32>(drawCall.instanceCount);
+				command.vertexCount = SafeCast<UInt32>(drawCall.indexCount);
+
+				indirectCommands.resize(offset + sizeof(command));
+				std::memcpy(&indirectCommands[offset], &command, sizeof(command));
+			}
+		}
+
+		bool CanBeDrawnIndirectly(const SubmeshRendererData::DrawCall& lhs, const SubmeshRendererData::DrawCall& rhs)
+		{
+			// Draw calls reading their world matrices from the instance buffer only differ by their draw parameters
+			return lhs.useInstanceBuffer && rhs.useInstanceBuffer &&
+			       lhs.renderPipeline == rhs.renderPipeline &&
+			       lhs.shaderBinding == rhs.shaderBinding &&
+			       lhs.indexBuffer == rhs.indexBuffer &&
+			       lhs.indexType == rhs.indexType &&
+			       lhs.vertexBuffer == rhs.vertexBuffer &&
+			       lhs.scissorBox == rhs.scissorBox;
+		}
+
+		bool CanBeInstanced(const RenderSubmesh& lhs, const RenderSubmesh& rhs)
+		{
+			// Only the world instance may differ between instances
+			return lhs.GetRenderPipeline() == rhs.GetRenderPipeline() &&
+			       &lhs.GetMaterialInstance() == &rhs.GetMaterialInstance() &&
+			       lhs.GetIndexBuffer() == rhs.GetIndexBuffer() &&
+			       lhs.GetVertexBuffer() == rhs.GetVertexBuffer() &&
+			       lhs.GetIndexCount() == rhs.GetIndexCount() &&
+			       lhs.GetScissorBox() == rhs.GetScissorBox() &&
+			       !rhs.GetSkeletonInstance();
+		}
+
+		void UploadInstanceMatrices(RenderResources& renderResources, SubmeshRendererData& data)
+		{
+			UInt64 instanceSize = data.instanceMatrices.size() * sizeof(Matrix4f);
+
+			UploadPool::Allocation& allocation = renderResources.GetUploadPool().Allocate(instanceSize);
+			std::memcpy(allocation.mappedPtr, data.instanceMatrices.data(), instanceSize);
+
+			renderResources.Execute([&](CommandBufferBuilder& builder)
+			{
+				builder.CopyBuffer(allocation, data.instanceBuffer.get(), instanceSize);
+				builder.MemoryBarrier(PipelineStage::Transfer, PipelineStage::VertexInput, MemoryAccess::TransferWrite, MemoryAccess::VertexBufferRead);
+			}, QueueType::Transfer);
+		}
+	}
+
 	SubmeshRenderer::SubmeshRenderer()
 	{
 		m_pool = std::make_shared<PoolData>();
@@ -59,9 +152,14 @@ namespace Nz
 		Recti currentScissorBox = invalidScissorBox;
 		RenderBufferView currentLightData;
 
+		// Submeshes using an instanced pipeline don't need a shader binding per world instance, consecutive draw calls
+		// of different submeshes or world instances can then be merged in a single indirect draw
+		const RenderDeviceFeatures& enabledFeatures = renderDevice.GetEnabledFeatures();
+		bool useIndirectDraws = enabledFeatures.drawIndirect && enabledFeatures.drawIndirectFirstInstance;
+
 		auto FlushDrawCall = [&]()
 		{
-			// Does nothing for now (but will serve once instancing is implemented)
+			// Does nothing for now (instanced draw calls are emitted directly)
 		};
 
 		auto FlushDrawData = [&]()
@@ -89,10 +187,37 @@ namespace Nz
 			const RenderSubmesh& submesh = static_cast<const RenderSubmesh&>(*elements[i]);
 			const RenderStates& renderState = renderStates[i];
 
-			if (const RenderPipeline* pipeline = submesh.GetRenderPipeline(); currentPipeline != pipeline)
+			// Consecutive submeshes only differing by their world instance are rendered using a single instanced draw call
+			const RenderPipeline* renderPipeline = submesh.GetRenderPipeline();
+			std::size_t instanceCount = 1;
+			bool useInstanceBuffer = false;
+			if (!submesh.GetSkeletonInstance())
+			{
+				while (i + instanceCount < elementCount)
+				{
+					const RenderSubmesh& otherSubmesh = static_cast<const RenderSubmesh&>(*elements[i + instanceCount]);
+					if (!CanBeInstanced(submesh, otherSubmesh) || renderStates[i + instanceCount].lightData != renderState.lightData)
+						break;
+
+					instanceCount++;
+				}
+
+				if (instanceCount > 1 || useIndirectDraws)
+				{
+					if (const RenderPipeline* instancedPipeline = submesh.GetInstancedRenderPipeline())
+					{
+						renderPipeline = instancedPipeline;
+						useInstanceBuffer = true;
+					}
+					else
+						instanceCount = 1;
+				}
+			}
+
+			if (currentPipeline != renderPipeline)
 			{
 				FlushDrawCall();
-				currentPipeline = pipeline;
+				currentPipeline = renderPipeline;
 			}
 
 			if (const MaterialInstance* materialInstance = &submesh.GetMaterialInstance(); currentMaterialInstance != materialInstance)
@@ -119,13 +244,9 @@ namespace Nz
 				currentSkeletonInstance = skeletonInstance;
 			}
 
-			if (const WorldInstance* worldInstance = &submesh.GetWorldInstance(); currentWorldInstance != worldInstance)
-			{
-				// TODO: Flushing draw calls on instance binding means we can have e.g. 1000 sprites rendered using a draw call for each one
-				// which is far from being efficient, using some bindless could help (or at least instancing?)
+			// Instanced pipelines read world matrices from the instance buffer, only other pipelines need a shader binding per world instance
+			if (const WorldInstance* worldInstance = &submesh.GetWorldInstance(); currentWorldInstance != worldInstance && !useInstanceBuffer)
 				FlushDrawData();
-				currentWorldInstance = worldInstance;
-			}
 
 			if (currentLightData != renderState.lightData)
 			{
@@ -144,6 +265,7 @@ namespace Nz
 			if (!currentShaderBinding)
 			{
 				NazaraAssert(currentMaterialInstance);
+				currentWorldInstance = &submesh.GetWorldInstance();
 
 				m_bindingCache.clear();
 				m_textureBindingCache.clear();
@@ -286,15 +408,46 @@ namespace Nz
 				data.shaderBindings.emplace_back(std::move(drawDataBinding));
 			}
 
-			auto& drawCall = data.drawCalls.emplace_back();
+			SubmeshRendererData::DrawCall drawCall;
+			drawCall.drawCount = 0;
 			drawCall.firstIndex = 0;
 			drawCall.indexBuffer = currentIndexBuffer;
 			drawCall.indexCount = submesh.GetIndexCount();
 			drawCall.indexType = submesh.GetIndexType();
+			drawCall.indirectOffset = 0;
+			drawCall.instanceCount = instanceCount;
+			drawCall.instanceOffset = 0;
 			drawCall.renderPipeline = currentPipeline;
 			drawCall.scissorBox = currentScissorBox;
 			drawCall.shaderBinding = currentShaderBinding;
+			drawCall.useInstanceBuffer = useInstanceBuffer;
 			drawCall.vertexBuffer = currentVertexBuffer;
+
+			if (useInstanceBuffer)
+			{
+				drawCall.instanceOffset = data.instances.size() * sizeof(Matrix4f);
+				for (std::size_t j = 0; j < instanceCount; ++j)
+					data.instances.push_back(&static_cast<const RenderSubmesh&>(*elements[i + j]).GetWorldInstance());
+
+				i += instanceCount - 1;
+			}
+
+			if (useIndirectDraws && data.drawCalls.size() > oldDrawCallCount && CanBeDrawnIndirectly(data.drawCalls.back(), drawCall))
+			{
+				// Commands of the previous draw call are the last ones, this one can be appended to them
+				auto& batchDrawCall = data.drawCalls.back();
+				if (batchDrawCall.drawCount == 0)
+				{
+					batchDrawCall.drawCount = 1;
+					batchDrawCall.indirectOffset = data.indirectCommands.size();
+					AppendIndirectCommand(data.indirectCommands, batchDrawCall);
+				}
+
+				AppendIndirectCommand(data.indirectCommands, drawCall);
+				batchDrawCall.drawCount++;
+			}
+			else
+				data.drawCalls.push_back(drawCall);
 		}
 
 		const RenderSubmesh* firstSubmesh = static_cast<const RenderSubmesh*>(elements[0]);
@@ -302,6 +455,40 @@ namespace Nz
 		data.drawCallPerElement[firstSubmesh] = SubmeshRendererData::DrawCallIndices{ oldDrawCallCount, drawCallCount };
 	}
 
+	void SubmeshRenderer::PrepareEnd(RenderResources& renderResources, ElementRendererData& rendererData)
+	{
+		auto& data = static_cast<SubmeshRendererData&>(rendererData);
+
+		if (!data.indirectCommands.empty())
+		{
+			NazaraAssertMsg(!data.indirectBuffer, "indirect buffer was not released");
+
+			UInt64 indirectSize = data.indirectCommands.size();
+			data.indirectBuffer = AcquireBuffer(m_pool->indirectBuffers, BufferType::Indirect, indirectSize, MinIndirectBufferSize);
+
+			UploadPool::Allocation& allocation = renderResources.GetUploadPool().Allocate(indirectSize);
+			std::memcpy(allocation.mappedPtr, data.indirectCommands.data(), indirectSize);
+
+			renderResources.Execute([&](CommandBufferBuilder& builder)
+			{
+				builder.CopyBuffer(allocation, data.indirectBuffer.get(), indirectSize);
+				builder.MemoryBarrier(PipelineStage::Transfer, PipelineStage::DrawIndirect, MemoryAccess::TransferWrite, MemoryAccess::IndirectCommandRead);
+			}, QueueType::Transfer);
+		}
+
+		if (!data.instances.empty())
+		{
+			NazaraAssertMsg(!data.instanceBuffer, "instance buffer was not released");
+
+			data.instanceMatrices.resize(data.instances.size());
+			for (std::size_t i = 0; i < data.instances.size(); ++i)
+				data.instanceMatrices[i] = data.instances[i]->GetWorldMatrix();
+
+			data.instanceBuffer = AcquireBuffer(m_pool->instanceBuffers, BufferType::Vertex, data.instanceMatrices.size() * sizeof(Matrix4f), MinInstanceBufferSize);
+			UploadInstanceMatrices(renderResources, data);
+		}
+	}
+
 	void SubmeshRenderer::Render(const ViewerInstance& viewerInstance, ElementRendererData& rendererData, CommandBufferBuilder& commandBuffer, std::size_t /*elementCount*/, const Pointer<const RenderElement>* elements)
 	{
 		auto& data = static_cast<SubmeshRendererData&>(rendererData);
@@ -360,10 +547,27 @@ namespace Nz
 				currentScissorBox = targetScissorBox;
 			}
 
-			if (currentIndexBuffer)
-				commandBuffer.DrawIndexed(SafeCast<UInt32>(drawData.indexCount), 1U, SafeCast<UInt32>(drawData.firstIndex));
+			if (drawData.useInstanceBuffer)
+			{
+				NazaraAssert(data.instanceBuffer);
+
+				// The instanced pipeline expects the instance buffer right after the regular vertex buffers, indirect commands select their instances using their first instance
+				UInt32 instanceBinding = SafeCast<UInt32>(drawData.renderPipeline->GetPipelineInfo().vertexBuffers.back().binding);
+				commandBuffer.BindVertexBuffer(instanceBinding, *data.instanceBuffer, (drawData.drawCount > 0) ? 0 : drawData.instanceOffset);
+			}
+
+			if (drawData.drawCount > 0)
+			{
+				NazaraAssert(data.indirectBuffer);
+				if (currentIndexBuffer)
+					commandBuffer.DrawIndexedIndirect(*data.indirectBuffer, drawData.indirectOffset, drawData.drawCount);
+				else
+					commandBuffer.DrawIndirect(*data.indirectBuffer, drawData.indirectOffset, drawData.drawCount);
+			}
+			else if (currentIndexBuffer)
+				commandBuffer.DrawIndexed(SafeCast<UInt32>(drawData.indexCount), SafeCast<UInt32>(drawData.instanceCount), SafeCast<UInt32>(drawData.firstIndex));
 			else
-				commandBuffer.Draw(SafeCast<UInt32>(drawData.indexCount), 1U, SafeCast<UInt32>(drawData.firstIndex));
+				commandBuffer.Draw(SafeCast<UInt32>(drawData.indexCount), SafeCast<UInt32>(drawData.instanceCount), SafeCast<UInt32>(drawData.firstIndex));
 		}
 	}
 
@@ -385,6 +589,49 @@ namespace Nz
 			renderResources.PushForRelease(std::move(shaderBinding));
 		data.shaderBindings.clear();
 
+		if (data.indirectBuffer)
+		{
+			renderResources.PushReleaseCallback([pool = m_pool, indirectBuffer = std::move(data.indirectBuffer)]() mutable
+			{
+				pool->indirectBuffers.push_back(std::move(indirectBuffer));
+			});
+			data.indirectBuffer.reset();
+		}
+
+		if (data.instanceBuffer)
+		{
+			renderResources.PushReleaseCallback([pool = m_pool, instanceBuffer = std::move(data.instanceBuffer)]() mutable
+			{
+				pool->instanceBuffers.push_back(std::move(instanceBuffer));
+			});
+			data.instanceBuffer.reset();
+		}
+
 		data.drawCalls.clear();
+		data.indirectCommands.clear();
+		data.instanceMatrices.clear();
+		data.instances.clear();
+	}
+
+	void SubmeshRenderer::Update(RenderResources& renderResources, ElementRendererData& rendererData)
+	{
+		auto& data = static_cast<SubmeshRendererData&>(rendererData);
+		if (data.instances.empty())
+			return;
+
+		// Instances can move without their elements being rebuilt, only upload their world matrices again if one of them changed
+		bool hasChanged = false;
+		for (std::size_t i = 0; i < data.instances.size(); ++i)
+		{
+			const Matrix4f& worldMatrix = data.instances[i]->GetWorldMatrix();
+			if (data.instanceMatrices[i] != worldMatrix)
+			{
+				data.instanceMatrices[i] = worldMatrix;
+				hasChanged = true;
+			}
+		}
+
+		if (hasChanged)
+			UploadInstanceMatrices(renderResources, data);
 	}
 }
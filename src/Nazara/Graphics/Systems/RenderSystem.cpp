@@ -7,6 +7,7 @@
 #include <Nazara/Core/Components/NodeComponent.hpp>
 #include <Nazara/Core/Components/SharedSkeletonComponent.hpp>
 #include <Nazara/Core/Components/SkeletonComponent.hpp>
+#include <Nazara/Core/EnttParallel.hpp>
 #include <Nazara/Graphics/DefaultFramePipeline.hpp>
 #include <Nazara/Graphics/ViewerInstance.hpp>
 #include <Nazara/Graphics/WorldInstance.hpp>
@@ -71,6 +72,9 @@ namespace Nz
 		UpdateObservers();
 		UpdateInstances();
 
+		// Frustum cullings use the task scheduler of the system graph, if any
+		m_pipeline->SetTaskScheduler(GetEnttTaskScheduler(m_registry));
+
 		auto HandleSwapchain = [&](WindowSwapchain& swapchain)
 		{
 			RenderFrame frame = swapchain.AcquireFrame();
@@ -3,8 +3,34 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Network/ENetCompressor.hpp>
+#include <cstring>
 
 namespace Nz
 {
 	ENetCompressor::~ENetCompressor() = default;
+
+	/*!
+	* \brief Returns the input buffers as one contiguous block
+	*
+	* \param buffers Buffers to compress
+	* \param bufferCount Number of buffers
+	* \param totalInputSize Sum of the buffers length
+	* \param scratch Storage used to concatenate the buffers when there's more than one
+	*/
+	const UInt8* ENetCompressor::GatherInput(const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, std::vector<UInt8>& scratch)
+	{
+		if (bufferCount == 1)
+			return static_cast<const UInt8*>(buffers[0].data);
+
+		scratch.resize(totalInputSize);
+
+		UInt8* ptr = scratch.data();
+		for (std::size_t i = 0; i < bufferCount; ++i)
+		{
+			std::memcpy(ptr, buffers[i].data, buffers[i].dataLength);
+			ptr += buffers[i].dataLength;
+		}
+
+		return scratch.data();
+	}
 }
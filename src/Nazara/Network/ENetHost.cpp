@@ -42,24 +42,18 @@ namespace Nz
 	}
 
 
-	ENetPacketRef ENetHost::AllocatePacket(ENetPacketFlags flags)
+	void ENetHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet)
 	{
-		std::size_t poolIndex;
-
-		ENetPacket* packet = m_packetPool.Allocate(poolIndex);
-
-		ENetPacketRef enetPacket(&m_packetPool, packet);
-		enetPacket->flags = flags;
-		enetPacket->poolIndex = poolIndex;
-		enetPacket.m_pool = &m_packetPool;
-
-		return enetPacket;
+		Broadcast(channelId, AllocatePacket(flags, std::move(packet)));
 	}
 
-	void ENetHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet)
+	/*!
+	* \brief Sends a packet to every connected peer
+	*
+	* All peers share the same packet and payload, which is only released once every peer is done with it.
+	*/
+	void ENetHost::Broadcast(UInt8 channelId, ENetPacketRef enetPacket)
 	{
-		ENetPacketRef enetPacket = AllocatePacket(flags, std::move(packet));
-
 		for (ENetPeer& peer : m_peers)
 		{
 			if (peer.GetState() != ENetPeerState::Connected)
@@ -174,7 +168,8 @@ namespace Nz
 		if (!InitSocket(listenAddress))
 			return false;
 
-		m_address = listenAddress;
+		// Keep the port picked by the system if listening on port zero
+		m_address = (m_socket.GetState() == SocketState::Bound) ? m_socket.GetBoundAddress() : listenAddress;
 		m_allowsIncomingConnections = (listenAddress.IsValid() && !listenAddress.IsLoopback());
 		m_randomSeed = *reinterpret_cast<UInt32*>(this);
 		m_randomSeed += s_randomGenerator();
@@ -192,6 +187,32 @@ namespace Nz
 		m_receivedData = nullptr;
 		m_receivedDataLength = 0;
 
+		// Datagrams are received and sent in batches, each one having its own MTU-sized buffer
+		auto InitDatagramBatch = [](DatagramBatch& batch, std::size_t datagramCount)
+		{
+			batch.count = 0;
+			batch.offset = 0;
+			batch.data.resize(datagramCount * ENetConstants::ENetProtocol_MaximumMTU);
+			batch.buffers.resize(datagramCount);
+			batch.datagrams.resize(datagramCount);
+			batch.peers.assign(datagramCount, nullptr);
+
+			for (std::size_t i = 0; i < datagramCount; ++i)
+			{
+				NetBuffer& buffer = batch.buffers[i];
+				buffer.data = &batch.data[i * ENetConstants::ENetProtocol_MaximumMTU];
+				buffer.dataLength = ENetConstants::ENetProtocol_MaximumMTU;
+
+				NetDatagram& datagram = batch.datagrams[i];
+				datagram.buffers = &buffer;
+				datagram.bufferCount = 1;
+				datagram.dataLength = 0;
+			}
+		};
+
+		InitDatagramBatch(m_incomingDatagrams, ENetConstants::ENetHost_ReceiveBatchSize);
+		InitDatagramBatch(m_outgoingDatagrams, ENetConstants::ENetHost_SendBatchSize);
+
 		m_totalSentData = 0;
 		m_totalSentPackets = 0;
 		m_totalReceivedData = 0;
@@ -217,6 +238,22 @@ namespace Nz
 		SendOutgoingCommands(nullptr, false);
 	}
 
+	/*!
+	* \brief Registers a socket which interrupts Service waits when it receives data
+	* \return true if the socket was registered
+	*
+	* This allows another thread to wake up a host blocked in Service, by sending a datagram to the wakeup socket.
+	* Service returns as soon as the wakeup socket is readable, reading its data is up to the caller.
+	*
+	* \param socket Socket to register, it must stay alive until it's unregistered or the host is destroyed
+	*
+	* \remark The host must have been created, sockets are unregistered when it's destroyed
+	*/
+	bool ENetHost::RegisterWakeupSocket(AbstractSocket& socket)
+	{
+		return m_poller.RegisterSocket(socket, SocketPollEvent::Read);
+	}
+
 	int ENetHost::Service(ENetEvent* event, UInt32 timeout)
 	{
 		if (event)
@@ -323,6 +360,11 @@ namespace Nz
 		}
 	}
 
+	void ENetHost::UnregisterWakeupSocket(AbstractSocket& socket)
+	{
+		m_poller.UnregisterSocket(socket);
+	}
+
 	bool ENetHost::InitSocket(const IpAddress& address)
 	{
 		if (!m_socket.Create((m_isUsingDualStack) ? NetProtocol::Any : address.GetProtocol()))
@@ -330,6 +372,9 @@ namespace Nz
 
 		m_socket.EnableBlocking(false);
 		m_socket.EnableBroadcasting(true);
+		if (m_isReusingPort)
+			m_socket.EnableReusePort(true); //< the caller checks if it succeeded
+
 		m_socket.SetReceiveBufferSize(ENetConstants::ENetHost_ReceiveBufferSize);
 		m_socket.SetSendBufferSize(ENetConstants::ENetHost_SendBufferSize);
 
@@ -415,6 +460,57 @@ namespace Nz
 		return false;
 	}
 
+	int ENetHost::FlushOutgoingDatagrams(ENetEvent* event)
+	{
+		while (m_outgoingDatagrams.offset < m_outgoingDatagrams.count)
+		{
+			std::size_t sentCount = 0;
+			bool success = m_socket.SendDatagrams(&m_outgoingDatagrams.datagrams[m_outgoingDatagrams.offset], m_outgoingDatagrams.count - m_outgoingDatagrams.offset, &sentCount);
+
+			for (std::size_t i = 0; i < sentCount; ++i)
+				m_totalSentData += m_outgoingDatagrams.datagrams[m_outgoingDatagrams.offset + i].dataLength;
+
+			m_outgoingDatagrams.offset += sentCount;
+
+			if (!success)
+			{
+				// Drop the datagram which failed to be sent
+				ENetPeer* peer = m_outgoingDatagrams.peers[m_outgoingDatagrams.offset++];
+
+				switch (m_socket.GetLastError())
+				{
+					case SocketError::NetworkError:
+					case SocketError::UnreachableHost:
+					{
+						if (!peer->IsConnected())
+						{
+							//< Network is down or unreachable (ex: IPv6 address when not supported), fails peer connection immediately
+							//< Remaining datagrams are kept for the next flush
+							NotifyDisconnect(peer, event, true);
+							return 1;
+						}
+
+						[[fallthrough]];
+					}
+
+					default:
+						m_outgoingDatagrams.count = 0;
+						m_outgoingDatagrams.offset = 0;
+						return -1;
+				}
+			}
+
+			// Socket send buffer is full, drop remaining datagrams as unbatched sending would have
+			if (sentCount == 0)
+				break;
+		}
+
+		m_outgoingDatagrams.count = 0;
+		m_outgoingDatagrams.offset = 0;
+
+		return 0;
+	}
+
 	ENetPeer* ENetHost::HandleConnect(ENetProtocolHeader* /*header*/, ENetProtocol* command)
 	{
 		if (!m_allowsIncomingConnections)
@@ -705,6 +801,7 @@ namespace Nz
 		{
 			bool shouldReceive = true;
 			std::size_t receivedLength;
+			UInt8* receivedData = m_packetData[0].data();
 
 			if (m_isSimulationEnabled)
 			{
@@ -726,11 +823,24 @@ namespace Nz
 
 			if (shouldReceive)
 			{
-				if (!m_socket.Receive(m_packetData[0].data(), m_packetData[0].size(), &m_receivedAddress, &receivedLength))
-					return -1; //< Error
+				// Only query the socket once every datagram of the previous batch has been handled
+				if (m_incomingDatagrams.offset >= m_incomingDatagrams.count)
+				{
+					m_incomingDatagrams.offset = 0;
+					if (!m_socket.ReceiveDatagrams(m_incomingDatagrams.datagrams.data(), m_incomingDatagrams.datagrams.size(), &m_incomingDatagrams.count))
+					{
+						m_incomingDatagrams.count = 0;
+						return -1; //< Error
+					}
 
-				if (receivedLength == 0)
-					return 0;
+					if (m_incomingDatagrams.count == 0)
+						return 0;
+				}
+
+				const NetDatagram& datagram = m_incomingDatagrams.datagrams[m_incomingDatagrams.offset++];
+				m_receivedAddress = datagram.address;
+				receivedData = static_cast<UInt8*>(datagram.buffers[0].data);
+				receivedLength = datagram.dataLength;
 
 				if (m_isSimulationEnabled)
 				{
@@ -743,7 +853,7 @@ namespace Nz
 						PendingIncomingPacket pendingPacket;
 						pendingPacket.deliveryTime = m_serviceTime + delay;
 						pendingPacket.from = m_receivedAddress;
-						pendingPacket.data = ByteArray(m_packetData[0].data(), receivedLength);
+						pendingPacket.data = ByteArray(receivedData, receivedLength);
 
 						auto it = std::upper_bound(m_pendingIncomingPackets.begin(), m_pendingIncomingPackets.end(), pendingPacket, [] (const PendingIncomingPacket& first, const PendingIncomingPacket& second)
 						{
@@ -756,7 +866,7 @@ namespace Nz
 				}
 			}
 
-			m_receivedData = m_packetData[0].data();
+			m_receivedData = receivedData;
 			m_receivedDataLength = receivedLength;
 
 			m_totalReceivedData += receivedLength;
@@ -969,6 +1079,10 @@ namespace Nz
 		std::array<UInt8, sizeof(ENetProtocolHeader) + sizeof(UInt32)> headerData;
 		ENetProtocolHeader* header = reinterpret_cast<ENetProtocolHeader*>(headerData.data());
 
+		// Send datagrams left over by a previous flush interrupted by a disconnection
+		if (int result = FlushOutgoingDatagrams(event); result != 0)
+			return result;
+
 		m_continueSending = true;
 
 		while (m_continueSending)
@@ -992,7 +1106,11 @@ namespace Nz
 				if (checkForTimeouts && !currentPeer->m_sentReliableCommands.empty() && ENetTimeGreaterEqual(m_serviceTime, currentPeer->m_nextTimeout) && currentPeer->CheckTimeouts(event))
 				{
 					if (event && event->type != ENetEventType::None)
+					{
+						// Don't hold datagrams built for previous peers until the next call, the event takes precedence over any sending error
+						FlushOutgoingDatagrams(nullptr);
 						return 1;
+					}
 					else
 						continue;
 				}
@@ -1110,38 +1228,43 @@ namespace Nz
 
 				if (sendNow)
 				{
-					std::size_t sentLength = 0;
+					// Sent unreliable commands are released below, copy the datagram to the outgoing batch
+					std::size_t datagramIndex = m_outgoingDatagrams.count++;
+
+					NetDatagram& datagram = m_outgoingDatagrams.datagrams[datagramIndex];
+					datagram.address = currentPeer->GetAddress();
 
-					if (!m_socket.SendMultiple(currentPeer->GetAddress(), m_buffers.data(), m_bufferCount, &sentLength))
+					NetBuffer& datagramBuffer = datagram.buffers[0];
+					UInt8* datagramData = &m_outgoingDatagrams.data[datagramIndex * ENetConstants::ENetProtocol_MaximumMTU];
+
+					std::size_t datagramSize = 0;
+					for (std::size_t i = 0; i < m_bufferCount; ++i)
 					{
-						switch (m_socket.GetLastError())
-						{
-							case SocketError::NetworkError:
-							case SocketError::UnreachableHost:
-							{
-								if (!currentPeer->IsConnected())
-								{
-									//< Network is down or unreachable (ex: IPv6 address when not supported), fails peer connection immediately
-									NotifyDisconnect(currentPeer, event, true);
-									return 1;
-								}
-
-								[[fallthrough]];
-							}
+						const NetBuffer& buffer = m_buffers[i];
+						NazaraAssertMsg(datagramSize + buffer.dataLength <= ENetConstants::ENetProtocol_MaximumMTU, "datagram exceeds maximum MTU");
 
-							default:
-								return -1;
-						}
+						std::memcpy(datagramData + datagramSize, buffer.data, buffer.dataLength);
+						datagramSize += buffer.dataLength;
 					}
 
-					m_totalSentData += sentLength;
+					datagramBuffer.dataLength = datagramSize;
+					m_outgoingDatagrams.peers[datagramIndex] = currentPeer;
 				}
 
 				currentPeer->RemoveSentUnreliableCommands();
 				m_totalSentPackets++;
+
+				if (m_outgoingDatagrams.count == m_outgoingDatagrams.datagrams.size())
+				{
+					if (int result = FlushOutgoingDatagrams(event); result != 0)
+						return result;
+				}
 			}
 		}
 
+		if (int result = FlushOutgoingDatagrams(event); result != 0)
+			return result;
+
 		if (!m_pendingOutgoingPackets.empty())
 		{
 			auto it = m_pendingOutgoingPackets.begin();
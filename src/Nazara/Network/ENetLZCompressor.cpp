@@ -0,0 +1,221 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Output follows the LZ4 block format: sequences of literals followed by a match (offset + length)
+		constexpr std::size_t MinMatch = 4;
+		constexpr std::size_t LastLiterals = 5;   //< the last bytes are always encoded as literals
+		constexpr std::size_t MatchFindLimit = 12; //< no match can start in the last bytes
+		constexpr std::size_t MaxOffset = 0xFFFF;
+
+		UInt32 Read32(const UInt8* ptr)
+		{
+			UInt32 value;
+			std::memcpy(&value, ptr, sizeof(value));
+
+			return value;
+		}
+
+		std::size_t Hash(UInt32 sequence)
+		{
+			return (sequence * 2654435761u) >> (32 - ENetLZCompressor::HashBits);
+		}
+
+		std::size_t LengthSize(std::size_t length)
+		{
+			return (length >= 15) ? (length - 15) / 255 + 1 : 0;
+		}
+
+		UInt8* WriteLength(UInt8* output, std::size_t length)
+		{
+			length -= 15;
+			while (length >= 255)
+			{
+				*output++ = 255;
+				length -= 255;
+			}
+			*output++ = static_cast<UInt8>(length);
+
+			return output;
+		}
+
+		UInt8* WriteSequence(UInt8* output, const UInt8* outputEnd, const UInt8* literals, std::size_t literalLength, std::size_t offset, std::size_t matchLength, bool lastSequence)
+		{
+			std::size_t sequenceSize = 1 + LengthSize(literalLength) + literalLength;
+			if (!lastSequence)
+				sequenceSize += 2 + LengthSize(matchLength);
+
+			if (sequenceSize > std::size_t(outputEnd - output))
+				return nullptr;
+
+			UInt8* token = output++;
+			*token = static_cast<UInt8>(std::min<std::size_t>(literalLength, 15) << 4);
+			if (literalLength >= 15)
+				output = WriteLength(output, literalLength);
+
+			std::memcpy(output, literals, literalLength);
+			output += literalLength;
+
+			if (lastSequence)
+				return output;
+
+			*output++ = static_cast<UInt8>(offset & 0xFF);
+			*output++ = static_cast<UInt8>(offset >> 8);
+
+			*token |= static_cast<UInt8>(std::min<std::size_t>(matchLength, 15));
+			if (matchLength >= 15)
+				output = WriteLength(output, matchLength);
+
+			return output;
+		}
+
+		bool ReadLength(const UInt8*& input, const UInt8* inputEnd, std::size_t& length)
+		{
+			UInt8 byte;
+			do
+			{
+				if (input >= inputEnd)
+					return false;
+
+				byte = *input++;
+				length += byte;
+			}
+			while (byte == 255);
+
+			return true;
+		}
+	}
+
+	/*!
+	* \brief Compresses a datagram using a fast LZ77 compressor tuned for small inputs
+	* \return Compressed size, or zero if the datagram couldn't be made smaller
+	*/
+	std::size_t ENetLZCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (totalInputSize <= MatchFindLimit)
+			return 0;
+
+		const UInt8* input = GatherInput(buffers, bufferCount, totalInputSize, m_inputBuffer);
+		const UInt8* inputEnd = input + totalInputSize;
+		const UInt8* matchLimit = inputEnd - LastLiterals;
+		const UInt8* matchFindLimit = inputEnd - MatchFindLimit;
+
+		// Compressing is pointless if it doesn't save at least one byte
+		UInt8* outputPtr = output;
+		const UInt8* outputEnd = output + std::min(maxOutputSize, totalInputSize - 1);
+
+		m_hashTable.fill(0);
+
+		const UInt8* anchor = input;
+		const UInt8* ip = input + 1;
+		while (ip <= matchFindLimit)
+		{
+			UInt32 sequence = Read32(ip);
+			UInt16& hashEntry = m_hashTable[Hash(sequence)];
+
+			const UInt8* candidate = input + hashEntry;
+			hashEntry = static_cast<UInt16>(ip - input);
+
+			if (candidate >= ip || std::size_t(ip - candidate) > MaxOffset || Read32(candidate) != sequence)
+			{
+				++ip;
+				continue;
+			}
+
+			while (ip > anchor && candidate > input && ip[-1] == candidate[-1])
+			{
+				--ip;
+				--candidate;
+			}
+
+			const UInt8* matchEnd = ip + MinMatch;
+			const UInt8* ref = candidate + MinMatch;
+			while (matchEnd < matchLimit && *matchEnd == *ref)
+			{
+				++matchEnd;
+				++ref;
+			}
+
+			outputPtr = WriteSequence(outputPtr, outputEnd, anchor, std::size_t(ip - anchor), std::size_t(ip - candidate), std::size_t(matchEnd - ip) - MinMatch, false);
+			if (!outputPtr)
+				return 0;
+
+			ip = matchEnd;
+			anchor = ip;
+
+			// Register a position near the end of the match to improve the odds of chaining matches
+			m_hashTable[Hash(Read32(ip - 2))] = static_cast<UInt16>(ip - 2 - input);
+		}
+
+		outputPtr = WriteSequence(outputPtr, outputEnd, anchor, std::size_t(inputEnd - anchor), 0, 0, true);
+		if (!outputPtr)
+			return 0;
+
+		return std::size_t(outputPtr - output);
+	}
+
+	std::size_t ENetLZCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		const UInt8* inputEnd = input + inputSize;
+		UInt8* outputPtr = output;
+		UInt8* outputEnd = output + maxOutputSize;
+
+		while (input < inputEnd)
+		{
+			UInt8 token = *input++;
+
+			std::size_t literalLength = token >> 4;
+			if (literalLength == 15 && !ReadLength(input, inputEnd, literalLength))
+				return 0;
+
+			if (literalLength > std::size_t(inputEnd - input) || literalLength > std::size_t(outputEnd - outputPtr))
+				return 0;
+
+			std::memcpy(outputPtr, input, literalLength);
+			input += literalLength;
+			outputPtr += literalLength;
+
+			// The last sequence only holds literals
+			if (input == inputEnd)
+				break;
+
+			if (inputEnd - input < 2)
+				return 0;
+
+			std::size_t offset = input[0] | (input[1] << 8);
+			input += 2;
+
+			if (offset == 0 || offset > std::size_t(outputPtr - output))
+				return 0;
+
+			std::size_t matchLength = token & 0xF;
+			if (matchLength == 15 && !ReadLength(input, inputEnd, matchLength))
+				return 0;
+
+			matchLength += MinMatch;
+			if (matchLength > std::size_t(outputEnd - outputPtr))
+				return 0;
+
+			// Matches may overlap their own output, copy byte by byte
+			const UInt8* ref = outputPtr - offset;
+			for (std::size_t i = 0; i < matchLength; ++i)
+				outputPtr[i] = ref[i];
+
+			outputPtr += matchLength;
+		}
+
+		return std::size_t(outputPtr - output);
+	}
+}
@@ -3,7 +3,7 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Network/ENetPacket.hpp>
-#include <NazaraUtils/MemoryPool.hpp>
+#include <Nazara/Network/ENetPacketAllocator.hpp>
 
 namespace Nz
 {
@@ -14,8 +14,8 @@ namespace Nz
 		{
 			if (--m_packet->referenceCount == 0)
 			{
-				assert(m_pool);
-				m_pool->Free(m_packet->poolIndex);
+				assert(m_allocator);
+				m_allocator->Release(m_packet);
 			}
 		}
 
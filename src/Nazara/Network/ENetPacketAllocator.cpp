@@ -0,0 +1,143 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetPacketAllocator.hpp>
+#include <algorithm>
+#include <bit>
+
+namespace Nz
+{
+	ENetPacketAllocator::ENetPacketAllocator() :
+	m_packetPool(sizeof(ENetPacket))
+	{
+	}
+
+	ENetPacketRef ENetPacketAllocator::Allocate(ENetPacketFlags flags)
+	{
+		std::size_t poolIndex;
+		ENetPacket* packet = m_packetPool.Allocate(poolIndex);
+		packet->flags = flags;
+		packet->poolIndex = poolIndex;
+
+		m_stats.activePackets++;
+
+		return ENetPacketRef(this, packet);
+	}
+
+	/*!
+	* \brief Allocates a packet with a payload of the given size taken from the pool
+	*
+	* \param flags Packet flags
+	* \param size Payload size, its content is left zero-initialized
+	*/
+	ENetPacketRef ENetPacketAllocator::Allocate(ENetPacketFlags flags, std::size_t size)
+	{
+		ENetPacketRef packet = Allocate(flags);
+		packet->data = AcquireBuffer(size);
+		packet->data.Resize(size);
+
+		return packet;
+	}
+
+	/*!
+	* \brief Allocates a packet with a copy of data as its payload, taken from the pool
+	*/
+	ENetPacketRef ENetPacketAllocator::Allocate(ENetPacketFlags flags, const void* data, std::size_t size)
+	{
+		const UInt8* bytes = static_cast<const UInt8*>(data);
+
+		ENetPacketRef packet = Allocate(flags);
+		packet->data = AcquireBuffer(size);
+		packet->data.Assign(bytes, bytes + size);
+
+		return packet;
+	}
+
+	/*!
+	* \brief Allocates a packet taking ownership of payload
+	*
+	* The payload buffer joins the pool once the packet is released.
+	*/
+	ENetPacketRef ENetPacketAllocator::Allocate(ENetPacketFlags flags, ByteArray&& payload)
+	{
+		ENetPacketRef packet = Allocate(flags);
+		packet->data = std::move(payload);
+
+		return packet;
+	}
+
+	void ENetPacketAllocator::Release(ENetPacket* packet)
+	{
+		NazaraAssertMsg(packet->referenceCount == 0, "packet is still referenced");
+
+		RecycleBuffer(std::move(packet->data));
+		m_packetPool.Free(packet->poolIndex);
+
+		m_stats.activePackets--;
+	}
+
+	ByteArray ENetPacketAllocator::AcquireBuffer(std::size_t size)
+	{
+		ByteArray buffer;
+		if (size > (std::size_t(1) << MaxSizeClassBits))
+		{
+			m_stats.bufferAllocations++;
+			buffer.Reserve(size);
+
+			return buffer;
+		}
+
+		// Smallest power of two size class able to hold size bytes
+		std::size_t sizeClassBits = std::max<std::size_t>(std::bit_width(std::max<std::size_t>(size, 1) - 1), MinSizeClassBits);
+
+		std::vector<ByteArray>& freeBuffers = m_freeBuffers[sizeClassBits - MinSizeClassBits];
+		if (!freeBuffers.empty())
+		{
+			buffer = std::move(freeBuffers.back());
+			freeBuffers.pop_back();
+
+			m_stats.bufferReuses++;
+			m_stats.pooledBuffers--;
+			m_stats.pooledMemory -= buffer.GetCapacity();
+
+			return buffer;
+		}
+
+		m_stats.bufferAllocations++;
+		buffer.Reserve(std::size_t(1) << sizeClassBits);
+
+		return buffer;
+	}
+
+	void ENetPacketAllocator::RecycleBuffer(ByteArray&& buffer)
+	{
+		std::size_t capacity = buffer.GetCapacity();
+		if (capacity == 0)
+			return;
+
+		// Buffers are pooled in the largest size class their capacity can hold, so every buffer of a class can hold its size
+		std::size_t sizeClassBits = std::bit_width(capacity) - 1;
+		if (sizeClassBits < MinSizeClassBits || sizeClassBits > MaxSizeClassBits)
+		{
+			m_stats.discardedBuffers++;
+			return;
+		}
+
+		std::vector<ByteArray>& freeBuffers = m_freeBuffers[sizeClassBits - MinSizeClassBits];
+		if (freeBuffers.size() >= MaxPooledBuffersPerClass)
+		{
+			m_stats.discardedBuffers++;
+			return;
+		}
+
+		if (freeBuffers.capacity() == 0)
+			freeBuffers.reserve(MaxPooledBuffersPerClass);
+
+		buffer.Clear(true);
+		freeBuffers.push_back(std::move(buffer));
+
+		m_stats.pooledBuffers++;
+		m_stats.pooledMemory += capacity;
+	}
+}
@@ -1235,11 +1235,8 @@ namespace Nz
 		if (m_totalWaitingData >= m_host->m_maximumWaitingData)
 			return nullptr;
 
-		ENetPacketRef packet = m_host->AllocatePacket(ENetPacketFlags(flags));
-		if (data)
-			packet->data = ByteArray(data, dataLength);
-		else
-			packet->data = ByteArray(dataLength);
+		// Fragments are reassembled directly into this buffer, which comes from the host packet pool
+		ENetPacketRef packet = (data) ? m_host->AllocatePacket(ENetPacketFlags(flags), data, dataLength) : m_host->AllocatePacket(ENetPacketFlags(flags), dataLength);
 
 		IncomingCommmand incomingCommand;
 		incomingCommand.reliableSequenceNumber = command.header.reliableSequenceNumber;
@@ -0,0 +1,366 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		constexpr UInt32 ProbabilityOne = 1u << ENetRangeCoderCompressor::ProbabilityBits;
+		constexpr UInt32 TopValue = 1u << 24;
+		constexpr unsigned int AdaptationShift = 4; //< fast adaptation, datagrams are too small for slow learning
+
+		// Binary adaptive range coder with carry propagation (same scheme as LZMA)
+		class RangeEncoder
+		{
+			public:
+				RangeEncoder(UInt8* output, const UInt8* outputEnd) :
+				m_low(0),
+				m_cacheSize(1),
+				m_range(0xFFFFFFFF),
+				m_output(output),
+				m_outputEnd(outputEnd),
+				m_cache(0),
+				m_isFirstByte(true),
+				m_hasOverflowed(false)
+				{
+				}
+
+				void EncodeBit(UInt16& probability, unsigned int bit)
+				{
+					UInt32 bound = (m_range >> ENetRangeCoderCompressor::ProbabilityBits) * probability;
+					if (bit == 0)
+					{
+						m_range = bound;
+						probability += (ProbabilityOne - probability) >> AdaptationShift;
+					}
+					else
+					{
+						m_low += bound;
+						m_range -= bound;
+						probability -= probability >> AdaptationShift;
+					}
+
+					while (m_range < TopValue)
+					{
+						m_range <<= 8;
+						ShiftLow();
+					}
+				}
+
+				UInt8* Flush()
+				{
+					for (unsigned int i = 0; i < 5; ++i)
+						ShiftLow();
+
+					return m_output;
+				}
+
+				bool HasOverflowed() const
+				{
+					return m_hasOverflowed;
+				}
+
+			private:
+				void PutByte(UInt8 byte)
+				{
+					// The first byte is always zero, the decoder doesn't need it
+					if (m_isFirstByte)
+					{
+						m_isFirstByte = false;
+						return;
+					}
+
+					if (m_output == m_outputEnd)
+					{
+						m_hasOverflowed = true;
+						return;
+					}
+
+					*m_output++ = byte;
+				}
+
+				void ShiftLow()
+				{
+					if (static_cast<UInt32>(m_low) < 0xFF000000u || (m_low >> 32) != 0)
+					{
+						UInt8 carry = static_cast<UInt8>(m_low >> 32);
+						UInt8 byte = m_cache;
+						do
+						{
+							PutByte(static_cast<UInt8>(byte + carry));
+							byte = 0xFF;
+						}
+						while (--m_cacheSize != 0);
+
+						m_cache = static_cast<UInt8>(m_low >> 24);
+					}
+
+					m_cacheSize++;
+					m_low = (m_low & 0x00FFFFFF) << 8;
+				}
+
+				UInt64 m_low;
+				UInt64 m_cacheSize;
+				UInt32 m_range;
+				UInt8* m_output;
+				const UInt8* m_outputEnd;
+				UInt8 m_cache;
+				bool m_isFirstByte;
+				bool m_hasOverflowed;
+		};
+
+		class RangeDecoder
+		{
+			public:
+				RangeDecoder(const UInt8* input, const UInt8* inputEnd) :
+				m_input(input),
+				m_inputEnd(inputEnd),
+				m_code(0),
+				m_range(0xFFFFFFFF)
+				{
+					for (unsigned int i = 0; i < 4; ++i)
+						m_code = (m_code << 8) | NextByte();
+				}
+
+				unsigned int DecodeBit(UInt16& probability)
+				{
+					unsigned int bit;
+
+					UInt32 bound = (m_range >> ENetRangeCoderCompressor::ProbabilityBits) * probability;
+					if (m_code < bound)
+					{
+						m_range = bound;
+						probability += (ProbabilityOne - probability) >> AdaptationShift;
+						bit = 0;
+					}
+					else
+					{
+						m_code -= bound;
+						m_range -= bound;
+						probability -= probability >> AdaptationShift;
+						bit = 1;
+					}
+
+					while (m_range < TopValue)
+					{
+						m_range <<= 8;
+						m_code = (m_code << 8) | NextByte();
+					}
+
+					return bit;
+				}
+
+			private:
+				// Trailing zero bytes are stripped by the compressor
+				UInt8 NextByte()
+				{
+					return (m_input < m_inputEnd) ? *m_input++ : 0;
+				}
+
+				const UInt8* m_input;
+				const UInt8* m_inputEnd;
+				UInt32 m_code;
+				UInt32 m_range;
+		};
+	}
+
+	/*!
+	* \brief Compresses a datagram using an adaptive binary range coder
+	* \return Compressed size, or zero if the datagram couldn't be made smaller
+	*/
+	std::size_t ENetRangeCoderCompressor::Compress(const ENetPeer* /*peer*/, const NetBuffer* buffers, std::size_t bufferCount, std::size_t totalInputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		if (totalInputSize == 0)
+			return 0;
+
+		const UInt8* input = GatherInput(buffers, bufferCount, totalInputSize, m_inputBuffer);
+
+		// Compressing is pointless if it doesn't save at least one byte
+		UInt8* outputPtr = output;
+		const UInt8* outputEnd = output + std::min(maxOutputSize, totalInputSize - 1);
+
+		// Decompressed size, as a variable-length integer
+		std::size_t size = totalInputSize;
+		do
+		{
+			if (outputPtr == outputEnd)
+				return 0;
+
+			UInt8 byte = static_cast<UInt8>(size & 0x7F);
+			size >>= 7;
+			if (size != 0)
+				byte |= 0x80;
+
+			*outputPtr++ = byte;
+		}
+		while (size != 0);
+
+		ResetModel();
+
+		RangeEncoder encoder(outputPtr, outputEnd);
+
+		UInt8 previousByte = 0;
+		for (std::size_t i = 0; i < totalInputSize; ++i)
+		{
+			UInt16* probabilities = GetContext(previousByte);
+
+			UInt8 byte = input[i];
+			unsigned int node = 1;
+			for (int bitIndex = 7; bitIndex >= 0; --bitIndex)
+			{
+				unsigned int bit = (byte >> bitIndex) & 1;
+				encoder.EncodeBit(probabilities[node], bit);
+				node = (node << 1) | bit;
+			}
+
+			if (encoder.HasOverflowed())
+				return 0;
+
+			previousByte = byte;
+		}
+
+		outputPtr = encoder.Flush();
+		if (encoder.HasOverflowed())
+			return 0;
+
+		while (outputPtr > output && outputPtr[-1] == 0)
+			--outputPtr;
+
+		return std::size_t(outputPtr - output);
+	}
+
+	std::size_t ENetRangeCoderCompressor::Decompress(const ENetPeer* /*peer*/, const UInt8* input, std::size_t inputSize, UInt8* output, std::size_t maxOutputSize)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		const UInt8* inputEnd = input + inputSize;
+
+		std::size_t size = 0;
+		unsigned int shift = 0;
+		for (;;)
+		{
+			if (input == inputEnd || shift >= 28)
+				return 0;
+
+			UInt8 byte = *input++;
+			size |= std::size_t(byte & 0x7F) << shift;
+			shift += 7;
+
+			if ((byte & 0x80) == 0)
+				break;
+		}
+
+		if (size > maxOutputSize)
+			return 0;
+
+		ResetModel();
+
+		RangeDecoder decoder(input, inputEnd);
+
+		UInt8 previousByte = 0;
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			UInt16* probabilities = GetContext(previousByte);
+
+			unsigned int node = 1;
+			for (unsigned int bitIndex = 0; bitIndex < 8; ++bitIndex)
+				node = (node << 1) | decoder.DecodeBit(probabilities[node]);
+
+			output[i] = static_cast<UInt8>(node);
+			previousByte = output[i];
+		}
+
+		return size;
+	}
+
+	/*!
+	* \brief Builds a dictionary from sample traffic
+	*
+	* The dictionary holds the bit probabilities of an order-1 model (one context per preceding byte) measured on the samples, which compressors then use as a starting point for every datagram.
+	*
+	* \param samples Datagrams representative of the traffic to compress
+	*/
+	std::shared_ptr<ENetRangeCoderCompressor::Dictionary> ENetRangeCoderCompressor::TrainDictionary(std::span<const ByteArray> samples)
+	{
+		std::vector<UInt32> zeroCounts(ContextCount * 256, 0);
+		std::vector<UInt32> oneCounts(ContextCount * 256, 0);
+
+		for (const ByteArray& sample : samples)
+		{
+			UInt8 previousByte = 0;
+			for (UInt8 byte : sample)
+			{
+				std::size_t contextOffset = std::size_t(previousByte) * 256;
+
+				unsigned int node = 1;
+				for (int bitIndex = 7; bitIndex >= 0; --bitIndex)
+				{
+					unsigned int bit = (byte >> bitIndex) & 1;
+					if (bit == 0)
+						zeroCounts[contextOffset + node]++;
+					else
+						oneCounts[contextOffset + node]++;
+
+					node = (node << 1) | bit;
+				}
+
+				previousByte = byte;
+			}
+		}
+
+		// Probabilities are those of a zero bit, kept away from the bounds so the model can still adapt
+		constexpr UInt32 MinProbability = 31;
+		constexpr UInt32 MaxProbability = ProbabilityOne - MinProbability;
+
+		std::shared_ptr<Dictionary> dictionary = std::make_shared<Dictionary>();
+		for (std::size_t i = 0; i < dictionary->probabilities.size(); ++i)
+		{
+			UInt64 zeroCount = zeroCounts[i];
+			UInt64 total = zeroCount + oneCounts[i];
+
+			UInt32 probability = static_cast<UInt32>(((zeroCount + 1) * ProbabilityOne) / (total + 2));
+			dictionary->probabilities[i] = static_cast<UInt16>(std::clamp(probability, MinProbability, MaxProbability));
+		}
+
+		return dictionary;
+	}
+
+	UInt16* ENetRangeCoderCompressor::GetContext(UInt8 previousByte)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		// Order-1 contexts are only worth it with trained probabilities, an empty model learns faster with a single context
+		std::size_t contextIndex = (m_dictionary) ? previousByte : 0;
+
+		UInt16* probabilities = &m_probabilities[contextIndex * 256];
+
+		// Contexts are lazily reset when first used by a datagram
+		if (m_contextGenerations[contextIndex] != m_generation)
+		{
+			if (m_dictionary)
+				std::memcpy(probabilities, &m_dictionary->probabilities[contextIndex * 256], 256 * sizeof(UInt16));
+			else
+				std::fill_n(probabilities, 256, static_cast<UInt16>(ProbabilityOne / 2));
+
+			m_contextGenerations[contextIndex] = m_generation;
+		}
+
+		return probabilities;
+	}
+
+	void ENetRangeCoderCompressor::ResetModel()
+	{
+		if (++m_generation == 0)
+		{
+			m_contextGenerations.fill(0);
+			m_generation = 1;
+		}
+	}
+}
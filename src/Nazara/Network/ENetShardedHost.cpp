@@ -0,0 +1,421 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Network module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <Nazara/Core/Format.hpp>
+#include <Nazara/Core/ThreadExt.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <concurrentqueue.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Nz
+{
+	namespace NAZARA_ANONYMOUS_NAMESPACE
+	{
+		// Maximum time a shard waits for datagrams, as ENet timers (resends, pings and timeouts) are only checked by Service
+		// Commands queued by the application wake the shard up through its wakeup socket
+		constexpr UInt32 ShardServiceTimeout = 10;
+	}
+
+	struct ENetShardedHost::Command
+	{
+		enum class Type
+		{
+			Broadcast,
+			Disconnect,
+			Send
+		};
+
+		ByteArray packet;
+		ENetPeer* peer;
+		ENetPacketFlags flags;
+		Type type;
+		UInt32 data;
+		UInt8 channelId;
+	};
+
+	struct ENetShardedHost::Data
+	{
+		moodycamel::ConcurrentQueue<ENetShardedEvent> events;
+		std::vector<std::unique_ptr<Shard>> shards;
+	};
+
+	class ENetShardedHost::Shard
+	{
+		public:
+			Shard(Data& data, unsigned int shardIndex) :
+			m_isWaiting(false),
+			m_running(false),
+			m_data(data),
+			m_shardIndex(shardIndex)
+			{
+			}
+
+			Shard(const Shard&) = delete;
+			Shard(Shard&&) = delete;
+
+			~Shard()
+			{
+				RequestStop();
+				WaitForStop();
+			}
+
+			void AddCommand(Command&& command)
+			{
+				m_commands.enqueue(std::move(command));
+				WakeUp();
+			}
+
+			bool CreateWakeupSocket()
+			{
+				if (!m_wakeupSocket.Create(NetProtocol::IPv4) || !m_wakeupSender.Create(NetProtocol::IPv4))
+					return false;
+
+				m_wakeupSocket.EnableBlocking(false);
+				if (m_wakeupSocket.Bind(IpAddress::LoopbackIpV4) != SocketState::Bound)
+					return false;
+
+				return m_host.RegisterWakeupSocket(m_wakeupSocket);
+			}
+
+			ENetHost& GetHost()
+			{
+				return m_host;
+			}
+
+			const ENetHost& GetHost() const
+			{
+				return m_host;
+			}
+
+			void RequestStop()
+			{
+				m_running.store(false, std::memory_order_relaxed);
+				WakeUp();
+			}
+
+			void Start()
+			{
+				m_running = true;
+				m_thread = std::thread([this]
+				{
+					SetCurrentThreadName(Format("NzENetShard #{0}", m_shardIndex).c_str());
+					Run();
+				});
+			}
+
+			void WaitForStop()
+			{
+				if (m_thread.joinable())
+					m_thread.join();
+			}
+
+			Shard& operator=(const Shard&) = delete;
+			Shard& operator=(Shard&&) = delete;
+
+		private:
+			void HandleCommand(Command& command)
+			{
+				switch (command.type)
+				{
+					case Command::Type::Broadcast:
+						m_host.Broadcast(command.channelId, command.flags, std::move(command.packet));
+						break;
+
+					case Command::Type::Disconnect:
+						command.peer->Disconnect(command.data);
+						break;
+
+					case Command::Type::Send:
+						command.peer->Send(command.channelId, command.flags, std::move(command.packet));
+						break;
+				}
+			}
+
+			void PushEvent(ENetEvent& event)
+			{
+				ENetShardedEvent shardedEvent;
+				shardedEvent.type = event.type;
+				shardedEvent.peer = event.peer;
+				shardedEvent.address = event.peer->GetAddress();
+				shardedEvent.channelId = event.channelId;
+				shardedEvent.data = event.data;
+
+				// Packets belong to the shard packet pool, only their data can leave the shard thread
+				if (event.packet)
+				{
+					shardedEvent.packet = std::move(event.packet->data);
+					event.packet.Reset();
+				}
+
+				m_data.events.enqueue(std::move(shardedEvent));
+			}
+
+			void Run()
+			{
+				NAZARA_USE_ANONYMOUS_NAMESPACE
+
+				Command command;
+				ENetEvent event;
+				while (m_running.load(std::memory_order_relaxed))
+				{
+					while (m_commands.try_dequeue(command))
+						HandleCommand(command);
+
+					// Commands queued from now on wake the shard up, check for those which were queued just before
+					m_isWaiting.store(true);
+					if (m_commands.size_approx() > 0 || !m_running.load(std::memory_order_relaxed))
+					{
+						m_isWaiting.store(false);
+						continue;
+					}
+
+					int serviceResult = m_host.Service(&event, ShardServiceTimeout);
+					m_isWaiting.store(false);
+
+					// Discard wakeup datagrams, all they carry is that there's something to do
+					UInt8 wakeupData;
+					while (m_wakeupSocket.Receive(&wakeupData, sizeof(wakeupData), nullptr, nullptr))
+						;
+
+					if (serviceResult > 0)
+					{
+						do
+						{
+							PushEvent(event);
+						}
+						while (m_host.CheckEvents(&event));
+					}
+				}
+			}
+
+			void WakeUp()
+			{
+				// Only send one datagram per wait
+				if (!m_isWaiting.exchange(false))
+					return;
+
+				std::lock_guard lock(m_wakeupMutex);
+
+				UInt8 wakeupData = 0;
+				m_wakeupSender.Send(m_wakeupSocket.GetBoundAddress(), &wakeupData, sizeof(wakeupData), nullptr);
+			}
+
+			std::atomic_bool m_isWaiting;
+			std::atomic_bool m_running;
+			std::mutex m_wakeupMutex;
+			std::thread m_thread;
+			moodycamel::ConcurrentQueue<Command> m_commands;
+			Data& m_data;
+			UdpSocket m_wakeupSender;
+			UdpSocket m_wakeupSocket; //< declared before the host which polls it
+			ENetHost m_host;
+			unsigned int m_shardIndex;
+	};
+
+	ENetShardedHost::ENetShardedHost(ENetShardedHost&&) noexcept = default;
+
+	ENetShardedHost::~ENetShardedHost()
+	{
+		Destroy();
+	}
+
+	/*!
+	* \brief Queues a packet for every connected peer of every shard
+	*/
+	void ENetShardedHost::Broadcast(UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet)
+	{
+		NazaraAssertMsg(m_data, "host has not been created");
+
+		for (std::size_t i = 0; i < m_data->shards.size(); ++i)
+		{
+			Command command;
+			command.type = Command::Type::Broadcast;
+			command.channelId = channelId;
+			command.flags = flags;
+			command.packet = (i + 1 < m_data->shards.size()) ? packet : std::move(packet);
+
+			m_data->shards[i]->AddCommand(std::move(command));
+		}
+	}
+
+	/*!
+	* \brief Creates shards listening on the same address, each one servicing its peers on its own thread
+	* \return true if the shards were created
+	*
+	* Every shard is an ENetHost owning a socket bound to the same port. The system balances incoming datagrams between those sockets
+	* based on the sender address, so a peer is always handled by the same shard which owns its queues and timeouts.
+	*
+	* \param listenAddress Address to listen on, its port is picked by the system if zero
+	* \param peerCount Maximum number of peers per shard, as peers aren't guaranteed to be evenly distributed
+	* \param channelCount Number of channels per peer
+	* \param shardCount Number of shards, zero to use one per hardware thread
+	*
+	* \remark Port sharing is only supported on Linux, other platforms fall back to a single shard (which still services peers on its own thread)
+	*/
+	bool ENetShardedHost::Create(const IpAddress& listenAddress, std::size_t peerCount, std::size_t channelCount, unsigned int shardCount)
+	{
+		NazaraAssertMsg(listenAddress.IsValid() && !listenAddress.IsLoopback(), "Invalid listening address");
+
+		Destroy();
+
+		if (shardCount == 0)
+			shardCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+		m_data = std::make_unique<Data>();
+
+		IpAddress shardAddress = listenAddress;
+		for (unsigned int shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+		{
+			auto& shard = m_data->shards.emplace_back(std::make_unique<Shard>(*m_data, shardIndex));
+
+			ENetHost& host = shard->GetHost();
+			host.EnablePortReuse(shardCount > 1);
+			if (!host.Create(shardAddress, peerCount, channelCount))
+			{
+				NazaraError("failed to create shard #{0}", shardIndex);
+				Destroy();
+				return false;
+			}
+
+			if (!shard->CreateWakeupSocket())
+			{
+				NazaraError("failed to create wakeup socket of shard #{0}", shardIndex);
+				Destroy();
+				return false;
+			}
+
+			if (shardIndex == 0)
+			{
+				// Other shards share the port of the first one, which may have been picked by the system
+				shardAddress = host.GetBoundAddress();
+
+				if (shardCount > 1 && !host.IsReusingPort())
+				{
+					NazaraWarning("port sharing is not supported on this platform, falling back to a single shard");
+					shardCount = 1;
+				}
+			}
+		}
+
+		m_boundAddress = shardAddress;
+		m_shardCount = shardCount;
+
+		for (auto& shard : m_data->shards)
+			shard->Start();
+
+		return true;
+	}
+
+	void ENetShardedHost::Destroy()
+	{
+		if (!m_data)
+			return;
+
+		// Stop every shard before waiting for them
+		for (auto& shard : m_data->shards)
+			shard->RequestStop();
+
+		for (auto& shard : m_data->shards)
+			shard->WaitForStop();
+
+		m_data.reset();
+		m_boundAddress = IpAddress::Invalid;
+		m_shardCount = 0;
+	}
+
+	/*!
+	* \brief Queues a disconnection request for a peer
+	*
+	* \param peer Peer to disconnect, as reported by an event
+	* \param data Data sent to the peer with the disconnection
+	*/
+	void ENetShardedHost::Disconnect(ENetPeer* peer, UInt32 data)
+	{
+		NazaraAssertMsg(m_data, "host has not been created");
+
+		Shard* shard = FindPeerShard(peer);
+		NazaraAssertMsg(shard, "peer doesn't belong to this host");
+
+		Command command;
+		command.type = Command::Type::Disconnect;
+		command.peer = peer;
+		command.data = data;
+
+		shard->AddCommand(std::move(command));
+	}
+
+	/*!
+	* \brief Retrieves an event reported by a shard, without blocking
+	* \return true if an event was retrieved
+	*
+	* Events of a peer are retrieved in the order they happened, there's no ordering between peers of different shards.
+	*
+	* \param event Event to fill
+	*/
+	bool ENetShardedHost::PollEvent(ENetShardedEvent* event)
+	{
+		NazaraAssertMsg(m_data, "host has not been created");
+		NazaraAssertMsg(event, "invalid event");
+
+		return m_data->events.try_dequeue(*event);
+	}
+
+	/*!
+	* \brief Queues a packet for a peer, it will be sent by the shard owning the peer
+	*
+	* \param peer Peer to send the packet to, as reported by an event
+	* \param channelId Channel to send the packet on
+	* \param flags Packet flags
+	* \param packet Packet data
+	*
+	* \remark Packets are silently dropped if the peer is not connected when the shard handles them.
+	* A peer slot can be reused by a new connection, stop sending to a peer once its disconnection event has been retrieved.
+	*/
+	void ENetShardedHost::Send(ENetPeer* peer, UInt8 channelId, ENetPacketFlags flags, ByteArray&& packet)
+	{
+		NazaraAssertMsg(m_data, "host has not been created");
+
+		Shard* shard = FindPeerShard(peer);
+		NazaraAssertMsg(shard, "peer doesn't belong to this host");
+
+		Command command;
+		command.type = Command::Type::Send;
+		command.peer = peer;
+		command.channelId = channelId;
+		command.flags = flags;
+		command.packet = std::move(packet);
+
+		shard->AddCommand(std::move(command));
+	}
+
+	ENetShardedHost& ENetShardedHost::operator=(ENetShardedHost&& host) noexcept
+	{
+		Destroy();
+
+		m_data = std::move(host.m_data);
+		m_boundAddress = std::move(host.m_boundAddress);
+		m_shardCount = std::exchange(host.m_shardCount, 0);
+
+		return *this;
+	}
+
+	auto ENetShardedHost::FindPeerShard(const ENetPeer* peer) const -> Shard*
+	{
+		for (auto& shard : m_data->shards)
+		{
+			if (shard->GetHost().OwnsPeer(peer))
+				return shard.get();
+		}
+
+		return nullptr;
+	}
+}
@@ -7,6 +7,7 @@
 #include <Nazara/Core/StringExt.hpp>
 #include <Nazara/Network/Algorithm.hpp>
 #include <Nazara/Network/NetBuffer.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/Posix/IpAddressImpl.hpp>
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/EnumArray.hpp>
@@ -497,6 +498,122 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		std::size_t bufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			bufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackArray(iovec, bufferCount);
+		StackArray<mmsghdr> msgHdrs = NazaraStackArray(mmsghdr, datagramCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackArray(IpAddressImpl::SockAddrBuffer, datagramCount);
+
+		iovec* sysBuffer = sysBuffers.data();
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const NetDatagram& datagram = datagrams[i];
+
+			mmsghdr& msgHdr = msgHdrs[i];
+			std::memset(&msgHdr, 0, sizeof(msgHdr));
+
+			msgHdr.msg_hdr.msg_iov = sysBuffer;
+			msgHdr.msg_hdr.msg_iovlen = datagram.bufferCount;
+			msgHdr.msg_hdr.msg_name = nameBuffers[i].data();
+			msgHdr.msg_hdr.msg_namelen = static_cast<socklen_t>(nameBuffers[i].size());
+
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffer->iov_base = datagram.buffers[j].data;
+				sysBuffer->iov_len = datagram.buffers[j].dataLength;
+				sysBuffer++;
+			}
+		}
+
+		// MSG_WAITFORONE only blocks (on blocking sockets) until the first datagram is received
+		int datagramRead = recvmmsg(handle, msgHdrs.data(), SafeCast<unsigned int>(datagramCount), MSG_WAITFORONE, nullptr);
+		if (datagramRead == -1)
+		{
+			int errorCode = errno;
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			switch (errorCode)
+			{
+				case EWOULDBLOCK:
+				{
+					// If we have no data and are not blocking, return true with 0 datagram read
+					datagramRead = 0;
+					break;
+				}
+
+				default:
+				{
+					if (error)
+						*error = TranslateErrorToSocketError(errorCode);
+
+					return false; //< Error
+				}
+			}
+		}
+
+		for (int i = 0; i < datagramRead; ++i)
+		{
+			datagrams[i].address = IpAddressImpl::FromSockAddr(reinterpret_cast<const sockaddr*>(nameBuffers[i].data()));
+			datagrams[i].dataLength = msgHdrs[i].msg_len;
+		}
+
+		if (received)
+			*received = SafeCast<std::size_t>(datagramRead);
+#else
+		// No batching syscall available, receive datagrams one by one until there's no more data available
+		std::size_t datagramRead = 0;
+		for (; datagramRead < datagramCount; ++datagramRead)
+		{
+			// Don't block waiting for more than one datagram
+			if (datagramRead > 0 && QueryAvailableBytes(handle) == 0)
+				break;
+
+			NetDatagram& datagram = datagrams[datagramRead];
+
+			int byteRead;
+			SocketError receiveError;
+			if (!ReceiveMultiple(handle, datagram.buffers, datagram.bufferCount, &datagram.address, &byteRead, &receiveError))
+			{
+				if (receiveError != SocketError::ConnectionClosed)
+				{
+					// Report received datagrams first, the error will occur again on next call
+					if (datagramRead > 0)
+						break;
+
+					if (error)
+						*error = receiveError;
+
+					return false; //< Error
+				}
+
+				// Empty datagram
+				byteRead = 0;
+			}
+			else if (byteRead == 0)
+				break; //< No more data
+
+			datagram.dataLength = SafeCast<std::size_t>(byteRead);
+		}
+
+		if (received)
+			*received = datagramRead;
+#endif
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
@@ -684,6 +801,107 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+#if defined(NAZARA_PLATFORM_LINUX)
+		std::size_t bufferCount = 0;
+		for (std::size_t i = 0; i < datagramCount; ++i)
+			bufferCount += datagrams[i].bufferCount;
+
+		StackArray<iovec> sysBuffers = NazaraStackArray(iovec, bufferCount);
+		StackArray<mmsghdr> msgHdrs = NazaraStackArray(mmsghdr, datagramCount);
+		StackArray<IpAddressImpl::SockAddrBuffer> nameBuffers = NazaraStackArray(IpAddressImpl::SockAddrBuffer, datagramCount);
+
+		iovec* sysBuffer = sysBuffers.data();
+		for (std::size_t i = 0; i < datagramCount; ++i)
+		{
+			const NetDatagram& datagram = datagrams[i];
+
+			mmsghdr& msgHdr = msgHdrs[i];
+			std::memset(&msgHdr, 0, sizeof(msgHdr));
+
+			msgHdr.msg_hdr.msg_iov = sysBuffer;
+			msgHdr.msg_hdr.msg_iovlen = datagram.bufferCount;
+			msgHdr.msg_hdr.msg_namelen = IpAddressImpl::ToSockAddr(datagram.address, nameBuffers[i].data());
+			msgHdr.msg_hdr.msg_name = nameBuffers[i].data();
+
+			for (std::size_t j = 0; j < datagram.bufferCount; ++j)
+			{
+				sysBuffer->iov_base = datagram.buffers[j].data;
+				sysBuffer->iov_len = datagram.buffers[j].dataLength;
+				sysBuffer++;
+			}
+		}
+
+		// sendmmsg stops at the first failing datagram and reports the error only if none were sent
+		int datagramSent = sendmmsg(handle, msgHdrs.data(), SafeCast<unsigned int>(datagramCount), MSG_NOSIGNAL);
+		if (datagramSent == -1)
+		{
+			int errorCode = errno;
+			if (errorCode == EAGAIN)
+				errorCode = EWOULDBLOCK;
+
+			switch (errorCode)
+			{
+				case EWOULDBLOCK:
+					datagramSent = 0;
+					break;
+
+				default:
+				{
+					if (error)
+						*error = TranslateErrorToSocketError(errorCode);
+
+					return false; //< Error
+				}
+			}
+		}
+
+		for (int i = 0; i < datagramSent; ++i)
+			datagrams[i].dataLength = msgHdrs[i].msg_len;
+
+		if (sent)
+			*sent = SafeCast<std::size_t>(datagramSent);
+#else
+		// No batching syscall available, send datagrams one by one
+		std::size_t datagramSent = 0;
+		for (; datagramSent < datagramCount; ++datagramSent)
+		{
+			NetDatagram& datagram = datagrams[datagramSent];
+
+			int byteSent;
+			SocketError sendError;
+			if (!SendMultiple(handle, datagram.buffers, datagram.bufferCount, datagram.address, &byteSent, &sendError))
+			{
+				// Report sent datagrams first, the error will occur again on next call
+				if (datagramSent > 0)
+					break;
+
+				if (error)
+					*error = sendError;
+
+				return false; //< Error
+			}
+
+			if (byteSent == 0)
+				break; //< Would block
+
+			datagram.dataLength = SafeCast<std::size_t>(byteSent);
+		}
+
+		if (sent)
+			*sent = datagramSent;
+#endif
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
@@ -927,6 +1145,35 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool reusePort, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+
+		// Only Linux balances incoming datagrams between sockets sharing a port, other systems deliver them to a single socket
+#if defined(NAZARA_PLATFORM_LINUX) && defined(SO_REUSEPORT)
+		int option = reusePort;
+		if (setsockopt(handle, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<const char*>(&option), sizeof(option)) == -1)
+		{
+			if (error)
+				*error = TranslateErrorToSocketError(errno);
+
+			return false; //< Error
+		}
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+#else
+		NazaraUnused(reusePort);
+
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return false;
+#endif
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
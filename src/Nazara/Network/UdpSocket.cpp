@@ -5,6 +5,7 @@
 #include <Nazara/Network/UdpSocket.hpp>
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 
 #if defined(NAZARA_PLATFORM_WINDOWS)
 #include <Nazara/Network/Win32/SocketImpl.hpp>
@@ -65,6 +66,26 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Allows other sockets to bind the same port, incoming datagrams being balanced between them
+	*
+	* \param reusePort Should the port be shared
+	*
+	* \remark Must be called before binding the socket
+	* \remark Only supported on Linux, check IsReusePortEnabled to know if it succeeded
+	* \remark Produces a NazaraAssert if socket is invalid
+	*/
+	void UdpSocket::EnableReusePort(bool reusePort)
+	{
+		NazaraAssertMsg(m_handle != SocketImpl::InvalidHandle, "Invalid handle");
+
+		if (m_isReusePortEnabled != reusePort)
+		{
+			if (SocketImpl::SetReusePort(m_handle, reusePort, &m_lastError))
+				m_isReusePortEnabled = reusePort;
+		}
+	}
+
 	/*!
 	* \brief Gets the maximum datagram size allowed
 	* \return Number of bytes
@@ -118,6 +139,32 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Receives up to datagramCount datagrams in a single call when supported by the platform
+	* \return true If no error occurred (receiving no datagram on a non-blocking socket isn't an error)
+	*
+	* \param datagrams Datagrams to fill, their buffers receive the data while their address and dataLength are set by this function
+	* \param datagramCount Number of datagrams available
+	* \param received Optional argument to get the number of datagrams received
+	*
+	* \remark On blocking sockets, this only blocks until the first datagram is received
+	* \remark Uses recvmmsg on Linux and falls back to one receive per datagram on other platforms
+	*/
+	bool UdpSocket::ReceiveDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received)
+	{
+		NazaraAssertMsg(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t datagramRead;
+		if (!SocketImpl::ReceiveDatagrams(m_handle, datagrams, datagramCount, &datagramRead, &m_lastError))
+			return false;
+
+		if (received)
+			*received = datagramRead;
+
+		return true;
+	}
+
 	/*!
 	* \brief Receive multiple datagram from one peer
 	* \return true If data were sent
@@ -184,6 +231,32 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Sends up to datagramCount datagrams in a single call when supported by the platform
+	* \return true If no error occurred
+	*
+	* \param datagrams Datagrams to send to their address, dataLength of sent datagrams is set by this function
+	* \param datagramCount Number of datagrams to send
+	* \param sent Optional argument to get the number of datagrams sent, which may be less than datagramCount if the socket would block
+	*
+	* \remark If an error occurs after some datagrams were sent, this function succeeds and the error is reported on the next call
+	* \remark Uses sendmmsg on Linux and falls back to one send per datagram on other platforms
+	*/
+	bool UdpSocket::SendDatagrams(NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent)
+	{
+		NazaraAssertMsg(m_handle != SocketImpl::InvalidHandle, "Socket hasn't been created");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		std::size_t datagramSent;
+		if (!SocketImpl::SendDatagrams(m_handle, datagrams, datagramCount, &datagramSent, &m_lastError))
+			return false;
+
+		if (sent)
+			*sent = datagramSent;
+
+		return true;
+	}
+
 	/*!
 	* \brief Sends multiple buffers as one datagram
 	* \return true If data were sent
@@ -230,5 +303,6 @@ namespace Nz
 
 		m_boundAddress = IpAddress::Invalid;
 		m_isBroadCastingEnabled = false;
+		m_isReusePortEnabled = false;
 	}
 }
@@ -6,6 +6,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Core/StringExt.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/Win32/IpAddressImpl.hpp>
 #include <NazaraUtils/Algorithm.hpp>
 #include <NazaraUtils/EnumArray.hpp>
@@ -571,6 +572,55 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::ReceiveDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* received, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// No batching syscall available, receive datagrams one by one until there's no more data available
+		std::size_t datagramRead = 0;
+		for (; datagramRead < datagramCount; ++datagramRead)
+		{
+			// Don't block waiting for more than one datagram
+			if (datagramRead > 0 && QueryAvailableBytes(handle) == 0)
+				break;
+
+			NetDatagram& datagram = datagrams[datagramRead];
+
+			int byteRead;
+			SocketError receiveError;
+			if (!ReceiveMultiple(handle, datagram.buffers, datagram.bufferCount, &datagram.address, &byteRead, &receiveError))
+			{
+				if (receiveError != SocketError::ConnectionClosed)
+				{
+					// Report received datagrams first, the error will occur again on next call
+					if (datagramRead > 0)
+						break;
+
+					if (error)
+						*error = receiveError;
+
+					return false; //< Error
+				}
+
+				// Empty datagram
+				byteRead = 0;
+			}
+			else if (byteRead == 0)
+				break; //< No more data
+
+			datagram.dataLength = SafeCast<std::size_t>(byteRead);
+		}
+
+		if (received)
+			*received = datagramRead;
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::ReceiveFrom(SocketHandle handle, void* buffer, int length, IpAddress* from, int* read, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
@@ -731,6 +781,46 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SendDatagrams(SocketHandle handle, NetDatagram* datagrams, std::size_t datagramCount, std::size_t* sent, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+		NazaraAssertMsg(datagrams && datagramCount > 0, "Invalid datagrams");
+
+		// No batching syscall available, send datagrams one by one
+		std::size_t datagramSent = 0;
+		for (; datagramSent < datagramCount; ++datagramSent)
+		{
+			NetDatagram& datagram = datagrams[datagramSent];
+
+			int byteSent;
+			SocketError sendError;
+			if (!SendMultiple(handle, datagram.buffers, datagram.bufferCount, datagram.address, &byteSent, &sendError))
+			{
+				// Report sent datagrams first, the error will occur again on next call
+				if (datagramSent > 0)
+					break;
+
+				if (error)
+					*error = sendError;
+
+				return false; //< Error
+			}
+
+			if (byteSent == 0)
+				break; //< Would block
+
+			datagram.dataLength = SafeCast<std::size_t>(byteSent);
+		}
+
+		if (sent)
+			*sent = datagramSent;
+
+		if (error)
+			*error = SocketError::NoError;
+
+		return true;
+	}
+
 	bool SocketImpl::SendMultiple(SocketHandle handle, const NetBuffer* buffers, std::size_t bufferCount, const IpAddress& to, int* sent, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
@@ -942,6 +1032,17 @@ namespace Nz
 		return true;
 	}
 
+	bool SocketImpl::SetReusePort(SocketHandle handle, bool /*reusePort*/, SocketError* error)
+	{
+		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
+
+		// SO_REUSEADDR doesn't balance incoming datagrams between sockets on Windows
+		if (error)
+			*error = SocketError::NotSupported;
+
+		return false;
+	}
+
 	bool SocketImpl::SetSendBufferSize(SocketHandle handle, std::size_t size, SocketError* error)
 	{
 		NazaraAssertMsg(handle != InvalidHandle, "Invalid handle");
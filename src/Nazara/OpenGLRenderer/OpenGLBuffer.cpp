@@ -18,6 +18,7 @@ namespace Nz
 		switch (type)
 		{
 			case BufferType::Index: target = GL::BufferTarget::ElementArray; break;
+			case BufferType::Indirect: target = GL::BufferTarget::DrawIndirect; break;
 			case BufferType::Storage: target = GL::BufferTarget::Storage; break;
 			case BufferType::Uniform: target = GL::BufferTarget::Uniform; break;
 			case BufferType::Vertex: target = GL::BufferTarget::Array; break;
@@ -13,6 +13,7 @@
 #include <Nazara/OpenGLRenderer/Wrapper/VertexArray.hpp>
 #include <NazaraUtils/StackArray.hpp>
 #include <NazaraUtils/StackVector.hpp>
+#include <cstring>
 
 namespace Nz
 {
@@ -76,18 +77,30 @@ namespace Nz
 	{
 		const GL::Context* context = GL::Context::GetCurrentContext();
 
-		for (const auto& commandVariant : m_commands)
+		// Tracks states set by previous commands, which are only recorded when they change
+		ReplayStates replayStates;
+
+		const UInt8* commandPtr = m_commandStream.data();
+		const UInt8* commandEnd = commandPtr + m_commandStream.size();
+		while (commandPtr < commandEnd)
 		{
-			switch (commandVariant.index())
+			const CommandHeader& header = *reinterpret_cast<const CommandHeader*>(commandPtr);
+			switch (header.type)
 			{
 #define NAZARA_OPENGL_COMMAND_CALLBACK(Command) \
 				case TypeListFind<CommandList, Command>: \
-					Execute(context, std::get<TypeListFind<CommandList, Command>>(commandVariant)); \
+					Execute(context, replayStates, GetCommand<Command>(header)); \
 					break;
 
 				NAZARA_OPENGL_FOREACH_COMMANDS(NAZARA_OPENGL_COMMAND_CALLBACK, NAZARA_OPENGL_COMMAND_CALLBACK)
 #undef NAZARA_OPENGL_COMMAND_CALLBACK
+
+				default:
+					NazaraInternalError("unexpected command type {0}", header.type);
+					return;
 			}
+
+			commandPtr += header.size;
 		}
 	}
 
@@ -96,30 +109,44 @@ namespace Nz
 		// No OpenGL object to name
 	}
 
-	void OpenGLCommandBuffer::ApplyBindings(const GL::Context& context, const ShaderBindings& states)
+	void OpenGLCommandBuffer::AppendDebugCommand(bool beginRegion, std::string_view text, const Color& color)
+	{
+		UInt8* textPtr;
+		if (beginRegion)
+		{
+			BeginDebugRegionCommand& command = AppendCommand<BeginDebugRegionCommand>(text.size());
+			command.color = color;
+			command.regionNameSize = SafeCast<UInt32>(text.size());
+
+			textPtr = GetTrailingData(command);
+		}
+		else
+		{
+			InsertDebugLabelCommand& command = AppendCommand<InsertDebugLabelCommand>(text.size());
+			command.color = color;
+			command.labelSize = SafeCast<UInt32>(text.size());
+
+			textPtr = GetTrailingData(command);
+		}
+
+		if (!text.empty())
+			std::memcpy(textPtr, text.data(), text.size());
+	}
+
+	void OpenGLCommandBuffer::ApplyBindings(const GL::Context& context, const ShaderBindingEntry* bindings, std::size_t bindingCount)
 	{
-		unsigned int setIndex = 0;
-		for (const auto& [pipelineLayout, shaderBinding] : states.shaderBindings)
+		for (std::size_t setIndex = 0; setIndex < bindingCount; ++setIndex)
 		{
+			const auto& [pipelineLayout, shaderBinding] = bindings[setIndex];
 			if (shaderBinding)
-				shaderBinding->Apply(*pipelineLayout, setIndex, context);
+				shaderBinding->Apply(*pipelineLayout, SafeCast<UInt32>(setIndex), context);
 			else
 				NazaraWarning("no shader binding for set #{0}", setIndex);
-
-			setIndex++;
 		}
 	}
 
-	void OpenGLCommandBuffer::ApplyStates(const GL::Context& context, const DrawStates& states)
+	void OpenGLCommandBuffer::BindVertexArray(const GL::Context& context, const DrawStates& states)
 	{
-		states.pipeline->Apply(context, states.shouldFlipY);
-
-		if (states.scissorRegion)
-			context.SetScissorBox(states.scissorRegion->x, states.scissorRegion->y, states.scissorRegion->width, states.scissorRegion->height);
-
-		if (states.viewportRegion)
-			context.SetViewport(states.viewportRegion->x, states.viewportRegion->y, states.viewportRegion->width, states.viewportRegion->height);
-
 		GL::OpenGLVaoSetup vaoSetup;
 		vaoSetup.indexBuffer = states.indexBuffer;
 
@@ -132,12 +159,14 @@ namespace Nz
 			const auto& vertexBufferInfo = states.vertexBuffers[bufferData.binding];
 
 			GLsizei stride = GLsizei(bufferData.declaration->GetStride());
+			GLuint divisor = (bufferData.declaration->GetInputRate() == VertexInputRate::Instance) ? 1 : 0;
 
 			for (const auto& componentInfo : bufferData.declaration->GetComponents())
 			{
 				auto& bufferAttribute = vaoSetup.vertexAttribs[locationIndex++].emplace();
 				BuildAttrib(bufferAttribute, componentInfo.type);
 
+				bufferAttribute.divisor = divisor;
 				bufferAttribute.pointer = originPtr + vertexBufferInfo.offset + componentInfo.offset;
 				bufferAttribute.stride = stride;
 				bufferAttribute.vertexBuffer = vertexBufferInfo.vertexBuffer;
@@ -148,110 +177,339 @@ namespace Nz
 		context.BindVertexArray(vao.GetObjectId());
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const BeginDebugRegionCommand& command)
+	void OpenGLCommandBuffer::RecordDrawStates()
+	{
+		// Only records states which changed since the last draw, replay keeps track of the others
+		const DrawStates& current = m_currentDrawStates;
+		DrawStates& recorded = m_recordedDrawStates;
+
+		if (!m_areRecordedStatesValid || current.pipeline != recorded.pipeline || current.shouldFlipY != recorded.shouldFlipY)
+		{
+			BindRenderPipelineCommand& command = AppendCommand<BindRenderPipelineCommand>();
+			command.pipeline = current.pipeline;
+			command.shouldFlipY = current.shouldFlipY;
+		}
+
+		if (current.scissorRegion && (!m_areRecordedStatesValid || current.scissorRegion != recorded.scissorRegion))
+			AppendCommand<SetScissorCommand>().scissorRegion = *current.scissorRegion;
+
+		if (current.viewportRegion && (!m_areRecordedStatesValid || current.viewportRegion != recorded.viewportRegion))
+			AppendCommand<SetViewportCommand>().viewportRegion = *current.viewportRegion;
+
+		if (!m_areRecordedStatesValid || current.indexBuffer != recorded.indexBuffer || current.indexBufferOffset != recorded.indexBufferOffset || current.indexBufferType != recorded.indexBufferType)
+		{
+			BindIndexBufferCommand& command = AppendCommand<BindIndexBufferCommand>();
+			command.indexBuffer = current.indexBuffer;
+			command.indexType = current.indexBufferType;
+			command.offset = current.indexBufferOffset;
+		}
+
+		for (std::size_t i = 0; i < current.vertexBuffers.size(); ++i)
+		{
+			const auto& vertexBuffer = current.vertexBuffers[i];
+			if (m_areRecordedStatesValid && i < recorded.vertexBuffers.size())
+			{
+				const auto& recordedVertexBuffer = recorded.vertexBuffers[i];
+				if (vertexBuffer.vertexBuffer == recordedVertexBuffer.vertexBuffer && vertexBuffer.offset == recordedVertexBuffer.offset)
+					continue;
+			}
+
+			BindVertexBufferCommand& command = AppendCommand<BindVertexBufferCommand>();
+			command.binding = SafeCast<UInt32>(i);
+			command.offset = vertexBuffer.offset;
+			command.vertexBuffer = vertexBuffer.vertexBuffer;
+		}
+
+		const auto& currentBindings = m_currentGraphicsShaderBindings.shaderBindings;
+		const auto& recordedBindings = m_recordedGraphicsShaderBindings.shaderBindings;
+
+		// Binding points come from the pipeline layout, a layout change may overwrite bindings of other sets
+		bool reapplyBindings = !m_areRecordedStatesValid || currentBindings.size() != recordedBindings.size();
+		for (std::size_t i = 0; i < currentBindings.size() && !reapplyBindings; ++i)
+		{
+			if (currentBindings[i].pipelineLayout != recordedBindings[i].pipelineLayout)
+				reapplyBindings = true;
+		}
+
+		for (std::size_t i = 0; i < currentBindings.size(); ++i)
+		{
+			const ShaderBindingEntry& binding = currentBindings[i];
+			if (!reapplyBindings)
+			{
+				const ShaderBindingEntry& recordedBinding = recordedBindings[i];
+				if (binding.pipelineLayout == recordedBinding.pipelineLayout && binding.shaderBinding == recordedBinding.shaderBinding)
+					continue;
+			}
+
+			BindRenderShaderBindingCommand& command = AppendCommand<BindRenderShaderBindingCommand>();
+			command.pipelineLayout = binding.pipelineLayout;
+			command.set = SafeCast<UInt32>(i);
+			command.shaderBinding = binding.shaderBinding;
+		}
+
+		recorded.indexBuffer = current.indexBuffer;
+		recorded.indexBufferOffset = current.indexBufferOffset;
+		recorded.indexBufferType = current.indexBufferType;
+		recorded.pipeline = current.pipeline;
+		recorded.scissorRegion = current.scissorRegion;
+		recorded.shouldFlipY = current.shouldFlipY;
+		recorded.vertexBuffers = current.vertexBuffers; //< doesn't reallocate once capacity is reached
+		recorded.viewportRegion = current.viewportRegion;
+		m_recordedGraphicsShaderBindings.shaderBindings = currentBindings;
+
+		m_areRecordedStatesValid = true;
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const BeginDebugRegionCommand& command)
 	{
 		if (context->glPushDebugGroup)
-			context->glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, GLsizei(command.regionName.size()), command.regionName.data());
+			context->glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, GLsizei(command.regionNameSize), reinterpret_cast<const char*>(GetTrailingData(command)));
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* /*context*/, ReplayStates& states, const BindIndexBufferCommand& command)
+	{
+		DrawStates& drawStates = states.drawStates;
+
+		// The index buffer is part of the VAO, offset and type are only used by draw calls
+		if (drawStates.indexBuffer != command.indexBuffer)
+		{
+			drawStates.indexBuffer = command.indexBuffer;
+			states.isVertexArrayDirty = true;
+		}
+
+		drawStates.indexBufferOffset = command.offset;
+		drawStates.indexBufferType = command.indexType;
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& states, const BindRenderPipelineCommand& command)
+	{
+		DrawStates& drawStates = states.drawStates;
+
+		// Vertex attributes depend on the pipeline vertex declarations
+		if (drawStates.pipeline != command.pipeline)
+		{
+			drawStates.pipeline = command.pipeline;
+			states.isVertexArrayDirty = true;
+		}
+
+		drawStates.shouldFlipY = command.shouldFlipY;
+
+		command.pipeline->Apply(*context, command.shouldFlipY);
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const BindRenderShaderBindingCommand& command)
+	{
+		if (command.shaderBinding)
+			command.shaderBinding->Apply(*command.pipelineLayout, command.set, *context);
+		else
+			NazaraWarning("no shader binding for set #{0}", command.set);
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* /*context*/, ReplayStates& states, const BindVertexBufferCommand& command)
+	{
+		auto& vertexBuffers = states.drawStates.vertexBuffers;
+		if (command.binding >= vertexBuffers.size())
+			vertexBuffers.resize(command.binding + 1);
+
+		auto& vertexBuffer = vertexBuffers[command.binding];
+		vertexBuffer.offset = command.offset;
+		vertexBuffer.vertexBuffer = command.vertexBuffer;
+
+		states.isVertexArrayDirty = true;
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const BlitTextureCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const BlitTextureCommand& command)
 	{
 		context->BlitTexture(*command.source, *command.target, command.sourceBox, command.targetBox, command.filter);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const BlitTextureToWindowCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const BlitTextureToWindowCommand& command)
 	{
 		context->BlitTextureToWindow(*command.source,  command.sourceBox, command.targetBox, command.filter);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* /*context*/, const BuildTextureMipmapsCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* /*context*/, ReplayStates& /*states*/, const BuildTextureMipmapsCommand& command)
 	{
 		command.texture->GenerateMipmaps(command.baseLevel, command.levelCount);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyBufferCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const CopyBufferCommand& command)
 	{
 		context->BindBuffer(GL::BufferTarget::CopyRead, command.source);
 		context->BindBuffer(GL::BufferTarget::CopyWrite, command.target);
 		context->glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, command.sourceOffset, command.targetOffset, command.size);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyBufferFromMemoryCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const CopyBufferFromMemoryCommand& command)
 	{
 		context->BindBuffer(GL::BufferTarget::CopyWrite, command.target);
 		context->glBufferSubData(GL_COPY_WRITE_BUFFER, command.targetOffset, command.size, command.memory);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const CopyTextureCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const CopyTextureCommand& command)
 	{
 		context->CopyTexture(*command.source, *command.target, command.sourceBox, command.targetPoint);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DispatchCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const DispatchCommand& command)
 	{
 		if NAZARA_UNLIKELY(!context->glDispatchCompute)
 			throw std::runtime_error("compute shaders are not supported on this device");
 
-		command.states.pipeline->Apply(*context);
-		ApplyBindings(*context, command.bindings);
+		command.pipeline->Apply(*context);
+		ApplyBindings(*context, reinterpret_cast<const ShaderBindingEntry*>(GetTrailingData(command)), command.bindingCount);
 		context->glDispatchCompute(command.numGroupsX, command.numGroupsY, command.numGroupsZ);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DrawCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& states, const DrawCommand& command)
 	{
-		ApplyStates(*context, command.states);
-		ApplyBindings(*context, command.bindings);
-		context->glDrawArraysInstanced(ToOpenGL(command.states.pipeline->GetPipelineInfo().primitiveMode), command.firstVertex, command.vertexCount, command.instanceCount);
+		const DrawStates& drawStates = states.drawStates;
+		if (states.isVertexArrayDirty)
+		{
+			BindVertexArray(*context, drawStates);
+			states.isVertexArrayDirty = false;
+		}
+
+		context->glDrawArraysInstanced(ToOpenGL(drawStates.pipeline->GetPipelineInfo().primitiveMode), command.firstVertex, command.vertexCount, command.instanceCount);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const DrawIndexedCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& states, const DrawIndexedCommand& command)
 	{
+		const DrawStates& drawStates = states.drawStates;
+
 		const UInt8* origin = 0; //< For an easy way to cast an integer to a pointer
-		origin += command.states.indexBufferOffset;
+		origin += drawStates.indexBufferOffset;
 
-		switch (command.states.indexBufferType)
+		switch (drawStates.indexBufferType)
 		{
 			case IndexType::U8:  origin += command.firstIndex * sizeof(UInt8); break;
 			case IndexType::U16: origin += command.firstIndex * sizeof(UInt16); break;
 			case IndexType::U32: origin += command.firstIndex * sizeof(UInt32); break;
 		}
 
-		ApplyStates(*context, command.states);
-		ApplyBindings(*context, command.bindings);
+		if (states.isVertexArrayDirty)
+		{
+			BindVertexArray(*context, drawStates);
+			states.isVertexArrayDirty = false;
+		}
 
 		if (command.baseVertex != 0)
 		{
 			if NAZARA_UNLIKELY(!context->glDrawElementsInstancedBaseVertex)
 				throw std::runtime_error("draw base vertex is not supported on this device");
 
-			context->glDrawElementsInstancedBaseVertex(ToOpenGL(command.states.pipeline->GetPipelineInfo().primitiveMode), command.indexCount, ToOpenGL(command.states.indexBufferType), origin, command.instanceCount, command.baseVertex);
+			context->glDrawElementsInstancedBaseVertex(ToOpenGL(drawStates.pipeline->GetPipelineInfo().primitiveMode), command.indexCount, ToOpenGL(drawStates.indexBufferType), origin, command.instanceCount, command.baseVertex);
 		}
 		else
-			context->glDrawElementsInstanced(ToOpenGL(command.states.pipeline->GetPipelineInfo().primitiveMode), command.indexCount, ToOpenGL(command.states.indexBufferType), origin, command.instanceCount);
+			context->glDrawElementsInstanced(ToOpenGL(drawStates.pipeline->GetPipelineInfo().primitiveMode), command.indexCount, ToOpenGL(drawStates.indexBufferType), origin, command.instanceCount);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const EndDebugRegionCommand& /*command*/)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& states, const DrawIndexedIndirectCommand& command)
+	{
+		if NAZARA_UNLIKELY(!context->glDrawElementsIndirect)
+			throw std::runtime_error("indirect draws are not supported on this device");
+
+		const DrawStates& drawStates = states.drawStates;
+		if (states.isVertexArrayDirty)
+		{
+			BindVertexArray(*context, drawStates);
+			states.isVertexArrayDirty = false;
+		}
+
+		context->BindBuffer(GL::BufferTarget::DrawIndirect, command.indirectBuffer);
+
+		GLenum primitiveMode = ToOpenGL(drawStates.pipeline->GetPipelineInfo().primitiveMode);
+		GLenum indexType = ToOpenGL(drawStates.indexBufferType);
+
+		const UInt8* origin = 0; //< For an easy way to cast an integer to a pointer
+		origin += command.offset;
+
+		if (command.countBuffer != 0)
+		{
+			if NAZARA_UNLIKELY(!context->glMultiDrawElementsIndirectCount)
+				throw std::runtime_error("indirect draw count is not supported on this device");
+
+			context->BindBuffer(GL::BufferTarget::Parameter, command.countBuffer);
+			context->glMultiDrawElementsIndirectCount(primitiveMode, indexType, origin, GLintptr(command.countOffset), SafeCast<GLsizei>(command.drawCount), SafeCast<GLsizei>(command.stride));
+		}
+		else if (context->glMultiDrawElementsIndirect)
+			context->glMultiDrawElementsIndirect(primitiveMode, indexType, origin, SafeCast<GLsizei>(command.drawCount), SafeCast<GLsizei>(command.stride));
+		else
+		{
+			// OpenGL ES without GL_EXT_multi_draw_indirect
+			for (UInt32 i = 0; i < command.drawCount; ++i)
+			{
+				context->glDrawElementsIndirect(primitiveMode, indexType, origin);
+				origin += command.stride;
+			}
+		}
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& states, const DrawIndirectCommand& command)
+	{
+		if NAZARA_UNLIKELY(!context->glDrawArraysIndirect)
+			throw std::runtime_error("indirect draws are not supported on this device");
+
+		const DrawStates& drawStates = states.drawStates;
+		if (states.isVertexArrayDirty)
+		{
+			BindVertexArray(*context, drawStates);
+			states.isVertexArrayDirty = false;
+		}
+
+		context->BindBuffer(GL::BufferTarget::DrawIndirect, command.indirectBuffer);
+
+		GLenum primitiveMode = ToOpenGL(drawStates.pipeline->GetPipelineInfo().primitiveMode);
+
+		const UInt8* origin = 0; //< For an easy way to cast an integer to a pointer
+		origin += command.offset;
+
+		if (command.countBuffer != 0)
+		{
+			if NAZARA_UNLIKELY(!context->glMultiDrawArraysIndirectCount)
+				throw std::runtime_error("indirect draw count is not supported on this device");
+
+			context->BindBuffer(GL::BufferTarget::Parameter, command.countBuffer);
+			context->glMultiDrawArraysIndirectCount(primitiveMode, origin, GLintptr(command.countOffset), SafeCast<GLsizei>(command.drawCount), SafeCast<GLsizei>(command.stride));
+		}
+		else if (context->glMultiDrawArraysIndirect)
+			context->glMultiDrawArraysIndirect(primitiveMode, origin, SafeCast<GLsizei>(command.drawCount), SafeCast<GLsizei>(command.stride));
+		else
+		{
+			// OpenGL ES without GL_EXT_multi_draw_indirect
+			for (UInt32 i = 0; i < command.drawCount; ++i)
+			{
+				context->glDrawArraysIndirect(primitiveMode, origin);
+				origin += command.stride;
+			}
+		}
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const EndDebugRegionCommand& /*command*/)
 	{
 		if (context->glPopDebugGroup)
 			context->glPopDebugGroup();
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const InsertDebugLabelCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const InsertDebugLabelCommand& command)
 	{
 		if (context->glDebugMessageInsert)
-			context->glDebugMessageInsert(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_MARKER, 0, GL_DEBUG_SEVERITY_NOTIFICATION, SafeCaster(command.label.size()), command.label.data());
+			context->glDebugMessageInsert(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_MARKER, 0, GL_DEBUG_SEVERITY_NOTIFICATION, SafeCast<GLsizei>(command.labelSize), reinterpret_cast<const char*>(GetTrailingData(command)));
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, const MemoryBarrier& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const MemoryBarrier& command)
 	{
 		if (context->glMemoryBarrier)
 			context->glMemoryBarrier(command.barriers);
 	}
 
-	inline void OpenGLCommandBuffer::Execute(const GL::Context*& context, const SetFrameBufferCommand& command)
+	inline void OpenGLCommandBuffer::Execute(const GL::Context*& context, ReplayStates& states, const SetFrameBufferCommand& command)
 	{
 		command.framebuffer->Activate();
 
+		// Window framebuffers may use another context, with its own vertex arrays
+		states.isVertexArrayDirty = true;
+
 		StackArray<std::size_t> colorIndexes = NazaraStackArrayNoInit(std::size_t, m_maxColorBufferCount);
 
 		std::size_t colorBufferCount = command.framebuffer->GetColorBufferCount();
@@ -442,6 +700,16 @@ namespace Nz
 			context->glInvalidateFramebuffer(GL_FRAMEBUFFER, GLsizei(invalidateAttachments.size()), invalidateAttachments.data());
 	}
 
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const SetScissorCommand& command)
+	{
+		context->SetScissorBox(command.scissorRegion.x, command.scissorRegion.y, command.scissorRegion.width, command.scissorRegion.height);
+	}
+
+	inline void OpenGLCommandBuffer::Execute(const GL::Context* context, ReplayStates& /*states*/, const SetViewportCommand& command)
+	{
+		context->SetViewport(command.viewportRegion.x, command.viewportRegion.y, command.viewportRegion.width, command.viewportRegion.height);
+	}
+
 	void OpenGLCommandBuffer::Release()
 	{
 		assert(m_owner);
@@ -151,6 +151,36 @@ namespace Nz
 		m_commandBuffer.DrawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 	}
 
+	void OpenGLCommandBufferBuilder::DrawIndexedIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride)
+	{
+		const OpenGLBuffer& glBuffer = SafeCast<const OpenGLBuffer&>(indirectBuffer);
+
+		m_commandBuffer.DrawIndexedIndirect(glBuffer.GetBuffer().GetObjectId(), offset, drawCount, stride);
+	}
+
+	void OpenGLCommandBufferBuilder::DrawIndexedIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride)
+	{
+		const OpenGLBuffer& glBuffer = SafeCast<const OpenGLBuffer&>(indirectBuffer);
+		const OpenGLBuffer& glCountBuffer = SafeCast<const OpenGLBuffer&>(countBuffer);
+
+		m_commandBuffer.DrawIndexedIndirect(glBuffer.GetBuffer().GetObjectId(), offset, maxDrawCount, stride, glCountBuffer.GetBuffer().GetObjectId(), countOffset);
+	}
+
+	void OpenGLCommandBufferBuilder::DrawIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride)
+	{
+		const OpenGLBuffer& glBuffer = SafeCast<const OpenGLBuffer&>(indirectBuffer);
+
+		m_commandBuffer.DrawIndirect(glBuffer.GetBuffer().GetObjectId(), offset, drawCount, stride);
+	}
+
+	void OpenGLCommandBufferBuilder::DrawIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride)
+	{
+		const OpenGLBuffer& glBuffer = SafeCast<const OpenGLBuffer&>(indirectBuffer);
+		const OpenGLBuffer& glCountBuffer = SafeCast<const OpenGLBuffer&>(countBuffer);
+
+		m_commandBuffer.DrawIndirect(glBuffer.GetBuffer().GetObjectId(), offset, maxDrawCount, stride, glCountBuffer.GetBuffer().GetObjectId(), countOffset);
+	}
+
 	void OpenGLCommandBufferBuilder::EndDebugRegion()
 	{
 		m_commandBuffer.EndDebugRegion();
@@ -177,6 +207,9 @@ namespace Nz
 		if (dstAccessMask.Test(MemoryAccess::IndexBufferRead))
 			barriers |= GL_ELEMENT_ARRAY_BARRIER_BIT;
 
+		if (dstAccessMask.Test(MemoryAccess::IndirectCommandRead))
+			barriers |= GL_COMMAND_BARRIER_BIT;
+
 		if (dstAccessMask.Test(MemoryAccess::VertexBufferRead))
 			barriers |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
 
@@ -75,6 +75,18 @@ namespace Nz
 		if (m_referenceContext->glDrawElementsInstancedBaseVertex)
 			m_deviceInfo.features.drawBaseVertex = true;
 
+		if (m_referenceContext->glDrawArraysIndirect && m_referenceContext->glDrawElementsIndirect)
+			m_deviceInfo.features.drawIndirect = true;
+
+		if (m_referenceContext->glMultiDrawArraysIndirectCount && m_referenceContext->glMultiDrawElementsIndirectCount)
+			m_deviceInfo.features.drawIndirectCount = true;
+
+		if (m_deviceInfo.features.drawIndirect && m_referenceContext->IsExtensionSupported(GL::Extension::BaseInstance)) //< baseInstance field of indirect commands must be zero otherwise
+			m_deviceInfo.features.drawIndirectFirstInstance = true;
+
+		if (m_referenceContext->glMultiDrawArraysIndirect && m_referenceContext->glMultiDrawElementsIndirect) //< multi-draws are emulated with a loop otherwise
+			m_deviceInfo.features.multiDrawIndirect = true;
+
 		if (m_referenceContext->glPolygonMode) //< not supported in core OpenGL ES, but supported in OpenGL or with GL_NV_polygon_mode extension
 			m_deviceInfo.features.nonSolidFaceFilling = true;
 
@@ -70,6 +70,9 @@ namespace Nz::GL
 								m_context.glVertexAttribPointer(bindingIndex, attrib.size, attrib.type, attrib.normalized, attrib.stride, attrib.pointer);
 								break;
 						}
+
+						if (attrib.divisor != 0)
+							m_context.glVertexAttribDivisor(bindingIndex, attrib.divisor);
 					}
 
 					bindingIndex++;
@@ -476,6 +476,14 @@ namespace Nz::GL
 
 		m_extensionStatus.fill(ExtensionStatus::NotSupported);
 
+		// Base instance
+		if (m_params.type == ContextType::OpenGL && glVersion >= 420)
+			m_extensionStatus[Extension::BaseInstance] = ExtensionStatus::Core;
+		else if (m_supportedExtensions.count("GL_ARB_base_instance"))
+			m_extensionStatus[Extension::BaseInstance] = ExtensionStatus::ARB;
+		else if (m_supportedExtensions.count("GL_EXT_base_instance"))
+			m_extensionStatus[Extension::BaseInstance] = ExtensionStatus::EXT;
+
 		// Clip control
 		if (m_params.type == ContextType::OpenGL && glVersion >= 450)
 			m_extensionStatus[Extension::ClipControl] = ExtensionStatus::Core;
@@ -1099,6 +1107,40 @@ namespace Nz::GL
 					return loader.Load<PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, functionIndex>(glDrawElementsInstancedBaseVertex, "glDrawElementsInstancedBaseVertexEXT", false);
 			}
 		}
+		else if (function == "glMultiDrawArraysIndirect")
+		{
+			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glMultiDrawArraysIndirect);
+
+			if (m_params.type == ContextType::OpenGL && IsExtensionSupported("GL_ARB_multi_draw_indirect"))
+				return loader.Load<PFNGLMULTIDRAWARRAYSINDIRECTPROC, functionIndex>(glMultiDrawArraysIndirect, "glMultiDrawArraysIndirect", false);
+
+			if (m_params.type == ContextType::OpenGL_ES && IsExtensionSupported("GL_EXT_multi_draw_indirect"))
+				return loader.Load<PFNGLMULTIDRAWARRAYSINDIRECTEXTPROC, functionIndex>(glMultiDrawArraysIndirect, "glMultiDrawArraysIndirectEXT", false);
+		}
+		else if (function == "glMultiDrawArraysIndirectCount")
+		{
+			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glMultiDrawArraysIndirectCount);
+
+			if (m_params.type == ContextType::OpenGL && IsExtensionSupported("GL_ARB_indirect_parameters"))
+				return loader.Load<PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, functionIndex>(glMultiDrawArraysIndirectCount, "glMultiDrawArraysIndirectCountARB", false);
+		}
+		else if (function == "glMultiDrawElementsIndirect")
+		{
+			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glMultiDrawElementsIndirect);
+
+			if (m_params.type == ContextType::OpenGL && IsExtensionSupported("GL_ARB_multi_draw_indirect"))
+				return loader.Load<PFNGLMULTIDRAWELEMENTSINDIRECTPROC, functionIndex>(glMultiDrawElementsIndirect, "glMultiDrawElementsIndirect", false);
+
+			if (m_params.type == ContextType::OpenGL_ES && IsExtensionSupported("GL_EXT_multi_draw_indirect"))
+				return loader.Load<PFNGLMULTIDRAWELEMENTSINDIRECTEXTPROC, functionIndex>(glMultiDrawElementsIndirect, "glMultiDrawElementsIndirectEXT", false);
+		}
+		else if (function == "glMultiDrawElementsIndirectCount")
+		{
+			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glMultiDrawElementsIndirectCount);
+
+			if (m_params.type == ContextType::OpenGL && IsExtensionSupported("GL_ARB_indirect_parameters"))
+				return loader.Load<PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, functionIndex>(glMultiDrawElementsIndirectCount, "glMultiDrawElementsIndirectCountARB", false);
+		}
 		else if (function == "glPolygonMode")
 		{
 			constexpr std::size_t functionIndex = UnderlyingCast(FunctionIndex::glPolygonMode);
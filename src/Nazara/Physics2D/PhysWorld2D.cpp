@@ -3,14 +3,220 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Core/DeltaEncoding.hpp>
+#include <Nazara/Core/Error.hpp>
 #include <Nazara/Physics2D/PhysArbiter2D.hpp>
 #include <NazaraUtils/StackArray.hpp>
 #include <chipmunk/chipmunk.h>
+#include <chipmunk/cpHastySpace.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// Chipmunk private API (used to save and restore arbiters and sleeping components) isn't declared with C linkage
+extern "C"
+{
+#include <chipmunk/chipmunk_private.h>
+}
 
 namespace Nz
 {
 	namespace
 	{
+		constexpr UInt32 InvalidArbiterIndex = std::numeric_limits<UInt32>::max();
+
+		enum ArbiterStateFlags : UInt8
+		{
+			ArbiterStateFlag_Swapped   = 1 << 0,
+			ArbiterStateFlag_ThreadedA = 1 << 1,
+			ArbiterStateFlag_ThreadedB = 1 << 2
+		};
+
+		struct ArbiterState
+		{
+			cpContact contacts[CP_MAX_CONTACTS_PER_ARBITER];
+			cpVect normal;
+			cpVect surfaceVelocity;
+			cpFloat elasticity;
+			cpFloat friction;
+			cpCollisionHandler* handler;
+			cpCollisionHandler* handlerA;
+			cpCollisionHandler* handlerB;
+			cpDataPointer userdata;
+			UInt64 shapeA; //< shape hash id
+			UInt64 shapeB; //< shape hash id
+			UInt32 contactCount;
+			UInt32 stampAge; //< steps since the arbiter was last used
+			UInt32 prevArbiterA; //< arbiter indices of the body A and B contact graph lists
+			UInt32 nextArbiterA;
+			UInt32 prevArbiterB;
+			UInt32 nextArbiterB;
+			UInt8 arbiterState;
+			UInt8 flags;
+		};
+
+		struct BodyState
+		{
+			UInt32 bodyIndex;
+			UInt32 sleepingRoot; //< InvalidBodyIndex if the body is awake
+			UInt32 sleepingNext;
+			cpVect position; //< center of gravity position
+			cpVect velocity;
+			cpVect velocityBias;
+			cpVect force;
+			cpFloat angle;
+			cpFloat angularVelocity;
+			cpFloat angularVelocityBias;
+			cpFloat torque;
+			cpFloat idleTime;
+		};
+
+		struct StateHeader
+		{
+			Int64 timestepAccumulator;
+			UInt64 bodyCount;
+			UInt64 arbiterCount;
+			UInt64 activeArbiterCount;
+			cpFloat lastTimestep;
+		};
+
+		bool ArbiterLess(const cpArbiter* lhs, const cpArbiter* rhs)
+		{
+			if (lhs->a->hashid != rhs->a->hashid)
+				return lhs->a->hashid < rhs->a->hashid;
+
+			return lhs->b->hashid < rhs->b->hashid;
+		}
+
+		cpArbiter* AllocateArbiter(cpSpace* space, cpShape* shapeA, cpShape* shapeB)
+		{
+			// Same as what Chipmunk does when it finds a new collision pair
+			if (space->pooledArbiters->num == 0)
+			{
+				constexpr std::size_t arbiterCount = CP_BUFFER_BYTES / sizeof(cpArbiter);
+
+				cpArbiter* buffer = static_cast<cpArbiter*>(cpcalloc(1, CP_BUFFER_BYTES));
+				cpArrayPush(space->allocatedBuffers, buffer);
+				for (std::size_t i = 0; i < arbiterCount; ++i)
+					cpArrayPush(space->pooledArbiters, buffer + i);
+			}
+
+			return cpArbiterInit(static_cast<cpArbiter*>(cpArrayPop(space->pooledArbiters)), shapeA, shapeB);
+		}
+
+		void ClearArbiters(cpSpace* space)
+		{
+			std::vector<cpArbiter*> arbiters;
+			cpHashSetEach(space->cachedArbiters, [](void* element, void* userdata)
+			{
+				static_cast<std::vector<cpArbiter*>*>(userdata)->push_back(static_cast<cpArbiter*>(element));
+			}, &arbiters);
+
+			for (cpArbiter* arbiter : arbiters)
+			{
+				cpArbiterUnthread(arbiter);
+
+				const cpShape* shapePair[] = { arbiter->a, arbiter->b };
+				cpHashSetRemove(space->cachedArbiters, CP_HASH_PAIR(arbiter->a, arbiter->b), shapePair);
+
+				arbiter->contacts = nullptr;
+				arbiter->count = 0;
+				cpArrayPush(space->pooledArbiters, arbiter);
+			}
+
+			space->arbiters->num = 0;
+		}
+
+		std::vector<cpArbiter*> CollectArbiters(cpSpace* space)
+		{
+			std::vector<cpArbiter*> arbiters;
+			cpHashSetEach(space->cachedArbiters, [](void* element, void* userdata)
+			{
+				static_cast<std::vector<cpArbiter*>*>(userdata)->push_back(static_cast<cpArbiter*>(element));
+			}, &arbiters);
+
+			// Arbiters of sleeping bodies are removed from the cache until they wake up (and are owned by body A, or body B if A is static)
+			for (int i = 0; i < space->sleepingComponents->num; ++i)
+			{
+				for (cpBody* body = static_cast<cpBody*>(space->sleepingComponents->arr[i]); body; body = body->sleeping.next)
+				{
+					for (cpArbiter* arbiter = body->arbiterList; arbiter; arbiter = cpArbiterThreadForBody(arbiter, body)->next)
+					{
+						if (arbiter->body_a == body || cpBodyGetType(arbiter->body_a) == CP_BODY_TYPE_STATIC)
+							arbiters.push_back(arbiter);
+					}
+				}
+			}
+
+			// Hash set order depends on its history, sort arbiters to keep states comparable
+			std::sort(arbiters.begin(), arbiters.end(), ArbiterLess);
+			arbiters.erase(std::unique(arbiters.begin(), arbiters.end()), arbiters.end());
+
+			return arbiters;
+		}
+
+		void CollectShapes(cpSpatialIndex* index, std::vector<cpShape*>& shapes)
+		{
+			cpSpatialIndexEach(index, [](void* object, void* userdata)
+			{
+				static_cast<std::vector<cpShape*>*>(userdata)->push_back(static_cast<cpShape*>(object));
+			}, &shapes);
+		}
+
+		UInt32 FindArbiterIndex(const std::vector<cpArbiter*>& arbiters, const cpArbiter* arbiter)
+		{
+			if (!arbiter)
+				return InvalidArbiterIndex;
+
+			auto it = std::lower_bound(arbiters.begin(), arbiters.end(), arbiter, ArbiterLess);
+			if (it == arbiters.end() || *it != arbiter)
+				return InvalidArbiterIndex;
+
+			return SafeCast<UInt32>(std::distance(arbiters.begin(), it));
+		}
+
+		UInt32 GetBodyIndex(cpBody* body)
+		{
+			if (!body)
+				return RigidBody2D::InvalidBodyIndex;
+
+			RigidBody2D* rigidBody = static_cast<RigidBody2D*>(cpBodyGetUserData(body));
+			return (rigidBody) ? rigidBody->GetBodyIndex() : RigidBody2D::InvalidBodyIndex;
+		}
+
+		bool IsArbiterThreaded(cpArbiter* arbiter, cpBody* body)
+		{
+			return cpArbiterThreadForBody(arbiter, body)->prev || body->arbiterList == arbiter;
+		}
+
+		void RebuildSpatialIndices(cpSpace* space)
+		{
+			// Spatial indices structure depends on their whole history and drives the order in which collision pairs are solved,
+			// rebuilding them with a canonical insertion order makes the simulation reproducible from a saved state
+			auto ExtractShapes = [](cpSpatialIndex* index)
+			{
+				std::vector<cpShape*> shapes;
+				CollectShapes(index, shapes);
+				std::sort(shapes.begin(), shapes.end(), [](const cpShape* lhs, const cpShape* rhs) { return lhs->hashid < rhs->hashid; });
+
+				for (cpShape* shape : shapes)
+					cpSpatialIndexRemove(index, shape, shape->hashid);
+
+				return shapes;
+			};
+
+			std::vector<cpShape*> dynamicShapes = ExtractShapes(space->dynamicShapes);
+			std::vector<cpShape*> staticShapes = ExtractShapes(space->staticShapes);
+
+			for (cpShape* shape : staticShapes)
+				cpSpatialIndexInsert(space->staticShapes, shape, shape->hashid);
+
+			for (cpShape* shape : dynamicShapes)
+				cpSpatialIndexInsert(space->dynamicShapes, shape, shape->hashid);
+		}
+
 		Color CpDebugColorToColor(cpSpaceDebugColor c)
 		{
 			return Color{ c.r, c.g, c.b, c.a };
@@ -81,17 +287,41 @@ namespace Nz
 	}
 
 	PhysWorld2D::PhysWorld2D() :
+	PhysWorld2D(Settings{})
+	{
+	}
+
+	/*!
+	* \brief Constructs a physics world
+	*
+	* \param settings World settings
+	*
+	* \remark A thread count other than one makes the world use Chipmunk multithreaded space (cpHastySpace), which runs the solver iterations on multiple threads.
+	*  Collision detection and callbacks still run on the thread calling Step.
+	*/
+	PhysWorld2D::PhysWorld2D(const Settings& settings) :
 	m_maxStepCount(50),
+	m_isMultithreaded(settings.threadCount != 1),
 	m_stepSize(Time::TickDuration(120)),
 	m_timestepAccumulator(Time::Zero())
 	{
-		m_handle = cpSpaceNew();
+		if (m_isMultithreaded)
+		{
+			m_handle = cpHastySpaceNew();
+			cpHastySpaceSetThreads(m_handle, settings.threadCount);
+		}
+		else
+			m_handle = cpSpaceNew();
+
 		cpSpaceSetUserData(m_handle, this);
 	}
 
 	PhysWorld2D::~PhysWorld2D()
 	{
-		cpSpaceFree(m_handle);
+		if (m_isMultithreaded)
+			cpHastySpaceFree(m_handle);
+		else
+			cpSpaceFree(m_handle);
 	}
 
 	void PhysWorld2D::DebugDraw(const DebugDrawOptions& options, bool drawShapes, bool drawConstraints, bool drawCollisions) const
@@ -161,6 +391,14 @@ namespace Nz
 		return m_stepSize;
 	}
 
+	unsigned int PhysWorld2D::GetThreadCount() const
+	{
+		if (!m_isMultithreaded)
+			return 1;
+
+		return static_cast<unsigned int>(cpHastySpaceGetThreads(m_handle));
+	}
+
 	bool PhysWorld2D::NearestBodyQuery(const Vector2f & from, float maxDistance, UInt32 collisionGroup, UInt32 categoryMask, UInt32 collisionMask, RigidBody2D** nearestBody)
 	{
 		cpShapeFilter filter = cpShapeFilterNew(collisionGroup, categoryMask, collisionMask);
@@ -318,6 +556,404 @@ namespace Nz
 		InitCallbacks(cpSpaceAddCollisionHandler(m_handle, collisionIdA, collisionIdB), std::move(callbacks));
 	}
 
+	/*!
+	* \brief Restores the world from a state saved by SaveState
+	* \return True if the state was successfully restored
+	*
+	* Restores the position, rotation, velocities and accumulated forces of every body, their sleeping state,
+	* the contact cache (used to warm start the solver) as well as the timestep accumulator.
+	*
+	* \param state State to restore
+	*
+	* \remark Every body saved in the state must still exist in the world (with the same body index)
+	* \remark States reference the world collision handlers and can only be restored in the world which saved them
+	* \remark Constraints accumulated impulses aren't part of the state
+	*
+	* \see SaveState
+	*/
+	bool PhysWorld2D::RestoreState(const ByteArray& state)
+	{
+		if (cpSpaceIsLocked(m_handle))
+		{
+			NazaraError("cannot restore state while world is being stepped");
+			return false;
+		}
+
+		StateHeader header;
+		if (state.GetSize() < sizeof(header))
+		{
+			NazaraError("invalid state: not enough data");
+			return false;
+		}
+
+		std::memcpy(&header, state.GetConstBuffer(), sizeof(header));
+
+		std::size_t dataSize = state.GetSize() - sizeof(header);
+		if (header.bodyCount > dataSize / sizeof(BodyState) || header.arbiterCount > dataSize / sizeof(ArbiterState) || header.activeArbiterCount > dataSize / sizeof(UInt32) ||
+		    dataSize != header.bodyCount * sizeof(BodyState) + header.arbiterCount * sizeof(ArbiterState) + header.activeArbiterCount * sizeof(UInt32))
+		{
+			NazaraError("invalid state: expected {0} bodies and {1} arbiters but state size is {2}", header.bodyCount, header.arbiterCount, state.GetSize());
+			return false;
+		}
+
+		const UInt8* bodyStates = state.GetConstBuffer() + sizeof(header);
+		const UInt8* arbiterStates = bodyStates + header.bodyCount * sizeof(BodyState);
+		const UInt8* activeArbiters = arbiterStates + header.arbiterCount * sizeof(ArbiterState);
+
+		auto IsValidBodyIndex = [&](UInt32 bodyIndex)
+		{
+			return bodyIndex < m_bodies.size() && m_bodies[bodyIndex];
+		};
+
+		// Validate the whole state before touching any body
+		for (std::size_t i = 0; i < header.bodyCount; ++i)
+		{
+			BodyState bodyState;
+			std::memcpy(&bodyState, bodyStates + i * sizeof(BodyState), sizeof(BodyState));
+
+			if (!IsValidBodyIndex(bodyState.bodyIndex))
+			{
+				NazaraError("invalid state: body #{0} doesn't exist", bodyState.bodyIndex);
+				return false;
+			}
+
+			if ((bodyState.sleepingRoot != RigidBody2D::InvalidBodyIndex && !IsValidBodyIndex(bodyState.sleepingRoot)) || (bodyState.sleepingNext != RigidBody2D::InvalidBodyIndex && !IsValidBodyIndex(bodyState.sleepingNext)))
+			{
+				NazaraError("invalid state: body #{0} sleeping component references a body which doesn't exist", bodyState.bodyIndex);
+				return false;
+			}
+		}
+
+		for (std::size_t i = 0; i < header.activeArbiterCount; ++i)
+		{
+			UInt32 arbiterIndex;
+			std::memcpy(&arbiterIndex, activeArbiters + i * sizeof(UInt32), sizeof(UInt32));
+
+			if (arbiterIndex >= header.arbiterCount)
+			{
+				NazaraError("invalid state: arbiter #{0} doesn't exist", arbiterIndex);
+				return false;
+			}
+		}
+
+		// Wake every body up and forget current contacts, putting the space in a known state
+		while (m_handle->sleepingComponents->num > 0)
+			cpBodyActivate(static_cast<cpBody*>(m_handle->sleepingComponents->arr[m_handle->sleepingComponents->num - 1]));
+
+		ClearArbiters(m_handle);
+
+		std::vector<UInt32> sleepingNext(m_bodies.size(), RigidBody2D::InvalidBodyIndex);
+		for (std::size_t i = 0; i < header.bodyCount; ++i)
+		{
+			BodyState bodyState;
+			std::memcpy(&bodyState, bodyStates + i * sizeof(BodyState), sizeof(BodyState));
+
+			cpBody* body = m_bodies[bodyState.bodyIndex]->GetHandle();
+
+			// Restore the center of gravity position instead of the body origin, to avoid rounding errors
+			body->p = bodyState.position;
+			cpBodySetAngle(body, bodyState.angle); //< also updates the body transform from its position
+
+			cpBodyEachShape(body, [](cpBody* /*body*/, cpShape* shape, void* /*userdata*/)
+			{
+				cpShapeCacheBB(shape);
+			}, nullptr);
+
+			if (cpBodyGetType(body) == CP_BODY_TYPE_STATIC)
+				continue;
+
+			body->v = bodyState.velocity;
+			body->v_bias = bodyState.velocityBias;
+			body->f = bodyState.force;
+			body->w = bodyState.angularVelocity;
+			body->w_bias = bodyState.angularVelocityBias;
+			body->t = bodyState.torque;
+
+			sleepingNext[bodyState.bodyIndex] = bodyState.sleepingNext;
+		}
+
+		m_handle->curr_dt = header.lastTimestep;
+		m_timestepAccumulator = Time::Nanoseconds(header.timestepAccumulator);
+
+		// Restore arbiters (arbiters whose shapes no longer exist are skipped)
+		std::vector<cpShape*> shapes;
+		CollectShapes(m_handle->dynamicShapes, shapes);
+		CollectShapes(m_handle->staticShapes, shapes);
+		std::sort(shapes.begin(), shapes.end(), [](const cpShape* lhs, const cpShape* rhs) { return lhs->hashid < rhs->hashid; });
+
+		auto FindShape = [&](UInt64 hashId) -> cpShape*
+		{
+			auto it = std::lower_bound(shapes.begin(), shapes.end(), hashId, [](const cpShape* shape, UInt64 id) { return shape->hashid < id; });
+			return (it != shapes.end() && (*it)->hashid == hashId) ? *it : nullptr;
+		};
+
+		if (!m_handle->contactBuffersHead)
+			cpSpacePushFreshContactBuffer(m_handle);
+
+		std::vector<cpArbiter*> arbiters(header.arbiterCount, nullptr);
+		for (std::size_t i = 0; i < header.arbiterCount; ++i)
+		{
+			ArbiterState arbiterState;
+			std::memcpy(&arbiterState, arbiterStates + i * sizeof(ArbiterState), sizeof(ArbiterState));
+
+			cpShape* shapeA = FindShape(arbiterState.shapeA);
+			cpShape* shapeB = FindShape(arbiterState.shapeB);
+			if (!shapeA || !shapeB)
+				continue;
+
+			cpArbiter* arbiter = AllocateArbiter(m_handle, shapeA, shapeB);
+			arbiter->e = arbiterState.elasticity;
+			arbiter->u = arbiterState.friction;
+			arbiter->surface_vr = arbiterState.surfaceVelocity;
+			arbiter->n = arbiterState.normal;
+			arbiter->data = arbiterState.userdata;
+			arbiter->handler = arbiterState.handler;
+			arbiter->handlerA = arbiterState.handlerA;
+			arbiter->handlerB = arbiterState.handlerB;
+			arbiter->swapped = (arbiterState.flags & ArbiterStateFlag_Swapped) ? cpTrue : cpFalse;
+			arbiter->stamp = m_handle->stamp - arbiterState.stampAge;
+			arbiter->state = static_cast<cpArbiterState>(arbiterState.arbiterState);
+
+			int contactCount = std::min(SafeCast<int>(arbiterState.contactCount), CP_MAX_CONTACTS_PER_ARBITER);
+			if (contactCount > 0)
+			{
+				arbiter->contacts = cpContactBufferGetArray(m_handle);
+				arbiter->count = contactCount;
+				std::memcpy(arbiter->contacts, arbiterState.contacts, contactCount * sizeof(cpContact));
+				cpSpacePushContacts(m_handle, contactCount);
+			}
+
+			const cpShape* shapePair[] = { shapeA, shapeB };
+			cpHashSetInsert(m_handle->cachedArbiters, CP_HASH_PAIR(shapeA, shapeB), shapePair, nullptr, arbiter);
+
+			arbiters[i] = arbiter;
+		}
+
+		auto GetArbiter = [&](UInt32 arbiterIndex)
+		{
+			return (arbiterIndex < arbiters.size()) ? arbiters[arbiterIndex] : nullptr;
+		};
+
+		// Rebuild bodies contact graph lists once every arbiter exists
+		for (std::size_t i = 0; i < header.arbiterCount; ++i)
+		{
+			cpArbiter* arbiter = arbiters[i];
+			if (!arbiter)
+				continue;
+
+			ArbiterState arbiterState;
+			std::memcpy(&arbiterState, arbiterStates + i * sizeof(ArbiterState), sizeof(ArbiterState));
+
+			if (arbiterState.flags & ArbiterStateFlag_ThreadedA)
+			{
+				arbiter->thread_a.prev = GetArbiter(arbiterState.prevArbiterA);
+				arbiter->thread_a.next = GetArbiter(arbiterState.nextArbiterA);
+				if (!arbiter->thread_a.prev)
+					arbiter->body_a->arbiterList = arbiter;
+			}
+
+			if (arbiterState.flags & ArbiterStateFlag_ThreadedB)
+			{
+				arbiter->thread_b.prev = GetArbiter(arbiterState.prevArbiterB);
+				arbiter->thread_b.next = GetArbiter(arbiterState.nextArbiterB);
+				if (!arbiter->thread_b.prev)
+					arbiter->body_b->arbiterList = arbiter;
+			}
+		}
+
+		for (std::size_t i = 0; i < header.activeArbiterCount; ++i)
+		{
+			UInt32 arbiterIndex;
+			std::memcpy(&arbiterIndex, activeArbiters + i * sizeof(UInt32), sizeof(UInt32));
+
+			if (cpArbiter* arbiter = arbiters[arbiterIndex])
+				cpArrayPush(m_handle->arbiters, arbiter);
+		}
+
+		// Put sleeping components back to sleep, which also removes their arbiters from the cache
+		if (cpSpaceGetSleepTimeThreshold(m_handle) < std::numeric_limits<cpFloat>::infinity())
+		{
+			std::vector<cpBody*> componentBodies;
+			for (std::size_t i = 0; i < header.bodyCount; ++i)
+			{
+				BodyState bodyState;
+				std::memcpy(&bodyState, bodyStates + i * sizeof(BodyState), sizeof(BodyState));
+
+				if (bodyState.sleepingRoot != bodyState.bodyIndex)
+					continue;
+
+				cpBody* root = m_bodies[bodyState.bodyIndex]->GetHandle();
+				if (cpBodyGetType(root) != CP_BODY_TYPE_DYNAMIC || cpBodyIsSleeping(root))
+					continue;
+
+				cpBodySleepWithGroup(root, nullptr);
+
+				componentBodies.clear();
+				for (UInt32 bodyIndex = bodyState.sleepingNext; bodyIndex != RigidBody2D::InvalidBodyIndex && componentBodies.size() < header.bodyCount; bodyIndex = sleepingNext[bodyIndex])
+				{
+					cpBody* body = m_bodies[bodyIndex]->GetHandle();
+					if (cpBodyGetType(body) == CP_BODY_TYPE_DYNAMIC && !cpBodyIsSleeping(body))
+						componentBodies.push_back(body);
+				}
+
+				// Bodies are inserted right after the component root, put them to sleep in reverse order to keep the component order
+				for (auto it = componentBodies.rbegin(); it != componentBodies.rend(); ++it)
+					cpBodySleepWithGroup(*it, root);
+			}
+		}
+
+		// Idle time is reset when a body wakes up or is put to sleep
+		for (std::size_t i = 0; i < header.bodyCount; ++i)
+		{
+			BodyState bodyState;
+			std::memcpy(&bodyState, bodyStates + i * sizeof(BodyState), sizeof(BodyState));
+
+			m_bodies[bodyState.bodyIndex]->GetHandle()->sleeping.idleTime = bodyState.idleTime;
+		}
+
+		RebuildSpatialIndices(m_handle);
+
+		return true;
+	}
+
+	/*!
+	* \brief Restores the world from a delta state saved by SaveState
+	* \return True if the state was successfully restored
+	*
+	* \param stateDelta Delta state to restore
+	* \param referenceState Full state the delta was computed against
+	*
+	* \see RestoreState
+	*/
+	bool PhysWorld2D::RestoreState(const ByteArray& stateDelta, const ByteArray& referenceState)
+	{
+		if (!ApplyDelta(referenceState, stateDelta, m_stateBuffer))
+			return false;
+
+		return RestoreState(m_stateBuffer);
+	}
+
+	/*!
+	* \brief Saves the state of the world into a contiguous buffer
+	*
+	* The saved state can be restored using RestoreState, allowing to rewind and re-simulate the world (e.g. for rollback networking).
+	* It holds every body state, the contact cache (used to warm start the solver) and sleeping components.
+	*
+	* \param state Output buffer (previous content is replaced, memory is reused)
+	*
+	* \remark The spatial indices are rebuilt in a canonical order (as RestoreState does), this is what makes re-simulating from a state give the same results
+	*
+	* \see RestoreState
+	*/
+	void PhysWorld2D::SaveState(ByteArray& state)
+	{
+		RebuildSpatialIndices(m_handle);
+
+		std::vector<cpArbiter*> arbiters = CollectArbiters(m_handle);
+
+		StateHeader header;
+		std::memset(&header, 0, sizeof(header)); //< clear padding bytes, keeping states comparable for delta compression
+		header.timestepAccumulator = m_timestepAccumulator.AsNanoseconds();
+		header.bodyCount = m_bodies.size() - m_freeBodyIndices.Count();
+		header.arbiterCount = arbiters.size();
+		header.activeArbiterCount = SafeCast<UInt64>(m_handle->arbiters->num);
+		header.lastTimestep = m_handle->curr_dt;
+
+		state.Resize(sizeof(header) + header.bodyCount * sizeof(BodyState) + header.arbiterCount * sizeof(ArbiterState) + header.activeArbiterCount * sizeof(UInt32));
+		std::memcpy(state.GetBuffer(), &header, sizeof(header));
+
+		UInt8* bodyStates = state.GetBuffer() + sizeof(header);
+		for (std::size_t bodyIndex = 0; bodyIndex < m_bodies.size(); ++bodyIndex)
+		{
+			if (!m_bodies[bodyIndex])
+				continue;
+
+			cpBody* body = m_bodies[bodyIndex]->GetHandle();
+
+			BodyState bodyState;
+			std::memset(&bodyState, 0, sizeof(bodyState)); //< clear padding bytes, keeping states comparable for delta compression
+			bodyState.bodyIndex = static_cast<UInt32>(bodyIndex);
+			bodyState.sleepingRoot = GetBodyIndex(body->sleeping.root);
+			bodyState.sleepingNext = GetBodyIndex(body->sleeping.next);
+			bodyState.position = body->p;
+			bodyState.velocity = body->v;
+			bodyState.velocityBias = body->v_bias;
+			bodyState.force = body->f;
+			bodyState.angle = body->a;
+			bodyState.angularVelocity = body->w;
+			bodyState.angularVelocityBias = body->w_bias;
+			bodyState.torque = body->t;
+			bodyState.idleTime = body->sleeping.idleTime;
+
+			std::memcpy(bodyStates, &bodyState, sizeof(bodyState));
+			bodyStates += sizeof(bodyState);
+		}
+
+		UInt8* arbiterStates = bodyStates;
+		for (cpArbiter* arbiter : arbiters)
+		{
+			ArbiterState arbiterState;
+			std::memset(&arbiterState, 0, sizeof(arbiterState)); //< clear padding bytes, keeping states comparable for delta compression
+			arbiterState.normal = arbiter->n;
+			arbiterState.surfaceVelocity = arbiter->surface_vr;
+			arbiterState.elasticity = arbiter->e;
+			arbiterState.friction = arbiter->u;
+			arbiterState.handler = arbiter->handler;
+			arbiterState.handlerA = arbiter->handlerA;
+			arbiterState.handlerB = arbiter->handlerB;
+			arbiterState.userdata = arbiter->data;
+			arbiterState.shapeA = arbiter->a->hashid;
+			arbiterState.shapeB = arbiter->b->hashid;
+			arbiterState.contactCount = SafeCast<UInt32>(arbiter->count);
+			arbiterState.stampAge = m_handle->stamp - arbiter->stamp;
+			arbiterState.prevArbiterA = FindArbiterIndex(arbiters, arbiter->thread_a.prev);
+			arbiterState.nextArbiterA = FindArbiterIndex(arbiters, arbiter->thread_a.next);
+			arbiterState.prevArbiterB = FindArbiterIndex(arbiters, arbiter->thread_b.prev);
+			arbiterState.nextArbiterB = FindArbiterIndex(arbiters, arbiter->thread_b.next);
+			arbiterState.arbiterState = static_cast<UInt8>(arbiter->state);
+
+			if (arbiter->count > 0)
+				std::memcpy(arbiterState.contacts, arbiter->contacts, arbiter->count * sizeof(cpContact));
+
+			if (arbiter->swapped)
+				arbiterState.flags |= ArbiterStateFlag_Swapped;
+
+			if (IsArbiterThreaded(arbiter, arbiter->body_a))
+				arbiterState.flags |= ArbiterStateFlag_ThreadedA;
+
+			if (IsArbiterThreaded(arbiter, arbiter->body_b))
+				arbiterState.flags |= ArbiterStateFlag_ThreadedB;
+
+			std::memcpy(arbiterStates, &arbiterState, sizeof(arbiterState));
+			arbiterStates += sizeof(arbiterState);
+		}
+
+		// Arbiters used during the last step, in solver order
+		UInt8* activeArbiters = arbiterStates;
+		for (int i = 0; i < m_handle->arbiters->num; ++i)
+		{
+			UInt32 arbiterIndex = FindArbiterIndex(arbiters, static_cast<cpArbiter*>(m_handle->arbiters->arr[i]));
+			std::memcpy(activeArbiters, &arbiterIndex, sizeof(arbiterIndex));
+			activeArbiters += sizeof(arbiterIndex);
+		}
+	}
+
+	/*!
+	* \brief Saves the world state as a delta against a reference state
+	*
+	* Only bytes which changed since the reference state are stored, making it a lot smaller than a full state when few bodies moved.
+	*
+	* \param stateDelta Output delta
+	* \param referenceState Full state (saved by SaveState) to compute the delta against
+	*
+	* \see SaveState
+	*/
+	void PhysWorld2D::SaveState(ByteArray& stateDelta, const ByteArray& referenceState)
+	{
+		SaveState(m_stateBuffer);
+		ComputeDelta(referenceState, m_stateBuffer, stateDelta);
+	}
+
 	void PhysWorld2D::SetDamping(float dampingValue)
 	{
 		cpSpaceSetDamping(m_handle, dampingValue);
@@ -351,6 +987,25 @@ namespace Nz
 		m_stepSize = stepSize;
 	}
 
+	/*!
+	* \brief Changes the number of threads used by the solver
+	*
+	* \param threadCount Number of threads, 0 meaning as many threads as the solver supports
+	*
+	* \remark The world has to be created with a thread count other than one (see Settings)
+	* \remark Chipmunk clamps the thread count to the maximum it supports
+	*/
+	void PhysWorld2D::SetThreadCount(unsigned int threadCount)
+	{
+		if (!m_isMultithreaded)
+		{
+			NazaraError("world was not created as multithreaded");
+			return;
+		}
+
+		cpHastySpaceSetThreads(m_handle, threadCount);
+	}
+
 	void PhysWorld2D::Step(Time timestep)
 	{
 		m_timestepAccumulator += timestep;
@@ -363,7 +1018,10 @@ namespace Nz
 		{
 			OnPhysWorld2DPreStep(this, invStepCount);
 
-			cpSpaceStep(m_handle, dt);
+			if (m_isMultithreaded)
+				cpHastySpaceStep(m_handle, dt);
+			else
+				cpSpaceStep(m_handle, dt);
 
 			OnPhysWorld2DPostStep(this, invStepCount);
 			if (!m_rigidBodyPostSteps.empty())
@@ -19,9 +19,10 @@ namespace Nz
 		}
 	}
 
-	Physics2DSystem::Physics2DSystem(entt::registry& registry) :
+	Physics2DSystem::Physics2DSystem(entt::registry& registry, const Settings& settings) :
 	m_registry(registry),
-	m_physicsConstructObserver(m_registry, entt::collector.group<RigidBody2DComponent, NodeComponent>())
+	m_physicsConstructObserver(m_registry, entt::collector.group<RigidBody2DComponent, NodeComponent>()),
+	m_physWorld(settings)
 	{
 		m_bodyConstructConnection = registry.on_construct<RigidBody2DComponent>().connect<&Physics2DSystem::OnBodyConstruct>(this);
 		m_bodyDestructConnection = registry.on_destroy<RigidBody2DComponent>().connect<&Physics2DSystem::OnBodyDestruct>(this);
@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Physics3D module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#include <Nazara/Physics3D/JoltTaskSchedulerJobSystem.hpp>
+#include <Nazara/Core/Error.hpp>
+#include <thread>
+
+namespace Nz
+{
+	JoltTaskSchedulerJobSystem::JoltTaskSchedulerJobSystem(TaskScheduler& taskScheduler, JPH::uint maxJobs, JPH::uint maxBarriers) :
+	JobSystemWithBarrier(maxBarriers),
+	m_taskScheduler(taskScheduler)
+	{
+		m_jobs.Init(maxJobs, maxJobs);
+	}
+
+	JoltTaskSchedulerJobSystem::~JoltTaskSchedulerJobSystem()
+	{
+		// Jobs may have been run by a barrier before their task, wait for those tasks to release them
+		m_taskScheduler.WaitForTasks(m_taskGroup);
+	}
+
+	auto JoltTaskSchedulerJobSystem::CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies) -> JobHandle
+	{
+		JPH::uint32 jobIndex;
+		for (;;)
+		{
+			jobIndex = m_jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+			if (jobIndex != decltype(m_jobs)::cInvalidObjectIndex)
+				break;
+
+			// Same behavior as Jolt thread pool: wait for a job to be freed
+			NazaraAssertMsg(false, "no Jolt job available, increase maxJobs");
+			std::this_thread::yield();
+		}
+
+		Job* job = &m_jobs.Get(jobIndex);
+
+		JobHandle handle(job);
+		if (inNumDependencies == 0)
+			QueueJob(job);
+
+		return handle;
+	}
+
+	int JoltTaskSchedulerJobSystem::GetMaxConcurrency() const
+	{
+		// The thread waiting on a barrier executes jobs as well
+		return static_cast<int>(m_taskScheduler.GetWorkerCount() + 1);
+	}
+
+	void JoltTaskSchedulerJobSystem::FreeJob(Job* inJob)
+	{
+		m_jobs.DestructObject(inJob);
+	}
+
+	void JoltTaskSchedulerJobSystem::QueueJob(Job* inJob)
+	{
+		// Keep the job alive until its task ran, even if a barrier executed it in the meantime (Execute does nothing in that case)
+		inJob->AddRef();
+
+		m_taskScheduler.AddTask([inJob]
+		{
+			inJob->Execute();
+			inJob->Release();
+		}, &m_taskGroup);
+	}
+
+	void JoltTaskSchedulerJobSystem::QueueJobs(Job** inJobs, JPH::uint inNumJobs)
+	{
+		for (JPH::uint i = 0; i < inNumJobs; ++i)
+			QueueJob(inJobs[i]);
+	}
+}
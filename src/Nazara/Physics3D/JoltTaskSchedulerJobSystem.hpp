@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Physics3D module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+#pragma once
+
+#ifndef NAZARA_PHYSICS3D_JOLTTASKSCHEDULERJOBSYSTEM_HPP
+#define NAZARA_PHYSICS3D_JOLTTASKSCHEDULERJOBSYSTEM_HPP
+
+#include <NazaraUtils/Prerequisites.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+
+namespace Nz
+{
+	// Runs Jolt jobs on a TaskScheduler, so physics shares the application workers instead of spawning its own threads
+	class JoltTaskSchedulerJobSystem final : public JPH::JobSystemWithBarrier
+	{
+		public:
+			JoltTaskSchedulerJobSystem(TaskScheduler& taskScheduler, JPH::uint maxJobs, JPH::uint maxBarriers);
+			JoltTaskSchedulerJobSystem(const JoltTaskSchedulerJobSystem&) = delete;
+			JoltTaskSchedulerJobSystem(JoltTaskSchedulerJobSystem&&) = delete;
+			~JoltTaskSchedulerJobSystem();
+
+			JobHandle CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies = 0) override;
+
+			int GetMaxConcurrency() const override;
+
+			inline TaskScheduler& GetTaskScheduler() const;
+
+			JoltTaskSchedulerJobSystem& operator=(const JoltTaskSchedulerJobSystem&) = delete;
+			JoltTaskSchedulerJobSystem& operator=(JoltTaskSchedulerJobSystem&&) = delete;
+
+		protected:
+			void FreeJob(Job* inJob) override;
+			void QueueJob(Job* inJob) override;
+			void QueueJobs(Job** inJobs, JPH::uint inNumJobs) override;
+
+		private:
+			JPH::FixedSizeFreeList<Job> m_jobs;
+			TaskScheduler& m_taskScheduler;
+			TaskScheduler::TaskGroup m_taskGroup;
+	};
+}
+
+#include <Nazara/Physics3D/JoltTaskSchedulerJobSystem.inl>
+
+#endif // NAZARA_PHYSICS3D_JOLTTASKSCHEDULERJOBSYSTEM_HPP
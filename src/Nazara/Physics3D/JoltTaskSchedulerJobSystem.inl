@@ -0,0 +1,12 @@
+// Copyright (C) 2025 Jérôme "SirLynix" Leclercq (lynix680@gmail.com)
+// This file is part of the "Nazara Engine - Physics3D module"
+// For conditions of distribution and use, see copyright notice in Export.hpp
+
+
+namespace Nz
+{
+	inline TaskScheduler& JoltTaskSchedulerJobSystem::GetTaskScheduler() const
+	{
+		return m_taskScheduler;
+	}
+}
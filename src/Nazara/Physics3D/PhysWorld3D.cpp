@@ -3,6 +3,8 @@
 // For conditions of distribution and use, see copyright notice in Export.hpp
 
 #include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Core/DeltaEncoding.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Physics3D/Collider3D.hpp>
 #include <Nazara/Physics3D/JoltHelper.hpp>
 #include <Nazara/Physics3D/PhysCharacter3D.hpp>
@@ -15,6 +17,7 @@
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsStepListener.h>
 #include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/Physics/StateRecorder.h>
 #include <Jolt/Physics/Body/BodyActivationListener.h>
 #include <Jolt/Physics/Collision/CastResult.h>
 #include <Jolt/Physics/Collision/CollidePointResult.h>
@@ -25,7 +28,9 @@
 #include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
 #include <Jolt/Physics/Collision/Shape/SphereShape.h>
 #include <tsl/ordered_set.h>
+#include <bit>
 #include <cassert>
+#include <cstring>
 
 namespace Nz
 {
@@ -236,6 +241,104 @@ namespace Nz
 				Vector3f m_to;
 				bool m_didHit;
 		};
+
+		class ByteArrayStateReader : public JPH::StateRecorder
+		{
+			public:
+				ByteArrayStateReader(const ByteArray& state) :
+				m_state(state),
+				m_offset(0),
+				m_failed(false)
+				{
+				}
+
+				bool IsEOF() const override
+				{
+					return m_offset >= m_state.GetSize();
+				}
+
+				bool IsFailed() const override
+				{
+					return m_failed;
+				}
+
+				void ReadBytes(void* outData, size_t inNumBytes) override
+				{
+					if (m_failed || inNumBytes > m_state.GetSize() - m_offset)
+					{
+						// Jolt doesn't check for failure after each read, make sure it reads zeroes instead of garbage
+						std::memset(outData, 0, inNumBytes);
+						m_failed = true;
+						return;
+					}
+
+					std::memcpy(outData, m_state.GetConstBuffer() + m_offset, inNumBytes);
+					m_offset += inNumBytes;
+				}
+
+				void WriteBytes(const void* /*inData*/, size_t /*inNumBytes*/) override
+				{
+					m_failed = true;
+				}
+
+			private:
+				const ByteArray& m_state;
+				std::size_t m_offset;
+				bool m_failed;
+		};
+
+		class ByteArrayStateWriter : public JPH::StateRecorder
+		{
+			public:
+				ByteArrayStateWriter(ByteArray& state) :
+				m_state(state)
+				{
+					m_state.Clear(true);
+				}
+
+				bool IsEOF() const override
+				{
+					return true;
+				}
+
+				bool IsFailed() const override
+				{
+					return false;
+				}
+
+				void ReadBytes(void* outData, size_t inNumBytes) override
+				{
+					NazaraAssertMsg(false, "state writer cannot be read");
+					std::memset(outData, 0, inNumBytes);
+				}
+
+				void WriteBytes(const void* inData, size_t inNumBytes) override
+				{
+					m_state.Append(inData, inNumBytes);
+				}
+
+			private:
+				ByteArray& m_state;
+		};
+
+		constexpr std::size_t BatchQueryGrainSize = 64;
+
+		std::size_t RunBatchQuery(TaskScheduler* taskScheduler, std::size_t requestCount, const FunctionRef<std::size_t(std::size_t begin, std::size_t end)>& queryRange)
+		{
+			if (!taskScheduler)
+				taskScheduler = Physics3D::Instance()->GetTaskScheduler();
+
+			if (!taskScheduler || requestCount <= BatchQueryGrainSize)
+				return queryRange(0, requestCount);
+
+			std::atomic_size_t hitCount = 0;
+			taskScheduler->ParallelFor(0, requestCount, BatchQueryGrainSize, [&](std::size_t begin, std::size_t end)
+			{
+				hitCount.fetch_add(queryRange(begin, end), std::memory_order_relaxed);
+			});
+
+			return hitCount.load(std::memory_order_relaxed);
+		}
 	}
 
 	class PhysWorld3D::BodyActivationListener : public JPH::BodyActivationListener
@@ -264,6 +367,9 @@ namespace Nz
 				UInt32 localIndex = bodyIndex % 64;
 
 				m_physWorld.m_activeBodies[blockIndex] &= ~(UInt64(1u) << localIndex);
+
+				// Remember it so its last movement can still be replicated
+				m_physWorld.m_deactivatedBodies[blockIndex] |= UInt64(1u) << localIndex;
 			}
 
 		private:
@@ -477,19 +583,49 @@ namespace Nz
 
 		m_world->physicsSystem.AddStepListener(&m_world->stepListener);
 
-		std::size_t blockCount = (m_world->physicsSystem.GetMaxBodies() - 1) / 64 + 1;
+		m_bodyBlockCount = (m_world->physicsSystem.GetMaxBodies() - 1) / 64 + 1;
 
-		m_activeBodies = std::make_unique<std::atomic_uint64_t[]>(blockCount);
-		for (std::size_t i = 0; i < blockCount; ++i)
+		m_activeBodies = std::make_unique<std::atomic_uint64_t[]>(m_bodyBlockCount);
+		for (std::size_t i = 0; i < m_bodyBlockCount; ++i)
 			m_activeBodies[i] = 0;
 
-		m_registeredBodies = std::make_unique<std::uint64_t[]>(blockCount);
-		for (std::size_t i = 0; i < blockCount; ++i)
+		m_deactivatedBodies = std::make_unique<std::atomic_uint64_t[]>(m_bodyBlockCount);
+		for (std::size_t i = 0; i < m_bodyBlockCount; ++i)
+			m_deactivatedBodies[i] = 0;
+
+		m_registeredBodies = std::make_unique<std::uint64_t[]>(m_bodyBlockCount);
+		for (std::size_t i = 0; i < m_bodyBlockCount; ++i)
 			m_registeredBodies[i] = 0;
 	}
 
 	PhysWorld3D::~PhysWorld3D() = default;
 
+	/*!
+	* \brief Retrieves the index of every body simulated since the last call
+	*
+	* This includes currently active bodies as well as bodies which went to sleep since the last call (so their final transform can be retrieved).
+	* It only goes through the activation bitset, making it much cheaper than checking every body when most of them are sleeping.
+	*
+	* \param bodyIndices Vector receiving the body indices, in increasing order (previous content is cleared)
+	*
+	* \remark This must not be called while the world is being stepped
+	*/
+	void PhysWorld3D::CollectSimulatedBodies(std::vector<UInt32>& bodyIndices)
+	{
+		bodyIndices.clear();
+		for (std::size_t blockIndex = 0; blockIndex < m_bodyBlockCount; ++blockIndex)
+		{
+			UInt64 mask = m_activeBodies[blockIndex].load(std::memory_order_relaxed) | m_deactivatedBodies[blockIndex].exchange(0, std::memory_order_relaxed);
+			while (mask != 0)
+			{
+				unsigned int localIndex = std::countr_zero(mask);
+				mask &= mask - 1;
+
+				bodyIndices.push_back(SafeCast<UInt32>(blockIndex * 64 + localIndex));
+			}
+		}
+	}
+
 	bool PhysWorld3D::CollisionQuery(const Vector3f& point, const FunctionRef<std::optional<float>(const PointCollisionInfo& collisionInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
 	{
 		NAZARA_USE_ANONYMOUS_NAMESPACE
@@ -535,6 +671,70 @@ namespace Nz
 		return collector.DidHit();
 	}
 
+	/*!
+	* \brief Performs a batch of shape collision queries, keeping the deepest hit of each request
+	* \return Number of requests which hit a body
+	*
+	* \param requests Shapes to test against the world
+	* \param hits Output array (must be at least as big as requests), hitBody is set to null for requests which hit nothing
+	* \param taskScheduler Task scheduler used to run the queries in parallel, defaults to the Physics3D task scheduler (queries are run on the calling thread if there's none)
+	*
+	* \remark Filters are called concurrently from multiple threads and must be thread-safe
+	* \remark The world must not be stepped or modified during the call
+	*/
+	std::size_t PhysWorld3D::CollisionQuery(std::span<const CollisionRequest> requests, std::span<ShapeCollisionInfo> hits, TaskScheduler* taskScheduler, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssertMsg(hits.size() >= requests.size(), "hits array is too small ({0} < {1})", hits.size(), requests.size());
+
+		const JPH::BodyLockInterface& bodyLockInterface = m_world->physicsSystem.GetBodyLockInterface();
+		const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_world->physicsSystem.GetNarrowPhaseQuery();
+
+		return RunBatchQuery(taskScheduler, requests.size(), [&](std::size_t begin, std::size_t end) -> std::size_t
+		{
+			JPH::BodyFilter defaultBodyFilter;
+			JPH::BroadPhaseLayerFilter defaultBroadphaseFilter;
+			JPH::ObjectLayerFilter defaultObjectFilter;
+
+			BodyFilterBridge bodyFilterBridge(bodyFilter);
+			BroadphaseLayerFilterBridge broadphaseLayerFilterBridge(broadphaseFilter);
+			ObjectLayerFilterBridge objectLayerFilterBridge(objectLayerFilter);
+
+			JPH::CollideShapeSettings collideShapeSettings;
+
+			std::size_t hitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const CollisionRequest& request = requests[i];
+				NazaraAssertMsg(request.collider, "invalid collider for request #{0}", i);
+
+				ShapeCollisionInfo& hitInfo = hits[i];
+				hitInfo.hitBody = nullptr;
+
+				// Closest hit for shape collisions is the one with the deepest penetration
+				JPH::ClosestHitCollisionCollector<JPH::CollideShapeCollector> collector;
+				narrowPhaseQuery.CollideShape(request.collider->GetShape(), ToJolt(request.scale), ToJolt(request.transform), collideShapeSettings, JPH::Vec3::sZero(), collector, (broadphaseFilter) ? broadphaseLayerFilterBridge : defaultBroadphaseFilter, (objectLayerFilter) ? objectLayerFilterBridge : defaultObjectFilter, (bodyFilter) ? bodyFilterBridge : defaultBodyFilter);
+				if (!collector.HadHit())
+					continue;
+
+				JPH::BodyLockRead lock(bodyLockInterface, collector.mHit.mBodyID2);
+				if (!lock.Succeeded())
+					continue; //< body was destroyed
+
+				hitInfo.hitBody = IntegerToPointer<PhysBody3D*>(lock.GetBody().GetUserData());
+				hitInfo.collisionPosition1 = FromJolt(collector.mHit.mContactPointOn1);
+				hitInfo.collisionPosition2 = FromJolt(collector.mHit.mContactPointOn2);
+				hitInfo.penetrationAxis = FromJolt(collector.mHit.mPenetrationAxis);
+				hitInfo.penetrationDepth = collector.mHit.mPenetrationDepth;
+
+				hitCount++;
+			}
+
+			return hitCount;
+		});
+	}
+
 	UInt32 PhysWorld3D::GetActiveBodyCount() const
 	{
 		return m_world->physicsSystem.GetNumActiveBodies(JPH::EBodyType::RigidBody);
@@ -624,6 +824,74 @@ namespace Nz
 		return true;
 	}
 
+	/*!
+	* \brief Performs a batch of raycasts, keeping the closest hit of each ray
+	* \return Number of rays which hit a body
+	*
+	* \param requests Rays to cast in the world
+	* \param hits Output array (must be at least as big as requests), hitBody is set to null for rays which hit nothing
+	* \param taskScheduler Task scheduler used to run the queries in parallel, defaults to the Physics3D task scheduler (queries are run on the calling thread if there's none)
+	*
+	* \remark Filters are called concurrently from multiple threads and must be thread-safe
+	* \remark The world must not be stepped or modified during the call
+	*/
+	std::size_t PhysWorld3D::RaycastQueryFirst(std::span<const RaycastRequest> requests, std::span<RaycastHit> hits, TaskScheduler* taskScheduler, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		NazaraAssertMsg(hits.size() >= requests.size(), "hits array is too small ({0} < {1})", hits.size(), requests.size());
+
+		const JPH::BodyLockInterface& bodyLockInterface = m_world->physicsSystem.GetBodyLockInterface();
+		const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_world->physicsSystem.GetNarrowPhaseQuery();
+
+		return RunBatchQuery(taskScheduler, requests.size(), [&](std::size_t begin, std::size_t end) -> std::size_t
+		{
+			JPH::BodyFilter defaultBodyFilter;
+			JPH::BroadPhaseLayerFilter defaultBroadphaseFilter;
+			JPH::ObjectLayerFilter defaultObjectFilter;
+
+			BodyFilterBridge bodyFilterBridge(bodyFilter);
+			BroadphaseLayerFilterBridge broadphaseLayerFilterBridge(broadphaseFilter);
+			ObjectLayerFilterBridge objectLayerFilterBridge(objectLayerFilter);
+
+			JPH::RayCastSettings rayCastSettings;
+
+			std::size_t hitCount = 0;
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				const RaycastRequest& request = requests[i];
+
+				RaycastHit& hitInfo = hits[i];
+				hitInfo.hitBody = nullptr;
+
+				JPH::RRayCast rayCast;
+				rayCast.mDirection = ToJolt(request.to - request.from);
+				rayCast.mOrigin = ToJolt(request.from);
+
+				JPH::ClosestHitCollisionCollector<JPH::CastRayCollector> collector;
+				narrowPhaseQuery.CastRay(rayCast, rayCastSettings, collector, (broadphaseFilter) ? broadphaseLayerFilterBridge : defaultBroadphaseFilter, (objectLayerFilter) ? objectLayerFilterBridge : defaultObjectFilter, (bodyFilter) ? bodyFilterBridge : defaultBodyFilter);
+				if (!collector.HadHit())
+					continue;
+
+				JPH::BodyLockRead lock(bodyLockInterface, collector.mHit.mBodyID);
+				if (!lock.Succeeded())
+					continue; //< body was destroyed
+
+				const JPH::Body& body = lock.GetBody();
+
+				hitInfo.fraction = collector.mHit.GetEarlyOutFraction();
+				hitInfo.hitPosition = Lerp(request.from, request.to, hitInfo.fraction);
+				hitInfo.hitBody = IntegerToPointer<PhysBody3D*>(body.GetUserData());
+				hitInfo.hitNormal = FromJolt(body.GetWorldSpaceSurfaceNormal(collector.mHit.mSubShapeID2, rayCast.GetPointOnRay(hitInfo.fraction)));
+				hitInfo.subShapeID = collector.mHit.mSubShapeID2.GetValue();
+
+				hitCount++;
+			}
+
+			return hitCount;
+		});
+	}
+
 	void PhysWorld3D::RefreshBodies()
 	{
 		// Batch add bodies (keeps the broadphase efficient)
@@ -671,6 +939,115 @@ namespace Nz
 		}
 	}
 
+	/*!
+	* \brief Restores the world from a state saved by SaveState
+	* \return True if the state was successfully restored
+	*
+	* Restores the state of every body (transforms, velocities, activation) and the contact cache, as well as the timestep accumulator.
+	*
+	* \param state State to restore
+	*
+	* \remark The world must hold the same bodies as when the state was saved
+	* \remark This must not be called while the world is being stepped
+	*
+	* \see SaveState
+	*/
+	bool PhysWorld3D::RestoreState(const ByteArray& state)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		RefreshBodies();
+
+		ByteArrayStateReader stateReader(state);
+
+		Int64 timestepAccumulator;
+		stateReader.Read(timestepAccumulator);
+
+		if (stateReader.IsFailed() || !m_world->physicsSystem.RestoreState(stateReader) || stateReader.IsFailed())
+		{
+			NazaraError("failed to restore physics state (was it saved with the same bodies?)");
+			return false;
+		}
+
+		m_timestepAccumulator = Time::Nanoseconds(timestepAccumulator);
+
+		// Jolt doesn't trigger activation callbacks when restoring, rebuild activation bitsets from its active list
+		for (std::size_t i = 0; i < m_bodyBlockCount; ++i)
+		{
+			m_activeBodies[i].store(0, std::memory_order_relaxed);
+
+			// Report every body as simulated so their restored transforms get replicated
+			m_deactivatedBodies[i].store(m_registeredBodies[i], std::memory_order_relaxed);
+		}
+
+		JPH::BodyIDVector activeBodies;
+		m_world->physicsSystem.GetActiveBodies(JPH::EBodyType::RigidBody, activeBodies);
+		for (const JPH::BodyID& bodyID : activeBodies)
+		{
+			UInt32 bodyIndex = bodyID.GetIndex();
+			m_activeBodies[bodyIndex / 64].fetch_or(UInt64(1u) << (bodyIndex % 64), std::memory_order_relaxed);
+		}
+
+		return true;
+	}
+
+	/*!
+	* \brief Restores the world from a delta state saved by SaveState
+	* \return True if the state was successfully restored
+	*
+	* \param stateDelta Delta state to restore
+	* \param referenceState Full state the delta was computed against
+	*
+	* \see RestoreState
+	*/
+	bool PhysWorld3D::RestoreState(const ByteArray& stateDelta, const ByteArray& referenceState)
+	{
+		if (!ApplyDelta(referenceState, stateDelta, m_stateBuffer))
+			return false;
+
+		return RestoreState(m_stateBuffer);
+	}
+
+	/*!
+	* \brief Saves the whole world state (bodies and contact cache) into a contiguous buffer
+	*
+	* The saved state can be restored using RestoreState, allowing to rewind and re-simulate the world (e.g. for rollback networking).
+	* Since stepping is deterministic, restoring a state and stepping again will give the same results as the first time.
+	*
+	* \param state Output buffer (previous content is replaced, memory is reused)
+	*
+	* \remark This must not be called while the world is being stepped
+	*
+	* \see RestoreState
+	*/
+	void PhysWorld3D::SaveState(ByteArray& state)
+	{
+		NAZARA_USE_ANONYMOUS_NAMESPACE
+
+		RefreshBodies();
+
+		ByteArrayStateWriter stateWriter(state);
+		stateWriter.Write(m_timestepAccumulator.AsNanoseconds());
+
+		m_world->physicsSystem.SaveState(stateWriter);
+	}
+
+	/*!
+	* \brief Saves the world state as a delta against a reference state
+	*
+	* Only bytes which changed since the reference state are stored, making it a lot smaller than a full state when few bodies changed.
+	*
+	* \param stateDelta Output delta
+	* \param referenceState Full state (saved by SaveState) to compute the delta against
+	*
+	* \see SaveState
+	*/
+	void PhysWorld3D::SaveState(ByteArray& stateDelta, const ByteArray& referenceState)
+	{
+		SaveState(m_stateBuffer);
+		ComputeDelta(referenceState, m_stateBuffer, stateDelta);
+	}
+
 	void PhysWorld3D::SetContactListener(std::unique_ptr<ContactListener> contactListener)
 	{
 		m_world->contactListenerBridge.emplace(m_world->physicsSystem.GetBodyLockInterfaceNoLock(), std::move(contactListener));
@@ -695,7 +1072,7 @@ namespace Nz
 
 		RefreshBodies();
 
-		JPH::JobSystem& jobSystem = Physics3D::Instance()->GetThreadPool();
+		JPH::JobSystem& jobSystem = Physics3D::Instance()->GetJobSystem();
 		float stepSize = m_stepSize.AsSeconds<float>();
 
 		std::size_t stepCount = 0;
@@ -813,6 +1190,9 @@ namespace Nz
 			}
 
 			bodyInterface.DestroyBody(bodyID); //< this invalidate the bodyID reference!
+
+			// Removing the body deactivated it, don't report it as simulated
+			m_deactivatedBodies[bodyIndex / 64] &= ~(UInt64(1u) << (bodyIndex % 64));
 		}
 		else
 			m_world->pendingDeactivations.insert(bodyID);
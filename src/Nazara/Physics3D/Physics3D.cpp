@@ -7,6 +7,7 @@
 #include <Nazara/Core/Error.hpp>
 #include <Nazara/Core/Log.hpp>
 #include <Nazara/Physics3D/Export.hpp>
+#include <Nazara/Physics3D/JoltTaskSchedulerJobSystem.hpp>
 #include <Jolt/Jolt.h>
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
@@ -30,34 +31,59 @@ static void TraceImpl(const char* inFMT, ...)
 
 namespace Nz
 {
-	Physics3D::Physics3D(Config /*config*/) :
-	ModuleBase("Physics3D", this)
+	Physics3D::Physics3D(Config config) :
+	ModuleBase("Physics3D", this),
+	m_taskScheduler(nullptr)
 	{
 		JPH::RegisterDefaultAllocator();
 		JPH::Trace = TraceImpl;
 		JPH::Factory::sInstance = new JPH::Factory;
 		JPH::RegisterTypes();
 
-		int threadCount = -1; //< system CPU core count
-#ifdef NAZARA_PLATFORM_WEB
-		threadCount = 0; // no thread on web for now
-#endif
-
-		m_threadPool = std::make_unique<JPH::JobSystemThreadPool>(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, threadCount);
+		SetTaskScheduler(config.taskScheduler);
 	}
 
 	Physics3D::~Physics3D()
 	{
-		m_threadPool.reset();
+		m_jobSystem.reset();
 		JPH::UnregisterTypes();
 
 		delete JPH::Factory::sInstance;
 		JPH::Factory::sInstance = nullptr;
 	}
 
-	JPH::JobSystem& Physics3D::GetThreadPool()
+	JPH::JobSystem& Physics3D::GetJobSystem()
+	{
+		return *m_jobSystem;
+	}
+
+	/*!
+	* \brief Changes the task scheduler running physics jobs
+	*
+	* \param taskScheduler Task scheduler to use (must outlive the module or be replaced before being destroyed), nullptr to use a dedicated Jolt thread pool
+	*
+	* \remark This must not be called while a physics world is being stepped
+	*/
+	void Physics3D::SetTaskScheduler(TaskScheduler* taskScheduler)
 	{
-		return *m_threadPool;
+		if (m_jobSystem && m_taskScheduler == taskScheduler)
+			return;
+
+		// Destroy the previous job system first, to avoid having both thread pools alive
+		m_jobSystem.reset();
+		m_taskScheduler = taskScheduler;
+
+		if (m_taskScheduler)
+			m_jobSystem = std::make_unique<JoltTaskSchedulerJobSystem>(*m_taskScheduler, JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+		else
+		{
+			int threadCount = -1; //< system CPU core count
+#ifdef NAZARA_PLATFORM_WEB
+			threadCount = 0; // no thread on web for now
+#endif
+
+			m_jobSystem = std::make_unique<JPH::JobSystemThreadPool>(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers, threadCount);
+		}
 	}
 
 	Physics3D* Physics3D::s_instance;
@@ -5,6 +5,8 @@
 #include <Nazara/Physics3D/Systems/Physics3DSystem.hpp>
 #include <Nazara/Core/Components/DisabledComponent.hpp>
 #include <Nazara/Core/Components/NodeComponent.hpp>
+#include <Nazara/Core/EnttParallel.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Physics3D/PhysBody3D.hpp>
 
 namespace Nz
@@ -77,6 +79,41 @@ namespace Nz
 		}, broadphaseFilter, objectLayerFilter, bodyFilter);
 	}
 
+	/*!
+	* \brief Performs a batch of shape collision queries, keeping the deepest hit of each request
+	* \return Number of requests which hit a body
+	*
+	* \param requests Shapes to test against the world
+	* \param hits Output array (must be at least as big as requests), hitBody and hitEntity are reset for requests which hit nothing
+	* \param scratchHits Caller-owned buffer (must be at least as big as requests) the physics world writes to before hits are resolved to entities
+	*
+	* \remark Batches can be issued concurrently as long as they don't share their scratch buffer
+	* \see PhysWorld3D::CollisionQuery
+	*/
+	std::size_t Physics3DSystem::CollisionQuery(std::span<const CollisionRequest> requests, std::span<ShapeCollisionInfo> hits, std::span<PhysWorld3D::ShapeCollisionInfo> scratchHits, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
+	{
+		NazaraAssertMsg(hits.size() >= requests.size(), "hits array is too small ({0} < {1})", hits.size(), requests.size());
+		NazaraAssertMsg(scratchHits.size() >= requests.size(), "scratch hits array is too small ({0} < {1})", scratchHits.size(), requests.size());
+
+		std::size_t hitCount = m_physWorld.CollisionQuery(requests, scratchHits, GetEnttTaskScheduler(m_registry), broadphaseFilter, objectLayerFilter, bodyFilter);
+
+		for (std::size_t i = 0; i < requests.size(); ++i)
+		{
+			ShapeCollisionInfo& extendedHitInfo = hits[i];
+			static_cast<PhysWorld3D::ShapeCollisionInfo&>(extendedHitInfo) = scratchHits[i];
+			extendedHitInfo.hitEntity = {};
+
+			if (extendedHitInfo.hitBody)
+			{
+				std::size_t bodyIndex = extendedHitInfo.hitBody->GetBodyIndex();
+				if (bodyIndex < m_bodyIndicesToEntity.size())
+					extendedHitInfo.hitEntity = entt::handle(m_registry, m_bodyIndicesToEntity[bodyIndex]);
+			}
+		}
+
+		return hitCount;
+	}
+
 	bool Physics3DSystem::RaycastQuery(const Vector3f& from, const Vector3f& to, const FunctionRef<std::optional<float>(const RaycastHit& hitInfo)>& callback, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
 	{
 		return m_physWorld.RaycastQuery(from, to, [&](const PhysWorld3D::RaycastHit& hitInfo)
@@ -113,6 +150,41 @@ namespace Nz
 		}, broadphaseFilter, objectLayerFilter, bodyFilter);
 	}
 
+	/*!
+	* \brief Performs a batch of raycasts, keeping the closest hit of each ray
+	* \return Number of rays which hit a body
+	*
+	* \param requests Rays to cast in the world
+	* \param hits Output array (must be at least as big as requests), hitBody and hitEntity are reset for rays which hit nothing
+	* \param scratchHits Caller-owned buffer (must be at least as big as requests) the physics world writes to before hits are resolved to entities
+	*
+	* \remark Batches can be issued concurrently as long as they don't share their scratch buffer
+	* \see PhysWorld3D::RaycastQueryFirst
+	*/
+	std::size_t Physics3DSystem::RaycastQueryFirst(std::span<const RaycastRequest> requests, std::span<RaycastHit> hits, std::span<PhysWorld3D::RaycastHit> scratchHits, const PhysBroadphaseLayerFilter3D* broadphaseFilter, const PhysObjectLayerFilter3D* objectLayerFilter, const PhysBodyFilter3D* bodyFilter)
+	{
+		NazaraAssertMsg(hits.size() >= requests.size(), "hits array is too small ({0} < {1})", hits.size(), requests.size());
+		NazaraAssertMsg(scratchHits.size() >= requests.size(), "scratch hits array is too small ({0} < {1})", scratchHits.size(), requests.size());
+
+		std::size_t hitCount = m_physWorld.RaycastQueryFirst(requests, scratchHits, GetEnttTaskScheduler(m_registry), broadphaseFilter, objectLayerFilter, bodyFilter);
+
+		for (std::size_t i = 0; i < requests.size(); ++i)
+		{
+			RaycastHit& extendedHitInfo = hits[i];
+			static_cast<PhysWorld3D::RaycastHit&>(extendedHitInfo) = scratchHits[i];
+			extendedHitInfo.hitEntity = {};
+
+			if (extendedHitInfo.hitBody)
+			{
+				std::size_t bodyIndex = extendedHitInfo.hitBody->GetBodyIndex();
+				if (bodyIndex < m_bodyIndicesToEntity.size())
+					extendedHitInfo.hitEntity = entt::handle(m_registry, m_bodyIndicesToEntity[bodyIndex]);
+			}
+		}
+
+		return hitCount;
+	}
+
 	void Physics3DSystem::SetContactListener(std::unique_ptr<ContactListener> contactListener)
 	{
 		class ContactListenerBridge : public PhysWorld3D::ContactListener
@@ -184,8 +256,7 @@ namespace Nz
 		if (!m_physWorld.Step(elapsedTime))
 			return; // No physics step took place
 
-		ReplicateEntities<PhysCharacter3DComponent>();
-		ReplicateEntities<RigidBody3DComponent>();
+		ReplicateEntities();
 	}
 
 	void Physics3DSystem::OnBodyConstruct(entt::registry& registry, entt::entity entity)
@@ -233,59 +304,157 @@ namespace Nz
 		m_bodyIndicesToEntity[uniqueIndex] = entt::null;
 	}
 
-	template<typename T>
 	void Physics3DSystem::ReplicateEntities()
 	{
-		auto view = m_registry.view<NodeComponent, T>(entt::exclude<DisabledComponent>);
-		for (auto entity : view)
+		// Only go through bodies simulated since last replication instead of every physics entity, as most of them are usually sleeping
+		m_physWorld.CollectSimulatedBodies(m_simulatedBodies);
+
+		auto& characterStorage = m_registry.storage<PhysCharacter3DComponent>();
+		auto& disabledStorage = m_registry.storage<DisabledComponent>();
+		auto& nodeStorage = m_registry.storage<NodeComponent>();
+		auto& rigidBodyStorage = m_registry.storage<RigidBody3DComponent>();
+
+		// Custom replication callbacks and global replication of child nodes (which reads the parent lazily-updated transform) are handled on this thread,
+		// other replications only touch their own node and can be applied in parallel
+		m_parallelReplications.clear();
+		m_serialReplications.clear();
+		for (UInt32 bodyIndex : m_simulatedBodies)
 		{
-			auto& bodyComponent = view.template get<T>(entity);
-			if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::None || !m_physWorld.IsBodyActive(bodyComponent.GetBodyIndex()))
+			if (bodyIndex >= m_bodyIndicesToEntity.size())
+				break; //< body indices are sorted
+
+			entt::entity entity = m_bodyIndicesToEntity[bodyIndex];
+			if (entity == entt::null || !nodeStorage.contains(entity) || disabledStorage.contains(entity))
 				continue;
 
-			auto& nodeComponent = view.template get<NodeComponent>(entity);
-			auto [position, rotation] = bodyComponent.GetPositionAndRotation();
+			ParallelReplication replication;
+			replication.entity = entity;
+			replication.nodeComponent = &nodeStorage.get(entity);
+			replication.characterComponent = (characterStorage.contains(entity)) ? &characterStorage.get(entity) : nullptr;
+			replication.rigidBodyComponent = (!replication.characterComponent && rigidBodyStorage.contains(entity)) ? &rigidBodyStorage.get(entity) : nullptr;
+
+			PhysicsReplication3D replicationMode;
+			if (replication.characterComponent)
+				replicationMode = replication.characterComponent->GetReplicationMode();
+			else if (replication.rigidBodyComponent)
+				replicationMode = replication.rigidBodyComponent->GetReplicationMode();
+			else
+				continue;
 
-			switch (bodyComponent.GetReplicationMode())
+			switch (replicationMode)
 			{
+				case PhysicsReplication3D::None:
+					break;
+
 				case PhysicsReplication3D::Custom:
 				case PhysicsReplication3D::CustomOnce:
-				{
-					const auto& replicationCallback = bodyComponent.GetReplicationCallback();
-					if NAZARA_LIKELY(replicationCallback)
-						replicationCallback(entt::handle(m_registry, entity), bodyComponent);
-					else
-						NazaraError("physics component has custom replication mode but no callback");
-
-					if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::CustomOnce)
-						bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
-
+					m_serialReplications.push_back(entity);
 					break;
-				}
 
 				case PhysicsReplication3D::Global:
 				case PhysicsReplication3D::GlobalOnce:
-				{
-					nodeComponent.SetGlobalTransform(position, rotation);
-					if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::GlobalOnce)
-						bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
-
+					if (replication.nodeComponent->GetParent())
+						m_serialReplications.push_back(entity);
+					else
+						m_parallelReplications.push_back(replication);
 					break;
-				}
 
 				case PhysicsReplication3D::Local:
 				case PhysicsReplication3D::LocalOnce:
-				{
-					nodeComponent.SetTransform(position, rotation);
-					if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::LocalOnce)
-						bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
-
+					m_parallelReplications.push_back(replication);
 					break;
-				}
+			}
+		}
 
-				case PhysicsReplication3D::None:
-					NAZARA_UNREACHABLE();
+		TaskScheduler* taskScheduler = GetEnttTaskScheduler(m_registry);
+		bool parallel = taskScheduler && m_parallelReplications.size() > EnttParallelDefaultGrainSize;
+
+		// Invalidation triggers signals, nodes can only be invalidated on the fly when replicating from this thread
+		auto ReplicateRange = [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				ParallelReplication& replication = m_parallelReplications[i];
+				if (replication.characterComponent)
+					ReplicateEntity(replication.entity, *replication.characterComponent, *replication.nodeComponent, !parallel);
+				else
+					ReplicateEntity(replication.entity, *replication.rigidBodyComponent, *replication.nodeComponent, !parallel);
+			}
+		};
+
+		if (parallel)
+		{
+			taskScheduler->ParallelFor(0, m_parallelReplications.size(), EnttParallelDefaultGrainSize, ReplicateRange);
+
+			for (ParallelReplication& replication : m_parallelReplications)
+				replication.nodeComponent->Invalidate();
+		}
+		else
+			ReplicateRange(0, m_parallelReplications.size());
+
+		for (entt::entity entity : m_serialReplications)
+		{
+			// Custom replication callbacks may have changed the registry
+			if (!m_registry.valid(entity))
+				continue;
+
+			NodeComponent* nodeComponent = m_registry.try_get<NodeComponent>(entity);
+			if (!nodeComponent)
+				continue;
+
+			if (PhysCharacter3DComponent* characterComponent = m_registry.try_get<PhysCharacter3DComponent>(entity))
+				ReplicateEntity(entity, *characterComponent, *nodeComponent, true);
+			else if (RigidBody3DComponent* rigidBodyComponent = m_registry.try_get<RigidBody3DComponent>(entity))
+				ReplicateEntity(entity, *rigidBodyComponent, *nodeComponent, true);
+		}
+	}
+
+	template<typename T>
+	void Physics3DSystem::ReplicateEntity(entt::entity entity, T& bodyComponent, NodeComponent& nodeComponent, bool invalidateNode)
+	{
+		Node::Invalidation invalidation = (invalidateNode) ? Node::Invalidation::InvalidateRecursively : Node::Invalidation::DontInvalidate;
+
+		switch (bodyComponent.GetReplicationMode())
+		{
+			case PhysicsReplication3D::Custom:
+			case PhysicsReplication3D::CustomOnce:
+			{
+				const auto& replicationCallback = bodyComponent.GetReplicationCallback();
+				if NAZARA_LIKELY(replicationCallback)
+					replicationCallback(entt::handle(m_registry, entity), bodyComponent);
+				else
+					NazaraError("physics component has custom replication mode but no callback");
+
+				if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::CustomOnce)
+					bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
+
+				break;
+			}
+
+			case PhysicsReplication3D::Global:
+			case PhysicsReplication3D::GlobalOnce:
+			{
+				auto [position, rotation] = bodyComponent.GetPositionAndRotation();
+				nodeComponent.SetGlobalTransform(position, rotation, invalidation);
+				if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::GlobalOnce)
+					bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
+
+				break;
 			}
+
+			case PhysicsReplication3D::Local:
+			case PhysicsReplication3D::LocalOnce:
+			{
+				auto [position, rotation] = bodyComponent.GetPositionAndRotation();
+				nodeComponent.SetTransform(position, rotation, invalidation);
+				if (bodyComponent.GetReplicationMode() == PhysicsReplication3D::LocalOnce)
+					bodyComponent.SetReplicationMode(PhysicsReplication3D::None);
+
+				break;
+			}
+
+			case PhysicsReplication3D::None:
+				break; //< may have been changed by a custom replication callback
 		}
 	}
 
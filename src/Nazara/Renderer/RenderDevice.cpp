@@ -43,6 +43,10 @@ namespace Nz
 		NzValidateFeature(anisotropicFiltering, "anistropic filtering feature")
 		NzValidateFeature(computeShaders, "compute shaders feature")
 		NzValidateFeature(depthClamping, "depth clamping feature")
+		NzValidateFeature(drawIndirect, "indirect draw feature")
+		NzValidateFeature(drawIndirectCount, "indirect draw count feature")
+		NzValidateFeature(drawIndirectFirstInstance, "indirect draw first instance feature")
+		NzValidateFeature(multiDrawIndirect, "multi-draw indirect feature")
 		NzValidateFeature(nonSolidFaceFilling, "non-solid face filling feature")
 		NzValidateFeature(storageBuffers, "storage buffers support")
 		NzValidateFeature(textureReadWithoutFormat, "texture read without format")
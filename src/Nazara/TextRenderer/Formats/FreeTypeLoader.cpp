@@ -317,7 +317,8 @@ namespace Nz
 				bool SetFile(const std::filesystem::path& filePath)
 				{
 					std::unique_ptr<File> file = std::make_unique<File>();
-					if (!file->Open(filePath, OpenMode::Read))
+					// FreeType reads glyphs all over the file, map it and let it read straight from memory
+					if (!file->Open(filePath, OpenMode::Read | OpenMode::MemoryMapped | OpenMode::RandomAccess))
 					{
 						NazaraError("failed to open stream from file: {0}", Error::GetLastError());
 						return false;
@@ -343,6 +344,16 @@ namespace Nz
 					m_stream.pos = 0;
 					m_stream.size = SafeCaster(stream.GetSize());
 
+					// A memory-based stream (no read function) lets FreeType access the data without copying it
+					if (stream.IsMemoryMapped())
+					{
+						if (const void* ptr = stream.GetMappedPointer())
+						{
+							m_stream.base = static_cast<unsigned char*>(const_cast<void*>(ptr));
+							m_stream.read = nullptr;
+						}
+					}
+
 					m_args.driver = nullptr;
 					m_args.flags = FT_OPEN_STREAM;
 					m_args.stream = &m_stream;
@@ -59,6 +59,10 @@ namespace Nz
 		deviceInfo.features.computeShaders = true;
 		deviceInfo.features.depthClamping = physDevice.features.depthClamp;
 		deviceInfo.features.drawBaseVertex = true;
+		deviceInfo.features.drawIndirect = true;
+		deviceInfo.features.drawIndirectCount = physDevice.extensions.count(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME) != 0;
+		deviceInfo.features.drawIndirectFirstInstance = physDevice.features.drawIndirectFirstInstance;
+		deviceInfo.features.multiDrawIndirect = physDevice.features.multiDrawIndirect;
 		deviceInfo.features.nonSolidFaceFilling = physDevice.features.fillModeNonSolid;
 		deviceInfo.features.storageBuffers = true;
 		deviceInfo.features.textureReadWithoutFormat = physDevice.features.shaderStorageImageReadWithoutFormat;
@@ -565,6 +569,9 @@ namespace Nz
 				EnableIfSupported(VK_KHR_BIND_MEMORY_2_EXTENSION_NAME);
 				EnableIfSupported(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);
 			}
+
+			if (enabledFeatures.drawIndirectCount)
+				enabledExtensions.emplace_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
 		}
 
 		std::vector<std::string> additionalExtensions; // Just to keep the String alive
@@ -590,6 +597,12 @@ namespace Nz
 		if (enabledFeatures.depthClamping)
 			deviceFeatures.depthClamp = VK_TRUE;
 
+		if (enabledFeatures.drawIndirectFirstInstance)
+			deviceFeatures.drawIndirectFirstInstance = VK_TRUE;
+
+		if (enabledFeatures.multiDrawIndirect)
+			deviceFeatures.multiDrawIndirect = VK_TRUE;
+
 		if (enabledFeatures.nonSolidFaceFilling)
 			deviceFeatures.fillModeNonSolid = VK_TRUE;
 
@@ -6,6 +6,7 @@
 #include <Nazara/Core/PixelFormat.hpp>
 #include <Nazara/VulkanRenderer/VulkanBuffer.hpp>
 #include <Nazara/VulkanRenderer/VulkanComputePipeline.hpp>
+#include <Nazara/VulkanRenderer/VulkanDevice.hpp>
 #include <Nazara/VulkanRenderer/VulkanRenderPass.hpp>
 #include <Nazara/VulkanRenderer/VulkanRenderPipeline.hpp>
 #include <Nazara/VulkanRenderer/VulkanRenderPipelineLayout.hpp>
@@ -353,6 +354,55 @@ namespace Nz
 		m_commandBuffer.DrawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 	}
 
+	void VulkanCommandBufferBuilder::DrawIndexedIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride)
+	{
+		const VulkanBuffer& vkBuffer = SafeCast<const VulkanBuffer&>(indirectBuffer);
+
+		if (drawCount <= 1 || IsMultiDrawIndirectEnabled())
+			m_commandBuffer.DrawIndexedIndirect(vkBuffer.GetBuffer(), offset, drawCount, stride);
+		else
+		{
+			// Without the multiDrawIndirect feature, drawCount must be 0 or 1
+			for (UInt32 i = 0; i < drawCount; ++i)
+				m_commandBuffer.DrawIndexedIndirect(vkBuffer.GetBuffer(), offset + UInt64(i) * stride, 1, stride);
+		}
+	}
+
+	void VulkanCommandBufferBuilder::DrawIndexedIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride)
+	{
+		if NAZARA_UNLIKELY(!m_commandBuffer.GetPool().GetDevice()->IsExtensionLoaded(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME))
+			throw std::runtime_error("indirect draw count is not supported by this device");
+
+		const VulkanBuffer& vkBuffer = SafeCast<const VulkanBuffer&>(indirectBuffer);
+		const VulkanBuffer& vkCountBuffer = SafeCast<const VulkanBuffer&>(countBuffer);
+
+		m_commandBuffer.DrawIndexedIndirectCount(vkBuffer.GetBuffer(), offset, vkCountBuffer.GetBuffer(), countOffset, maxDrawCount, stride);
+	}
+
+	void VulkanCommandBufferBuilder::DrawIndirect(const RenderBuffer& indirectBuffer, UInt64 offset, UInt32 drawCount, UInt32 stride)
+	{
+		const VulkanBuffer& vkBuffer = SafeCast<const VulkanBuffer&>(indirectBuffer);
+
+		if (drawCount <= 1 || IsMultiDrawIndirectEnabled())
+			m_commandBuffer.DrawIndirect(vkBuffer.GetBuffer(), offset, drawCount, stride);
+		else
+		{
+			for (UInt32 i = 0; i < drawCount; ++i)
+				m_commandBuffer.DrawIndirect(vkBuffer.GetBuffer(), offset + UInt64(i) * stride, 1, stride);
+		}
+	}
+
+	void VulkanCommandBufferBuilder::DrawIndirectCount(const RenderBuffer& indirectBuffer, UInt64 offset, const RenderBuffer& countBuffer, UInt64 countOffset, UInt32 maxDrawCount, UInt32 stride)
+	{
+		if NAZARA_UNLIKELY(!m_commandBuffer.GetPool().GetDevice()->IsExtensionLoaded(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME))
+			throw std::runtime_error("indirect draw count is not supported by this device");
+
+		const VulkanBuffer& vkBuffer = SafeCast<const VulkanBuffer&>(indirectBuffer);
+		const VulkanBuffer& vkCountBuffer = SafeCast<const VulkanBuffer&>(countBuffer);
+
+		m_commandBuffer.DrawIndirectCount(vkBuffer.GetBuffer(), offset, vkCountBuffer.GetBuffer(), countOffset, maxDrawCount, stride);
+	}
+
 	void VulkanCommandBufferBuilder::EndDebugRegion()
 	{
 		m_commandBuffer.EndDebugRegion();
@@ -418,4 +468,10 @@ namespace Nz
 
 		m_commandBuffer.ImageBarrier(ToVulkan(srcStageMask), ToVulkan(dstStageMask), VkDependencyFlags(0), ToVulkan(srcAccessMask), ToVulkan(dstAccessMask), ToVulkan(oldLayout), ToVulkan(newLayout), vkTexture.GetImage(), vkTexture.GetSubresourceRange());
 	}
+
+	bool VulkanCommandBufferBuilder::IsMultiDrawIndirectEnabled() const
+	{
+		const VulkanDevice& device = SafeCast<const VulkanDevice&>(*m_commandBuffer.GetPool().GetDevice());
+		return device.GetEnabledFeatures().multiDrawIndirect;
+	}
 }
@@ -33,6 +33,8 @@ namespace Nz
 
 		std::pair<VkRenderPass, std::size_t> key = { renderPassHandle, colorAttachmentCount };
 
+		std::lock_guard lock(m_pipelineMutex);
+
 		if (auto it = m_pipelines.find(key); it != m_pipelines.end())
 			return it->second.pipeline;
 
@@ -44,6 +46,7 @@ namespace Nz
 		PipelineData pipelineData;
 		pipelineData.onRenderPassRelease.Connect(renderPass.OnRenderPassRelease, [this, key](const VulkanRenderPass*)
 		{
+			std::lock_guard lock(m_pipelineMutex);
 			m_pipelines.erase(key);
 		});
 
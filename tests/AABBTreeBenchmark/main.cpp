@@ -0,0 +1,98 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Graphics/AABBTree.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t BoxCount = 200'000;
+	constexpr std::size_t MovingBoxCount = 5'000;
+	constexpr std::size_t FrameCount = 100;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_real_distribution<float> positionDis(-1000.f, 1000.f);
+	std::uniform_real_distribution<float> sizeDis(0.5f, 5.f);
+	std::uniform_real_distribution<float> velocityDis(-1.f, 1.f);
+
+	std::vector<Nz::Boxf> boxes;
+	boxes.reserve(BoxCount);
+	for (std::size_t i = 0; i < BoxCount; ++i)
+		boxes.emplace_back(positionDis(randEngine), positionDis(randEngine), positionDis(randEngine), sizeDis(randEngine), sizeDis(randEngine), sizeDis(randEngine));
+
+	// The first boxes are the moving ones, shuffle indices so they're spread in the tree
+	std::vector<std::size_t> insertionOrder(BoxCount);
+	std::iota(insertionOrder.begin(), insertionOrder.end(), std::size_t(0));
+	std::shuffle(insertionOrder.begin(), insertionOrder.end(), randEngine);
+
+	std::vector<Nz::Vector3f> velocities(MovingBoxCount);
+	for (Nz::Vector3f& velocity : velocities)
+		velocity = Nz::Vector3f(velocityDis(randEngine), velocityDis(randEngine), velocityDis(randEngine));
+
+	Nz::AABBTree tree;
+	std::vector<Nz::UInt32> proxies(BoxCount);
+
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (std::size_t index : insertionOrder)
+		proxies[index] = tree.Insert(boxes[index], index);
+	Nz::Time insertTime = Nz::GetElapsedNanoseconds() - start;
+
+	Nz::Time moveTime = Nz::Time::Zero();
+	Nz::Time treeCullTime = Nz::Time::Zero();
+	Nz::Time bruteForceTime = Nz::Time::Zero();
+	std::size_t reinsertionCount = 0;
+	std::size_t treeVisibleCount = 0;
+	std::size_t bruteForceVisibleCount = 0;
+	for (std::size_t frame = 0; frame < FrameCount; ++frame)
+	{
+		Nz::RadianAnglef cameraAngle(frame * 0.05f);
+		Nz::Frustumf frustum = Nz::Frustumf::Build(Nz::DegreeAnglef(70.f), 16.f / 9.f, 1.f, 500.f, Nz::Vector3f::Zero(), Nz::Vector3f(cameraAngle.GetCos(), 0.f, cameraAngle.GetSin()));
+
+		for (std::size_t i = 0; i < MovingBoxCount; ++i)
+		{
+			boxes[i].x += velocities[i].x;
+			boxes[i].y += velocities[i].y;
+			boxes[i].z += velocities[i].z;
+		}
+
+		start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < MovingBoxCount; ++i)
+		{
+			if (tree.Move(proxies[i], boxes[i]))
+				reinsertionCount++;
+		}
+		moveTime += Nz::GetElapsedNanoseconds() - start;
+
+		start = Nz::GetElapsedNanoseconds();
+		tree.Cull(frustum, [&](std::size_t /*userData*/, bool /*isFullyInside*/)
+		{
+			treeVisibleCount++;
+		});
+		treeCullTime += Nz::GetElapsedNanoseconds() - start;
+
+		start = Nz::GetElapsedNanoseconds();
+		for (const Nz::Boxf& box : boxes)
+		{
+			if (frustum.Intersect(box) != Nz::IntersectionSide::Outside)
+				bruteForceVisibleCount++;
+		}
+		bruteForceTime += Nz::GetElapsedNanoseconds() - start;
+	}
+
+	std::cout << "AABBTree::Insert: " << insertTime.AsMicroseconds() << "us for " << BoxCount << " boxes (height: " << tree.GetHeight() << ")" << std::endl;
+	std::cout << "AABBTree::Move: " << moveTime.AsMicroseconds() / Nz::Int64(FrameCount) << "us per " << MovingBoxCount << " moving boxes (" << reinsertionCount / FrameCount << " reinsertions per frame)" << std::endl;
+	std::cout << "AABBTree::Cull: " << treeCullTime.AsMicroseconds() / Nz::Int64(FrameCount) << "us per frame (" << treeVisibleCount / FrameCount << " visible boxes, fat boxes included)" << std::endl;
+	std::cout << "Frustum::Intersect: " << bruteForceTime.AsMicroseconds() / Nz::Int64(FrameCount) << "us per frame (" << bruteForceVisibleCount / FrameCount << " visible boxes)" << std::endl;
+	std::cout << "AABBTree total (Move + Cull): " << (moveTime + treeCullTime).AsMicroseconds() / Nz::Int64(FrameCount) << "us per frame" << std::endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,3 @@
+target("AABBTreeBenchmark")
+	add_deps("NazaraGraphics")
+	add_files("main.cpp")
@@ -0,0 +1,106 @@
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/VirtualDirectory.hpp>
+#include <Nazara/Core/VirtualDirectoryArchiveResolver.hpp>
+#include <Nazara/Core/VirtualDirectoryFilesystemResolver.hpp>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t DirectoryCount = 50;
+	constexpr std::size_t FilePerDirectory = 200;
+
+	Nz::ByteArray GenerateContent(std::mt19937& rand, std::size_t size, bool compressible)
+	{
+		std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+		Nz::ByteArray content(size, 0);
+		for (std::size_t i = 0; i < size; ++i)
+			content[i] = static_cast<Nz::UInt8>((compressible) ? (i / 64) % 7 : byteDis(rand));
+
+		return content;
+	}
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::mt19937 rand(1337);
+	std::uniform_int_distribution<std::size_t> sizeDis(256, 16 * 1024);
+
+	// Generate a loose asset tree (similar to what a game would ship)
+	std::filesystem::path looseDir = "ArchiveBenchmark";
+	std::filesystem::remove_all(looseDir);
+
+	Nz::ArchiveBuilder builder;
+	for (std::size_t i = 0; i < DirectoryCount; ++i)
+	{
+		std::filesystem::path dirPath = looseDir / ("Dir" + std::to_string(i / 10)) / ("Sub" + std::to_string(i));
+		std::filesystem::create_directories(dirPath);
+
+		for (std::size_t j = 0; j < FilePerDirectory; ++j)
+		{
+			Nz::ByteArray content = GenerateContent(rand, sizeDis(rand), j % 2 == 0);
+			if (!Nz::File::WriteWhole(dirPath / ("File" + std::to_string(j) + ".bin"), content.GetConstBuffer(), content.GetSize()))
+			{
+				std::cerr << "failed to write loose files" << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	Nz::ArchiveBuilder compressedBuilder;
+	if (!builder.AddDirectory(looseDir) || !builder.Save("ArchiveBenchmark.nzpk") ||
+	    !compressedBuilder.AddDirectory(looseDir, Nz::ArchiveCompression::LZ4) || !compressedBuilder.Save("ArchiveBenchmarkLZ4.nzpk"))
+	{
+		std::cerr << "failed to build archives" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	auto Measure = [&](const char* name, std::shared_ptr<Nz::VirtualDirectoryResolver> resolver)
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+
+		std::shared_ptr<Nz::VirtualDirectory> virtualDir = std::make_shared<Nz::VirtualDirectory>(std::move(resolver));
+
+		std::size_t fileCount = 0;
+		Nz::UInt64 totalSize = 0;
+		auto Traverse = [&](auto&& self, Nz::VirtualDirectory& directory) -> void
+		{
+			directory.ForEach([&](std::string_view /*name*/, const Nz::VirtualDirectory::Entry& entry)
+			{
+				if (const auto* dirEntry = std::get_if<Nz::VirtualDirectory::DirectoryEntry>(&entry))
+					self(self, *dirEntry->directory);
+				else if (const auto* fileEntry = std::get_if<Nz::VirtualDirectory::FileEntry>(&entry))
+				{
+					Nz::Stream& stream = *fileEntry->stream;
+
+					std::vector<Nz::UInt8> content(stream.GetSize());
+					totalSize += stream.Read(content.data(), content.size());
+					fileCount++;
+				}
+			});
+		};
+		Traverse(Traverse, *virtualDir);
+
+		Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+
+		std::cout << name << ": " << fileCount << "/" << DirectoryCount * FilePerDirectory << " files (" << totalSize << " bytes) enumerated and loaded in " << elapsed.AsMilliseconds() << "ms" << std::endl;
+	};
+
+	Measure("Loose files", std::make_shared<Nz::VirtualDirectoryFilesystemResolver>(looseDir));
+	Measure("Archive", Nz::VirtualDirectoryArchiveResolver::Open("ArchiveBenchmark.nzpk"));
+	Measure("Archive (LZ4)", Nz::VirtualDirectoryArchiveResolver::Open("ArchiveBenchmarkLZ4.nzpk"));
+
+	std::filesystem::remove_all(looseDir);
+
+	return EXIT_SUCCESS;
+}
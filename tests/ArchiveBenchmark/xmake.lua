@@ -0,0 +1,3 @@
+target("ArchiveBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,166 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Snapshot-like datagrams: entity ids followed by slowly changing quantized positions
+	std::vector<Nz::ByteArray> GenerateTraffic(unsigned int seed, std::size_t packetCount)
+	{
+		std::mt19937 randomGenerator(seed);
+
+		std::vector<Nz::ByteArray> packets;
+		packets.reserve(packetCount);
+		for (std::size_t i = 0; i < packetCount; ++i)
+		{
+			Nz::ByteArray packet;
+
+			std::size_t entityCount = 10 + randomGenerator() % 40;
+			for (std::size_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+			{
+				Nz::UInt16 entityId = static_cast<Nz::UInt16>(entityIndex * 3);
+				packet.PushBack(0x02);
+				packet.PushBack(static_cast<Nz::UInt8>(entityId & 0xFF));
+				packet.PushBack(static_cast<Nz::UInt8>(entityId >> 8));
+
+				for (std::size_t axis = 0; axis < 3; ++axis)
+				{
+					Nz::Int32 position = static_cast<Nz::Int32>(1000 * entityIndex + randomGenerator() % 64);
+					for (std::size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+						packet.PushBack(static_cast<Nz::UInt8>(position >> (8 * byteIndex)));
+				}
+			}
+
+			packets.push_back(std::move(packet));
+		}
+
+		return packets;
+	}
+
+	// Captures are a sequence of datagrams, each prefixed by its size as a little-endian 16bits integer
+	std::vector<Nz::ByteArray> LoadCapture(const std::filesystem::path& capturePath)
+	{
+		std::ifstream file(capturePath, std::ios::binary);
+
+		std::vector<Nz::ByteArray> packets;
+		for (;;)
+		{
+			Nz::UInt8 sizeBytes[2];
+			if (!file.read(reinterpret_cast<char*>(sizeBytes), sizeof(sizeBytes)))
+				break;
+
+			Nz::ByteArray packet(sizeBytes[0] | (sizeBytes[1] << 8));
+			if (!file.read(reinterpret_cast<char*>(packet.GetBuffer()), packet.GetSize()))
+				break;
+
+			packets.push_back(std::move(packet));
+		}
+
+		return packets;
+	}
+}
+
+int main()
+{
+	Nz::Modules<Nz::Network> network;
+
+	// Uses recorded captures when available, synthetic traffic otherwise
+	std::vector<Nz::ByteArray> trainingPackets;
+	std::vector<Nz::ByteArray> packets;
+
+	std::filesystem::path captureDir = "assets/unittests/Network/Captures";
+	if (!std::filesystem::is_directory(captureDir) && std::filesystem::is_directory("../.." / captureDir))
+		captureDir = "../.." / captureDir;
+
+	if (std::filesystem::is_directory(captureDir))
+	{
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(captureDir))
+		{
+			std::vector<Nz::ByteArray> capture = LoadCapture(entry.path());
+
+			// Train on the first half of each capture, measure on the other
+			std::size_t half = capture.size() / 2;
+			trainingPackets.insert(trainingPackets.end(), capture.begin(), capture.begin() + half);
+			packets.insert(packets.end(), capture.begin() + half, capture.end());
+		}
+	}
+
+	if (packets.empty())
+	{
+		trainingPackets = GenerateTraffic(1, 1'000);
+		packets = GenerateTraffic(2, 10'000);
+	}
+
+	std::size_t inputSize = 0;
+	for (const Nz::ByteArray& packet : packets)
+		inputSize += packet.GetSize();
+
+	std::vector<Nz::UInt8> compressed(packets.size() * Nz::ENetConstants::ENetProtocol_MaximumMTU);
+	std::vector<std::size_t> compressedSizes(packets.size());
+	std::vector<Nz::UInt8> decompressed(Nz::ENetConstants::ENetProtocol_MaximumMTU);
+
+	auto Measure = [&](const char* name, Nz::ENetCompressor& compressor, Nz::ENetCompressor& decompressor)
+	{
+		std::size_t failureCount = 0;
+		std::size_t outputSize = 0;
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < packets.size(); ++i)
+		{
+			Nz::NetBuffer buffer = { const_cast<Nz::UInt8*>(packets[i].GetConstBuffer()), packets[i].GetSize() };
+			compressedSizes[i] = compressor.Compress(nullptr, &buffer, 1, packets[i].GetSize(), &compressed[i * Nz::ENetConstants::ENetProtocol_MaximumMTU], Nz::ENetConstants::ENetProtocol_MaximumMTU);
+
+			// Incompressible datagrams are sent as is
+			outputSize += (compressedSizes[i] > 0) ? compressedSizes[i] : packets[i].GetSize();
+		}
+		Nz::Time compressionTime = Nz::GetElapsedNanoseconds() - start;
+
+		start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < packets.size(); ++i)
+		{
+			if (compressedSizes[i] > 0 && decompressor.Decompress(nullptr, &compressed[i * Nz::ENetConstants::ENetProtocol_MaximumMTU], compressedSizes[i], decompressed.data(), decompressed.size()) != packets[i].GetSize())
+				failureCount++;
+		}
+		Nz::Time decompressionTime = Nz::GetElapsedNanoseconds() - start;
+
+		if (failureCount > 0)
+			std::cout << name << ": " << failureCount << " datagrams failed to decompress" << std::endl;
+
+		double megabytes = inputSize / 1'000'000.0;
+		std::cout << name << ": ratio " << static_cast<double>(outputSize) / inputSize
+		          << ", compression " << megabytes / compressionTime.AsSeconds<double>() << "MB/s"
+		          << ", decompression " << megabytes / decompressionTime.AsSeconds<double>() << "MB/s" << std::endl;
+	};
+
+	std::cout << packets.size() << " datagrams, " << inputSize << " bytes" << std::endl;
+
+	{
+		Nz::ENetLZCompressor compressor;
+		Nz::ENetLZCompressor decompressor;
+		Measure("ENetLZCompressor", compressor, decompressor);
+	}
+
+	{
+		Nz::ENetRangeCoderCompressor compressor;
+		Nz::ENetRangeCoderCompressor decompressor;
+		Measure("ENetRangeCoderCompressor", compressor, decompressor);
+	}
+
+	{
+		std::shared_ptr<Nz::ENetRangeCoderCompressor::Dictionary> dictionary = Nz::ENetRangeCoderCompressor::TrainDictionary(trainingPackets);
+
+		Nz::ENetRangeCoderCompressor compressor(dictionary);
+		Nz::ENetRangeCoderCompressor decompressor(dictionary);
+		Measure("ENetRangeCoderCompressor (dictionary)", compressor, decompressor);
+	}
+
+	return EXIT_SUCCESS;
+}
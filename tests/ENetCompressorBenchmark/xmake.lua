@@ -0,0 +1,3 @@
+target("ENetCompressorBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
@@ -0,0 +1,81 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Math/Frustum.hpp>
+#include <bit>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t BoxCount = 1'000'000;
+	constexpr std::size_t RunCount = 20;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::minstd_rand randEngine(42);
+	std::uniform_real_distribution<float> positionDis(-200.f, 200.f);
+	std::uniform_real_distribution<float> sizeDis(0.f, 20.f);
+
+	std::vector<Nz::Boxf> boxes;
+	std::vector<float> x, y, z;
+	std::vector<float> width, height, depth;
+	for (std::size_t i = 0; i < BoxCount; ++i)
+	{
+		Nz::Boxf box(positionDis(randEngine), positionDis(randEngine), positionDis(randEngine), sizeDis(randEngine), sizeDis(randEngine), sizeDis(randEngine));
+
+		boxes.push_back(box);
+		x.push_back(box.x);
+		y.push_back(box.y);
+		z.push_back(box.z);
+		width.push_back(box.width);
+		height.push_back(box.height);
+		depth.push_back(box.depth);
+	}
+
+	Nz::Frustumf::BoxBatch boxBatch;
+	boxBatch.x = x.data();
+	boxBatch.y = y.data();
+	boxBatch.z = z.data();
+	boxBatch.width = width.data();
+	boxBatch.height = height.data();
+	boxBatch.depth = depth.data();
+	boxBatch.count = BoxCount;
+
+	Nz::Frustumf frustum = Nz::Frustumf::Build(Nz::DegreeAnglef(90.f), 1.f, 1.f, 1000.f, Nz::Vector3f::Zero(), Nz::Vector3f::UnitX());
+
+	std::size_t scalarVisibleCount = 0;
+	Nz::Time start = Nz::GetElapsedNanoseconds();
+	for (std::size_t run = 0; run < RunCount; ++run)
+	{
+		for (const Nz::Boxf& box : boxes)
+		{
+			if (frustum.Intersect(box) != Nz::IntersectionSide::Outside)
+				scalarVisibleCount++;
+		}
+	}
+	Nz::Time scalarTime = Nz::GetElapsedNanoseconds() - start;
+
+	std::vector<Nz::UInt64> visibilityMask((BoxCount + 63) / 64);
+
+	std::size_t batchVisibleCount = 0;
+	start = Nz::GetElapsedNanoseconds();
+	for (std::size_t run = 0; run < RunCount; ++run)
+	{
+		frustum.CullBoxes(boxBatch, visibilityMask.data());
+		for (Nz::UInt64 mask : visibilityMask)
+			batchVisibleCount += std::popcount(mask);
+	}
+	Nz::Time batchTime = Nz::GetElapsedNanoseconds() - start;
+
+	if (scalarVisibleCount != batchVisibleCount)
+		std::cout << "visibility mismatch: " << scalarVisibleCount << " boxes visible with Frustum::Intersect, " << batchVisibleCount << " with Frustum::CullBoxes" << std::endl;
+
+	std::cout << "Frustum::Intersect: " << scalarTime.AsMicroseconds() / Nz::Int64(RunCount) << "us per " << BoxCount << " boxes" << std::endl;
+	std::cout << "Frustum::CullBoxes: " << batchTime.AsMicroseconds() / Nz::Int64(RunCount) << "us per " << BoxCount << " boxes" << std::endl;
+
+	return EXIT_SUCCESS;
+}
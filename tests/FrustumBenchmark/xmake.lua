@@ -0,0 +1,3 @@
+target("FrustumBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,469 @@
+// Checks DrawIndirect, DrawIndexedIndirect and their Count variants on every renderer backend
+// Each indirect command draws instances (starting at a non-zero firstInstance) into the cells of an offscreen target,
+// which is then read back by a compute shader and compared to the cells which should have been drawn.
+// Every backend is tested with and without the multiDrawIndirect feature, to go through the per-draw fallbacks.
+
+#include <Nazara/Core.hpp>
+#include <Nazara/Math.hpp>
+#include <Nazara/Platform.hpp>
+#include <Nazara/Renderer.hpp>
+#include <NZSL/Parser.hpp>
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+NAZARA_REQUEST_DEDICATED_GPU()
+
+namespace
+{
+	constexpr Nz::UInt32 GridSize = 8;
+	constexpr Nz::UInt32 CellCount = GridSize * GridSize;
+	constexpr Nz::UInt32 CellPixelSize = 8;
+	constexpr Nz::UInt32 TargetSize = GridSize * CellPixelSize;
+
+	const char drawShaderSource[] = R"(
+[nzsl_version("1.0")]
+module;
+
+struct VertIn
+{
+	[location(0)] pos: vec2[f32],
+	[location(1)] cell: vec2[f32]
+}
+
+struct VertOut
+{
+	[builtin(position)] pos: vec4[f32]
+}
+
+struct FragOut
+{
+	[location(0)] color: vec4[f32]
+}
+
+[entry(frag)]
+fn main() -> FragOut
+{
+	let output: FragOut;
+	output.color = vec4[f32](1.0, 1.0, 1.0, 1.0);
+
+	return output;
+}
+
+[entry(vert)]
+fn main(input: VertIn) -> VertOut
+{
+	// Only covers the center of the cell
+	let cellPos = (input.cell + vec2[f32](0.25, 0.25) + input.pos * 0.5) / 8.0;
+
+	let output: VertOut;
+	output.pos = vec4[f32](cellPos * 2.0 - vec2[f32](1.0, 1.0), 0.0, 1.0);
+
+	return output;
+}
+)";
+
+	const char readbackShaderSource[] = R"(
+[nzsl_version("1.0")]
+module;
+
+[layout(std430)]
+struct Coverage
+{
+	cells: dyn_array[f32]
+}
+
+external
+{
+	[binding(0)] render_target: texture2D[f32, readonly, rgba8],
+	[binding(1)] coverage: storage[Coverage]
+}
+
+struct Input
+{
+	[builtin(global_invocation_indices)] indices: vec3[u32]
+}
+
+[entry(compute)]
+[workgroup(8, 8, 1)]
+fn main(input: Input)
+{
+	let cell = vec2[i32](input.indices.xy);
+	let color = render_target.Read(cell * 8 + vec2[i32](4, 4));
+
+	coverage.cells[cell.y * 8 + cell.x] = color.r;
+}
+)";
+
+	enum class TestResult
+	{
+		Failed,
+		Passed,
+		Skipped
+	};
+
+	struct DrawRange
+	{
+		Nz::UInt32 firstInstance;
+		Nz::UInt32 instanceCount;
+	};
+
+	// Instances are stored in reverse cell order, so a wrong firstInstance ends up in the wrong cell
+	constexpr std::array<DrawRange, 3> s_drawRanges = { { { 0, 2 }, { 5, 1 }, { 10, 3 } } };
+	constexpr std::array<DrawRange, 2> s_drawIndexedRanges = { { { 16, 4 }, { 30, 1 } } };
+	constexpr std::array<DrawRange, 3> s_drawCountRanges = { { { 32, 2 }, { 36, 1 }, { 38, 2 } } };
+	constexpr std::array<DrawRange, 2> s_drawIndexedCountRanges = { { { 44, 2 }, { 50, 2 } } };
+	constexpr std::array<Nz::UInt32, 2> s_drawCounts = { 2, 1 }; //< last command of each Count draw is not executed
+
+	Nz::UInt32 GetInstanceCell(Nz::UInt32 instanceIndex)
+	{
+		return CellCount - 1 - instanceIndex;
+	}
+
+	template<std::size_t N>
+	void MarkDrawnCells(std::vector<bool>& expectedCells, const std::array<DrawRange, N>& ranges, std::size_t drawCount)
+	{
+		for (std::size_t i = 0; i < drawCount; ++i)
+		{
+			for (Nz::UInt32 j = 0; j < ranges[i].instanceCount; ++j)
+				expectedCells[GetInstanceCell(ranges[i].firstInstance + j)] = true;
+		}
+	}
+
+	TestResult RunTest(Nz::RenderAPI api, std::string_view apiName, bool multiDrawIndirect)
+	{
+		std::string testName = std::string(apiName) + ((multiDrawIndirect) ? " with multi-draw" : " without multi-draw");
+
+		Nz::Renderer::Config rendererConfig;
+		rendererConfig.preferredAPI = api;
+
+		Nz::Modules<Nz::Renderer> nazara(rendererConfig);
+
+		Nz::Renderer* renderer = Nz::Renderer::Instance();
+		if (renderer->QueryAPI() != api)
+		{
+			std::cout << testName << ": skipped (renderer is not available)" << std::endl;
+			return TestResult::Skipped;
+		}
+
+		Nz::RenderDeviceFeatures enabledFeatures;
+		enabledFeatures.computeShaders = true;
+		enabledFeatures.drawIndirect = true;
+		enabledFeatures.drawIndirectCount = true;
+		enabledFeatures.drawIndirectFirstInstance = true;
+		enabledFeatures.multiDrawIndirect = multiDrawIndirect;
+		enabledFeatures.storageBuffers = true;
+		enabledFeatures.textureReadWrite = true;
+
+		std::shared_ptr<Nz::RenderDevice> device = renderer->InstanciateRenderDevice(0, enabledFeatures);
+
+		const Nz::RenderDeviceFeatures& features = device->GetEnabledFeatures();
+		if (!features.computeShaders || !features.storageBuffers || !features.textureReadWrite)
+		{
+			std::cout << testName << ": skipped (device cannot read the result back)" << std::endl;
+			return TestResult::Skipped;
+		}
+
+		if (!features.drawIndirect || !features.drawIndirectFirstInstance || features.multiDrawIndirect != multiDrawIndirect)
+		{
+			std::cout << testName << ": skipped (device doesn't support the required indirect draw features)" << std::endl;
+			return TestResult::Skipped;
+		}
+
+		bool testDrawCount = features.drawIndirectCount;
+
+		// Draw pipeline
+		nzsl::Ast::ModulePtr drawShaderModule = nzsl::Parse(std::string_view(drawShaderSource, sizeof(drawShaderSource)));
+		std::shared_ptr<Nz::ShaderModule> drawShader = device->InstantiateShaderModule(nzsl::ShaderStageType::Fragment | nzsl::ShaderStageType::Vertex, *drawShaderModule, {});
+		if (!drawShader)
+		{
+			std::cout << testName << ": failed to instantiate draw shader" << std::endl;
+			return TestResult::Failed;
+		}
+
+		std::shared_ptr<Nz::VertexDeclaration> instanceDeclaration = std::make_shared<Nz::VertexDeclaration>(Nz::VertexInputRate::Instance, std::initializer_list<Nz::VertexDeclaration::ComponentEntry>{
+			{
+				Nz::VertexComponent::Userdata,
+				Nz::ComponentType::Float2,
+				0
+			}
+		});
+
+		Nz::RenderPipelineInfo pipelineInfo;
+		pipelineInfo.pipelineLayout = device->InstantiateRenderPipelineLayout({});
+		pipelineInfo.shaderModules.push_back(drawShader);
+		pipelineInfo.vertexBuffers.push_back({ 0, Nz::VertexDeclaration::Get(Nz::VertexLayout::XY) });
+		pipelineInfo.vertexBuffers.push_back({ 1, instanceDeclaration });
+
+		std::shared_ptr<Nz::RenderPipeline> drawPipeline = device->InstantiateRenderPipeline(std::move(pipelineInfo));
+
+		// Quad vertices used by indexed draws, followed by the same quad as a triangle list for non-indexed draws
+		std::array<Nz::Vector2f, 10> vertices = {
+			Nz::Vector2f(0.f, 0.f), Nz::Vector2f(1.f, 0.f), Nz::Vector2f(0.f, 1.f), Nz::Vector2f(1.f, 1.f),
+			Nz::Vector2f(0.f, 0.f), Nz::Vector2f(1.f, 0.f), Nz::Vector2f(0.f, 1.f), Nz::Vector2f(0.f, 1.f), Nz::Vector2f(1.f, 0.f), Nz::Vector2f(1.f, 1.f)
+		};
+		constexpr Nz::UInt32 firstTriangleVertex = 4;
+
+		std::array<Nz::UInt16, 6> indices = { 0, 1, 2, 2, 1, 3 };
+
+		std::vector<Nz::Vector2f> instanceCells(CellCount);
+		for (Nz::UInt32 i = 0; i < CellCount; ++i)
+		{
+			Nz::UInt32 cell = GetInstanceCell(i);
+			instanceCells[i] = Nz::Vector2f(float(cell % GridSize), float(cell / GridSize));
+		}
+
+		std::shared_ptr<Nz::RenderBuffer> vertexBuffer = device->InstantiateBuffer(Nz::BufferType::Vertex, sizeof(vertices), Nz::BufferUsage::DeviceLocal, vertices.data());
+		std::shared_ptr<Nz::RenderBuffer> indexBuffer = device->InstantiateBuffer(Nz::BufferType::Index, sizeof(indices), Nz::BufferUsage::DeviceLocal, indices.data());
+		std::shared_ptr<Nz::RenderBuffer> instanceBuffer = device->InstantiateBuffer(Nz::BufferType::Vertex, instanceCells.size() * sizeof(Nz::Vector2f), Nz::BufferUsage::DeviceLocal, instanceCells.data());
+
+		// Indirect commands, non-indexed ones first
+		std::vector<Nz::CommandBufferBuilder::DrawIndirectCommand> drawCommands;
+		for (const DrawRange& range : s_drawRanges)
+			drawCommands.push_back({ 6, range.instanceCount, firstTriangleVertex, range.firstInstance });
+
+		for (const DrawRange& range : s_drawCountRanges)
+			drawCommands.push_back({ 6, range.instanceCount, firstTriangleVertex, range.firstInstance });
+
+		std::vector<Nz::CommandBufferBuilder::DrawIndexedIndirectCommand> drawIndexedCommands;
+		for (const DrawRange& range : s_drawIndexedRanges)
+			drawIndexedCommands.push_back({ 6, range.instanceCount, 0, 0, range.firstInstance });
+
+		for (const DrawRange& range : s_drawIndexedCountRanges)
+			drawIndexedCommands.push_back({ 6, range.instanceCount, 0, 0, range.firstInstance });
+
+		constexpr Nz::UInt64 drawCountOffset = s_drawRanges.size() * sizeof(Nz::CommandBufferBuilder::DrawIndirectCommand);
+		constexpr Nz::UInt64 drawIndexedOffset = drawCountOffset + s_drawCountRanges.size() * sizeof(Nz::CommandBufferBuilder::DrawIndirectCommand);
+		constexpr Nz::UInt64 drawIndexedCountOffset = drawIndexedOffset + s_drawIndexedRanges.size() * sizeof(Nz::CommandBufferBuilder::DrawIndexedIndirectCommand);
+
+		std::vector<Nz::UInt8> indirectData(drawIndexedOffset + drawIndexedCommands.size() * sizeof(Nz::CommandBufferBuilder::DrawIndexedIndirectCommand));
+		std::memcpy(&indirectData[0], drawCommands.data(), drawCommands.size() * sizeof(Nz::CommandBufferBuilder::DrawIndirectCommand));
+		std::memcpy(&indirectData[drawIndexedOffset], drawIndexedCommands.data(), drawIndexedCommands.size() * sizeof(Nz::CommandBufferBuilder::DrawIndexedIndirectCommand));
+
+		std::shared_ptr<Nz::RenderBuffer> indirectBuffer = device->InstantiateBuffer(Nz::BufferType::Indirect, indirectData.size(), Nz::BufferUsage::DeviceLocal, indirectData.data());
+		std::shared_ptr<Nz::RenderBuffer> countBuffer = device->InstantiateBuffer(Nz::BufferType::Indirect, sizeof(s_drawCounts), Nz::BufferUsage::DeviceLocal, s_drawCounts.data());
+
+		// Render target
+		Nz::TextureInfo targetInfo;
+		targetInfo.pixelFormat = Nz::PixelFormat::RGBA8;
+		targetInfo.type = Nz::ImageType::E2D;
+		targetInfo.usageFlags = Nz::TextureUsage::ColorAttachment | Nz::TextureUsage::ShaderReadWrite | Nz::TextureUsage::TransferSource;
+		targetInfo.levelCount = 1;
+		targetInfo.width = TargetSize;
+		targetInfo.height = TargetSize;
+
+		std::shared_ptr<Nz::Texture> renderTarget = device->InstantiateTexture(targetInfo);
+
+		Nz::RenderPass::Attachment colorAttachment;
+		colorAttachment.format = Nz::PixelFormat::RGBA8;
+		colorAttachment.loadOp = Nz::AttachmentLoadOp::Clear;
+		colorAttachment.finalLayout = Nz::TextureLayout::ColorOutput;
+
+		Nz::RenderPass::SubpassDescription subpass;
+		subpass.colorAttachment.push_back({ 0, Nz::TextureLayout::ColorOutput });
+
+		std::shared_ptr<Nz::RenderPass> renderPass = device->InstantiateRenderPass({ colorAttachment }, { subpass }, {});
+		std::shared_ptr<Nz::Framebuffer> framebuffer = device->InstantiateFramebuffer(TargetSize, TargetSize, renderPass, { renderTarget });
+
+		// Readback pipeline
+		nzsl::Ast::ModulePtr readbackShaderModule = nzsl::Parse(std::string_view(readbackShaderSource, sizeof(readbackShaderSource)));
+		std::shared_ptr<Nz::ShaderModule> readbackShader = device->InstantiateShaderModule(nzsl::ShaderStageType::Compute, *readbackShaderModule, {});
+		if (!readbackShader)
+		{
+			std::cout << testName << ": failed to instantiate readback shader" << std::endl;
+			return TestResult::Failed;
+		}
+
+		Nz::RenderPipelineLayoutInfo readbackPipelineLayoutInfo;
+		readbackPipelineLayoutInfo.bindings.assign({
+			{
+				0, 0, 1,
+				Nz::ShaderBindingType::Texture,
+				nzsl::ShaderStageType::Compute
+			},
+			{
+				0, 1, 1,
+				Nz::ShaderBindingType::StorageBuffer,
+				nzsl::ShaderStageType::Compute
+			}
+		});
+
+		std::shared_ptr<Nz::RenderPipelineLayout> readbackPipelineLayout = device->InstantiateRenderPipelineLayout(std::move(readbackPipelineLayoutInfo));
+
+		Nz::ComputePipelineInfo readbackPipelineInfo;
+		readbackPipelineInfo.pipelineLayout = readbackPipelineLayout;
+		readbackPipelineInfo.shaderModule = readbackShader;
+
+		std::shared_ptr<Nz::ComputePipeline> readbackPipeline = device->InstantiateComputePipeline(std::move(readbackPipelineInfo));
+
+		std::vector<float> initialCoverage(CellCount, -1.f);
+		std::shared_ptr<Nz::RenderBuffer> coverageBuffer = device->InstantiateBuffer(Nz::BufferType::Storage, CellCount * sizeof(float), Nz::BufferUsage::DeviceLocal | Nz::BufferUsage::DirectMapping | Nz::BufferUsage::Read | Nz::BufferUsage::Write, initialCoverage.data());
+
+		Nz::ShaderBindingPtr readbackBinding = readbackPipelineLayout->AllocateShaderBinding(0);
+		readbackBinding->Update({
+			{
+				0,
+				Nz::ShaderBinding::TextureBinding {
+					renderTarget.get(),
+					Nz::TextureAccess::ReadOnly
+				}
+			},
+			{
+				1,
+				Nz::ShaderBinding::StorageBufferBinding {
+					coverageBuffer.get(), 0, CellCount * sizeof(float)
+				}
+			}
+		});
+
+		// Command buffers are submitted through a frame, the result is also displayed
+		Nz::Window window;
+		if (!window.Create(Nz::VideoMode(TargetSize * 8, TargetSize * 8), "Indirect draw test - " + testName))
+		{
+			std::cout << testName << ": failed to create window" << std::endl;
+			return TestResult::Failed;
+		}
+
+		Nz::WindowSwapchain windowSwapchain(device, window);
+
+		for (unsigned int attempt = 0;; ++attempt)
+		{
+			Nz::Window::ProcessEvents();
+
+			Nz::RenderFrame frame = windowSwapchain.AcquireFrame();
+			if (!frame)
+			{
+				if (attempt >= 100)
+				{
+					std::cout << testName << ": failed to acquire a frame" << std::endl;
+					return TestResult::Failed;
+				}
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				continue;
+			}
+
+			frame.Execute([&](Nz::CommandBufferBuilder& builder)
+			{
+				Nz::Recti renderRect(0, 0, TargetSize, TargetSize);
+
+				Nz::CommandBufferBuilder::ClearValues clearValues;
+				clearValues.color = Nz::Color::Black();
+
+				builder.BeginDebugRegion("Indirect draws", Nz::Color::Green());
+				{
+					builder.BeginRenderPass(*framebuffer, *renderPass, renderRect, { clearValues });
+					{
+						builder.SetScissor(renderRect);
+						builder.SetViewport(renderRect);
+
+						builder.BindRenderPipeline(*drawPipeline);
+						builder.BindIndexBuffer(*indexBuffer, Nz::IndexType::U16);
+						builder.BindVertexBuffer(0, *vertexBuffer);
+						builder.BindVertexBuffer(1, *instanceBuffer);
+
+						builder.DrawIndirect(*indirectBuffer, 0, Nz::UInt32(s_drawRanges.size()));
+						builder.DrawIndexedIndirect(*indirectBuffer, drawIndexedOffset, Nz::UInt32(s_drawIndexedRanges.size()));
+
+						if (testDrawCount)
+						{
+							builder.DrawIndirectCount(*indirectBuffer, drawCountOffset, *countBuffer, 0, Nz::UInt32(s_drawCountRanges.size()));
+							builder.DrawIndexedIndirectCount(*indirectBuffer, drawIndexedCountOffset, *countBuffer, sizeof(Nz::UInt32), Nz::UInt32(s_drawIndexedCountRanges.size()));
+						}
+					}
+					builder.EndRenderPass();
+				}
+				builder.EndDebugRegion();
+
+				builder.BeginDebugRegion("Readback", Nz::Color::Blue());
+				{
+					builder.TextureBarrier(Nz::PipelineStage::ColorOutput, Nz::PipelineStage::ComputeShader, Nz::MemoryAccess::ColorWrite, Nz::MemoryAccess::ShaderRead, Nz::TextureLayout::ColorOutput, Nz::TextureLayout::General, *renderTarget);
+
+					builder.BindComputePipeline(*readbackPipeline);
+					builder.BindComputeShaderBinding(0, *readbackBinding);
+					builder.Dispatch(1, 1, 1);
+
+					builder.MemoryBarrier(Nz::PipelineStage::ComputeShader, Nz::PipelineStage::BottomOfPipe, Nz::MemoryAccess::MemoryWrite | Nz::MemoryAccess::ShaderWrite, Nz::MemoryAccess::HostRead);
+				}
+				builder.EndDebugRegion();
+
+				builder.TextureBarrier(Nz::PipelineStage::ComputeShader, Nz::PipelineStage::Transfer, Nz::MemoryAccess::ShaderRead, Nz::MemoryAccess::TransferRead, Nz::TextureLayout::General, Nz::TextureLayout::TransferSource, *renderTarget);
+				builder.BlitTextureToSwapchain(*renderTarget, Nz::Boxui(0, 0, 0, TargetSize, TargetSize, 1), Nz::TextureLayout::TransferSource, *windowSwapchain.GetSwapchain(), frame.GetImageIndex());
+			}, Nz::QueueType::Graphics);
+
+			frame.Present();
+			break;
+		}
+
+		device->WaitForIdle();
+
+		std::vector<bool> expectedCells(CellCount, false);
+		MarkDrawnCells(expectedCells, s_drawRanges, s_drawRanges.size());
+		MarkDrawnCells(expectedCells, s_drawIndexedRanges, s_drawIndexedRanges.size());
+		if (testDrawCount)
+		{
+			MarkDrawnCells(expectedCells, s_drawCountRanges, s_drawCounts[0]);
+			MarkDrawnCells(expectedCells, s_drawIndexedCountRanges, s_drawCounts[1]);
+		}
+
+		std::vector<float> coverage(CellCount);
+		const void* coverageData = coverageBuffer->Map(0, CellCount * sizeof(float));
+		if (!coverageData)
+		{
+			std::cout << testName << ": failed to map coverage buffer" << std::endl;
+			return TestResult::Failed;
+		}
+
+		std::memcpy(coverage.data(), coverageData, CellCount * sizeof(float));
+		coverageBuffer->Unmap();
+
+		std::size_t errorCount = 0;
+		for (Nz::UInt32 cell = 0; cell < CellCount; ++cell)
+		{
+			if (coverage[cell] < 0.f)
+			{
+				std::cout << testName << ": cell " << cell << " was not read back" << std::endl;
+				errorCount++;
+			}
+			else if ((coverage[cell] > 0.5f) != expectedCells[cell])
+			{
+				std::cout << testName << ": cell " << cell << " should" << ((expectedCells[cell]) ? "" : " not") << " have been drawn" << std::endl;
+				errorCount++;
+			}
+		}
+
+		if (errorCount > 0)
+		{
+			std::cout << testName << ": failed (" << errorCount << " wrong cells)" << std::endl;
+			return TestResult::Failed;
+		}
+
+		std::cout << testName << ": passed on " << device->GetDeviceInfo().name << ((testDrawCount) ? "" : " (count draws are not supported)") << std::endl;
+		return TestResult::Passed;
+	}
+}
+
+int main()
+{
+	std::array<std::pair<Nz::RenderAPI, std::string_view>, 2> apis = {
+		{
+			{ Nz::RenderAPI::Vulkan, "Vulkan" },
+			{ Nz::RenderAPI::OpenGL, "OpenGL" }
+		}
+	};
+
+	bool hasFailed = false;
+	for (auto&& [api, apiName] : apis)
+	{
+		for (bool multiDrawIndirect : { true, false })
+		{
+			if (RunTest(api, apiName, multiDrawIndirect) == TestResult::Failed)
+				hasFailed = true;
+		}
+	}
+
+	return (hasFailed) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
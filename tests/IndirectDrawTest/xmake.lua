@@ -0,0 +1,7 @@
+if is_plat("wasm") then
+	return -- Compute shaders (used to read the result back) are not supported with WebGL
+end
+
+target("IndirectDrawTest")
+	add_deps("NazaraRenderer")
+	add_files("main.cpp")
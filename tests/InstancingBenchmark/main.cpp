@@ -0,0 +1,202 @@
+#include <Nazara/Core.hpp>
+#include <Nazara/Platform.hpp>
+#include <Nazara/Graphics.hpp>
+#include <Nazara/Renderer.hpp>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t GridWidth = 250;
+	constexpr std::size_t GridDepth = 200; //< 50k meshes
+	constexpr float Spacing = 2.f;
+}
+
+int main()
+{
+	Nz::Renderer::Config rendererConfig;
+#ifndef NAZARA_PLATFORM_WEB
+	std::cout << "Run using Vulkan? (y/n)" << std::endl;
+	if (std::getchar() == 'y')
+		rendererConfig.preferredAPI = Nz::RenderAPI::Vulkan;
+	else
+		rendererConfig.preferredAPI = Nz::RenderAPI::OpenGL;
+#endif
+
+	Nz::Application<Nz::Graphics> app(rendererConfig);
+	auto& windowingApp = app.AddComponent<Nz::WindowingAppComponent>();
+
+	std::shared_ptr<Nz::RenderDevice> device = Nz::Graphics::Instance()->GetRenderDevice();
+
+	std::string windowTitle = "Instancing Benchmark";
+	Nz::Window& window = windowingApp.CreateWindow(Nz::VideoMode(1280, 720), windowTitle);
+	Nz::WindowSwapchain windowSwapchain(device, window);
+
+	std::shared_ptr<Nz::GraphicalMesh> cubeMesh = Nz::GraphicalMesh::Build(Nz::Primitive::Box(Nz::Vector3f::Unit()));
+
+	std::shared_ptr<Nz::MaterialInstance> sharedMaterial = Nz::MaterialInstance::Instantiate(Nz::MaterialType::Basic);
+	sharedMaterial->SetValueProperty("BaseColor", Nz::Color::Orange());
+
+	// Every cube shares the same model (and thus the same material), allowing them to be instanced
+	std::shared_ptr<Nz::Model> sharedModel = std::make_shared<Nz::Model>(cubeMesh);
+	sharedModel->SetMaterial(0, sharedMaterial);
+
+	// One model and material per cube, which prevents instancing (used for comparison)
+	std::vector<std::shared_ptr<Nz::Model>> uniqueModels;
+
+	Nz::Vector2ui windowSize = window.GetSize();
+
+	Nz::Camera camera(std::make_shared<Nz::RenderWindow>(windowSwapchain));
+	camera.UpdateClearColor(Nz::Color::Gray());
+
+	Nz::Vector3f viewerPos(0.f, 150.f, 350.f);
+	Nz::EulerAnglesf camAngles(-30.f, 0.f, 0.f);
+
+	Nz::ViewerInstance& viewerInstance = camera.GetViewerInstance();
+	viewerInstance.UpdateTargetSize(Nz::Vector2f(windowSize));
+	viewerInstance.UpdateProjViewMatrices(Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), float(windowSize.x) / windowSize.y, 0.1f, 2000.f), Nz::Matrix4f::TransformInverse(viewerPos, camAngles));
+	viewerInstance.UpdateNearFarPlanes(0.1f, 2000.f);
+	viewerInstance.UpdateEyePosition(viewerPos);
+
+	Nz::ElementRendererRegistry elementRegistry;
+	Nz::DefaultFramePipeline framePipeline(elementRegistry);
+	framePipeline.RegisterViewer(&camera, 0);
+
+	Nz::Recti scissorBox(-1, -1, -1, -1);
+
+	std::vector<Nz::Vector3f> cubePositions;
+	std::vector<Nz::WorldInstancePtr> worldInstances;
+	std::vector<std::size_t> worldInstanceIndices;
+	for (std::size_t z = 0; z < GridDepth; ++z)
+	{
+		for (std::size_t x = 0; x < GridWidth; ++x)
+		{
+			Nz::Vector3f position((float(x) - GridWidth * 0.5f) * Spacing, 0.f, (float(z) - GridDepth * 0.5f) * Spacing);
+
+			Nz::WorldInstancePtr& worldInstance = worldInstances.emplace_back(std::make_shared<Nz::WorldInstance>());
+			worldInstance->UpdateWorldMatrix(Nz::Matrix4f::Translate(position));
+
+			cubePositions.push_back(position);
+			worldInstanceIndices.push_back(framePipeline.RegisterWorldInstance(worldInstance));
+		}
+	}
+
+	std::vector<std::size_t> renderableIndices;
+	bool useInstancing = true;
+	bool moveCubes = false;
+
+	auto RegisterCubes = [&]
+	{
+		for (std::size_t renderableIndex : renderableIndices)
+			framePipeline.UnregisterRenderable(renderableIndex);
+
+		renderableIndices.clear();
+
+		if (!useInstancing && uniqueModels.empty())
+		{
+			uniqueModels.reserve(worldInstances.size());
+			for (std::size_t i = 0; i < worldInstances.size(); ++i)
+			{
+				std::shared_ptr<Nz::Model>& model = uniqueModels.emplace_back(std::make_shared<Nz::Model>(cubeMesh));
+				model->SetMaterial(0, sharedMaterial->Clone());
+			}
+		}
+
+		for (std::size_t i = 0; i < worldInstances.size(); ++i)
+		{
+			const Nz::Model* model = (useInstancing) ? sharedModel.get() : uniqueModels[i].get();
+			renderableIndices.push_back(framePipeline.RegisterRenderable(worldInstanceIndices[i], Nz::FramePipeline::NoSkeletonInstance, model, 0xFFFFFFFF, scissorBox));
+		}
+
+		std::cout << worldInstances.size() << " cubes, " << ((useInstancing) ? "shared material (instanced)" : "one material per cube (not instanced)") << std::endl;
+	};
+
+	RegisterCubes();
+
+	std::cout << "Press I to toggle between shared and per-cube materials, M to toggle cube movement" << std::endl;
+
+	window.GetEventHandler().OnEvent.Connect([&](const Nz::WindowEventHandler*, const Nz::WindowEvent& event)
+	{
+		switch (event.type)
+		{
+			case Nz::WindowEventType::Quit:
+				window.Close();
+				break;
+
+			case Nz::WindowEventType::KeyPressed:
+				if (event.key.virtualKey == Nz::Keyboard::VKey::I)
+				{
+					useInstancing = !useInstancing;
+					RegisterCubes();
+				}
+				else if (event.key.virtualKey == Nz::Keyboard::VKey::M)
+					moveCubes = !moveCubes;
+
+				break;
+
+			case Nz::WindowEventType::Resized:
+			{
+				Nz::Vector2ui newWindowSize = window.GetSize();
+				viewerInstance.UpdateProjectionMatrix(Nz::Matrix4f::Perspective(Nz::DegreeAnglef(70.f), float(newWindowSize.x) / newWindowSize.y, 0.1f, 2000.f));
+				viewerInstance.UpdateTargetSize(Nz::Vector2f(newWindowSize));
+				break;
+			}
+
+			default:
+				break;
+		}
+	});
+
+	Nz::MillisecondClock fpsClock;
+	Nz::HighPrecisionClock animationClock;
+	Nz::Time frameTime = Nz::Time::Zero();
+	unsigned int fps = 0;
+
+	app.AddUpdaterFunc([&]
+	{
+		Nz::RenderFrame frame = windowSwapchain.AcquireFrame();
+		if (!frame)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			return;
+		}
+
+		Nz::Time frameStart = Nz::GetElapsedNanoseconds();
+
+		// Moving cubes don't change their elements but require their world matrices to be uploaded again
+		if (moveCubes)
+		{
+			float elapsedTime = animationClock.GetElapsedTime().AsSeconds();
+			for (std::size_t i = 0; i < worldInstances.size(); ++i)
+			{
+				Nz::Vector3f position = cubePositions[i];
+				position.y = std::sin(elapsedTime * 2.f + position.x * 0.1f + position.z * 0.1f) * 2.f;
+
+				worldInstances[i]->UpdateWorldMatrix(Nz::Matrix4f::Translate(position));
+			}
+		}
+
+		framePipeline.Render(frame);
+
+		frameTime += Nz::GetElapsedNanoseconds() - frameStart;
+
+		frame.Present();
+
+		fps++;
+
+		if (fpsClock.RestartIfOver(Nz::Time::Second()))
+		{
+			Nz::Time averageFrameTime = Nz::Time::Nanoseconds(frameTime.AsNanoseconds() / fps);
+			std::cout << fps << " FPS, " << averageFrameTime << " per frame (CPU)" << std::endl;
+
+			window.SetTitle(windowTitle + " - " + Nz::NumberToString(fps) + " FPS");
+			frameTime = Nz::Time::Zero();
+			fps = 0;
+		}
+	});
+
+	return app.Run();
+}
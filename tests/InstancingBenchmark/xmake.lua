@@ -0,0 +1,3 @@
+target("InstancingBenchmark")
+	add_deps("NazaraGraphics")
+	add_files("main.cpp")
@@ -0,0 +1,309 @@
+// Measures OpenGLCommandBuffer recording and replay of many draw calls
+// Can run without a GPU using a software implementation, for example with Mesa llvmpipe:
+// LIBGL_ALWAYS_SOFTWARE=1 EGL_PLATFORM=surfaceless ./OpenGLCommandStreamBenchmark
+
+#include <Nazara/Core.hpp>
+#include <Nazara/Math.hpp>
+#include <Nazara/OpenGLRenderer/OpenGLCommandBuffer.hpp>
+#include <Nazara/OpenGLRenderer/OpenGLDevice.hpp>
+#include <Nazara/Renderer.hpp>
+#include <NZSL/Parser.hpp>
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t DrawCount = 100'000;
+	constexpr std::size_t FrameCount = 10;
+	constexpr std::size_t PipelineCount = 8;
+	constexpr std::size_t ShaderBindingCount = 256;
+	constexpr std::size_t VertexBufferCount = 16;
+	constexpr Nz::UInt32 TargetSize = 64;
+
+	const char shaderSource[] = R"(
+[nzsl_version("1.0")]
+module;
+
+[layout(std140)]
+struct Data
+{
+	color: vec4[f32],
+	offset: vec2[f32]
+}
+
+external
+{
+	[binding(0)] data: uniform[Data]
+}
+
+struct VertIn
+{
+	[location(0)] pos: vec2[f32]
+}
+
+struct VertOut
+{
+	[builtin(position)] pos: vec4[f32]
+}
+
+struct FragOut
+{
+	[location(0)] color: vec4[f32]
+}
+
+[entry(frag)]
+fn main() -> FragOut
+{
+	let output: FragOut;
+	output.color = data.color;
+
+	return output;
+}
+
+[entry(vert)]
+fn main(input: VertIn) -> VertOut
+{
+	let output: VertOut;
+	output.pos = vec4[f32](input.pos * 0.01 + data.offset, 0.0, 1.0);
+
+	return output;
+}
+)";
+
+	struct DrawInfo
+	{
+		std::size_t pipelineIndex;
+		std::size_t shaderBindingIndex;
+		std::size_t vertexBufferIndex;
+	};
+
+	struct Scene
+	{
+		std::shared_ptr<Nz::RenderPipelineLayout> pipelineLayout;
+		std::vector<std::shared_ptr<Nz::RenderPipeline>> pipelines;
+		std::vector<std::shared_ptr<Nz::RenderBuffer>> vertexBuffers;
+		std::vector<Nz::ShaderBindingPtr> shaderBindings;
+		std::shared_ptr<Nz::RenderBuffer> indexBuffer;
+		std::shared_ptr<Nz::RenderBuffer> uniformBuffer;
+		std::shared_ptr<Nz::Framebuffer> framebuffer;
+		std::shared_ptr<Nz::RenderPass> renderPass;
+		std::shared_ptr<Nz::Texture> renderTarget;
+	};
+
+	Scene BuildScene(Nz::RenderDevice& device)
+	{
+		Scene scene;
+
+		nzsl::Ast::ModulePtr shaderModule = nzsl::Parse(std::string_view(shaderSource, sizeof(shaderSource)));
+		std::shared_ptr<Nz::ShaderModule> shader = device.InstantiateShaderModule(nzsl::ShaderStageType::Fragment | nzsl::ShaderStageType::Vertex, *shaderModule, {});
+
+		Nz::RenderPipelineLayoutInfo pipelineLayoutInfo;
+		auto& uboBinding = pipelineLayoutInfo.bindings.emplace_back();
+		uboBinding.setIndex = 0;
+		uboBinding.bindingIndex = 0;
+		uboBinding.shaderStageFlags = nzsl::ShaderStageType::Fragment | nzsl::ShaderStageType::Vertex;
+		uboBinding.type = Nz::ShaderBindingType::UniformBuffer;
+
+		scene.pipelineLayout = device.InstantiateRenderPipelineLayout(std::move(pipelineLayoutInfo));
+
+		// Pipelines only differ by their render states, as materials usually do
+		for (std::size_t i = 0; i < PipelineCount; ++i)
+		{
+			Nz::RenderPipelineInfo pipelineInfo;
+			pipelineInfo.blending = (i & 1) != 0;
+			pipelineInfo.faceCulling = (i & 2) ? Nz::FaceCulling::Back : Nz::FaceCulling::None;
+			pipelineInfo.primitiveMode = (i & 4) ? Nz::PrimitiveMode::TriangleList : Nz::PrimitiveMode::LineList;
+			pipelineInfo.pipelineLayout = scene.pipelineLayout;
+			pipelineInfo.shaderModules.push_back(shader);
+			pipelineInfo.vertexBuffers.push_back({ 0, Nz::VertexDeclaration::Get(Nz::VertexLayout::XY) });
+
+			scene.pipelines.push_back(device.InstantiateRenderPipeline(std::move(pipelineInfo)));
+		}
+
+		std::mt19937 randEngine(42);
+		std::uniform_real_distribution<float> positionDis(-1.f, 1.f);
+
+		for (std::size_t i = 0; i < VertexBufferCount; ++i)
+		{
+			std::array<Nz::Vector2f, 4> vertices;
+			for (Nz::Vector2f& vertex : vertices)
+				vertex = Nz::Vector2f(positionDis(randEngine), positionDis(randEngine));
+
+			scene.vertexBuffers.push_back(device.InstantiateBuffer(Nz::BufferType::Vertex, sizeof(vertices), Nz::BufferUsage::DeviceLocal, vertices.data()));
+		}
+
+		std::array<Nz::UInt16, 6> indices = { 0, 1, 2, 2, 1, 3 };
+		scene.indexBuffer = device.InstantiateBuffer(Nz::BufferType::Index, sizeof(indices), Nz::BufferUsage::DeviceLocal, indices.data());
+
+		// One UBO slice per shader binding
+		constexpr Nz::UInt64 uboAlignment = 256;
+		std::vector<Nz::UInt8> uboData(ShaderBindingCount * uboAlignment);
+		for (std::size_t i = 0; i < ShaderBindingCount; ++i)
+		{
+			float* data = reinterpret_cast<float*>(&uboData[i * uboAlignment]);
+			for (std::size_t j = 0; j < 6; ++j)
+				data[j] = positionDis(randEngine);
+		}
+
+		scene.uniformBuffer = device.InstantiateBuffer(Nz::BufferType::Uniform, uboData.size(), Nz::BufferUsage::DeviceLocal, uboData.data());
+
+		for (std::size_t i = 0; i < ShaderBindingCount; ++i)
+		{
+			Nz::ShaderBindingPtr shaderBinding = scene.pipelineLayout->AllocateShaderBinding(0);
+			shaderBinding->Update({
+				{
+					0,
+					Nz::ShaderBinding::UniformBufferBinding {
+						scene.uniformBuffer.get(), i * uboAlignment, 8 * sizeof(float)
+					}
+				}
+			});
+
+			scene.shaderBindings.push_back(std::move(shaderBinding));
+		}
+
+		Nz::TextureInfo targetInfo;
+		targetInfo.pixelFormat = Nz::PixelFormat::RGBA8;
+		targetInfo.type = Nz::ImageType::E2D;
+		targetInfo.usageFlags = Nz::TextureUsage::ColorAttachment;
+		targetInfo.levelCount = 1;
+		targetInfo.width = TargetSize;
+		targetInfo.height = TargetSize;
+
+		scene.renderTarget = device.InstantiateTexture(targetInfo);
+
+		Nz::RenderPass::Attachment colorAttachment;
+		colorAttachment.format = Nz::PixelFormat::RGBA8;
+		colorAttachment.loadOp = Nz::AttachmentLoadOp::Clear;
+		colorAttachment.finalLayout = Nz::TextureLayout::ColorOutput;
+
+		Nz::RenderPass::SubpassDescription subpass;
+		subpass.colorAttachment.push_back({ 0, Nz::TextureLayout::ColorOutput });
+
+		scene.renderPass = device.InstantiateRenderPass({ colorAttachment }, { subpass }, {});
+		scene.framebuffer = device.InstantiateFramebuffer(TargetSize, TargetSize, scene.renderPass, { scene.renderTarget });
+
+		return scene;
+	}
+
+	void RunBenchmark(const char* name, Nz::OpenGLDevice& device, Nz::CommandPool& commandPool, const Scene& scene, const std::vector<DrawInfo>& draws, bool rebindEverything)
+	{
+		Nz::Time recordTime = Nz::Time::Zero();
+		Nz::Time replayTime = Nz::Time::Zero();
+
+		const Nz::GL::Context& context = device.GetReferenceContext();
+
+		for (std::size_t frameIndex = 0; frameIndex < FrameCount; ++frameIndex)
+		{
+			Nz::Time start = Nz::GetElapsedNanoseconds();
+
+			Nz::CommandBufferPtr commandBuffer = commandPool.BuildCommandBuffer([&](Nz::CommandBufferBuilder& builder)
+			{
+				Nz::Recti renderRect(0, 0, TargetSize, TargetSize);
+
+				builder.BeginRenderPass(*scene.framebuffer, *scene.renderPass, renderRect, { Nz::CommandBufferBuilder::ClearValues{} });
+				{
+					builder.SetScissor(renderRect);
+					builder.SetViewport(renderRect);
+					builder.BindIndexBuffer(*scene.indexBuffer, Nz::IndexType::U16);
+
+					const DrawInfo* previousDraw = nullptr;
+					for (const DrawInfo& draw : draws)
+					{
+						// Render queues usually bind states only when they change, but some passes rebind everything
+						if (rebindEverything || !previousDraw || previousDraw->pipelineIndex != draw.pipelineIndex)
+							builder.BindRenderPipeline(*scene.pipelines[draw.pipelineIndex]);
+
+						if (rebindEverything || !previousDraw || previousDraw->vertexBufferIndex != draw.vertexBufferIndex)
+							builder.BindVertexBuffer(0, *scene.vertexBuffers[draw.vertexBufferIndex]);
+
+						if (rebindEverything || !previousDraw || previousDraw->shaderBindingIndex != draw.shaderBindingIndex)
+							builder.BindRenderShaderBinding(0, *scene.shaderBindings[draw.shaderBindingIndex]);
+
+						if (rebindEverything)
+						{
+							builder.BindIndexBuffer(*scene.indexBuffer, Nz::IndexType::U16);
+							builder.SetScissor(renderRect);
+						}
+
+						builder.DrawIndexed(6);
+
+						previousDraw = &draw;
+					}
+				}
+				builder.EndRenderPass();
+			});
+
+			recordTime += Nz::GetElapsedNanoseconds() - start;
+
+			Nz::GL::Context::SetCurrentContext(&context);
+
+			start = Nz::GetElapsedNanoseconds();
+
+			static_cast<Nz::OpenGLCommandBuffer&>(*commandBuffer).Execute();
+			context.glFinish();
+
+			replayTime += Nz::GetElapsedNanoseconds() - start;
+		}
+
+		std::cout << "--- " << name << " ---" << std::endl;
+		std::cout << "record: " << Nz::Time::Nanoseconds(recordTime.AsNanoseconds() / Nz::Int64(FrameCount)) << std::endl;
+		std::cout << "replay: " << Nz::Time::Nanoseconds(replayTime.AsNanoseconds() / Nz::Int64(FrameCount)) << std::endl;
+	}
+}
+
+int main()
+{
+	Nz::Renderer::Config rendererConfig;
+	rendererConfig.preferredAPI = Nz::RenderAPI::OpenGL;
+
+	Nz::Modules<Nz::Renderer> nazara(rendererConfig);
+
+	std::shared_ptr<Nz::RenderDevice> device = Nz::Renderer::Instance()->InstanciateRenderDevice(0);
+	Nz::OpenGLDevice* openglDevice = dynamic_cast<Nz::OpenGLDevice*>(device.get());
+	if (!openglDevice)
+	{
+		std::cerr << "this benchmark requires the OpenGL renderer" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Scene scene = BuildScene(*device);
+	std::shared_ptr<Nz::CommandPool> commandPool = device->InstantiateCommandPool(Nz::QueueType::Graphics);
+
+	std::mt19937 randEngine(1337);
+	std::uniform_int_distribution<std::size_t> pipelineDis(0, PipelineCount - 1);
+	std::uniform_int_distribution<std::size_t> shaderBindingDis(0, ShaderBindingCount - 1);
+	std::uniform_int_distribution<std::size_t> vertexBufferDis(0, VertexBufferCount - 1);
+
+	std::vector<DrawInfo> draws(DrawCount);
+	for (DrawInfo& draw : draws)
+	{
+		draw.pipelineIndex = pipelineDis(randEngine);
+		draw.shaderBindingIndex = shaderBindingDis(randEngine);
+		draw.vertexBufferIndex = vertexBufferDis(randEngine);
+	}
+
+	std::cout << DrawCount << " draws, average over " << FrameCount << " frames" << std::endl;
+
+	RunBenchmark("unsorted draws", *openglDevice, *commandPool, scene, draws, false);
+	RunBenchmark("unsorted draws, rebinding every state", *openglDevice, *commandPool, scene, draws, true);
+
+	std::sort(draws.begin(), draws.end(), [](const DrawInfo& lhs, const DrawInfo& rhs)
+	{
+		if (lhs.pipelineIndex != rhs.pipelineIndex)
+			return lhs.pipelineIndex < rhs.pipelineIndex;
+
+		if (lhs.vertexBufferIndex != rhs.vertexBufferIndex)
+			return lhs.vertexBufferIndex < rhs.vertexBufferIndex;
+
+		return lhs.shaderBindingIndex < rhs.shaderBindingIndex;
+	});
+
+	RunBenchmark("sorted draws", *openglDevice, *commandPool, scene, draws, false);
+	RunBenchmark("sorted draws, rebinding every state", *openglDevice, *commandPool, scene, draws, true);
+
+	return EXIT_SUCCESS;
+}
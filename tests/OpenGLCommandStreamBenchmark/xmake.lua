@@ -0,0 +1,12 @@
+if is_plat("wasm") then
+	return
+end
+
+target("OpenGLCommandStreamBenchmark")
+	-- Uses OpenGLCommandBuffer directly to measure replay
+	if has_config("embed_rendererbackends", "static") then
+		add_deps("NazaraRenderer")
+	else
+		add_deps("NazaraOpenGLRenderer")
+	end
+	add_files("main.cpp")
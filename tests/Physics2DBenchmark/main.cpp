@@ -0,0 +1,69 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Physics2D/Collider2D.hpp>
+#include <Nazara/Physics2D/Physics2D.hpp>
+#include <Nazara/Physics2D/PhysWorld2D.hpp>
+#include <Nazara/Physics2D/RigidBody2D.hpp>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t BodyCount = 10'000;
+	constexpr std::size_t IterationCount = 100;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Physics2D> nazara;
+
+	Nz::PhysWorld2D world;
+	world.SetGravity(Nz::Vector2f(0.f, -9.81f));
+
+	std::shared_ptr<Nz::Collider2D> box = std::make_shared<Nz::BoxCollider2D>(Nz::Rectf(0.f, 0.f, 1.f, 1.f));
+
+	std::vector<Nz::RigidBody2D> bodies;
+	bodies.reserve(BodyCount);
+	for (std::size_t i = 0; i < BodyCount; ++i)
+	{
+		Nz::RigidBody2D::DynamicSettings settings;
+		settings.collider = box;
+		settings.mass = 1.f;
+		settings.position = Nz::Vector2f(2.f * (i % 100), 2.f * (i / 100));
+
+		bodies.emplace_back(world, settings);
+	}
+
+	world.Step(Nz::Time::TickDuration(60));
+
+	Nz::ByteArray referenceState;
+	world.SaveState(referenceState);
+
+	// Move a tenth of the bodies, as if they were the only ones awake
+	for (std::size_t i = 0; i < BodyCount; i += 10)
+		bodies[i].SetPosition(bodies[i].GetPosition() + Nz::Vector2f(0.5f, 0.5f));
+
+	Nz::ByteArray state;
+	Nz::ByteArray stateDelta;
+
+	auto Measure = [&](const char* name, auto&& func)
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < IterationCount; ++i)
+			func();
+
+		Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+		std::cout << name << ": " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / Nz::Int64(IterationCount)) << " per " << BodyCount << " bodies" << std::endl;
+	};
+
+	Measure("SaveState", [&] { world.SaveState(state); });
+	Measure("SaveState (delta)", [&] { world.SaveState(stateDelta, referenceState); });
+	Measure("RestoreState", [&] { world.RestoreState(state); });
+	Measure("RestoreState (delta)", [&] { world.RestoreState(stateDelta, referenceState); });
+
+	std::cout << "state size: " << state.GetSize() << " bytes, delta size: " << stateDelta.GetSize() << " bytes" << std::endl;
+
+	return EXIT_SUCCESS;
+}
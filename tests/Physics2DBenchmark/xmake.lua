@@ -0,0 +1,3 @@
+target("Physics2DBenchmark")
+	add_deps("NazaraPhysics2D")
+	add_files("main.cpp")
@@ -0,0 +1,251 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Modules.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/Physics3D.hpp>
+#include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t PileWidth = 20;
+	constexpr std::size_t PileHeight = 50; //< PileWidth * PileWidth * PileHeight = 20k bodies
+	constexpr std::size_t StepCount = 300;
+	constexpr std::size_t RayCount = 100'000;
+	constexpr std::size_t StateBodyCount = 10'000;
+	constexpr std::size_t StateIterationCount = 100;
+
+	void RunBenchmark(const char* name)
+	{
+		Nz::PhysWorld3D::Settings settings = Nz::PhysWorld3D::BuildDefaultSettings();
+		settings.gravity = Nz::Vector3f::Down() * 9.81f;
+		settings.maxBodies = 32 * 1024;
+		settings.maxBodyPairs = 256 * 1024;
+		settings.maxContactConstraints = 128 * 1024;
+		settings.tempAllocatorSize = 64 * 1024 * 1024;
+
+		Nz::PhysWorld3D world(std::move(settings));
+
+		Nz::RigidBody3D::StaticSettings floorSettings(std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(1000.f, 1.f, 1000.f)));
+		floorSettings.position = Nz::Vector3f::Down() * 0.5f;
+		floorSettings.objectLayer = 0;
+
+		Nz::RigidBody3D floor(world, floorSettings);
+
+		std::shared_ptr<Nz::Collider3D> boxCollider = std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f::Unit());
+
+		std::vector<Nz::RigidBody3D> bodies;
+		bodies.reserve(PileWidth * PileWidth * PileHeight);
+		for (std::size_t y = 0; y < PileHeight; ++y)
+		{
+			for (std::size_t z = 0; z < PileWidth; ++z)
+			{
+				for (std::size_t x = 0; x < PileWidth; ++x)
+				{
+					Nz::RigidBody3D::DynamicSettings bodySettings(boxCollider, 1.f);
+					bodySettings.objectLayer = 1;
+					// Slightly shifted layers so the pile collapses instead of staying stacked
+					bodySettings.position = Nz::Vector3f(x * 1.1f + (y % 2) * 0.5f, 0.6f + y * 1.1f, z * 1.1f + (y % 2) * 0.5f);
+
+					bodies.emplace_back(world, bodySettings);
+				}
+			}
+		}
+
+		world.Step(world.GetStepSize()); // warm-up (also registers bodies)
+
+		Nz::Time minStepTime = Nz::Time::Seconds(60);
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < StepCount; ++i)
+		{
+			Nz::Time stepStart = Nz::GetElapsedNanoseconds();
+			world.Step(world.GetStepSize());
+			minStepTime = std::min(minStepTime, Nz::GetElapsedNanoseconds() - stepStart);
+		}
+		Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+
+		std::cout << name << ": " << bodies.size() << " bodies, average step " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / Nz::Int64(StepCount)) << " (best " << minStepTime << "), " << world.GetActiveBodyCount() << " bodies still active" << std::endl;
+	}
+
+	void RunRaycastBenchmark(Nz::TaskScheduler& taskScheduler)
+	{
+		Nz::PhysWorld3D::Settings settings = Nz::PhysWorld3D::BuildDefaultSettings();
+		settings.maxBodies = 32 * 1024;
+
+		Nz::PhysWorld3D world(std::move(settings));
+
+		// 100x100 grid of boxes of varying height (something like a city)
+		std::mt19937 rand(42);
+		std::uniform_real_distribution<float> heightDis(1.f, 20.f);
+
+		std::vector<Nz::RigidBody3D> bodies;
+		bodies.reserve(100 * 100);
+		for (std::size_t z = 0; z < 100; ++z)
+		{
+			for (std::size_t x = 0; x < 100; ++x)
+			{
+				float height = heightDis(rand);
+
+				Nz::RigidBody3D::StaticSettings bodySettings(std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(1.f, height, 1.f)));
+				bodySettings.position = Nz::Vector3f(x * 2.f, height * 0.5f, z * 2.f);
+				bodySettings.objectLayer = 0;
+
+				bodies.emplace_back(world, bodySettings);
+			}
+		}
+
+		world.RefreshBodies();
+
+		std::uniform_real_distribution<float> posDis(0.f, 200.f);
+
+		std::vector<Nz::PhysWorld3D::RaycastRequest> rays(RayCount);
+		for (Nz::PhysWorld3D::RaycastRequest& ray : rays)
+		{
+			ray.from = Nz::Vector3f(posDis(rand), 50.f, posDis(rand));
+			ray.to = Nz::Vector3f(posDis(rand), -1.f, posDis(rand));
+		}
+
+		std::vector<Nz::PhysWorld3D::RaycastHit> hits(RayCount);
+
+		auto Measure = [&](const char* name, auto&& func)
+		{
+			Nz::Time start = Nz::GetElapsedNanoseconds();
+			std::size_t hitCount = func();
+			Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+
+			std::cout << name << ": " << RayCount << " rays (" << hitCount << " hits) in " << elapsed << std::endl;
+		};
+
+		Measure("Raycasts (one by one)", [&]
+		{
+			std::size_t hitCount = 0;
+			for (std::size_t i = 0; i < rays.size(); ++i)
+			{
+				if (world.RaycastQueryFirst(rays[i].from, rays[i].to, [&](const Nz::PhysWorld3D::RaycastHit& hitInfo) { hits[i] = hitInfo; }))
+					hitCount++;
+			}
+
+			return hitCount;
+		});
+
+		Measure("Raycasts (batch, single thread)", [&]
+		{
+			return world.RaycastQueryFirst(rays, hits);
+		});
+
+		Measure("Raycasts (batch, TaskScheduler)", [&]
+		{
+			return world.RaycastQueryFirst(rays, hits, &taskScheduler);
+		});
+	}
+
+	void RunStateBenchmark()
+	{
+		Nz::PhysWorld3D::Settings settings = Nz::PhysWorld3D::BuildDefaultSettings();
+		settings.gravity = Nz::Vector3f::Down() * 9.81f;
+		settings.maxBodies = 32 * 1024;
+		settings.maxBodyPairs = 256 * 1024;
+		settings.maxContactConstraints = 128 * 1024;
+		settings.tempAllocatorSize = 64 * 1024 * 1024;
+
+		Nz::PhysWorld3D world(std::move(settings));
+
+		Nz::RigidBody3D::StaticSettings floorSettings(std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(1000.f, 1.f, 1000.f)));
+		floorSettings.position = Nz::Vector3f::Down() * 0.5f;
+		floorSettings.objectLayer = 0;
+
+		Nz::RigidBody3D floor(world, floorSettings);
+
+		std::shared_ptr<Nz::Collider3D> boxCollider = std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f::Unit());
+
+		// Bodies resting in a grid, a tenth of them are falling (which is what changes between two snapshots)
+		std::vector<Nz::RigidBody3D> bodies;
+		bodies.reserve(StateBodyCount);
+		for (std::size_t i = 0; i < StateBodyCount; ++i)
+		{
+			Nz::RigidBody3D::DynamicSettings bodySettings(boxCollider, 1.f);
+			bodySettings.objectLayer = 1;
+			bodySettings.position = Nz::Vector3f((i % 100) * 2.f, (i % 10 == 0) ? 20.f : 0.5f, (i / 100) * 2.f);
+
+			bodies.emplace_back(world, bodySettings);
+		}
+
+		for (std::size_t i = 0; i < 60; ++i)
+			world.Step(world.GetStepSize());
+
+		Nz::ByteArray referenceState;
+		world.SaveState(referenceState);
+
+		world.Step(world.GetStepSize());
+
+		Nz::ByteArray state;
+		Nz::ByteArray stateDelta;
+
+		auto Measure = [&](const char* name, auto&& func)
+		{
+			Nz::Time start = Nz::GetElapsedNanoseconds();
+			for (std::size_t i = 0; i < StateIterationCount; ++i)
+				func();
+
+			Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+			std::cout << name << ": " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / Nz::Int64(StateIterationCount)) << " per " << StateBodyCount << " bodies" << std::endl;
+		};
+
+		Measure("SaveState", [&] { world.SaveState(state); });
+		Measure("SaveState (delta)", [&] { world.SaveState(stateDelta, referenceState); });
+		Measure("RestoreState", [&] { world.RestoreState(state); });
+		Measure("RestoreState (delta)", [&] { world.RestoreState(stateDelta, referenceState); });
+
+		std::cout << "state size: " << state.GetSize() << " bytes, delta size: " << stateDelta.GetSize() << " bytes, " << world.GetActiveBodyCount() << " active bodies" << std::endl;
+	}
+}
+
+int main()
+{
+	Nz::Modules<Nz::Physics3D> nazara;
+
+	Nz::TaskScheduler taskScheduler;
+
+	RunRaycastBenchmark(taskScheduler);
+	RunStateBenchmark();
+
+	// Application workload running concurrently with physics (half the workers are kept busy), which is where oversubscription hurts
+	auto RunWithBackgroundWork = [&](const char* name)
+	{
+		Nz::TaskScheduler::TaskGroup backgroundGroup;
+		std::atomic_bool stop = false;
+		for (unsigned int i = 0; i < std::max(taskScheduler.GetWorkerCount() / 2, 1u); ++i)
+		{
+			taskScheduler.AddTask([&]
+			{
+				while (!stop)
+					std::this_thread::yield();
+			}, &backgroundGroup);
+		}
+
+		RunBenchmark(name);
+
+		stop = true;
+		taskScheduler.WaitForTasks(backgroundGroup);
+	};
+
+	RunBenchmark("Jolt thread pool");
+	RunWithBackgroundWork("Jolt thread pool (with background work)");
+
+	Nz::Physics3D::Instance()->SetTaskScheduler(&taskScheduler);
+
+	RunBenchmark("TaskScheduler");
+	RunWithBackgroundWork("TaskScheduler (with background work)");
+
+	Nz::Physics3D::Instance()->SetTaskScheduler(nullptr);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,3 @@
+target("Physics3DBenchmark")
+	add_deps("NazaraPhysics3D")
+	add_files("main.cpp")
@@ -0,0 +1,153 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t ElementCount = 50'000;
+	constexpr std::size_t FrameCount = 100;
+
+	// Mimics RenderSubmesh::ComputeSortingScore: opaque elements use state indices, transparent ones their distance
+	struct FakeElement
+	{
+		Nz::UInt64 ComputeSortingScore(float cameraPosition) const
+		{
+			if (sortByDistance)
+			{
+				float distance = position - cameraPosition;
+				Nz::UInt64 distanceKey = static_cast<Nz::UInt32>(std::max(distance, 0.f) * 1000.f);
+
+				return Nz::UInt64(1) << 55 | distanceKey << 23;
+			}
+			else
+				return pipelineIndex << 35 | materialIndex << 19 | vertexBufferIndex << 11;
+		}
+
+		Nz::UInt64 materialIndex;
+		Nz::UInt64 pipelineIndex;
+		Nz::UInt64 vertexBufferIndex;
+		float position;
+		bool sortByDistance;
+	};
+
+	std::vector<FakeElement> GenerateElements(float transparentRatio)
+	{
+		std::minstd_rand randEngine(42);
+		std::uniform_int_distribution<Nz::UInt64> pipelineDis(0, 32);
+		std::uniform_int_distribution<Nz::UInt64> materialDis(0, 2000);
+		std::uniform_int_distribution<Nz::UInt64> vertexBufferDis(0, 255);
+		std::uniform_real_distribution<float> positionDis(0.f, 1000.f);
+		std::bernoulli_distribution transparentDis(transparentRatio);
+
+		std::vector<FakeElement> elements(ElementCount);
+		for (FakeElement& element : elements)
+		{
+			element.materialIndex = materialDis(randEngine);
+			element.pipelineIndex = pipelineDis(randEngine);
+			element.vertexBufferIndex = vertexBufferDis(randEngine);
+			element.position = positionDis(randEngine);
+			element.sortByDistance = transparentDis(randEngine);
+		}
+
+		return elements;
+	}
+
+	template<typename F>
+	Nz::Time MeasureFrames(F&& frame)
+	{
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < FrameCount; ++i)
+			frame(i);
+
+		return Nz::Time::Nanoseconds((Nz::GetElapsedNanoseconds() - start).AsNanoseconds() / Nz::Int64(FrameCount));
+	}
+
+	void RunBenchmark(const char* name, float transparentRatio, bool movingCamera)
+	{
+		std::cout << "--- " << name << " ---" << std::endl;
+
+		std::vector<FakeElement> elements = GenerateElements(transparentRatio);
+
+		auto CameraPosition = [&](std::size_t frameIndex)
+		{
+			return (movingCamera) ? static_cast<float>(frameIndex) : 0.f;
+		};
+
+		// Previous implementation: std::sort computing both keys on every comparison
+		{
+			std::vector<const FakeElement*> queue;
+			for (const FakeElement& element : elements)
+				queue.push_back(&element);
+
+			std::size_t scoreCount = 0;
+			Nz::Time time = MeasureFrames([&](std::size_t frameIndex)
+			{
+				float cameraPosition = CameraPosition(frameIndex);
+				std::sort(queue.begin(), queue.end(), [&](const FakeElement* lhs, const FakeElement* rhs)
+				{
+					scoreCount += 2;
+					return lhs->ComputeSortingScore(cameraPosition) < rhs->ComputeSortingScore(cameraPosition);
+				});
+			});
+
+			std::cout << "std::sort with comparator: " << time << " (" << scoreCount / FrameCount << " scores computed per frame)" << std::endl;
+		}
+
+		// RenderQueue: keys computed once per element and radix sorted
+		{
+			Nz::RenderQueue<const FakeElement*> renderQueue;
+			for (const FakeElement& element : elements)
+				renderQueue.Insert(&element);
+
+			std::size_t scoreCount = 0;
+			Nz::Time time = MeasureFrames([&](std::size_t frameIndex)
+			{
+				float cameraPosition = CameraPosition(frameIndex);
+				renderQueue.Sort([&](const FakeElement* element)
+				{
+					scoreCount++;
+					return element->ComputeSortingScore(cameraPosition);
+				});
+			});
+
+			std::cout << "RenderQueue::Sort: " << time << " (" << scoreCount / FrameCount << " scores computed per frame)" << std::endl;
+		}
+
+		// RenderQueue with a fresh queue every frame (as when visible elements change)
+		{
+			Nz::RenderQueue<const FakeElement*> renderQueue;
+
+			Nz::Time time = MeasureFrames([&](std::size_t frameIndex)
+			{
+				renderQueue.Clear();
+				for (const FakeElement& element : elements)
+					renderQueue.Insert(&element);
+
+				float cameraPosition = CameraPosition(frameIndex);
+				renderQueue.Sort([&](const FakeElement* element)
+				{
+					return element->ComputeSortingScore(cameraPosition);
+				});
+			});
+
+			std::cout << "RenderQueue::Sort (unsorted queue every frame): " << time << std::endl;
+		}
+	}
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	std::cout << ElementCount << " elements, average over " << FrameCount << " frames" << std::endl;
+
+	RunBenchmark("opaque elements, static camera", 0.f, false);
+	RunBenchmark("10% transparent elements, moving camera", 0.1f, true);
+	RunBenchmark("transparent elements, moving camera", 1.f, true);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,3 @@
+target("RenderQueueBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -2,6 +2,7 @@
 #include <Nazara/Core/Core.hpp>
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <Nazara/Core/Image.hpp>
+#include "spawn.hpp"
 #include "task.hpp"
 #include <iostream>
 #include <mutex>
@@ -20,6 +21,8 @@ int main()
 
 	Nz::TaskScheduler taskScheduler;
 
+	RunSpawnBenchmarks(taskScheduler);
+
 	std::cout << "Initializing..." << std::endl;
 
 	// from https://raytracing.github.io/books/RayTracingInOneWeekend.html
@@ -64,7 +67,7 @@ int main()
 	for (unsigned int i = 0; i < boxes.size(); ++i)
 	{
 		unsigned int x = i % boxCount;
-		unsigned int y = i % boxCount;
+		unsigned int y = i / boxCount;
 
 		Nz::Vector2ui mins(x * tileSize, y * tileSize);
 		Nz::Vector2ui maxs = mins + Nz::Vector2ui(tileSize);
@@ -104,6 +107,70 @@ int main()
 	std::cout << "thread count: " << threadCounter << std::endl;
 	std::cout << "box count: " << boxCountAcc << std::endl;
 
+	auto MeasureTime = [&](const char* name, auto&& func)
+	{
+		std::cout << "Measuring " << name << "..." << std::endl;
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		func();
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		std::cout << name << " update time: " << (end - start) << " (" << (end - start).AsSeconds<double>() / taskSchedulerTime.AsSeconds<double>() * 100.0 << "% of per-tile AddTask)" << std::endl;
+	};
+
+	MeasureTime("task-group", [&]
+	{
+		Nz::TaskScheduler::TaskGroup group;
+		for (auto&& [offset, dims] : boxes)
+		{
+			taskScheduler.AddTask([&, offset = offset, dims = dims]
+			{
+				RayCast(sceneData, offset, dims);
+			}, &group);
+		}
+		taskScheduler.WaitForTasks(group);
+	});
+
+	MeasureTime("parallel-for (per tile)", [&]
+	{
+		taskScheduler.ParallelFor(0, boxes.size(), 1, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+				RayCast(sceneData, boxes[i].first, boxes[i].second);
+		});
+	});
+
+	MeasureTime("parallel-for (adaptive rows)", [&]
+	{
+		taskScheduler.ParallelFor(0, imageDimensions, 0, [&](std::size_t begin, std::size_t end)
+		{
+			RayCast(sceneData, Nz::Vector2ui(0, Nz::SafeCast<unsigned int>(begin)), Nz::Vector2ui(imageDimensions, Nz::SafeCast<unsigned int>(end - begin)));
+		});
+	});
+
+	MeasureTime("dependent tiles (row by row)", [&]
+	{
+		// Each row of tiles depends on the previous one, only tiles of the same row can run concurrently
+		Nz::TaskScheduler::TaskGroup group;
+		std::vector<Nz::TaskScheduler::TaskHandle> previousRow;
+		std::vector<Nz::TaskScheduler::TaskHandle> currentRow;
+		for (unsigned int y = 0; y < boxCount; ++y)
+		{
+			currentRow.clear();
+			for (unsigned int x = 0; x < boxCount; ++x)
+			{
+				auto&& [offset, dims] = boxes[y * boxCount + x];
+				currentRow.push_back(taskScheduler.AddTask([&, offset = offset, dims = dims]
+				{
+					RayCast(sceneData, offset, dims);
+				}, previousRow, &group));
+			}
+
+			std::swap(previousRow, currentRow);
+		}
+		taskScheduler.WaitForTasks(group);
+	});
+
 	static_assert(sizeof(PixelColor) == 3 * sizeof(Nz::UInt8));
 
 	Nz::Image image(Nz::ImageType::E2D, Nz::PixelFormat::RGB8, imageDimensions, imageDimensions);
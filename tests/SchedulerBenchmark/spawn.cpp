@@ -0,0 +1,140 @@
+#include "spawn.hpp"
+#include <Nazara/Core/Clock.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t SpawnCount = 1'000'000;
+	constexpr std::size_t LatencySampleCount = 10'000;
+
+	void PrintThroughput(const char* name, std::size_t taskCount, Nz::Time duration)
+	{
+		double seconds = duration.AsSeconds<double>();
+		std::cout << name << ": " << duration << " for " << taskCount << " tasks (" << static_cast<Nz::UInt64>(taskCount / seconds) << " tasks/s, " << duration.AsNanoseconds() / static_cast<Nz::Int64>(taskCount) << "ns/task)" << std::endl;
+	}
+}
+
+void RunSpawnBenchmarks(Nz::TaskScheduler& taskScheduler)
+{
+	std::cout << "Measuring spawn/steal throughput..." << std::endl;
+
+	std::atomic_uint64_t counter = 0;
+
+	// Tasks submitted from an external thread, they go through worker inboxes
+	{
+		Nz::TaskScheduler::TaskGroup group;
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < SpawnCount; ++i)
+			taskScheduler.AddTask([&counter] { counter.fetch_add(1, std::memory_order_relaxed); }, &group);
+
+		taskScheduler.WaitForTasks(group);
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		PrintThroughput("external spawn", SpawnCount, end - start);
+	}
+
+	// Tasks submitted from a single worker, they're pushed on its local deque and other workers have to steal them
+	{
+		Nz::TaskScheduler::TaskGroup group;
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		taskScheduler.AddTask([&]
+		{
+			for (std::size_t i = 0; i < SpawnCount; ++i)
+				taskScheduler.AddTask([&counter] { counter.fetch_add(1, std::memory_order_relaxed); }, &group);
+		}, &group);
+
+		taskScheduler.WaitForTasks(group);
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		PrintThroughput("single worker spawn (stealing)", SpawnCount, end - start);
+	}
+
+	// Recursive fork (each task spawns two children until the requested depth), spawning is spread across all workers
+	{
+		constexpr unsigned int Depth = 20; //< 2^21 - 1 tasks
+
+		Nz::TaskScheduler::TaskGroup group;
+
+		auto Fork = [&](auto&& self, unsigned int depth) -> void
+		{
+			counter.fetch_add(1, std::memory_order_relaxed);
+			if (depth == 0)
+				return;
+
+			for (unsigned int i = 0; i < 2; ++i)
+				taskScheduler.AddTask([&self, depth] { self(self, depth - 1); }, &group);
+		};
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		taskScheduler.AddTask([&] { Fork(Fork, Depth); }, &group);
+		taskScheduler.WaitForTasks(group);
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		PrintThroughput("recursive fork", (std::size_t(1) << (Depth + 1)) - 1, end - start);
+	}
+
+	// Capture bigger than the inline storage, to see the cost of the heap fallback
+	{
+		struct BigCapture
+		{
+			std::atomic_uint64_t* counter;
+			Nz::UInt8 padding[Nz::TaskScheduler::Task::InlineStorageSize];
+		};
+
+		Nz::TaskScheduler::TaskGroup group;
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < SpawnCount; ++i)
+		{
+			BigCapture capture;
+			capture.counter = &counter;
+			capture.padding[0] = 0;
+
+			taskScheduler.AddTask([capture] { capture.counter->fetch_add(capture.padding[0] + 1, std::memory_order_relaxed); }, &group);
+		}
+
+		taskScheduler.WaitForTasks(group);
+		Nz::Time end = Nz::GetElapsedNanoseconds();
+
+		PrintThroughput("external spawn (heap capture)", SpawnCount, end - start);
+	}
+
+	std::cout << "Measuring spawn latency..." << std::endl;
+
+	// Time between the submission of a task and the beginning of its execution (workers may be sleeping)
+	{
+		std::vector<Nz::Int64> latencies;
+		latencies.reserve(LatencySampleCount);
+
+		for (std::size_t i = 0; i < LatencySampleCount; ++i)
+		{
+			Nz::TaskScheduler::TaskGroup group;
+
+			Nz::Time startTime;
+			Nz::Time submitTime = Nz::GetElapsedNanoseconds();
+			taskScheduler.AddTask([&] { startTime = Nz::GetElapsedNanoseconds(); }, &group);
+
+			// Don't help, we want to measure the time it takes for a worker to pick the task
+			while (!group.IsDone())
+				std::this_thread::yield();
+
+			latencies.push_back((startTime - submitTime).AsNanoseconds());
+		}
+
+		std::sort(latencies.begin(), latencies.end());
+
+		Nz::Int64 sum = 0;
+		for (Nz::Int64 latency : latencies)
+			sum += latency;
+
+		std::cout << "spawn latency: avg " << sum / static_cast<Nz::Int64>(latencies.size()) << "ns, median " << latencies[latencies.size() / 2] << "ns, 99th percentile " << latencies[latencies.size() * 99 / 100] << "ns, max " << latencies.back() << "ns" << std::endl;
+	}
+
+	std::cout << "executed " << counter << " tasks" << std::endl;
+}
@@ -0,0 +1,3 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+
+void RunSpawnBenchmarks(Nz::TaskScheduler& taskScheduler);
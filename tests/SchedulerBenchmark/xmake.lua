@@ -1,5 +1,5 @@
 target("SchedulerBenchmark")
 	add_deps("NazaraCore")
 	add_files("main.cpp")
-	add_headerfiles("task.hpp")
-	add_files("task.cpp")
+	add_headerfiles("spawn.hpp", "task.hpp")
+	add_files("spawn.cpp", "task.cpp")
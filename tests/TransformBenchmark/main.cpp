@@ -0,0 +1,158 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Core/Core.hpp>
+#include <Nazara/Core/Node.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/TransformHierarchy.hpp>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t TransformCount = 1'000'000;
+	constexpr std::size_t FrameCount = 10;
+
+	struct HierarchyShape
+	{
+		const char* name;
+		std::size_t rootCount; //< every root has an equal share of the remaining transforms
+		bool chain; //< children form a chain (deep) instead of all being attached to the root (wide)
+	};
+
+	struct MovePattern
+	{
+		const char* name;
+		std::size_t step; //< one transform out of step is moved every frame
+	};
+
+	template<typename F>
+	Nz::Time MeasureFrames(F&& frame)
+	{
+		frame(); // warm-up
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < FrameCount; ++i)
+			frame();
+
+		return Nz::Time::Nanoseconds((Nz::GetElapsedNanoseconds() - start).AsNanoseconds() / Nz::Int64(FrameCount));
+	}
+
+	// Returns the parent index of every transform (TransformCount when it's a root)
+	std::vector<std::size_t> BuildParents(const HierarchyShape& shape)
+	{
+		std::vector<std::size_t> parents(TransformCount);
+		std::size_t transformPerRoot = TransformCount / shape.rootCount;
+		for (std::size_t i = 0; i < TransformCount; ++i)
+		{
+			std::size_t localIndex = i % transformPerRoot;
+			if (localIndex == 0)
+				parents[i] = TransformCount;
+			else if (shape.chain)
+				parents[i] = i - 1;
+			else
+				parents[i] = i - localIndex;
+		}
+
+		return parents;
+	}
+
+	void RunBenchmark(Nz::TaskScheduler& taskScheduler, const HierarchyShape& shape, const MovePattern& movePattern)
+	{
+		std::cout << "--- " << shape.name << " hierarchy, " << movePattern.name << " ---" << std::endl;
+
+		std::vector<std::size_t> parents = BuildParents(shape);
+
+		std::minstd_rand randEngine(42);
+		std::uniform_real_distribution<float> moveDis(-0.01f, 0.01f);
+
+		std::vector<Nz::Vector3f> movements(TransformCount);
+		for (Nz::Vector3f& movement : movements)
+			movement = Nz::Vector3f(moveDis(randEngine), moveDis(randEngine), moveDis(randEngine));
+
+		// Nodes
+		{
+			std::vector<std::unique_ptr<Nz::Node>> nodes(TransformCount);
+			for (std::size_t i = 0; i < TransformCount; ++i)
+			{
+				nodes[i] = std::make_unique<Nz::Node>(Nz::Vector3f(0.f, 0.f, 0.1f), Nz::Quaternionf(Nz::EulerAnglesf(0.f, 0.1f, 0.f)));
+				if (parents[i] != TransformCount)
+					nodes[i]->SetParent(*nodes[parents[i]]);
+			}
+
+			Nz::Time nodeTime = MeasureFrames([&]
+			{
+				for (std::size_t i = 0; i < TransformCount; i += movePattern.step)
+					nodes[i]->Move(movements[i]);
+
+				// Pull every transform matrix, as rendering would
+				for (const auto& node : nodes)
+					node->EnsureTransformMatrixUpdate();
+			});
+
+			std::cout << "Node: " << nodeTime << std::endl;
+
+			// Destroy children first to avoid each node detaching its children
+			while (!nodes.empty())
+				nodes.pop_back();
+		}
+
+		// TransformHierarchy
+		{
+			Nz::TransformHierarchy hierarchy;
+
+			std::vector<Nz::TransformHierarchy::TransformId> transformIds(TransformCount);
+			for (std::size_t i = 0; i < TransformCount; ++i)
+			{
+				Nz::TransformHierarchy::TransformId parentId = (parents[i] != TransformCount) ? transformIds[parents[i]] : Nz::TransformHierarchy::InvalidId;
+				transformIds[i] = hierarchy.Create(parentId, Nz::Vector3f(0.f, 0.f, 0.1f), Nz::Quaternionf(Nz::EulerAnglesf(0.f, 0.1f, 0.f)));
+			}
+
+			Nz::Time singleThreadedTime = MeasureFrames([&]
+			{
+				for (std::size_t i = 0; i < TransformCount; i += movePattern.step)
+					hierarchy.Move(transformIds[i], movements[i]);
+
+				hierarchy.Update();
+			});
+
+			std::cout << "TransformHierarchy (" << hierarchy.GetDepthCount() << " depth levels): " << singleThreadedTime << std::endl;
+
+			Nz::Time multiThreadedTime = MeasureFrames([&]
+			{
+				for (std::size_t i = 0; i < TransformCount; i += movePattern.step)
+					hierarchy.Move(transformIds[i], movements[i]);
+
+				hierarchy.Update(&taskScheduler);
+			});
+
+			std::cout << "TransformHierarchy with " << taskScheduler.GetWorkerCount() << " workers: " << multiThreadedTime << std::endl;
+		}
+	}
+}
+
+int main()
+{
+	Nz::Modules<Nz::Core> core;
+
+	Nz::TaskScheduler taskScheduler;
+
+	std::vector<HierarchyShape> shapes = {
+		{ "wide (1000 roots of 999 children)", 1000, false },
+		{ "deep (1000 chains of 1000 transforms)", 1000, true },
+		{ "flat (1M roots)", TransformCount, false }
+	};
+
+	std::vector<MovePattern> movePatterns = {
+		{ "every transform moved", 1 },
+		{ "1% of transforms moved", 100 }
+	};
+
+	for (const HierarchyShape& shape : shapes)
+	{
+		for (const MovePattern& movePattern : movePatterns)
+			RunBenchmark(taskScheduler, shape, movePattern);
+	}
+
+	return EXIT_SUCCESS;
+}
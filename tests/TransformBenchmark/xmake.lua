@@ -0,0 +1,3 @@
+target("TransformBenchmark")
+	add_deps("NazaraCore")
+	add_files("main.cpp")
@@ -0,0 +1,117 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
+#include <Nazara/Network/Network.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <array>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t BatchSize = 32;
+	constexpr std::size_t DatagramSize = 64;
+	constexpr std::size_t RoundCount = 20'000;
+}
+
+int main()
+{
+	Nz::Modules<Nz::Network> network;
+
+	Nz::UdpSocket server(Nz::NetProtocol::IPv4);
+	if (server.Bind(0) != Nz::SocketState::Bound)
+	{
+		std::cerr << "failed to bind server socket" << std::endl;
+		return EXIT_FAILURE;
+	}
+	server.EnableBlocking(false);
+
+	Nz::IpAddress serverIP(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundPort());
+
+	Nz::UdpSocket client(Nz::NetProtocol::IPv4);
+	if (client.Bind(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), 0)) != Nz::SocketState::Bound)
+	{
+		std::cerr << "failed to bind client socket" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::vector<Nz::UInt8> sendData(BatchSize * DatagramSize, 0xAB);
+	std::vector<Nz::UInt8> receiveData(BatchSize * DatagramSize);
+
+	std::array<Nz::NetBuffer, BatchSize> sendBuffers;
+	std::array<Nz::NetBuffer, BatchSize> receiveBuffers;
+	std::array<Nz::NetDatagram, BatchSize> sendDatagrams;
+	std::array<Nz::NetDatagram, BatchSize> receiveDatagrams;
+	for (std::size_t i = 0; i < BatchSize; ++i)
+	{
+		sendBuffers[i] = { &sendData[i * DatagramSize], DatagramSize };
+		receiveBuffers[i] = { &receiveData[i * DatagramSize], DatagramSize };
+		sendDatagrams[i] = { serverIP, &sendBuffers[i], 1, 0 };
+		receiveDatagrams[i] = { Nz::IpAddress::Invalid, &receiveBuffers[i], 1, 0 };
+	}
+
+	// Each round sends a burst of datagrams on loopback and drains it, reports packets per second and CPU time per packet
+	auto Measure = [&](const char* name, auto&& sendBurst, auto&& receiveBurst)
+	{
+		std::size_t receivedCount = 0;
+
+		std::clock_t cpuStart = std::clock();
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t round = 0; round < RoundCount; ++round)
+		{
+			sendBurst();
+
+			// Loopback delivery is synchronous, anything not there yet was dropped
+			std::size_t count;
+			while ((count = receiveBurst()) > 0)
+				receivedCount += count;
+		}
+		Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+		std::clock_t cpuTime = std::clock() - cpuStart;
+
+		if (receivedCount == 0)
+		{
+			std::cout << name << ": no datagram received" << std::endl;
+			return;
+		}
+
+		double cpuNanoseconds = 1'000'000'000.0 * cpuTime / CLOCKS_PER_SEC;
+		std::cout << name << ": " << static_cast<Nz::UInt64>(receivedCount / elapsed.AsSeconds<double>()) << " packets/s, "
+		          << static_cast<Nz::UInt64>(cpuNanoseconds / receivedCount) << "ns CPU per packet (" << receivedCount << "/" << RoundCount * BatchSize << " received)" << std::endl;
+	};
+
+	Measure("UdpSocket::Send/Receive", [&]
+	{
+		for (std::size_t i = 0; i < BatchSize; ++i)
+			client.Send(serverIP, sendBuffers[i].data, DatagramSize, nullptr);
+	},
+	[&]() -> std::size_t
+	{
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < BatchSize; ++i)
+		{
+			std::size_t received;
+			if (!server.Receive(receiveBuffers[i].data, DatagramSize, nullptr, &received) || received == 0)
+				break;
+
+			count++;
+		}
+
+		return count;
+	});
+
+	Measure("UdpSocket::SendDatagrams/ReceiveDatagrams", [&]
+	{
+		client.SendDatagrams(sendDatagrams.data(), sendDatagrams.size(), nullptr);
+	},
+	[&]() -> std::size_t
+	{
+		std::size_t count;
+		if (!server.ReceiveDatagrams(receiveDatagrams.data(), receiveDatagrams.size(), &count))
+			return 0;
+
+		return count;
+	});
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,3 @@
+target("UdpSocketBenchmark")
+	add_deps("NazaraNetwork")
+	add_files("main.cpp")
@@ -0,0 +1,174 @@
+#include <Nazara/Core/ArchiveBuilder.hpp>
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/File.hpp>
+#include <Nazara/Core/VirtualDirectory.hpp>
+#include <Nazara/Core/VirtualDirectoryArchiveResolver.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+	Nz::ByteArray GenerateContent(std::mt19937& rand, std::size_t size, bool compressible)
+	{
+		std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+		Nz::ByteArray content(size, 0);
+		for (std::size_t i = 0; i < size; ++i)
+			content[i] = static_cast<Nz::UInt8>((compressible) ? (i / 64) % 7 : byteDis(rand));
+
+		return content;
+	}
+
+	bool CheckContent(Nz::VirtualDirectory& directory, std::string_view path, const Nz::ByteArray& expected)
+	{
+		bool matches = false;
+		bool found = directory.GetFileContent(path, [&](const void* data, std::size_t size)
+		{
+			matches = (size == expected.GetSize() && (size == 0 || std::memcmp(data, expected.GetConstBuffer(), size) == 0));
+		});
+
+		return found && matches;
+	}
+}
+
+TEST_CASE("Archive", "[CORE][ARCHIVE]")
+{
+	std::mt19937 rand(42);
+
+	Nz::ByteArray stored = GenerateContent(rand, 1000, false);
+	Nz::ByteArray compressed = GenerateContent(rand, 100'000, true);
+	Nz::ByteArray incompressible = GenerateContent(rand, 5000, false);
+	Nz::ByteArray text("Hello world", 11);
+
+	std::filesystem::path archivePath = "ArchiveTest.nzpk";
+
+	Nz::ArchiveBuilder builder;
+	builder.AddFile("stored.bin", stored);
+	builder.AddFile("Textures/compressed.bin", compressed, Nz::ArchiveCompression::LZ4);
+	builder.AddFile("Textures/incompressible.bin", incompressible, Nz::ArchiveCompression::LZ4);
+	builder.AddFile("Textures/Sub/hello.txt", text);
+	builder.AddFile("empty.txt", Nz::ByteArray{});
+	REQUIRE(builder.GetFileCount() == 5);
+	REQUIRE(builder.Save(archivePath));
+
+	SECTION("Duplicated paths are rejected")
+	{
+		Nz::ArchiveBuilder invalidBuilder;
+		invalidBuilder.AddFile("a/b", text);
+		invalidBuilder.AddFile("a\\b", text);
+		CHECK_FALSE(invalidBuilder.Save("InvalidArchive.nzpk"));
+	}
+
+	SECTION("A path can't be both a file and a directory")
+	{
+		Nz::ArchiveBuilder invalidBuilder;
+		invalidBuilder.AddFile("a", text);
+		invalidBuilder.AddFile("a/b", text);
+		CHECK_FALSE(invalidBuilder.Save("InvalidArchive.nzpk"));
+	}
+
+	SECTION("Non-archive files are rejected")
+	{
+		std::filesystem::path invalidPath = "InvalidArchive.nzpk";
+		REQUIRE(Nz::File::WriteWhole(invalidPath, compressed.GetConstBuffer(), compressed.GetSize()));
+		CHECK_FALSE(Nz::VirtualDirectoryArchiveResolver::Open(invalidPath));
+	}
+
+	SECTION("Corrupted bucket tables are rejected")
+	{
+		std::optional<std::vector<Nz::UInt8>> content = Nz::File::ReadWhole(archivePath);
+		REQUIRE(content);
+
+		// See ArchiveHeader
+		Nz::UInt32 entryCount;
+		Nz::UInt32 bucketCount;
+		Nz::UInt64 bucketTableOffset;
+		std::memcpy(&entryCount, content->data() + 8, sizeof(entryCount));
+		std::memcpy(&bucketCount, content->data() + 12, sizeof(bucketCount));
+		std::memcpy(&bucketTableOffset, content->data() + 40, sizeof(bucketTableOffset));
+		REQUIRE(bucketTableOffset + bucketCount * sizeof(Nz::UInt32) <= content->size());
+
+		auto CheckRejected = [&](auto&& corruptBuckets)
+		{
+			std::vector<Nz::UInt8> corruptedContent = *content;
+			corruptBuckets(reinterpret_cast<Nz::UInt32*>(corruptedContent.data() + bucketTableOffset));
+
+			std::filesystem::path invalidPath = "InvalidArchive.nzpk";
+			REQUIRE(Nz::File::WriteWhole(invalidPath, corruptedContent.data(), corruptedContent.size()));
+			CHECK_FALSE(Nz::VirtualDirectoryArchiveResolver::Open(invalidPath));
+		};
+
+		// Out of bounds entry index
+		CheckRejected([&](Nz::UInt32* buckets) { buckets[0] = entryCount + 1; });
+
+		// No empty bucket, lookups of missing paths would never end
+		CheckRejected([&](Nz::UInt32* buckets)
+		{
+			for (Nz::UInt32 i = 0; i < bucketCount; ++i)
+				buckets[i] = 1;
+		});
+	}
+
+	WHEN("Opening the archive")
+	{
+		std::shared_ptr<Nz::VirtualDirectoryArchiveResolver> resolver = Nz::VirtualDirectoryArchiveResolver::Open(archivePath);
+		REQUIRE(resolver);
+
+		std::shared_ptr<Nz::VirtualDirectory> virtualDir = std::make_shared<Nz::VirtualDirectory>(resolver);
+
+		THEN("Files can be retrieved")
+		{
+			CHECK(CheckContent(*virtualDir, "stored.bin", stored));
+			CHECK(CheckContent(*virtualDir, "Textures/compressed.bin", compressed));
+			CHECK(CheckContent(*virtualDir, "Textures/incompressible.bin", incompressible));
+			CHECK(CheckContent(*virtualDir, "Textures/Sub/hello.txt", text));
+			CHECK(virtualDir->Exists("empty.txt"));
+
+			CHECK_FALSE(virtualDir->Exists("missing.bin"));
+			CHECK_FALSE(virtualDir->Exists("Textures/hello.txt"));
+			CHECK_FALSE(virtualDir->Exists("Textures/Sub/hello.txt/foo"));
+		}
+
+		THEN("Directories can be retrieved and resolved")
+		{
+			CHECK(virtualDir->GetDirectoryEntry("Textures/Sub", [&](const Nz::VirtualDirectory::DirectoryEntry& entry)
+			{
+				CHECK(CheckContent(*entry.directory, "hello.txt", text));
+				CHECK_FALSE(entry.directory->Exists("compressed.bin"));
+			}));
+
+			CHECK_FALSE(virtualDir->GetDirectoryEntry("stored.bin", [](const Nz::VirtualDirectory::DirectoryEntry& /*entry*/) {}));
+		}
+
+		THEN("Entries can be iterated")
+		{
+			std::set<std::string> rootEntries;
+			virtualDir->ForEach([&](std::string_view name, const Nz::VirtualDirectory::Entry& /*entry*/)
+			{
+				CHECK(rootEntries.emplace(name).second);
+			});
+			CHECK(rootEntries == std::set<std::string>{ "Textures", "empty.txt", "stored.bin" });
+
+			std::set<std::string> textureEntries;
+			CHECK(virtualDir->GetDirectoryEntry("Textures", [&](const Nz::VirtualDirectory::DirectoryEntry& entry)
+			{
+				entry.directory->ForEach([&](std::string_view name, const Nz::VirtualDirectory::Entry& entry)
+				{
+					CHECK(std::holds_alternative<Nz::VirtualDirectory::DirectoryEntry>(entry) == (name == "Sub"));
+					CHECK(textureEntries.emplace(name).second);
+				});
+			}));
+			CHECK(textureEntries == std::set<std::string>{ "Sub", "compressed.bin", "incompressible.bin" });
+		}
+
+		THEN("Compressed files are smaller in the archive")
+		{
+			CHECK(std::filesystem::file_size(archivePath) < compressed.GetSize());
+		}
+	}
+}
@@ -0,0 +1,80 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/DeltaEncoding.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+
+SCENARIO("DeltaEncoding", "[CORE][DELTAENCODING]")
+{
+	std::mt19937 rand(42);
+	std::uniform_int_distribution<unsigned int> byteDis(0, 255);
+
+	Nz::ByteArray reference(4096, 0);
+	for (auto& byte : reference)
+		byte = static_cast<Nz::UInt8>(byteDis(rand));
+
+	auto CheckRoundtrip = [&](const Nz::ByteArray& data)
+	{
+		Nz::ByteArray delta;
+		Nz::ComputeDelta(reference, data, delta);
+
+		Nz::ByteArray decoded;
+		REQUIRE(Nz::ApplyDelta(reference, delta, decoded));
+		CHECK(decoded == data);
+
+		return delta.GetSize();
+	};
+
+	WHEN("Data is identical to the reference")
+	{
+		CHECK(CheckRoundtrip(reference) < 8);
+	}
+
+	WHEN("A few bytes changed")
+	{
+		Nz::ByteArray data = reference;
+		data[0] ^= 0xFF;
+		data[1000] ^= 0xFF;
+		data[1001] ^= 0xFF;
+		data[4095] ^= 0xFF;
+
+		CHECK(CheckRoundtrip(data) < 32);
+	}
+
+	WHEN("Data is bigger or smaller than the reference")
+	{
+		Nz::ByteArray bigger = reference;
+		bigger.Append("Hello world", 11);
+		CHECK(CheckRoundtrip(bigger) < 32);
+
+		Nz::ByteArray smaller = reference;
+		smaller.Resize(1000);
+		CHECK(CheckRoundtrip(smaller) < 8);
+
+		CheckRoundtrip(Nz::ByteArray{});
+	}
+
+	WHEN("Data is unrelated to the reference")
+	{
+		Nz::ByteArray data(4096, 0);
+		for (auto& byte : data)
+			byte = static_cast<Nz::UInt8>(byteDis(rand));
+
+		CheckRoundtrip(data);
+	}
+
+	WHEN("Delta is corrupted")
+	{
+		Nz::ByteArray data = reference;
+		data[2000] ^= 0xFF;
+
+		Nz::ByteArray delta;
+		Nz::ComputeDelta(reference, data, delta);
+
+		Nz::ByteArray decoded;
+		CHECK_FALSE(Nz::ApplyDelta(reference, Nz::ByteArray(delta.GetConstBuffer(), delta.GetSize() - 1), decoded));
+
+		Nz::ByteArray smallerReference = reference;
+		smallerReference.Resize(1000);
+		CHECK_FALSE(Nz::ApplyDelta(smallerReference, delta, decoded));
+	}
+}
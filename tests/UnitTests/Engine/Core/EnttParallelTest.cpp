@@ -0,0 +1,81 @@
+#include <Nazara/Core/EnttParallel.hpp>
+#include <Nazara/Core/EnttSystemGraph.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <optional>
+
+namespace
+{
+	struct Counter
+	{
+		unsigned int value = 0;
+	};
+
+	struct Tag
+	{
+		int value;
+	};
+
+	struct Excluded {};
+}
+
+SCENARIO("EnttParallelForEach", "[CORE][EnttParallel]")
+{
+	for (std::size_t workerCount : { 0, 1, 4 })
+	{
+		GIVEN("A registry with many entities, using " << workerCount << " workers (0 = no task scheduler)")
+		{
+			std::optional<Nz::TaskScheduler> taskScheduler;
+			if (workerCount > 0)
+				taskScheduler.emplace(workerCount);
+
+			entt::registry registry;
+			for (int i = 0; i < 10'000; ++i)
+			{
+				entt::entity entity = registry.create();
+				registry.emplace<Counter>(entity);
+				if (i % 3 != 0)
+					registry.emplace<Tag>(entity, i);
+
+				if (i % 7 == 0)
+					registry.emplace<Excluded>(entity);
+			}
+
+			WHEN("We iterate a view in parallel")
+			{
+				auto view = registry.view<Counter, Tag>(entt::exclude<Excluded>);
+				Nz::EnttParallelForEach((taskScheduler) ? &*taskScheduler : nullptr, view, [](entt::entity /*entity*/, Counter& counter, const Tag& /*tag*/)
+				{
+					counter.value++;
+				}, 64);
+
+				THEN("Every entity of the view was processed exactly once")
+				{
+					unsigned int invalidCount = 0;
+					for (auto [entity, counter] : registry.view<Counter>().each())
+					{
+						unsigned int expectedValue = (registry.all_of<Tag>(entity) && !registry.all_of<Excluded>(entity)) ? 1 : 0;
+						if (counter.value != expectedValue)
+							invalidCount++;
+					}
+
+					CHECK(invalidCount == 0);
+				}
+			}
+		}
+	}
+
+	GIVEN("A registry with a task scheduler registered by a system graph")
+	{
+		Nz::TaskScheduler taskScheduler(2);
+
+		entt::registry registry;
+		CHECK(Nz::GetEnttTaskScheduler(registry) == nullptr);
+
+		Nz::EnttSystemGraph systemGraph(registry);
+		systemGraph.SetTaskScheduler(&taskScheduler);
+		CHECK(Nz::GetEnttTaskScheduler(registry) == &taskScheduler);
+
+		systemGraph.SetTaskScheduler(nullptr);
+		CHECK(Nz::GetEnttTaskScheduler(registry) == nullptr);
+	}
+}
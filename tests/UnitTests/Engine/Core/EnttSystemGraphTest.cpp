@@ -0,0 +1,247 @@
+#include <Nazara/Core/EnttSystemGraph.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <thread>
+
+namespace
+{
+	struct Position
+	{
+		float value;
+	};
+
+	struct Speed
+	{
+		float value;
+	};
+
+	struct Health
+	{
+		int value;
+	};
+
+	struct ExecutionLog
+	{
+		// Independent systems wait (for a bounded time) for each other, to check they actually run concurrently
+		void EnterIndependentSystem()
+		{
+			unsigned int running = ++runningIndependentSystems;
+
+			unsigned int peak = peakIndependentSystems.load();
+			while (running > peak && !peakIndependentSystems.compare_exchange_weak(peak, running));
+
+			if (!waitForIndependentSystems)
+				return;
+
+			// The other system raises the peak when it starts while we're still running
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+			while (peakIndependentSystems.load() < 2 && std::chrono::steady_clock::now() < deadline)
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+
+		void LeaveIndependentSystem()
+		{
+			--runningIndependentSystems;
+		}
+
+		std::atomic_uint counter = 0;
+		std::atomic_uint peakIndependentSystems = 0;
+		std::atomic_uint runningIndependentSystems = 0;
+		bool waitForIndependentSystems = false;
+		unsigned int healthOrder = 0;
+		unsigned int moveOrder = 0;
+		unsigned int speedOrder = 0;
+		unsigned int syncOrder = 0;
+	};
+
+	class SpeedSystem
+	{
+		public:
+			static constexpr Nz::Int64 ExecutionOrder = 0;
+			using Components = Nz::TypeList<Speed>;
+
+			SpeedSystem(entt::registry& registry, ExecutionLog& log) :
+			m_registry(registry),
+			m_log(log)
+			{
+			}
+
+			void Update(Nz::Time /*elapsedTime*/)
+			{
+				m_log.EnterIndependentSystem();
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+				for (auto [entity, speed] : m_registry.view<Speed>().each())
+					speed.value *= 2.f;
+
+				m_log.LeaveIndependentSystem();
+
+				m_log.speedOrder = ++m_log.counter;
+			}
+
+		private:
+			entt::registry& m_registry;
+			ExecutionLog& m_log;
+	};
+
+	class MoveSystem
+	{
+		public:
+			static constexpr Nz::Int64 ExecutionOrder = 1;
+			using Components = Nz::TypeList<Position>;
+			using ReadOnlyComponents = Nz::TypeList<Speed>;
+
+			MoveSystem(entt::registry& registry, ExecutionLog& log) :
+			m_registry(registry),
+			m_log(log)
+			{
+			}
+
+			void Update(Nz::Time /*elapsedTime*/)
+			{
+				for (auto [entity, position, speed] : m_registry.view<Position, Speed>().each())
+					position.value += speed.value;
+
+				m_log.moveOrder = ++m_log.counter;
+			}
+
+		private:
+			entt::registry& m_registry;
+			ExecutionLog& m_log;
+	};
+
+	class HealthSystem
+	{
+		public:
+			static constexpr Nz::Int64 ExecutionOrder = 0;
+			using Components = Nz::TypeList<Health>;
+
+			HealthSystem(entt::registry& registry, ExecutionLog& log) :
+			m_registry(registry),
+			m_log(log)
+			{
+			}
+
+			void Update(Nz::Time /*elapsedTime*/)
+			{
+				m_log.EnterIndependentSystem();
+
+				for (auto [entity, health] : m_registry.view<Health>().each())
+					health.value--;
+
+				m_log.LeaveIndependentSystem();
+
+				m_log.healthOrder = ++m_log.counter;
+			}
+
+		private:
+			entt::registry& m_registry;
+			ExecutionLog& m_log;
+	};
+
+	// No declared components, has to run alone
+	class SyncSystem
+	{
+		public:
+			static constexpr Nz::Int64 ExecutionOrder = 2;
+
+			SyncSystem(entt::registry& /*registry*/, ExecutionLog& log) :
+			m_log(log)
+			{
+			}
+
+			void Update(Nz::Time /*elapsedTime*/)
+			{
+				m_log.syncOrder = ++m_log.counter;
+			}
+
+		private:
+			ExecutionLog& m_log;
+	};
+}
+
+SCENARIO("EnttSystemGraph", "[CORE][EnttSystemGraph]")
+{
+	for (std::size_t workerCount : { 0, 1, 4 })
+	{
+		GIVEN("A system graph with systems accessing components, using " << workerCount << " workers (0 = no task scheduler)")
+		{
+			std::optional<Nz::TaskScheduler> taskScheduler;
+			if (workerCount > 0)
+				taskScheduler.emplace(workerCount);
+
+			entt::registry registry;
+			for (int i = 0; i < 100; ++i)
+			{
+				entt::entity entity = registry.create();
+				registry.emplace<Position>(entity, 0.f);
+				registry.emplace<Speed>(entity, 1.f);
+				registry.emplace<Health>(entity, 10);
+			}
+
+			ExecutionLog log;
+			log.waitForIndependentSystems = (workerCount > 1);
+
+			Nz::EnttSystemGraph systemGraph(registry);
+			systemGraph.SetTaskScheduler((taskScheduler) ? &*taskScheduler : nullptr);
+			systemGraph.AddSystem<SyncSystem>(log);
+			systemGraph.AddSystem<MoveSystem>(log);
+			systemGraph.AddSystem<HealthSystem>(log);
+			systemGraph.AddSystem<SpeedSystem>(log);
+
+			WHEN("We update it multiple times")
+			{
+				for (std::size_t i = 0; i < 3; ++i)
+				{
+					log.counter = 0;
+					systemGraph.Update(Nz::Time::Milliseconds(16));
+
+					INFO("update #" << i);
+
+					// MoveSystem reads what SpeedSystem writes and SyncSystem has to run after everything
+					CHECK(log.speedOrder < log.moveOrder);
+					CHECK(log.healthOrder < log.syncOrder);
+					CHECK(log.moveOrder < log.syncOrder);
+					CHECK(log.syncOrder == 4);
+				}
+
+				// HealthSystem and SpeedSystem don't share any component
+				if (workerCount > 1)
+					CHECK(log.peakIndependentSystems > 1);
+				else if (workerCount == 0)
+					CHECK(log.peakIndependentSystems == 1);
+
+				for (auto [entity, position, speed, health] : registry.view<Position, Speed, Health>().each())
+				{
+					CHECK(speed.value == 8.f);
+					CHECK(position.value == 2.f + 4.f + 8.f);
+					CHECK(health.value == 7);
+				}
+
+				THEN("Timings are reported")
+				{
+					const auto& timings = systemGraph.GetSystemTimings();
+					REQUIRE(timings.size() == 4);
+
+					// SpeedSystem sleeps, it's on the critical path
+					bool speedSystemOnCriticalPath = false;
+					for (const auto& timing : timings)
+					{
+						if (timing.systemName.find("SpeedSystem") != std::string_view::npos)
+							speedSystemOnCriticalPath = timing.isOnCriticalPath;
+
+						if (!taskScheduler)
+							CHECK_FALSE(timing.isParallel);
+					}
+
+					CHECK(speedSystemOnCriticalPath);
+					CHECK(systemGraph.GetCriticalPathTime() >= Nz::Time::Milliseconds(5));
+					CHECK_FALSE(systemGraph.ReportTimings().empty());
+				}
+			}
+		}
+	}
+}
@@ -1,6 +1,7 @@
 #include <Nazara/Core/File.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <cstring>
 
 std::filesystem::path GetAssetDir();
 
@@ -81,4 +82,74 @@ SCENARIO("File", "[CORE][FILE]")
 			}
 		}
 	}
+	GIVEN("A memory-mapped file")
+	{
+		const char content[] = "Memory-mapped content";
+		REQUIRE(Nz::File::WriteWhole("Mapped File.bin", content, sizeof(content)));
+
+		Nz::File file("Mapped File.bin", Nz::OpenMode::Read | Nz::OpenMode::MemoryMapped | Nz::OpenMode::SequentialAccess);
+		REQUIRE(file.IsOpen());
+		REQUIRE(file.IsMemoryMapped());
+
+		WHEN("We access its content")
+		{
+			THEN("It's available without reading")
+			{
+				REQUIRE(file.GetSize() == sizeof(content));
+				CHECK(std::memcmp(file.GetMappedPointer(), content, sizeof(content)) == 0);
+			}
+
+			AND_THEN("It can still be read as a stream")
+			{
+				REQUIRE(file.SetCursorPos(7));
+
+				char buffer[6];
+				REQUIRE(file.Read(buffer, 6) == 6);
+				CHECK(std::string_view(buffer, 6) == "mapped");
+				CHECK(file.GetCursorPos() == 13);
+
+				CHECK(file.Read(nullptr, 100) == sizeof(content) - 13);
+				CHECK(file.EndOfStream());
+			}
+		}
+
+		WHEN("We close it")
+		{
+			file.Close();
+
+			THEN("It's no longer mapped")
+			{
+				CHECK_FALSE(file.IsMemoryMapped());
+			}
+		}
+
+		WHEN("We defer its mapping")
+		{
+			Nz::File deferredFile("Mapped File.bin", Nz::OpenMode::Read | Nz::OpenMode::MemoryMapped | Nz::OpenMode::Defer);
+
+			THEN("It's only mapped on first access")
+			{
+				CHECK_FALSE(deferredFile.IsOpen());
+				CHECK(deferredFile.IsMemoryMapped());
+
+				const void* ptr = deferredFile.GetMappedPointer();
+				REQUIRE(ptr);
+				CHECK(deferredFile.IsOpen());
+				CHECK(std::memcmp(ptr, content, sizeof(content)) == 0);
+			}
+		}
+
+		WHEN("We try to map it for writing")
+		{
+			Nz::File writableFile;
+
+			THEN("It fails")
+			{
+				CHECK_FALSE(writableFile.Open("Mapped File.bin", Nz::OpenMode_ReadWrite | Nz::OpenMode::MemoryMapped));
+			}
+		}
+
+		file.Close();
+		std::filesystem::remove("Mapped File.bin");
+	}
 }
@@ -1,8 +1,10 @@
 #include <Nazara/Core/TaskScheduler.hpp>
 #include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <random>
 #include <thread>
 
@@ -66,6 +68,124 @@ SCENARIO("TaskScheduler", "[CORE][TaskScheduler]")
 					CHECK(completionBuffer[i] == 1);
 				}
 			}
+
+			WHEN("We add tasks with move-only and big captures")
+			{
+				std::array<Nz::UInt64, 16> bigData;
+				for (std::size_t i = 0; i < bigData.size(); ++i)
+					bigData[i] = i;
+
+				static_assert(sizeof(bigData) > Nz::TaskScheduler::Task::InlineStorageSize);
+
+				std::atomic_uint64_t sum = 0;
+				auto value = std::make_unique<Nz::UInt64>(42);
+
+				scheduler.AddTask([&sum, value = std::move(value)] { sum += *value; });
+				scheduler.AddTask([&sum, bigData] { for (Nz::UInt64 v : bigData) sum += v; });
+				scheduler.WaitForTasks();
+
+				CHECK(sum == 42 + 15 * 16 / 2);
+			}
+
+			WHEN("We add tasks with dependencies, they are executed after them")
+			{
+				std::atomic_uint counter = 0;
+				unsigned int firstOrder = 0;
+				unsigned int secondOrder = 0;
+				unsigned int joinOrder = 0;
+
+				Nz::TaskScheduler::TaskGroup group;
+				Nz::TaskScheduler::TaskHandle first = scheduler.AddTask([&]
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(20));
+					firstOrder = ++counter;
+				}, &group);
+
+				Nz::TaskScheduler::TaskHandle second = scheduler.AddContinuation(first, [&] { secondOrder = ++counter; }, &group);
+
+				std::array dependencies = { first, second };
+				Nz::TaskScheduler::TaskHandle join = scheduler.AddTask([&] { joinOrder = ++counter; }, dependencies, &group);
+
+				scheduler.WaitForTasks(group);
+
+				CHECK(group.IsDone());
+				CHECK(first.IsFinished());
+				CHECK(second.IsFinished());
+				CHECK(join.IsFinished());
+				CHECK(firstOrder == 1);
+				CHECK(secondOrder == 2);
+				CHECK(joinOrder == 3);
+
+				AND_WHEN("We add a continuation to a finished task, it is still executed")
+				{
+					bool executed = false;
+					scheduler.AddContinuation(join, [&] { executed = true; }, &group);
+					scheduler.WaitForTasks(group);
+
+					CHECK(executed);
+				}
+			}
+
+			WHEN("We wait on a task group, only its tasks are waited on")
+			{
+				scheduler.AddTask([] { std::this_thread::sleep_for(std::chrono::milliseconds(100)); });
+
+				Nz::TaskScheduler::TaskGroup group;
+				std::atomic_uint count = 0;
+				for (unsigned int i = 0; i < 64; ++i)
+					scheduler.AddTask([&] { count++; }, &group);
+
+				scheduler.WaitForTasks(group);
+				CHECK(count == 64);
+
+				scheduler.WaitForTasks();
+			}
+
+			WHEN("We use ParallelFor, every index is processed once")
+			{
+				for (std::size_t grainSize : { 0, 1, 7, 100, 5000 })
+				{
+					INFO("grain size: " << grainSize);
+
+					constexpr std::size_t indexCount = 4321;
+
+					std::atomic_uint invalidChunkCount = 0;
+					std::vector<std::atomic_uint> processCount(indexCount);
+					scheduler.ParallelFor(10, indexCount, grainSize, [&](std::size_t begin, std::size_t end)
+					{
+						// Catch2 assertions aren't thread-safe
+						if (begin >= end || (grainSize != 0 && end - begin > grainSize))
+							invalidChunkCount++;
+
+						for (std::size_t i = begin; i < end; ++i)
+							processCount[i]++;
+					});
+
+					CHECK(invalidChunkCount == 0);
+
+					for (std::size_t i = 0; i < indexCount; ++i)
+					{
+						INFO("checking that index " << i << " was processed " << ((i >= 10) ? "once" : "zero time"));
+						CHECK(processCount[i] == ((i >= 10) ? 1 : 0));
+					}
+				}
+			}
+
+			WHEN("We use ParallelFor from a task")
+			{
+				std::atomic_uint sum = 0;
+				scheduler.AddTask([&]
+				{
+					scheduler.ParallelFor(0, 1000, 10, [&](std::size_t begin, std::size_t end)
+					{
+						for (std::size_t i = begin; i < end; ++i)
+							sum += static_cast<unsigned int>(i);
+					});
+				});
+				scheduler.WaitForTasks();
+
+				CHECK(sum == 999 * 1000 / 2);
+			}
 		}
 	}
 }
@@ -0,0 +1,168 @@
+#include <Nazara/Core/Node.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/TransformHierarchy.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <memory>
+#include <random>
+
+SCENARIO("TransformHierarchy", "[CORE][TRANSFORMHIERARCHY]")
+{
+	GIVEN("A small hierarchy")
+	{
+		Nz::TransformHierarchy hierarchy;
+		Nz::TransformHierarchy::TransformId root = hierarchy.Create(Nz::TransformHierarchy::InvalidId, Nz::Vector3f(1.f, 0.f, 0.f));
+		Nz::TransformHierarchy::TransformId child = hierarchy.Create(root, Nz::Vector3f(0.f, 2.f, 0.f), Nz::Quaternionf::Identity(), Nz::Vector3f(2.f));
+		Nz::TransformHierarchy::TransformId grandChild = hierarchy.Create(child, Nz::Vector3f(0.f, 0.f, 3.f));
+
+		hierarchy.Update();
+
+		THEN("Global values are computed")
+		{
+			CHECK(hierarchy.GetDepthCount() == 3);
+			CHECK(hierarchy.GetUpdatedTransforms().size() == 3);
+			CHECK(hierarchy.GetGlobalPosition(child) == Nz::Vector3f(1.f, 2.f, 0.f));
+			CHECK(hierarchy.GetGlobalPosition(grandChild) == Nz::Vector3f(1.f, 2.f, 6.f));
+			CHECK(hierarchy.GetGlobalScale(grandChild) == Nz::Vector3f(2.f));
+			CHECK(hierarchy.GetTransformMatrix(grandChild).GetTranslation() == Nz::Vector3f(1.f, 2.f, 6.f));
+		}
+
+		WHEN("We move the root")
+		{
+			hierarchy.Move(root, Nz::Vector3f(0.f, 0.f, 1.f));
+			hierarchy.Update();
+
+			THEN("Children are updated too")
+			{
+				CHECK(hierarchy.GetUpdatedTransforms().size() == 3);
+				CHECK(hierarchy.GetGlobalPosition(grandChild) == Nz::Vector3f(1.f, 2.f, 7.f));
+			}
+		}
+
+		WHEN("We move the grand-child")
+		{
+			hierarchy.SetPosition(grandChild, Nz::Vector3f::Zero());
+			hierarchy.Update();
+
+			THEN("Only the grand-child is updated")
+			{
+				REQUIRE(hierarchy.GetUpdatedTransforms().size() == 1);
+				CHECK(hierarchy.GetUpdatedTransforms()[0] == grandChild);
+				CHECK(hierarchy.GetGlobalPosition(grandChild) == Nz::Vector3f(1.f, 2.f, 0.f));
+			}
+		}
+
+		WHEN("We reparent the grand-child to the root")
+		{
+			hierarchy.SetParent(grandChild, root);
+			hierarchy.Update();
+
+			THEN("Its global values use its new parent")
+			{
+				CHECK(hierarchy.GetParent(grandChild) == root);
+				CHECK(hierarchy.GetDepthCount() == 2);
+				CHECK(hierarchy.GetGlobalPosition(grandChild) == Nz::Vector3f(1.f, 0.f, 3.f));
+			}
+		}
+
+		WHEN("We destroy the child")
+		{
+			hierarchy.Destroy(child);
+			hierarchy.Update();
+
+			THEN("The grand-child becomes a root")
+			{
+				CHECK_FALSE(hierarchy.IsValid(child));
+				CHECK(hierarchy.GetTransformCount() == 2);
+				CHECK(hierarchy.GetParent(grandChild) == Nz::TransformHierarchy::InvalidId);
+				CHECK(hierarchy.GetGlobalPosition(grandChild) == Nz::Vector3f(0.f, 0.f, 3.f));
+			}
+
+			AND_WHEN("We create a new transform")
+			{
+				Nz::TransformHierarchy::TransformId newChild = hierarchy.Create(grandChild, Nz::Vector3f(1.f, 1.f, 1.f));
+				hierarchy.Update();
+
+				CHECK(hierarchy.GetGlobalPosition(newChild) == Nz::Vector3f(1.f, 1.f, 4.f));
+			}
+		}
+	}
+
+	GIVEN("A random hierarchy mirrored by nodes")
+	{
+		constexpr std::size_t TransformCount = 5'000;
+
+		std::mt19937 randomEngine(42);
+		std::uniform_real_distribution<float> positionDis(-10.f, 10.f);
+		std::uniform_real_distribution<float> angleDis(-180.f, 180.f);
+		std::uniform_real_distribution<float> scaleDis(0.8f, 1.25f);
+
+		Nz::TransformHierarchy hierarchy;
+		std::vector<std::unique_ptr<Nz::Node>> nodes;
+		std::vector<Nz::TransformHierarchy::TransformId> transformIds;
+
+		for (std::size_t i = 0; i < TransformCount; ++i)
+		{
+			Nz::Vector3f position(positionDis(randomEngine), positionDis(randomEngine), positionDis(randomEngine));
+			Nz::Quaternionf rotation = Nz::EulerAnglesf(angleDis(randomEngine), angleDis(randomEngine), angleDis(randomEngine));
+			Nz::Vector3f scale(scaleDis(randomEngine), scaleDis(randomEngine), scaleDis(randomEngine));
+
+			// Pick a parent among the existing transforms (or none), keeping the depth reasonable
+			std::size_t parentIndex = (i > 0) ? std::uniform_int_distribution<std::size_t>(0, i)(randomEngine) : i;
+			bool hasParent = parentIndex < i && parentIndex > i / 2;
+
+			auto& node = nodes.emplace_back(std::make_unique<Nz::Node>(position, rotation, scale));
+			if (hasParent)
+				node->SetParent(*nodes[parentIndex]);
+
+			transformIds.push_back(hierarchy.Create((hasParent) ? transformIds[parentIndex] : Nz::TransformHierarchy::InvalidId, position, rotation, scale));
+		}
+
+		auto CheckHierarchy = [&]
+		{
+			// Tolerance relative to the magnitude, as error accumulates with depth
+			auto IsClose = [](const Nz::Vector3f& lhs, const Nz::Vector3f& rhs)
+			{
+				return lhs.ApproxEqual(rhs, 0.001f * std::max(1.f, rhs.GetLength()));
+			};
+
+			std::size_t invalidCount = 0;
+			for (std::size_t i = 0; i < TransformCount; ++i)
+			{
+				if (!IsClose(hierarchy.GetGlobalPosition(transformIds[i]), nodes[i]->GetGlobalPosition()))
+					invalidCount++;
+
+				if (!IsClose(hierarchy.GetGlobalScale(transformIds[i]), nodes[i]->GetGlobalScale()))
+					invalidCount++;
+			}
+
+			CHECK(invalidCount == 0);
+		};
+
+		WHEN("We update it on the calling thread")
+		{
+			hierarchy.Update();
+			CheckHierarchy();
+		}
+
+		WHEN("We update it using a task scheduler")
+		{
+			Nz::TaskScheduler taskScheduler(4);
+			hierarchy.Update(&taskScheduler, 64);
+			CheckHierarchy();
+
+			AND_WHEN("We move some transforms")
+			{
+				for (std::size_t i = 0; i < TransformCount; i += 10)
+				{
+					Nz::Vector3f movement(positionDis(randomEngine), positionDis(randomEngine), positionDis(randomEngine));
+					nodes[i]->Move(movement);
+					hierarchy.Move(transformIds[i], movement);
+				}
+
+				hierarchy.Update(&taskScheduler, 64);
+				CheckHierarchy();
+			}
+		}
+	}
+}
@@ -0,0 +1,212 @@
+#include <Nazara/Graphics/AABBTree.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr float Epsilon = 0.001f;
+
+	Nz::Boxf Grow(const Nz::Boxf& box, float margin)
+	{
+		return Nz::Boxf(box.x - margin, box.y - margin, box.z - margin, box.width + 2.f * margin, box.height + 2.f * margin, box.depth + 2.f * margin);
+	}
+
+	Nz::Boxf GenerateBox(std::minstd_rand& randEngine)
+	{
+		std::uniform_real_distribution<float> positionDis(-200.f, 200.f);
+		std::uniform_real_distribution<float> sizeDis(0.1f, 20.f);
+
+		return Nz::Boxf(positionDis(randEngine), positionDis(randEngine), positionDis(randEngine), sizeDis(randEngine), sizeDis(randEngine), sizeDis(randEngine));
+	}
+
+	// Merged boxes in the tree may be rounded, only boxes further than Epsilon from a frustum plane have to match Frustum::Intersect exactly
+	void CheckCulling(const Nz::AABBTree& tree, const Nz::Frustumf& frustum, const std::vector<Nz::UInt32>& proxies)
+	{
+		std::vector<int> reportCount(proxies.size(), 0);
+		std::vector<bool> reportedInside(proxies.size(), false);
+		tree.Cull(frustum, [&](std::size_t userData, bool isFullyInside)
+		{
+			REQUIRE(userData < proxies.size());
+			REQUIRE(proxies[userData] != Nz::AABBTree::InvalidProxy);
+
+			reportCount[userData]++;
+			reportedInside[userData] = isFullyInside;
+		});
+
+		std::size_t falseNegativeCount = 0;
+		std::size_t falsePositiveCount = 0;
+		std::size_t wrongInsideCount = 0;
+		for (std::size_t i = 0; i < proxies.size(); ++i)
+		{
+			if (proxies[i] == Nz::AABBTree::InvalidProxy)
+			{
+				CHECK(reportCount[i] == 0);
+				continue;
+			}
+
+			CHECK(reportCount[i] <= 1);
+
+			const Nz::Boxf& fatBox = tree.GetFatAABB(proxies[i]);
+			if (reportCount[i] == 0 && frustum.Intersect(Grow(fatBox, -Epsilon)) != Nz::IntersectionSide::Outside)
+				falseNegativeCount++;
+
+			if (reportCount[i] != 0 && frustum.Intersect(Grow(fatBox, Epsilon)) == Nz::IntersectionSide::Outside)
+				falsePositiveCount++;
+
+			if (reportedInside[i] && frustum.Intersect(Grow(fatBox, -Epsilon)) != Nz::IntersectionSide::Inside)
+				wrongInsideCount++;
+		}
+
+		CHECK(falseNegativeCount == 0);
+		CHECK(falsePositiveCount == 0);
+		CHECK(wrongInsideCount == 0);
+	}
+}
+
+SCENARIO("AABBTree", "[GRAPHICS][AABBTREE]")
+{
+	std::minstd_rand randEngine(42);
+
+	Nz::Frustumf frustum = Nz::Frustumf::Build(Nz::DegreeAnglef(70.f), 16.f / 9.f, 1.f, 250.f, Nz::Vector3f(0.f, 0.f, -150.f), Nz::Vector3f::Zero());
+
+	GIVEN("An empty tree")
+	{
+		Nz::AABBTree tree;
+		CHECK(tree.GetProxyCount() == 0);
+		CHECK(tree.GetHeight() == 0);
+
+		tree.Cull(frustum, [](std::size_t /*userData*/, bool /*isFullyInside*/)
+		{
+			FAIL("nothing should be reported");
+		});
+
+		WHEN("We insert boxes along a line")
+		{
+			// Sorted insertion degenerates into a list without rotations
+			for (std::size_t i = 0; i < 1024; ++i)
+				tree.Insert(Nz::Boxf(i * 2.f, 0.f, 0.f, 1.f, 1.f, 1.f), i);
+
+			THEN("The tree stays balanced")
+			{
+				CHECK(tree.GetProxyCount() == 1024);
+				CHECK(tree.GetHeight() <= 20);
+			}
+		}
+	}
+
+	GIVEN("A tree with random boxes")
+	{
+		Nz::AABBTree tree;
+
+		std::vector<Nz::Boxf> boxes;
+		std::vector<Nz::UInt32> proxies;
+		for (std::size_t i = 0; i < 2000; ++i)
+		{
+			boxes.push_back(GenerateBox(randEngine));
+			proxies.push_back(tree.Insert(boxes.back(), i));
+		}
+
+		REQUIRE(tree.GetProxyCount() == 2000);
+		for (std::size_t i = 0; i < proxies.size(); ++i)
+		{
+			CHECK(tree.GetUserData(proxies[i]) == i);
+			CHECK(tree.GetFatAABB(proxies[i]) == boxes[i]);
+		}
+
+		CheckCulling(tree, frustum, proxies);
+
+		WHEN("A box moves inside its fat box")
+		{
+			REQUIRE(tree.Move(proxies[0], Nz::Boxf(boxes[0].x, boxes[0].y, boxes[0].z, boxes[0].width * 2.f, boxes[0].height, boxes[0].depth)));
+			Nz::Boxf fatBox = tree.GetFatAABB(proxies[0]);
+
+			THEN("It's only reinserted when leaving it")
+			{
+				CHECK_FALSE(tree.Move(proxies[0], Nz::Boxf(boxes[0].x, boxes[0].y, boxes[0].z, boxes[0].width * 2.05f, boxes[0].height, boxes[0].depth)));
+				CHECK(tree.GetFatAABB(proxies[0]) == fatBox);
+
+				CHECK(tree.Move(proxies[0], Nz::Boxf(fatBox.x + 1000.f, boxes[0].y, boxes[0].z, boxes[0].width, boxes[0].height, boxes[0].depth)));
+				CHECK(tree.GetFatAABB(proxies[0]).Contains(Nz::Boxf(fatBox.x + 1000.f, boxes[0].y, boxes[0].z, boxes[0].width, boxes[0].height, boxes[0].depth)));
+			}
+		}
+
+		WHEN("Boxes are randomly moved, removed and inserted")
+		{
+			std::uniform_int_distribution<std::size_t> indexDis(0, proxies.size() - 1);
+			std::uniform_real_distribution<float> offsetDis(-5.f, 5.f);
+			std::uniform_int_distribution<int> actionDis(0, 9);
+
+			std::size_t proxyCount = proxies.size();
+			for (std::size_t frame = 0; frame < 50; ++frame)
+			{
+				for (std::size_t i = 0; i < 200; ++i)
+				{
+					std::size_t index = indexDis(randEngine);
+					int action = actionDis(randEngine);
+					if (proxies[index] == Nz::AABBTree::InvalidProxy)
+					{
+						boxes[index] = GenerateBox(randEngine);
+						proxies[index] = tree.Insert(boxes[index], index);
+						proxyCount++;
+					}
+					else if (action == 0)
+					{
+						tree.Remove(proxies[index]);
+						proxies[index] = Nz::AABBTree::InvalidProxy;
+						proxyCount--;
+					}
+					else if (action == 1)
+					{
+						// Teleport
+						boxes[index] = GenerateBox(randEngine);
+						tree.Move(proxies[index], boxes[index]);
+					}
+					else
+					{
+						boxes[index].x += offsetDis(randEngine);
+						boxes[index].y += offsetDis(randEngine);
+						boxes[index].z += offsetDis(randEngine);
+						tree.Move(proxies[index], boxes[index]);
+					}
+				}
+
+				INFO("frame #" << frame);
+				REQUIRE(tree.GetProxyCount() == proxyCount);
+
+				for (std::size_t i = 0; i < proxies.size(); ++i)
+				{
+					if (proxies[i] != Nz::AABBTree::InvalidProxy)
+					{
+						CHECK(tree.GetUserData(proxies[i]) == i);
+						CHECK(tree.GetFatAABB(proxies[i]).Contains(boxes[i]));
+					}
+				}
+
+				CheckCulling(tree, frustum, proxies);
+			}
+
+			THEN("The tree stays balanced")
+			{
+				CHECK(tree.GetHeight() <= 30);
+			}
+		}
+
+		WHEN("Every box is removed")
+		{
+			for (Nz::UInt32 proxyId : proxies)
+				tree.Remove(proxyId);
+
+			THEN("Nothing is reported anymore")
+			{
+				CHECK(tree.GetProxyCount() == 0);
+				CHECK(tree.GetHeight() == 0);
+
+				tree.Cull(frustum, [](std::size_t /*userData*/, bool /*isFullyInside*/)
+				{
+					FAIL("nothing should be reported");
+				});
+			}
+		}
+	}
+}
@@ -0,0 +1,267 @@
+#include <Nazara/Graphics/InstancedRenderable.hpp>
+#include <Nazara/Graphics/RenderElement.hpp>
+#include <Nazara/Graphics/RenderElementCache.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	class TestRenderable final : public Nz::InstancedRenderable
+	{
+		public:
+			TestRenderable(std::size_t elementCount, int renderLayer) :
+			m_elementCount(elementCount)
+			{
+				UpdateRenderLayer(renderLayer);
+			}
+
+			void BuildElement(Nz::ElementRendererRegistry& /*registry*/, const ElementData& /*elementData*/, std::size_t /*passIndex*/, std::vector<Nz::RenderElementOwner>& /*elements*/) const override
+			{
+			}
+
+			std::size_t GetElementCount() const
+			{
+				return m_elementCount;
+			}
+
+			const std::shared_ptr<Nz::MaterialInstance>& GetMaterial(std::size_t /*materialIndex*/) const override
+			{
+				static std::shared_ptr<Nz::MaterialInstance> invalidMaterial;
+				return invalidMaterial;
+			}
+
+			std::size_t GetMaterialCount() const override
+			{
+				return 0;
+			}
+
+		private:
+			std::size_t m_elementCount;
+	};
+
+	class TestElement final : public Nz::RenderElement
+	{
+		public:
+			TestElement(int renderLayer) :
+			RenderElement(Nz::UInt8(0)),
+			m_renderLayer(renderLayer)
+			{
+			}
+
+			Nz::UInt64 ComputeSortingScore(const Nz::Frustumf& /*frustum*/, const Nz::RenderQueueRegistry& registry) const override
+			{
+				return registry.FetchLayerIndex(m_renderLayer);
+			}
+
+			int GetRenderLayer() const
+			{
+				return m_renderLayer;
+			}
+
+			void Register(Nz::RenderQueueRegistry& registry) const override
+			{
+				registry.RegisterLayer(m_renderLayer);
+			}
+
+		private:
+			int m_renderLayer;
+	};
+
+	struct CacheTester
+	{
+		bool Update(const std::vector<Nz::FramePipelinePass::VisibleRenderable>& visibleRenderables, bool rebuild = false)
+		{
+			return cache.Update(Nz::MaxValue(), visibleRenderables, rebuild, [&](const Nz::FramePipelinePass::VisibleRenderable& visibleRenderable, std::vector<Nz::RenderElementOwner>& elements)
+			{
+				const TestRenderable* renderable = static_cast<const TestRenderable*>(visibleRenderable.instancedRenderable);
+				buildCount[renderable]++;
+
+				// Elements aren't owned by a pool, they stay alive in the storage
+				for (std::size_t i = 0; i < renderable->GetElementCount(); ++i)
+					elements.emplace_back(nullptr, 0, &elementStorage.emplace_back(renderable->GetRenderLayer()));
+			},
+			[&](std::vector<Nz::RenderElementOwner>&& elements)
+			{
+				releasedCount += elements.size();
+			});
+		}
+
+		void CheckRenderQueue(std::size_t expectedElementCount)
+		{
+			CHECK(cache.GetElementCount() == expectedElementCount);
+			REQUIRE(cache.GetRenderQueue().size() == expectedElementCount);
+
+			// Registry indices have to be valid for every element in the queue
+			for (const Nz::RenderElement* element : cache.GetRenderQueue())
+				CHECK(cache.GetRenderQueueRegistry().FetchLayerIndex(static_cast<const TestElement*>(element)->GetRenderLayer()) < 2);
+		}
+
+		void ResetCounters()
+		{
+			buildCount.clear();
+			releasedCount = 0;
+		}
+
+		Nz::RenderElementCache cache;
+		std::deque<TestElement> elementStorage;
+		std::size_t releasedCount = 0;
+		std::unordered_map<const TestRenderable*, std::size_t> buildCount;
+	};
+
+	Nz::FramePipelinePass::VisibleRenderable MakeVisibleRenderable(const TestRenderable& renderable, Nz::UInt8 generation)
+	{
+		Nz::FramePipelinePass::VisibleRenderable visibleRenderable;
+		visibleRenderable.instancedRenderable = &renderable;
+		visibleRenderable.skeletonInstance = nullptr;
+		visibleRenderable.worldInstance = nullptr;
+		visibleRenderable.scissorBox = Nz::Recti(-1, -1, -1, -1);
+		visibleRenderable.renderMask = Nz::MaxValue();
+		visibleRenderable.generation = generation;
+
+		return visibleRenderable;
+	}
+}
+
+SCENARIO("RenderElementCache", "[GRAPHICS][RENDERELEMENTCACHE]")
+{
+	GIVEN("A cache with two visible renderables")
+	{
+		TestRenderable firstRenderable(2, 0);
+		TestRenderable secondRenderable(3, 1);
+
+		CacheTester tester;
+		CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(secondRenderable, 1) }));
+		CHECK(tester.buildCount[&firstRenderable] == 1);
+		CHECK(tester.buildCount[&secondRenderable] == 1);
+		tester.CheckRenderQueue(5);
+
+		tester.ResetCounters();
+
+		WHEN("Visibility doesn't change")
+		{
+			THEN("Nothing is rebuilt")
+			{
+				CHECK_FALSE(tester.Update({ MakeVisibleRenderable(secondRenderable, 1), MakeVisibleRenderable(firstRenderable, 0) }));
+				CHECK(tester.buildCount.empty());
+				CHECK(tester.releasedCount == 0);
+				tester.CheckRenderQueue(5);
+			}
+		}
+
+		WHEN("A renderable is added")
+		{
+			TestRenderable thirdRenderable(4, 0);
+
+			THEN("Only its elements are built")
+			{
+				CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(secondRenderable, 1), MakeVisibleRenderable(thirdRenderable, 2) }));
+				CHECK(tester.buildCount.size() == 1);
+				CHECK(tester.buildCount[&thirdRenderable] == 1);
+				CHECK(tester.releasedCount == 0);
+				tester.CheckRenderQueue(9);
+			}
+		}
+
+		WHEN("A renderable is removed")
+		{
+			THEN("Only its elements are released")
+			{
+				CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0) }));
+				CHECK(tester.buildCount.empty());
+				CHECK(tester.releasedCount == 3);
+				tester.CheckRenderQueue(2);
+			}
+
+			AND_THEN("It can be added back")
+			{
+				CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0) }));
+				CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(secondRenderable, 1) }));
+				CHECK(tester.buildCount.size() == 1);
+				CHECK(tester.buildCount[&secondRenderable] == 1);
+				tester.CheckRenderQueue(5);
+			}
+		}
+
+		WHEN("A renderable is registered again at the same address")
+		{
+			// The pipeline gives it a new generation, cached elements of the previous registration mustn't be reused
+			std::optional<TestRenderable> renderable;
+			renderable.emplace(1, 0);
+
+			CHECK(tester.Update({ MakeVisibleRenderable(*renderable, 5) }));
+			CHECK(tester.buildCount[&*renderable] == 1);
+			tester.CheckRenderQueue(1);
+
+			tester.ResetCounters();
+
+			renderable.reset();
+			renderable.emplace(4, 1);
+
+			THEN("Its elements are rebuilt")
+			{
+				CHECK(tester.Update({ MakeVisibleRenderable(*renderable, 6) }));
+				CHECK(tester.buildCount[&*renderable] == 1);
+				CHECK(tester.releasedCount == 1);
+				tester.CheckRenderQueue(4);
+			}
+		}
+
+		WHEN("A renderable is visible twice")
+		{
+			THEN("Elements are built for each occurrence")
+			{
+				CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(secondRenderable, 1), MakeVisibleRenderable(firstRenderable, 0) }));
+				CHECK(tester.buildCount[&firstRenderable] == 2);
+				tester.CheckRenderQueue(7);
+			}
+
+			AND_THEN("Going back to a single occurrence releases the extra elements")
+			{
+				CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(secondRenderable, 1), MakeVisibleRenderable(firstRenderable, 0) }));
+				CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(secondRenderable, 1) }));
+				tester.CheckRenderQueue(5);
+
+				tester.ResetCounters();
+
+				CHECK_FALSE(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(secondRenderable, 1) }));
+				CHECK(tester.buildCount.empty());
+				tester.CheckRenderQueue(5);
+			}
+		}
+
+		WHEN("A rebuild is requested")
+		{
+			THEN("Every element is rebuilt")
+			{
+				CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(secondRenderable, 1) }, true));
+				CHECK(tester.buildCount[&firstRenderable] == 1);
+				CHECK(tester.buildCount[&secondRenderable] == 1);
+				CHECK(tester.releasedCount == 5);
+				tester.CheckRenderQueue(5);
+			}
+		}
+
+		WHEN("Renderables are removed and added until the registry is compacted")
+		{
+			std::vector<TestRenderable> renderables;
+			renderables.reserve(10);
+			for (std::size_t i = 0; i < 10; ++i)
+				renderables.emplace_back(1, int(i % 2));
+
+			THEN("The render queue stays consistent")
+			{
+				for (std::size_t i = 0; i < renderables.size(); ++i)
+				{
+					CHECK(tester.Update({ MakeVisibleRenderable(firstRenderable, 0), MakeVisibleRenderable(renderables[i], Nz::UInt8(10 + i)) }));
+					tester.CheckRenderQueue(3);
+				}
+
+				CHECK(tester.releasedCount == 3 + 9);
+			}
+		}
+	}
+}
@@ -0,0 +1,189 @@
+#include <Nazara/Graphics/Algorithm.hpp>
+#include <Nazara/Graphics/RenderElement.hpp>
+#include <Nazara/Graphics/RenderQueue.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+	struct QueueElement
+	{
+		Nz::UInt64 key;
+		std::size_t index;
+	};
+
+	void CheckAgainstStableSort(const std::vector<Nz::UInt64>& keys)
+	{
+		Nz::RenderQueue<QueueElement> renderQueue;
+		std::vector<QueueElement> expectedElements;
+		for (std::size_t i = 0; i < keys.size(); ++i)
+		{
+			renderQueue.Insert({ keys[i], i });
+			expectedElements.push_back({ keys[i], i });
+		}
+
+		std::size_t keyFuncCallCount = 0;
+		renderQueue.Sort([&](const QueueElement& element)
+		{
+			keyFuncCallCount++;
+			return element.key;
+		});
+
+		std::stable_sort(expectedElements.begin(), expectedElements.end(), [](const QueueElement& lhs, const QueueElement& rhs)
+		{
+			return lhs.key < rhs.key;
+		});
+
+		CHECK(keyFuncCallCount == keys.size());
+		REQUIRE(renderQueue.size() == expectedElements.size());
+
+		std::size_t mismatchCount = 0;
+		auto it = renderQueue.begin();
+		for (const QueueElement& expectedElement : expectedElements)
+		{
+			if (it->key != expectedElement.key || it->index != expectedElement.index)
+				mismatchCount++;
+
+			++it;
+		}
+
+		CHECK(mismatchCount == 0);
+	}
+}
+
+SCENARIO("RenderQueue", "[GRAPHICS][RENDERQUEUE]")
+{
+	std::minstd_rand randEngine(42);
+	std::uniform_int_distribution<Nz::UInt64> keyDis;
+
+	// Comparison sort is used up to 64 elements, radix sort above
+	constexpr std::size_t ElementCounts[] = { 1, 2, 63, 64, 65, 255, 256, 257, 5000 };
+
+	WHEN("We sort random keys")
+	{
+		for (std::size_t elementCount : ElementCounts)
+		{
+			INFO(elementCount << " elements");
+
+			std::vector<Nz::UInt64> keys(elementCount);
+			for (Nz::UInt64& key : keys)
+				key = keyDis(randEngine);
+
+			CheckAgainstStableSort(keys);
+		}
+	}
+
+	WHEN("We sort keys with many duplicates")
+	{
+		std::uniform_int_distribution<Nz::UInt64> smallKeyDis(0, 7);
+
+		for (std::size_t elementCount : ElementCounts)
+		{
+			INFO(elementCount << " elements");
+
+			std::vector<Nz::UInt64> keys(elementCount);
+			for (Nz::UInt64& key : keys)
+				key = smallKeyDis(randEngine) << 40;
+
+			CheckAgainstStableSort(keys);
+		}
+	}
+
+	WHEN("We sort keys where most bytes are identical")
+	{
+		// Passes of bytes shared by every key are skipped, make sure the result doesn't depend on which buffer holds it
+		for (Nz::UInt64 byteMask : { 0x00000000000000FFull, 0x000000000000FF00ull, 0x00000000FF00FF00ull, 0xFF00000000000000ull, 0xFF000000000000FFull })
+		{
+			INFO("mask: " << byteMask);
+
+			for (std::size_t elementCount : ElementCounts)
+			{
+				INFO(elementCount << " elements");
+
+				std::vector<Nz::UInt64> keys(elementCount);
+				for (Nz::UInt64& key : keys)
+					key = 0x0123456789ABCDEFull ^ (keyDis(randEngine) & byteMask);
+
+				CheckAgainstStableSort(keys);
+			}
+		}
+	}
+
+	WHEN("We sort keys already sorted or in reverse order")
+	{
+		std::vector<Nz::UInt64> keys(1000);
+		for (std::size_t i = 0; i < keys.size(); ++i)
+			keys[i] = i * 0x0101010101ull;
+
+		CheckAgainstStableSort(keys);
+
+		std::reverse(keys.begin(), keys.end());
+		CheckAgainstStableSort(keys);
+	}
+
+	WHEN("We sort elements sorted by distance mixed with other elements")
+	{
+		std::uniform_int_distribution<Nz::UInt64> layerDis(0, 2);
+		std::uniform_real_distribution<float> distanceDis(-100.f, 1000.f);
+		std::bernoulli_distribution sortByDistanceDis(0.3);
+
+		for (std::size_t elementCount : ElementCounts)
+		{
+			INFO(elementCount << " elements");
+
+			std::vector<Nz::UInt64> keys(elementCount);
+			for (Nz::UInt64& key : keys)
+			{
+				Nz::UInt64 layerIndex = layerDis(randEngine);
+				if (sortByDistanceDis(randEngine))
+				{
+					// Same layout as RenderSubmesh and RenderSpriteChain
+					Nz::UInt64 distance = Nz::DistanceAsSortKey(distanceDis(randEngine));
+					key = (layerIndex & 0xFF) << 56 | Nz::RenderElement::SortByDistanceScoreFlag | distance << 23;
+				}
+				else
+					key = (layerIndex & 0xFF) << 56 | (keyDis(randEngine) & (Nz::RenderElement::SortByDistanceScoreFlag - 1));
+			}
+
+			CheckAgainstStableSort(keys);
+		}
+	}
+
+	WHEN("We sort the same queue multiple times with changing keys")
+	{
+		std::uniform_int_distribution<Nz::UInt64> smallKeyDis(0, 15);
+
+		Nz::RenderQueue<QueueElement> renderQueue;
+		for (std::size_t i = 0; i < 500; ++i)
+			renderQueue.Insert({ 0, i });
+
+		std::vector<Nz::UInt64> keys(500);
+		for (std::size_t frame = 0; frame < 10; ++frame)
+		{
+			INFO("frame #" << frame);
+
+			for (Nz::UInt64& key : keys)
+				key = smallKeyDis(randEngine) << (frame * 6);
+
+			// Sort keys are looked up by element index as elements are reordered each frame
+			std::vector<QueueElement> expectedElements(renderQueue.begin(), renderQueue.end());
+			renderQueue.Sort([&](const QueueElement& element)
+			{
+				return keys[element.index];
+			});
+
+			std::stable_sort(expectedElements.begin(), expectedElements.end(), [&](const QueueElement& lhs, const QueueElement& rhs)
+			{
+				return keys[lhs.index] < keys[rhs.index];
+			});
+
+			REQUIRE(renderQueue.size() == expectedElements.size());
+			CHECK(std::equal(renderQueue.begin(), renderQueue.end(), expectedElements.begin(), [](const QueueElement& lhs, const QueueElement& rhs)
+			{
+				return lhs.index == rhs.index;
+			}));
+		}
+	}
+}
@@ -0,0 +1,178 @@
+#include <Nazara/Math/Frustum.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	struct BoxArrays
+	{
+		Nz::Frustumf::BoxBatch GetBatch() const
+		{
+			Nz::Frustumf::BoxBatch batch;
+			batch.x = x.data();
+			batch.y = y.data();
+			batch.z = z.data();
+			batch.width = width.data();
+			batch.height = height.data();
+			batch.depth = depth.data();
+			batch.count = boxes.size();
+
+			return batch;
+		}
+
+		void AddBox(const Nz::Boxf& box)
+		{
+			boxes.push_back(box);
+			x.push_back(box.x);
+			y.push_back(box.y);
+			z.push_back(box.z);
+			width.push_back(box.width);
+			height.push_back(box.height);
+			depth.push_back(box.depth);
+		}
+
+		std::vector<Nz::Boxf> boxes;
+		std::vector<float> x, y, z;
+		std::vector<float> width, height, depth;
+	};
+
+	BoxArrays GenerateBoxes(std::size_t boxCount, std::minstd_rand& randEngine)
+	{
+		std::uniform_real_distribution<float> positionDis(-200.f, 200.f);
+		std::uniform_real_distribution<float> sizeDis(0.f, 20.f);
+
+		BoxArrays arrays;
+		for (std::size_t i = 0; i < boxCount; ++i)
+		{
+			Nz::Vector3f min(positionDis(randEngine), positionDis(randEngine), positionDis(randEngine));
+			Nz::Vector3f max = min + Nz::Vector3f(sizeDis(randEngine), sizeDis(randEngine), sizeDis(randEngine));
+
+			arrays.AddBox(Nz::Boxf::FromExtents(min, max));
+		}
+
+		return arrays;
+	}
+
+	// CullBoxes and Frustum::Intersect may be compiled with different floating-point contraction (FMA), boxes lying
+	// on the edge of a plane can then legitimately be classified differently by both functions
+	bool IsOnPlaneBoundary(const Nz::Frustumf& frustum, const Nz::Boxf& box)
+	{
+		constexpr double Epsilon = 0.001;
+
+		Nz::Vector3d center(box.GetCenter());
+		Nz::Vector3d extents(box.GetLengths() * 0.5f);
+
+		for (const Nz::Planef& plane : frustum.GetPlanes())
+		{
+			if (!std::isfinite(plane.distance))
+				continue;
+
+			Nz::Vector3d normal(plane.normal);
+			double radius = extents.x * std::abs(normal.x) + extents.y * std::abs(normal.y) + extents.z * std::abs(normal.z);
+			double distance = normal.DotProduct(center) + plane.distance;
+
+			if (std::abs(distance + radius) < Epsilon || std::abs(distance - radius) < Epsilon)
+				return true;
+		}
+
+		return false;
+	}
+
+	void CheckAgainstScalar(const Nz::Frustumf& frustum, const BoxArrays& arrays)
+	{
+		std::size_t boxCount = arrays.boxes.size();
+
+		// Fill the masks with garbage, CullBoxes must clear them (including bits past the box count)
+		std::vector<Nz::UInt64> insideMask((boxCount + 63) / 64, 0xDEADBEEFDEADBEEF);
+		std::vector<Nz::UInt64> visibilityMask((boxCount + 63) / 64, 0xDEADBEEFDEADBEEF);
+		frustum.CullBoxes(arrays.GetBatch(), visibilityMask.data(), insideMask.data());
+
+		std::size_t mismatchCount = 0;
+		for (std::size_t i = 0; i < boxCount; ++i)
+		{
+			bool isInside = (insideMask[i / 64] & (Nz::UInt64(1) << (i % 64))) != 0;
+			bool isVisible = (visibilityMask[i / 64] & (Nz::UInt64(1) << (i % 64))) != 0;
+
+			Nz::IntersectionSide expectedSide = frustum.Intersect(arrays.boxes[i]);
+			if (isVisible != (expectedSide != Nz::IntersectionSide::Outside) || isInside != (expectedSide == Nz::IntersectionSide::Inside))
+			{
+				if (!IsOnPlaneBoundary(frustum, arrays.boxes[i]))
+					mismatchCount++;
+			}
+		}
+
+		CHECK(mismatchCount == 0);
+
+		if (boxCount % 64 != 0)
+		{
+			CHECK((insideMask.back() >> (boxCount % 64)) == 0);
+			CHECK((visibilityMask.back() >> (boxCount % 64)) == 0);
+		}
+	}
+}
+
+SCENARIO("Frustum batch culling", "[MATH][FRUSTUM]")
+{
+	std::minstd_rand randEngine(42);
+
+	GIVEN("One frustum (90, 1, 1, 1000, (0, 0, 0), (1, 0, 0))")
+	{
+		Nz::Frustumf frustum = Nz::Frustumf::Build(Nz::DegreeAnglef(90.f), 1.f, 1.f, 1000.f, Nz::Vector3f::Zero(), Nz::Vector3f::UnitX());
+
+		WHEN("We cull a few specific boxes")
+		{
+			BoxArrays arrays;
+			auto AddBox = [&](const Nz::Vector3f& min, const Nz::Vector3f& max)
+			{
+				arrays.AddBox(Nz::Boxf::FromExtents(min, max));
+			};
+
+			AddBox(Nz::Vector3f(50.f, -1.f, -1.f), Nz::Vector3f(52.f, 1.f, 1.f));     //< inside
+			AddBox(Nz::Vector3f(-60.f, -1.f, -1.f), Nz::Vector3f(-50.f, 1.f, 1.f));   //< behind
+			AddBox(Nz::Vector3f(0.f, 0.f, 0.f), Nz::Vector3f(10.f, 10.f, 10.f));      //< intersecting
+			AddBox(Nz::Vector3f(2000.f, -1.f, -1.f), Nz::Vector3f(2010.f, 1.f, 1.f)); //< past the far plane
+
+			Nz::UInt64 insideMask;
+			Nz::UInt64 visibilityMask;
+			frustum.CullBoxes(arrays.GetBatch(), &visibilityMask, &insideMask);
+
+			THEN("Only boxes not outside of the frustum are visible")
+			{
+				CHECK(visibilityMask == 0b0101);
+				CHECK(insideMask == 0b0001);
+			}
+		}
+
+		WHEN("We cull random boxes")
+		{
+			THEN("Results match Frustum::Intersect")
+			{
+				for (std::size_t boxCount : { 1, 3, 4, 7, 8, 9, 63, 64, 65, 1000 })
+					CheckAgainstScalar(frustum, GenerateBoxes(boxCount, randEngine));
+			}
+		}
+	}
+
+	GIVEN("One frustum with an infinite far plane")
+	{
+		Nz::Frustumf frustum = Nz::Frustumf::Build(Nz::DegreeAnglef(70.f), 1.5f, 1.f, 1000.f, Nz::Vector3f::Zero(), Nz::Vector3f(1.f, 0.5f, 0.f));
+
+		Nz::EnumArray<Nz::FrustumPlane, Nz::Planef> planes = frustum.GetPlanes();
+		planes[Nz::FrustumPlane::Far].distance = std::numeric_limits<float>::infinity();
+
+		Nz::Frustumf infiniteFrustum(planes);
+		REQUIRE(infiniteFrustum.HasInfiniteFarPlane());
+
+		WHEN("We cull random boxes")
+		{
+			THEN("Results match Frustum::Intersect")
+			{
+				for (std::size_t boxCount : { 5, 16, 130 })
+					CheckAgainstScalar(infiniteFrustum, GenerateBoxes(boxCount, randEngine));
+			}
+		}
+	}
+}
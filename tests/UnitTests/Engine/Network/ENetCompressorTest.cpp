@@ -0,0 +1,119 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Network/ENetLZCompressor.hpp>
+#include <Nazara/Network/ENetProtocol.hpp>
+#include <Nazara/Network/ENetRangeCoderCompressor.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Snapshot-like datagrams: entity ids followed by slowly changing quantized positions
+	std::vector<Nz::ByteArray> GenerateTraffic(unsigned int seed, std::size_t packetCount)
+	{
+		std::mt19937 randomGenerator(seed);
+
+		std::vector<Nz::ByteArray> packets;
+		packets.reserve(packetCount);
+		for (std::size_t i = 0; i < packetCount; ++i)
+		{
+			Nz::ByteArray packet;
+
+			std::size_t entityCount = 10 + randomGenerator() % 40;
+			for (std::size_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+			{
+				Nz::UInt16 entityId = static_cast<Nz::UInt16>(entityIndex * 3);
+				packet.PushBack(0x02);
+				packet.PushBack(static_cast<Nz::UInt8>(entityId & 0xFF));
+				packet.PushBack(static_cast<Nz::UInt8>(entityId >> 8));
+
+				for (std::size_t axis = 0; axis < 3; ++axis)
+				{
+					Nz::Int32 position = static_cast<Nz::Int32>(1000 * entityIndex + randomGenerator() % 64);
+					for (std::size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+						packet.PushBack(static_cast<Nz::UInt8>(position >> (8 * byteIndex)));
+				}
+			}
+
+			packets.push_back(std::move(packet));
+		}
+
+		return packets;
+	}
+
+	void CheckRoundTrip(Nz::ENetCompressor& compressor, Nz::ENetCompressor& decompressor, const Nz::ByteArray& packet)
+	{
+		// Split the input to exercise multiple buffers
+		std::size_t splitOffset = packet.GetSize() / 3;
+		Nz::NetBuffer buffers[2] = {
+			{ const_cast<Nz::UInt8*>(packet.GetConstBuffer()), splitOffset },
+			{ const_cast<Nz::UInt8*>(packet.GetConstBuffer()) + splitOffset, packet.GetSize() - splitOffset }
+		};
+
+		std::vector<Nz::UInt8> compressed(Nz::ENetConstants::ENetProtocol_MaximumMTU);
+		std::size_t compressedSize = compressor.Compress(nullptr, buffers, 2, packet.GetSize(), compressed.data(), compressed.size());
+		if (compressedSize == 0)
+			return; //< incompressible, sent as is
+
+		CHECK(compressedSize < packet.GetSize());
+
+		std::vector<Nz::UInt8> decompressed(Nz::ENetConstants::ENetProtocol_MaximumMTU);
+		std::size_t decompressedSize = decompressor.Decompress(nullptr, compressed.data(), compressedSize, decompressed.data(), decompressed.size());
+		REQUIRE(decompressedSize == packet.GetSize());
+		CHECK(std::memcmp(decompressed.data(), packet.GetConstBuffer(), decompressedSize) == 0);
+	}
+}
+
+SCENARIO("ENetCompressor", "[NETWORK][ENETCOMPRESSOR]")
+{
+	std::vector<Nz::ByteArray> packets = GenerateTraffic(42, 100);
+
+	// Highly redundant and random datagrams
+	packets.emplace_back(1200, 0xAB);
+
+	std::mt19937 randomGenerator(1337);
+	Nz::ByteArray randomPacket(1200);
+	for (Nz::UInt8& byte : randomPacket)
+		byte = static_cast<Nz::UInt8>(randomGenerator());
+
+	packets.push_back(std::move(randomPacket));
+
+	WHEN("Using the LZ compressor")
+	{
+		Nz::ENetLZCompressor compressor;
+		Nz::ENetLZCompressor decompressor;
+
+		for (const Nz::ByteArray& packet : packets)
+			CheckRoundTrip(compressor, decompressor, packet);
+
+		THEN("Redundant datagrams are compressed")
+		{
+			Nz::ByteArray packet(1200, 0xAB);
+			Nz::NetBuffer buffer = { packet.GetBuffer(), packet.GetSize() };
+
+			std::vector<Nz::UInt8> compressed(packet.GetSize());
+			CHECK(compressor.Compress(nullptr, &buffer, 1, packet.GetSize(), compressed.data(), compressed.size()) < 32);
+		}
+	}
+
+	WHEN("Using the range coder compressor")
+	{
+		Nz::ENetRangeCoderCompressor compressor;
+		Nz::ENetRangeCoderCompressor decompressor;
+
+		for (const Nz::ByteArray& packet : packets)
+			CheckRoundTrip(compressor, decompressor, packet);
+	}
+
+	WHEN("Using the range coder compressor with a trained dictionary")
+	{
+		std::shared_ptr<Nz::ENetRangeCoderCompressor::Dictionary> dictionary = Nz::ENetRangeCoderCompressor::TrainDictionary(GenerateTraffic(7, 100));
+
+		Nz::ENetRangeCoderCompressor compressor(dictionary);
+		Nz::ENetRangeCoderCompressor decompressor(dictionary);
+
+		for (const Nz::ByteArray& packet : packets)
+			CheckRoundTrip(compressor, decompressor, packet);
+	}
+}
@@ -0,0 +1,67 @@
+#include <Nazara/Network/ENetPacketAllocator.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+SCENARIO("ENetPacketAllocator", "[NETWORK][ENETPACKETALLOCATOR]")
+{
+	GIVEN("A packet allocator")
+	{
+		Nz::ENetPacketAllocator allocator;
+
+		WHEN("We allocate and release packets of the same size class")
+		{
+			const char payload[] = "Hello ENet";
+
+			Nz::ENetPacketRef packet = allocator.Allocate(Nz::ENetPacketFlag::Reliable, payload, sizeof(payload));
+			REQUIRE(packet->data.GetSize() == sizeof(payload));
+			CHECK(std::memcmp(packet->data.GetConstBuffer(), payload, sizeof(payload)) == 0);
+			CHECK(allocator.GetStats().activePackets == 1);
+			CHECK(allocator.GetStats().bufferAllocations == 1);
+
+			const Nz::UInt8* buffer = packet->data.GetConstBuffer();
+			packet.Reset();
+
+			THEN("The payload buffer is pooled and reused")
+			{
+				CHECK(allocator.GetStats().activePackets == 0);
+				CHECK(allocator.GetStats().pooledBuffers == 1);
+
+				Nz::ENetPacketRef otherPacket = allocator.Allocate(Nz::ENetPacketFlag_Unreliable, 32);
+				CHECK(otherPacket->data.GetSize() == 32);
+				CHECK(otherPacket->data.GetConstBuffer() == buffer);
+				CHECK(allocator.GetStats().bufferAllocations == 1);
+				CHECK(allocator.GetStats().bufferReuses == 1);
+				CHECK(allocator.GetStats().pooledBuffers == 0);
+			}
+		}
+
+		WHEN("A packet is shared by several references")
+		{
+			Nz::ENetPacketRef packet = allocator.Allocate(Nz::ENetPacketFlag::Reliable, 1000);
+			Nz::ENetPacketRef sharedPacket = packet;
+			packet.Reset();
+
+			THEN("It is only released with its last reference")
+			{
+				CHECK(allocator.GetStats().activePackets == 1);
+				CHECK(allocator.GetStats().pooledBuffers == 0);
+
+				sharedPacket.Reset();
+				CHECK(allocator.GetStats().activePackets == 0);
+				CHECK(allocator.GetStats().pooledBuffers == 1);
+			}
+		}
+
+		WHEN("We allocate a payload larger than the largest size class")
+		{
+			Nz::ENetPacketRef packet = allocator.Allocate(Nz::ENetPacketFlag::Reliable, 100'000);
+			packet.Reset();
+
+			THEN("Its buffer isn't pooled")
+			{
+				CHECK(allocator.GetStats().pooledBuffers == 0);
+				CHECK(allocator.GetStats().discardedBuffers == 1);
+			}
+		}
+	}
+}
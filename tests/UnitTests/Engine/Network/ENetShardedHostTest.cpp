@@ -0,0 +1,229 @@
+#include <Nazara/Core/Clock.hpp>
+#include <Nazara/Network/ENetHost.hpp>
+#include <Nazara/Network/ENetPeer.hpp>
+#include <Nazara/Network/ENetShardedHost.hpp>
+#include <Nazara/Network/UdpSocket.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct SoakResult
+	{
+		std::size_t messageCount;
+		std::size_t peerCount;
+		std::size_t shardCount;
+		Nz::Time connectionTime;
+		Nz::Time echoTime;
+	};
+
+	// Connects peerCount client peers (spread over several client hosts) to a sharded server, exchanges reliable messages and disconnects them
+	SoakResult RunShardedHostSoak(std::size_t clientHostCount, std::size_t peersPerClient, std::size_t messagesPerPeer, unsigned int shardCount)
+	{
+		std::size_t peerCount = clientHostCount * peersPerClient;
+
+		Nz::ENetShardedHost server;
+		REQUIRE(server.Create(Nz::IpAddress::AnyIpV4, peerCount, 1, shardCount));
+		CHECK(server.GetShardCount() >= 1);
+
+		Nz::IpAddress serverAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), server.GetBoundAddress().GetPort());
+
+		// ENetHost can't be moved once created (peers keep a pointer to their host)
+		std::vector<Nz::ENetHost> clients(clientHostCount);
+		std::vector<Nz::ENetPeer*> clientPeers;
+		for (Nz::ENetHost& client : clients)
+		{
+			REQUIRE(client.Create(Nz::IpAddress::LoopbackIpV4, peersPerClient, 1));
+			for (std::size_t i = 0; i < peersPerClient; ++i)
+			{
+				Nz::ENetPeer* peer = client.Connect(serverAddress, 1);
+				REQUIRE(peer);
+
+				clientPeers.push_back(peer);
+			}
+		}
+
+		std::size_t clientConnections = 0;
+		std::size_t clientDisconnections = 0;
+		std::size_t clientReceivedMessages = 0;
+		std::size_t serverConnections = 0;
+		std::size_t serverDisconnections = 0;
+		std::size_t serverReceivedMessages = 0;
+		Nz::UInt64 clientReceivedSum = 0;
+
+		auto Pump = [&](auto&& isDone)
+		{
+			Nz::Time deadline = Nz::GetElapsedMilliseconds() + Nz::Time::Seconds(30);
+			while (!isDone())
+			{
+				for (Nz::ENetHost& client : clients)
+				{
+					Nz::ENetEvent event;
+					while (client.Service(&event, 0) > 0)
+					{
+						switch (event.type)
+						{
+							case Nz::ENetEventType::OutgoingConnect:
+								clientConnections++;
+								break;
+
+							case Nz::ENetEventType::Disconnect:
+							case Nz::ENetEventType::DisconnectTimeout:
+								clientDisconnections++;
+								break;
+
+							case Nz::ENetEventType::Receive:
+							{
+								Nz::UInt32 value;
+								REQUIRE(event.packet->data.GetSize() == sizeof(value));
+								std::memcpy(&value, event.packet->data.GetConstBuffer(), sizeof(value));
+
+								clientReceivedMessages++;
+								clientReceivedSum += value;
+								break;
+							}
+
+							default:
+								break;
+						}
+					}
+				}
+
+				Nz::ENetShardedEvent event;
+				while (server.PollEvent(&event))
+				{
+					switch (event.type)
+					{
+						case Nz::ENetEventType::IncomingConnect:
+							serverConnections++;
+							break;
+
+						case Nz::ENetEventType::Disconnect:
+						case Nz::ENetEventType::DisconnectTimeout:
+							serverDisconnections++;
+							break;
+
+						case Nz::ENetEventType::Receive:
+							// Echo messages back
+							serverReceivedMessages++;
+							server.Send(event.peer, event.channelId, Nz::ENetPacketFlag::Reliable, std::move(event.packet));
+							break;
+
+						default:
+							break;
+					}
+				}
+
+				if (Nz::GetElapsedMilliseconds() > deadline)
+					return false;
+
+				std::this_thread::yield();
+			}
+
+			return true;
+		};
+
+		Nz::Time start = Nz::GetElapsedMilliseconds();
+
+		REQUIRE(Pump([&] { return clientConnections == peerCount && serverConnections == peerCount; }));
+		Nz::Time connectionTime = Nz::GetElapsedMilliseconds() - start;
+
+		Nz::UInt64 expectedSum = 0;
+		Nz::UInt32 value = 0;
+		for (Nz::ENetPeer* peer : clientPeers)
+		{
+			for (std::size_t i = 0; i < messagesPerPeer; ++i)
+			{
+				value++;
+				expectedSum += value;
+				REQUIRE(peer->Send(0, Nz::ENetPacketFlag::Reliable, Nz::ByteArray(&value, sizeof(value))));
+			}
+		}
+
+		std::size_t messageCount = peerCount * messagesPerPeer;
+
+		start = Nz::GetElapsedMilliseconds();
+		REQUIRE(Pump([&] { return clientReceivedMessages == messageCount; }));
+		Nz::Time echoTime = Nz::GetElapsedMilliseconds() - start;
+
+		CHECK(serverReceivedMessages == messageCount);
+		CHECK(clientReceivedSum == expectedSum);
+
+		for (Nz::ENetPeer* peer : clientPeers)
+			peer->Disconnect(0);
+
+		REQUIRE(Pump([&] { return clientDisconnections == peerCount && serverDisconnections == peerCount; }));
+
+		return SoakResult{ messageCount, peerCount, server.GetShardCount(), connectionTime, echoTime };
+	}
+}
+
+SCENARIO("ENetShardedHost", "[NETWORK][ENETSHARDEDHOST]")
+{
+	GIVEN("A sharded server and a few clients")
+	{
+		RunShardedHostSoak(4, 8, 4, 4);
+	}
+
+	GIVEN("A host listening on a port picked by the system")
+	{
+		Nz::ENetHost host;
+		REQUIRE(host.Create(Nz::IpAddress::AnyIpV4, 2, 1));
+
+		CHECK(host.GetBoundAddress().GetPort() != 0);
+
+		Nz::ENetHost otherHost;
+		REQUIRE(otherHost.Create(Nz::IpAddress::LoopbackIpV4, 1, 1));
+
+		Nz::ENetPeer* peer = otherHost.Connect(Nz::IpAddress(Nz::IpAddress::LoopbackIpV4.ToIPv4(), host.GetBoundAddress().GetPort()), 1);
+		REQUIRE(peer);
+		CHECK(otherHost.OwnsPeer(peer));
+		CHECK_FALSE(host.OwnsPeer(peer));
+
+		WHEN("Another thread sends a datagram to its wakeup socket")
+		{
+			Nz::UdpSocket wakeupSocket(Nz::NetProtocol::IPv4);
+			wakeupSocket.EnableBlocking(false);
+			REQUIRE(wakeupSocket.Bind(Nz::IpAddress::LoopbackIpV4) == Nz::SocketState::Bound);
+			REQUIRE(host.RegisterWakeupSocket(wakeupSocket));
+
+			std::thread wakeupThread([&]
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+				Nz::UdpSocket sender(Nz::NetProtocol::IPv4);
+				Nz::UInt8 wakeupData = 0;
+				sender.Send(wakeupSocket.GetBoundAddress(), &wakeupData, sizeof(wakeupData), nullptr);
+			});
+
+			Nz::Time start = Nz::GetElapsedMilliseconds();
+
+			Nz::ENetEvent event;
+			int result = host.Service(&event, 10'000);
+
+			Nz::Time waitTime = Nz::GetElapsedMilliseconds() - start;
+			wakeupThread.join();
+
+			THEN("Service returns without waiting for its timeout")
+			{
+				CHECK(result == 0);
+				CHECK(waitTime < Nz::Time::Seconds(5));
+
+				Nz::UInt8 wakeupData;
+				CHECK(wakeupSocket.Receive(&wakeupData, sizeof(wakeupData), nullptr, nullptr));
+			}
+
+			host.UnregisterWakeupSocket(wakeupSocket);
+		}
+	}
+}
+
+TEST_CASE("ENetShardedHost soak", "[.][NETWORK][ENETSHARDEDHOST][SOAK]")
+{
+	SoakResult result = RunShardedHostSoak(32, 128, 16, 0);
+
+	std::cout << result.peerCount << " peers over " << result.shardCount << " shards: connected in " << result.connectionTime << ", " << result.messageCount << " messages echoed in " << result.echoTime << std::endl;
+}
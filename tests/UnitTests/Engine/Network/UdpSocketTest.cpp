@@ -1,9 +1,11 @@
 #include <Nazara/Core/ByteArray.hpp>
 #include <Nazara/Core/ByteStream.hpp>
 #include <Nazara/Math/Vector3.hpp>
+#include <Nazara/Network/NetDatagram.hpp>
 #include <Nazara/Network/UdpSocket.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <array>
 
 SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 {
@@ -41,5 +43,64 @@ SCENARIO("UdpSocket", "[NETWORK][UDPSOCKET]")
 				REQUIRE(result == vector123);
 			}
 		}
+
+		WHEN("We send a batch of datagrams from client")
+		{
+			constexpr std::size_t DatagramCount = 4;
+
+			std::array<Nz::UInt32, DatagramCount> values = { 1, 2, 3, 4 };
+			std::array<Nz::NetBuffer, DatagramCount> buffers;
+			std::array<Nz::NetDatagram, DatagramCount> datagrams;
+			for (std::size_t i = 0; i < DatagramCount; ++i)
+			{
+				buffers[i] = { &values[i], sizeof(Nz::UInt32) };
+				datagrams[i] = { serverIP, &buffers[i], 1, 0 };
+			}
+
+			std::size_t sentCount;
+			REQUIRE(client.SendDatagrams(datagrams.data(), datagrams.size(), &sentCount));
+			CHECK(sentCount == DatagramCount);
+			CHECK(datagrams[0].dataLength == sizeof(Nz::UInt32));
+
+			THEN("We should get all of them in order on the server")
+			{
+				std::array<Nz::UInt32, DatagramCount * 2> receivedValues;
+				std::array<Nz::NetBuffer, DatagramCount * 2> receivedBuffers;
+				std::array<Nz::NetDatagram, DatagramCount * 2> receivedDatagrams;
+				for (std::size_t i = 0; i < receivedDatagrams.size(); ++i)
+				{
+					receivedBuffers[i] = { &receivedValues[i], sizeof(Nz::UInt32) };
+					receivedDatagrams[i] = { Nz::IpAddress::Invalid, &receivedBuffers[i], 1, 0 };
+				}
+
+				// Blocking sockets only wait for the first datagram
+				std::size_t receivedCount = 0;
+				while (receivedCount < DatagramCount)
+				{
+					std::size_t count;
+					REQUIRE(server.ReceiveDatagrams(&receivedDatagrams[receivedCount], receivedDatagrams.size() - receivedCount, &count));
+					REQUIRE(count > 0);
+
+					receivedCount += count;
+				}
+
+				REQUIRE(receivedCount == DatagramCount);
+				for (std::size_t i = 0; i < DatagramCount; ++i)
+				{
+					CHECK(receivedDatagrams[i].address.IsLoopback());
+					CHECK(receivedDatagrams[i].dataLength == sizeof(Nz::UInt32));
+					CHECK(receivedValues[i] == values[i]);
+				}
+
+				AND_THEN("Nothing is left once the socket is non-blocking")
+				{
+					server.EnableBlocking(false);
+
+					std::size_t count;
+					REQUIRE(server.ReceiveDatagrams(receivedDatagrams.data(), receivedDatagrams.size(), &count));
+					CHECK(count == 0);
+				}
+			}
+		}
 	}
 }
@@ -1,6 +1,9 @@
+#include <Nazara/Core/Clock.hpp>
 #include <Nazara/Physics2D/PhysWorld2D.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <iostream>
 
 Nz::RigidBody2D CreateBody(Nz::PhysWorld2D& world, const Nz::Vector2f& position, bool isMoving = true, const Nz::Vector2f& lengths = Nz::Vector2f::Unit());
 
@@ -193,6 +196,270 @@ SCENARIO("PhysWorld2D", "[PHYSICS2D][PHYSWORLD2D]")
 	}
 }
 
+SCENARIO("PhysWorld2D state", "[PHYSICS2D][PHYSWORLD2D]")
+{
+	GIVEN("A physic world with a stack of boxes on a floor")
+	{
+		Nz::PhysWorld2D world;
+		world.SetGravity(Nz::Vector2f(0.f, -9.81f));
+
+		Nz::RigidBody2D floor(world, Nz::RigidBody2D::StaticSettings(std::make_shared<Nz::BoxCollider2D>(Nz::Rectf(-10.f, -1.f, 20.f, 1.f))));
+
+		// Boxes are offset so the stack keeps resting on contacts (which are warm started using the contact cache)
+		std::vector<Nz::RigidBody2D> bodies;
+		for (int i = 0; i != 8; ++i)
+			bodies.push_back(CreateBody(world, Nz::Vector2f(0.2f * (i % 2), 1.01f * i)));
+
+		// Falls on the stack after the state was saved
+		bodies.push_back(CreateBody(world, Nz::Vector2f(0.f, 14.f)));
+
+		for (int i = 0; i != 30; ++i)
+			world.Step(Nz::Time::TickDuration(60));
+
+		auto GetTransforms = [&]
+		{
+			std::vector<std::pair<Nz::Vector2f, Nz::RadianAnglef>> transforms;
+			for (const Nz::RigidBody2D& body : bodies)
+				transforms.emplace_back(body.GetPosition(), body.GetRotation());
+
+			return transforms;
+		};
+
+		Nz::ByteArray state;
+		world.SaveState(state);
+
+		auto savedTransforms = GetTransforms();
+
+		for (int i = 0; i != 60; ++i)
+			world.Step(Nz::Time::TickDuration(60));
+
+		auto simulatedTransforms = GetTransforms();
+		CHECK(simulatedTransforms != savedTransforms);
+
+		WHEN("We restore the state")
+		{
+			REQUIRE(world.RestoreState(state));
+
+			THEN("Bodies are back to their saved state and simulate the same way")
+			{
+				CHECK(GetTransforms() == savedTransforms);
+
+				for (int i = 0; i != 60; ++i)
+					world.Step(Nz::Time::TickDuration(60));
+
+				CHECK(GetTransforms() == simulatedTransforms);
+			}
+
+			THEN("Queries use the restored positions")
+			{
+				Nz::PhysWorld2D::NearestQueryResult result;
+				REQUIRE(world.NearestBodyQuery(savedTransforms.back().first + Nz::Vector2f(0.5f, 0.5f), 0.1f, collisionGroup, categoryMask, collisionMask, &result));
+				CHECK(result.nearestBody == &bodies.back());
+			}
+		}
+
+		WHEN("We save a delta against the previous state")
+		{
+			bodies[3].SetPosition(Nz::Vector2f(-100.f, -100.f));
+
+			Nz::ByteArray referenceState;
+			world.SaveState(referenceState);
+
+			bodies[3].SetPosition(Nz::Vector2f(100.f, 100.f));
+
+			Nz::ByteArray stateDelta;
+			world.SaveState(stateDelta, referenceState);
+
+			THEN("Delta is smaller than a full state and can be restored")
+			{
+				CHECK(stateDelta.GetSize() < referenceState.GetSize() / 4);
+
+				REQUIRE(world.RestoreState(referenceState));
+				CHECK(bodies[3].GetPosition() == Nz::Vector2f(-100.f, -100.f));
+
+				REQUIRE(world.RestoreState(stateDelta, referenceState));
+				CHECK(bodies[3].GetPosition() == Nz::Vector2f(100.f, 100.f));
+			}
+		}
+
+		WHEN("A body was removed")
+		{
+			bodies.pop_back();
+
+			THEN("The state can no longer be restored")
+			{
+				CHECK_FALSE(world.RestoreState(state));
+			}
+		}
+	}
+
+	GIVEN("A physic world with a sleeping stack of boxes")
+	{
+		Nz::PhysWorld2D world;
+		world.SetGravity(Nz::Vector2f(0.f, -9.81f));
+		world.SetSleepTime(Nz::Time::Milliseconds(500));
+
+		Nz::RigidBody2D floor(world, Nz::RigidBody2D::StaticSettings(std::make_shared<Nz::BoxCollider2D>(Nz::Rectf(-10.f, -1.f, 20.f, 1.f))));
+
+		std::vector<Nz::RigidBody2D> bodies;
+		for (int i = 0; i != 5; ++i)
+			bodies.push_back(CreateBody(world, Nz::Vector2f(0.f, 1.01f * i)));
+
+		auto IsStackSleeping = [&]
+		{
+			return std::all_of(bodies.begin(), bodies.end(), [](const Nz::RigidBody2D& body) { return body.IsSleeping(); });
+		};
+
+		for (int i = 0; i != 600 && !IsStackSleeping(); ++i)
+			world.Step(Nz::Time::TickDuration(60));
+
+		REQUIRE(IsStackSleeping());
+
+		auto GetTransforms = [&]
+		{
+			std::vector<std::pair<Nz::Vector2f, Nz::RadianAnglef>> transforms;
+			for (const Nz::RigidBody2D& body : bodies)
+				transforms.emplace_back(body.GetPosition(), body.GetRotation());
+
+			return transforms;
+		};
+
+		// Pushing the top box wakes the whole stack up
+		auto PushStack = [&]
+		{
+			bodies.back().Wakeup();
+			bodies.back().AddImpulse(Nz::Vector2f(2.f, 0.f));
+			for (int i = 0; i != 60; ++i)
+				world.Step(Nz::Time::TickDuration(60));
+		};
+
+		Nz::ByteArray state;
+		world.SaveState(state);
+
+		auto savedTransforms = GetTransforms();
+
+		PushStack();
+		CHECK_FALSE(IsStackSleeping());
+
+		auto pushedTransforms = GetTransforms();
+		CHECK(pushedTransforms != savedTransforms);
+
+		WHEN("We restore the state")
+		{
+			REQUIRE(world.RestoreState(state));
+
+			THEN("Bodies are asleep again and stay still")
+			{
+				CHECK(IsStackSleeping());
+				CHECK(GetTransforms() == savedTransforms);
+
+				for (int i = 0; i != 60; ++i)
+					world.Step(Nz::Time::TickDuration(60));
+
+				CHECK(IsStackSleeping());
+				CHECK(GetTransforms() == savedTransforms);
+			}
+
+			THEN("Bodies wake up and simulate the same way")
+			{
+				PushStack();
+				CHECK(GetTransforms() == pushedTransforms);
+			}
+		}
+	}
+}
+
+SCENARIO("PhysWorld2D multithreaded", "[PHYSICS2D][PHYSWORLD2D]")
+{
+	GIVEN("A single threaded and a multithreaded world")
+	{
+		Nz::PhysWorld2D world;
+		CHECK_FALSE(world.IsMultithreaded());
+		CHECK(world.GetThreadCount() == 1);
+
+		Nz::PhysWorld2D::Settings settings;
+		settings.threadCount = 2;
+
+		Nz::PhysWorld2D threadedWorld(settings);
+		CHECK(threadedWorld.IsMultithreaded());
+		CHECK(threadedWorld.GetThreadCount() == 2);
+
+		WHEN("We drop a body on a static one in both worlds")
+		{
+			auto Simulate = [](Nz::PhysWorld2D& physWorld)
+			{
+				physWorld.SetGravity(Nz::Vector2f(0.f, -9.81f));
+
+				Nz::RigidBody2D ground(physWorld, Nz::RigidBody2D::StaticSettings(std::make_shared<Nz::BoxCollider2D>(Nz::Rectf(-5.f, -1.f, 10.f, 1.f))));
+
+				Nz::RigidBody2D body = CreateBody(physWorld, Nz::Vector2f(0.f, 5.f));
+				for (int i = 0; i != 300; ++i)
+					physWorld.Step(Nz::Time::TickDuration(60));
+
+				return body.GetPosition();
+			};
+
+			THEN("It lands at the same position")
+			{
+				Nz::Vector2f position = Simulate(world);
+				Nz::Vector2f threadedPosition = Simulate(threadedWorld);
+
+				CHECK(position.y == Catch::Approx(0.f).margin(0.15f));
+				CHECK(threadedPosition.x == Catch::Approx(position.x).margin(0.01f));
+				CHECK(threadedPosition.y == Catch::Approx(position.y).margin(0.01f));
+			}
+		}
+	}
+}
+
+TEST_CASE("PhysWorld2D multithreaded performance", "[.][PHYSICS2D][PHYSWORLD2D][BENCHMARK]")
+{
+	constexpr std::size_t CircleCount = 10'000;
+	constexpr std::size_t StepCount = 300;
+
+	auto RunBenchmark = [&](const char* name, unsigned int threadCount)
+	{
+		Nz::PhysWorld2D::Settings settings;
+		settings.threadCount = threadCount;
+
+		Nz::PhysWorld2D world(settings);
+		world.SetGravity(Nz::Vector2f(0.f, -9.81f));
+		world.SetIterationCount(10);
+
+		// A container so circles pile up and keep colliding (the solver is the threaded part)
+		std::vector<Nz::RigidBody2D> walls;
+		for (const Nz::Rectf& wallRect : { Nz::Rectf(-1.f, -1.f, 102.f, 1.f), Nz::Rectf(-1.f, 0.f, 1.f, 200.f), Nz::Rectf(100.f, 0.f, 1.f, 200.f) })
+			walls.emplace_back(world, Nz::RigidBody2D::StaticSettings(std::make_shared<Nz::BoxCollider2D>(wallRect)));
+
+		std::shared_ptr<Nz::Collider2D> circle = std::make_shared<Nz::CircleCollider2D>(0.45f);
+
+		std::vector<Nz::RigidBody2D> circles;
+		circles.reserve(CircleCount);
+		for (std::size_t i = 0; i < CircleCount; ++i)
+		{
+			Nz::RigidBody2D::DynamicSettings bodySettings;
+			bodySettings.collider = circle;
+			bodySettings.mass = 1.f;
+			bodySettings.position = Nz::Vector2f(0.5f + (i % 100) + ((i / 100) % 2) * 0.25f, 0.5f + (i / 100) * 1.f);
+
+			circles.emplace_back(world, bodySettings);
+		}
+
+		world.Step(world.GetStepSize());
+
+		Nz::Time start = Nz::GetElapsedNanoseconds();
+		for (std::size_t i = 0; i < StepCount; ++i)
+			world.Step(world.GetStepSize());
+
+		Nz::Time elapsed = Nz::GetElapsedNanoseconds() - start;
+		std::cout << name << " (" << world.GetThreadCount() << " threads): " << CircleCount << " circles, average step " << Nz::Time::Nanoseconds(elapsed.AsNanoseconds() / Nz::Int64(StepCount)) << std::endl;
+	};
+
+	RunBenchmark("cpSpace", 1);
+	RunBenchmark("cpHastySpace", 2);
+	RunBenchmark("cpHastySpace", 0);
+}
+
 Nz::RigidBody2D CreateBody(Nz::PhysWorld2D& world, const Nz::Vector2f& position, bool isMoving, const Nz::Vector2f& lengths)
 {
 	Nz::Rectf aabb(0.f, 0.f, lengths.x, lengths.y);
@@ -0,0 +1,215 @@
+#include <Nazara/Core/ByteArray.hpp>
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/PhysWorld3D.hpp>
+#include <Nazara/Physics3D/RigidBody3D.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <memory>
+#include <optional>
+#include <vector>
+
+SCENARIO("PhysWorld3D state", "[PHYSICS3D][PHYSWORLD3D]")
+{
+	GIVEN("A physic world with boxes falling on a floor")
+	{
+		Nz::PhysWorld3D::Settings settings = Nz::PhysWorld3D::BuildDefaultSettings();
+		settings.gravity = Nz::Vector3f::Down() * 9.81f;
+
+		Nz::PhysWorld3D world(std::move(settings));
+
+		Nz::RigidBody3D::StaticSettings floorSettings(std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(100.f, 1.f, 100.f)));
+		floorSettings.position = Nz::Vector3f::Down() * 0.5f;
+		floorSettings.objectLayer = 0;
+
+		Nz::RigidBody3D floor(world, floorSettings);
+
+		std::shared_ptr<Nz::Collider3D> boxCollider = std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f::Unit());
+
+		std::vector<Nz::RigidBody3D> bodies;
+		bodies.reserve(10);
+		for (int i = 0; i != 10; ++i)
+		{
+			Nz::RigidBody3D::DynamicSettings bodySettings(boxCollider, 1.f);
+			bodySettings.objectLayer = 1;
+			// Stacked with an offset so they collide with each other on the way down
+			bodySettings.position = Nz::Vector3f(0.3f * (i % 2), 2.f + 1.5f * i, 0.f);
+
+			bodies.emplace_back(world, bodySettings);
+		}
+
+		for (int i = 0; i != 10; ++i)
+			world.Step(world.GetStepSize());
+
+		auto GetTransforms = [&]
+		{
+			std::vector<std::pair<Nz::Vector3f, Nz::Quaternionf>> transforms;
+			for (const Nz::RigidBody3D& body : bodies)
+				transforms.push_back(body.GetPositionAndRotation());
+
+			return transforms;
+		};
+
+		Nz::ByteArray state;
+		world.SaveState(state);
+
+		auto savedTransforms = GetTransforms();
+
+		for (int i = 0; i != 60; ++i)
+			world.Step(world.GetStepSize());
+
+		auto simulatedTransforms = GetTransforms();
+		CHECK(simulatedTransforms != savedTransforms);
+
+		WHEN("We restore the state")
+		{
+			REQUIRE(world.RestoreState(state));
+
+			THEN("Bodies are back to their saved state and simulate the same way")
+			{
+				CHECK(GetTransforms() == savedTransforms);
+
+				for (int i = 0; i != 60; ++i)
+					world.Step(world.GetStepSize());
+
+				CHECK(GetTransforms() == simulatedTransforms);
+			}
+		}
+	}
+}
+
+SCENARIO("PhysWorld3D batch queries", "[PHYSICS3D][PHYSWORLD3D]")
+{
+	GIVEN("A physic world with static boxes scattered on a grid")
+	{
+		Nz::PhysWorld3D world;
+
+		std::shared_ptr<Nz::Collider3D> boxCollider = std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f::Unit());
+
+		// Boxes are far enough from each other for a query to hit at most one of them
+		std::vector<Nz::RigidBody3D> boxes;
+		boxes.reserve(81);
+		for (int z = -4; z <= 4; ++z)
+		{
+			for (int x = -4; x <= 4; ++x)
+			{
+				Nz::RigidBody3D::StaticSettings boxSettings(boxCollider);
+				boxSettings.position = Nz::Vector3f(3.f * x, 0.5f * ((x + z + 8) % 3), 3.f * z);
+
+				boxes.emplace_back(world, boxSettings);
+			}
+		}
+
+		world.RefreshBodies();
+
+		// More requests than what a single task processes, to run them in parallel when a task scheduler is available
+		constexpr std::size_t RequestCount = 400;
+
+		std::optional<Nz::TaskScheduler> taskScheduler;
+		bool useTaskScheduler = GENERATE(false, true);
+		if (useTaskScheduler)
+			taskScheduler.emplace(4);
+
+		Nz::TaskScheduler* scheduler = (taskScheduler) ? &*taskScheduler : nullptr;
+
+		WHEN("We cast rays in batch")
+		{
+			std::vector<Nz::PhysWorld3D::RaycastRequest> requests(RequestCount);
+			for (std::size_t i = 0; i < RequestCount; ++i)
+			{
+				Nz::Vector3f position(1.48f * (i % 20) - 14.f, 0.f, 1.48f * (i / 20) - 14.f);
+
+				requests[i].from = position + Nz::Vector3f::Up() * 10.f;
+				requests[i].to = position + Nz::Vector3f::Down() * 10.f;
+			}
+
+			std::vector<Nz::PhysWorld3D::RaycastHit> hits(RequestCount);
+			std::size_t hitCount = world.RaycastQueryFirst(requests, hits, scheduler);
+
+			THEN("Results match single raycasts")
+			{
+				CHECK(hitCount > 0);
+				CHECK(hitCount < RequestCount);
+
+				std::size_t expectedHitCount = 0;
+				for (std::size_t i = 0; i < RequestCount; ++i)
+				{
+					INFO("ray #" << i);
+
+					std::optional<Nz::PhysWorld3D::RaycastHit> expectedHit;
+					bool didHit = world.RaycastQueryFirst(requests[i].from, requests[i].to, [&](const Nz::PhysWorld3D::RaycastHit& hitInfo)
+					{
+						expectedHit = hitInfo;
+					});
+
+					CHECK(didHit == (hits[i].hitBody != nullptr));
+					if (!expectedHit)
+						continue;
+
+					expectedHitCount++;
+
+					CHECK(hits[i].hitBody == expectedHit->hitBody);
+					CHECK(Nz::NumberEquals(hits[i].fraction, expectedHit->fraction, 0.0001f));
+					CHECK(hits[i].hitNormal.ApproxEqual(expectedHit->hitNormal, 0.0001f));
+					CHECK(hits[i].hitPosition.ApproxEqual(expectedHit->hitPosition, 0.0001f));
+					CHECK(hits[i].subShapeID == expectedHit->subShapeID);
+				}
+
+				CHECK(hitCount == expectedHitCount);
+			}
+		}
+
+		WHEN("We test shapes collisions in batch")
+		{
+			Nz::SphereCollider3D sphereCollider(0.4f);
+
+			std::vector<Nz::PhysWorld3D::CollisionRequest> requests(RequestCount);
+			for (std::size_t i = 0; i < RequestCount; ++i)
+			{
+				Nz::Vector3f position(1.48f * (i % 20) - 14.f, 0.1f * (i % 7), 1.48f * (i / 20) - 14.f);
+
+				requests[i].collider = &sphereCollider;
+				requests[i].transform = Nz::Matrix4f::Translate(position);
+			}
+
+			std::vector<Nz::PhysWorld3D::ShapeCollisionInfo> hits(RequestCount);
+			std::size_t hitCount = world.CollisionQuery(requests, hits, scheduler);
+
+			THEN("Results match single collision queries")
+			{
+				CHECK(hitCount > 0);
+				CHECK(hitCount < RequestCount);
+
+				std::size_t expectedHitCount = 0;
+				for (std::size_t i = 0; i < RequestCount; ++i)
+				{
+					INFO("shape #" << i);
+
+					// Batch queries keep the deepest hit
+					std::optional<Nz::PhysWorld3D::ShapeCollisionInfo> expectedHit;
+					world.CollisionQuery(*requests[i].collider, requests[i].transform, [&](const Nz::PhysWorld3D::ShapeCollisionInfo& hitInfo) -> std::optional<float>
+					{
+						if (!expectedHit || hitInfo.penetrationDepth > expectedHit->penetrationDepth)
+							expectedHit = hitInfo;
+
+						return std::nullopt; //< keep collecting hits
+					});
+
+					CHECK(expectedHit.has_value() == (hits[i].hitBody != nullptr));
+					if (!expectedHit)
+						continue;
+
+					expectedHitCount++;
+
+					CHECK(hits[i].hitBody == expectedHit->hitBody);
+					CHECK(Nz::NumberEquals(hits[i].penetrationDepth, expectedHit->penetrationDepth, 0.0001f));
+					CHECK(hits[i].penetrationAxis.ApproxEqual(expectedHit->penetrationAxis, 0.0001f));
+					CHECK(hits[i].collisionPosition1.ApproxEqual(expectedHit->collisionPosition1, 0.0001f));
+					CHECK(hits[i].collisionPosition2.ApproxEqual(expectedHit->collisionPosition2, 0.0001f));
+				}
+
+				CHECK(hitCount == expectedHitCount);
+			}
+		}
+	}
+}
@@ -0,0 +1,320 @@
+#include <Nazara/Core/TaskScheduler.hpp>
+#include <Nazara/Core/Components/NodeComponent.hpp>
+#include <Nazara/Physics3D/Collider3D.hpp>
+#include <Nazara/Physics3D/Components/RigidBody3DComponent.hpp>
+#include <Nazara/Physics3D/Systems/Physics3DSystem.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace
+{
+	constexpr float TransformEpsilon = 0.0001f;
+
+	entt::handle CreateBody(entt::registry& registry, const std::shared_ptr<Nz::Collider3D>& collider, const Nz::Vector3f& position, Nz::PhysicsReplication3D replication)
+	{
+		entt::handle entity(registry, registry.create());
+		entity.emplace<Nz::NodeComponent>(position);
+
+		Nz::RigidBody3D::DynamicSettings settings(collider, 1.f);
+		settings.position = position;
+
+		entity.emplace<Nz::RigidBody3DComponent>(settings, replication);
+
+		return entity;
+	}
+
+	bool IsReplicated(entt::handle entity)
+	{
+		const Nz::NodeComponent& node = entity.get<Nz::NodeComponent>();
+		auto [position, rotation] = entity.get<Nz::RigidBody3DComponent>().GetPositionAndRotation();
+
+		return node.GetGlobalPosition().ApproxEqual(position, TransformEpsilon) && node.GetGlobalRotation().ApproxEqual(rotation, TransformEpsilon);
+	}
+}
+
+SCENARIO("Physics3DSystem", "[PHYSICS3D][PHYSICS3DSYSTEM]")
+{
+	std::shared_ptr<Nz::Collider3D> boxCollider = std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f::Unit());
+
+	GIVEN("Boxes falling on a floor until they sleep")
+	{
+		// Enough bodies to go through parallel replication when a task scheduler is available
+		constexpr std::size_t BoxCount = 600;
+
+		unsigned int workerCount = GENERATE(0u, 4u);
+
+		entt::registry registry;
+
+		std::optional<Nz::TaskScheduler> taskScheduler;
+		if (workerCount > 0)
+		{
+			taskScheduler.emplace(workerCount);
+			registry.ctx().emplace<Nz::TaskScheduler*>(&*taskScheduler);
+		}
+
+		Nz::Physics3DSystem physicsSystem(registry);
+		Nz::Time stepSize = physicsSystem.GetPhysWorld().GetStepSize();
+
+		entt::handle floor(registry, registry.create());
+		Nz::RigidBody3D::StaticSettings floorSettings(std::make_shared<Nz::BoxCollider3D>(Nz::Vector3f(200.f, 1.f, 200.f)));
+		floorSettings.position = Nz::Vector3f::Down() * 0.5f;
+		floor.emplace<Nz::RigidBody3DComponent>(floorSettings);
+
+		std::vector<entt::handle> boxes;
+		for (std::size_t i = 0; i < BoxCount; ++i)
+			boxes.push_back(CreateBody(registry, boxCollider, Nz::Vector3f(2.f * (i % 25) - 25.f, 1.f, 2.f * (i / 25) - 25.f), Nz::PhysicsReplication3D::Global));
+
+		auto AreSleeping = [&]
+		{
+			for (entt::handle box : boxes)
+			{
+				if (!box.get<Nz::RigidBody3DComponent>().IsSleeping())
+					return false;
+			}
+
+			return true;
+		};
+
+		for (std::size_t i = 0; i < 2000 && !AreSleeping(); ++i)
+			physicsSystem.Update(stepSize);
+
+		REQUIRE(AreSleeping());
+
+		THEN("Their last movement before sleeping is replicated")
+		{
+			for (entt::handle box : boxes)
+			{
+				CHECK(box.get<Nz::NodeComponent>().GetGlobalPosition().y < 1.f);
+				CHECK(IsReplicated(box));
+			}
+		}
+
+		WHEN("Simulation goes on while they sleep")
+		{
+			for (entt::handle box : boxes)
+				box.get<Nz::NodeComponent>().SetPosition(Nz::Vector3f::Up() * 10.f);
+
+			for (std::size_t i = 0; i < 10; ++i)
+				physicsSystem.Update(stepSize);
+
+			THEN("They are not replicated again")
+			{
+				for (entt::handle box : boxes)
+					CHECK(box.get<Nz::NodeComponent>().GetPosition() == Nz::Vector3f::Up() * 10.f);
+			}
+		}
+	}
+
+	GIVEN("Falling boxes replicated once")
+	{
+		entt::registry registry;
+		Nz::Physics3DSystem physicsSystem(registry);
+		Nz::Time stepSize = physicsSystem.GetPhysWorld().GetStepSize();
+
+		entt::handle globalBox = CreateBody(registry, boxCollider, Nz::Vector3f(0.f, 10.f, 0.f), Nz::PhysicsReplication3D::GlobalOnce);
+		entt::handle localBox = CreateBody(registry, boxCollider, Nz::Vector3f(5.f, 10.f, 0.f), Nz::PhysicsReplication3D::LocalOnce);
+		entt::handle customBox = CreateBody(registry, boxCollider, Nz::Vector3f(10.f, 10.f, 0.f), Nz::PhysicsReplication3D::CustomOnce);
+
+		unsigned int customReplicationCount = 0;
+		customBox.get<Nz::RigidBody3DComponent>().SetReplicationCallback([&](entt::handle entity, Nz::RigidBody3DComponent& rigidBody)
+		{
+			CHECK(entity == customBox);
+			customReplicationCount++;
+
+			auto [position, rotation] = rigidBody.GetPositionAndRotation();
+			entity.get<Nz::NodeComponent>().SetTransform(position, rotation);
+		});
+
+		physicsSystem.Update(stepSize);
+
+		THEN("They are replicated on the first step and their replication mode is reset")
+		{
+			for (entt::handle box : { globalBox, localBox, customBox })
+			{
+				CHECK(box.get<Nz::NodeComponent>().GetGlobalPosition().y < 10.f);
+				CHECK(IsReplicated(box));
+				CHECK(box.get<Nz::RigidBody3DComponent>().GetReplicationMode() == Nz::PhysicsReplication3D::None);
+			}
+
+			CHECK(customReplicationCount == 1);
+		}
+
+		WHEN("They keep falling")
+		{
+			std::vector<Nz::Vector3f> replicatedPositions;
+			for (entt::handle box : { globalBox, localBox, customBox })
+				replicatedPositions.push_back(box.get<Nz::NodeComponent>().GetPosition());
+
+			for (std::size_t i = 0; i < 10; ++i)
+				physicsSystem.Update(stepSize);
+
+			THEN("They are not replicated anymore")
+			{
+				std::size_t boxIndex = 0;
+				for (entt::handle box : { globalBox, localBox, customBox })
+				{
+					CHECK(box.get<Nz::RigidBody3DComponent>().GetPosition().y < replicatedPositions[boxIndex].y);
+					CHECK(box.get<Nz::NodeComponent>().GetPosition() == replicatedPositions[boxIndex]);
+					boxIndex++;
+				}
+
+				CHECK(customReplicationCount == 1);
+			}
+		}
+	}
+
+	GIVEN("A body replicated globally to a child node")
+	{
+		entt::registry registry;
+		Nz::Physics3DSystem physicsSystem(registry);
+		Nz::Time stepSize = physicsSystem.GetPhysWorld().GetStepSize();
+
+		entt::handle parent(registry, registry.create());
+		parent.emplace<Nz::NodeComponent>(Nz::Vector3f(10.f, 5.f, -3.f), Nz::Quaternionf(Nz::EulerAnglesf(0.f, 90.f, 0.f)), Nz::Vector3f(2.f));
+
+		entt::handle child(registry, registry.create());
+		auto& childNode = child.emplace<Nz::NodeComponent>(Nz::Vector3f(1.f, 0.f, 0.f));
+		childNode.SetParent(parent);
+
+		Nz::RigidBody3D::DynamicSettings settings(boxCollider, 1.f);
+		settings.angularVelocity = Nz::Vector3f(1.f, 2.f, 3.f);
+		auto& childBody = child.emplace<Nz::RigidBody3DComponent>(settings, Nz::PhysicsReplication3D::Global);
+
+		WHEN("The body is simulated")
+		{
+			for (std::size_t i = 0; i < 10; ++i)
+				physicsSystem.Update(stepSize);
+
+			THEN("The child global transform matches the body")
+			{
+				REQUIRE_FALSE(childBody.IsSleeping());
+				CHECK(childNode.GetGlobalPosition().y < 5.f);
+				CHECK_FALSE(childNode.GetPosition().ApproxEqual(childNode.GetGlobalPosition(), TransformEpsilon));
+				CHECK(IsReplicated(child));
+			}
+		}
+	}
+
+	GIVEN("Bodies destroyed between a physics step and replication")
+	{
+		entt::registry registry;
+		Nz::Physics3DSystem physicsSystem(registry);
+		Nz::Time stepSize = physicsSystem.GetPhysWorld().GetStepSize();
+
+		entt::handle firstBox = CreateBody(registry, boxCollider, Nz::Vector3f(0.f, 10.f, 0.f), Nz::PhysicsReplication3D::Global);
+		entt::handle secondBox = CreateBody(registry, boxCollider, Nz::Vector3f(5.f, 10.f, 0.f), Nz::PhysicsReplication3D::Global);
+		entt::handle thirdBox = CreateBody(registry, boxCollider, Nz::Vector3f(10.f, 10.f, 0.f), Nz::PhysicsReplication3D::Global);
+
+		physicsSystem.Update(stepSize);
+
+		WHEN("A replication callback destroys a body which has yet to be replicated")
+		{
+			unsigned int secondBoxReplicationCount = 0;
+			secondBox.get<Nz::RigidBody3DComponent>().SetReplicationMode(Nz::PhysicsReplication3D::Custom);
+			secondBox.get<Nz::RigidBody3DComponent>().SetReplicationCallback([&](entt::handle, Nz::RigidBody3DComponent&)
+			{
+				secondBoxReplicationCount++;
+			});
+
+			REQUIRE(firstBox.get<Nz::RigidBody3DComponent>().GetBodyIndex() < secondBox.get<Nz::RigidBody3DComponent>().GetBodyIndex());
+
+			bool hasDestroyedEntity = false;
+			firstBox.get<Nz::RigidBody3DComponent>().SetReplicationMode(Nz::PhysicsReplication3D::Custom);
+			firstBox.get<Nz::RigidBody3DComponent>().SetReplicationCallback([&](entt::handle, Nz::RigidBody3DComponent&)
+			{
+				if (!hasDestroyedEntity)
+				{
+					secondBox.destroy();
+					hasDestroyedEntity = true;
+				}
+			});
+
+			physicsSystem.Update(stepSize);
+
+			THEN("It is skipped")
+			{
+				CHECK(hasDestroyedEntity);
+				CHECK(secondBoxReplicationCount == 0);
+				CHECK(IsReplicated(thirdBox));
+			}
+		}
+
+		WHEN("A simulated body is destroyed and its index reused before the next step")
+		{
+			Nz::UInt32 bodyIndex = thirdBox.get<Nz::RigidBody3DComponent>().GetBodyIndex();
+			thirdBox.destroy();
+
+			entt::handle newBox = CreateBody(registry, boxCollider, Nz::Vector3f(-5.f, 20.f, 0.f), Nz::PhysicsReplication3D::Global);
+			CHECK(newBox.get<Nz::RigidBody3DComponent>().GetBodyIndex() == bodyIndex);
+
+			physicsSystem.Update(stepSize);
+
+			THEN("Replication only affects live entities")
+			{
+				CHECK(IsReplicated(firstBox));
+				CHECK(IsReplicated(secondBox));
+				CHECK(IsReplicated(newBox));
+				CHECK(physicsSystem.GetRigidBodyEntity(bodyIndex) == newBox);
+			}
+		}
+	}
+
+	GIVEN("Entities queried in batch")
+	{
+		entt::registry registry;
+		Nz::Physics3DSystem physicsSystem(registry);
+
+		entt::handle firstBox = CreateBody(registry, boxCollider, Nz::Vector3f(0.f, 0.f, 0.f), Nz::PhysicsReplication3D::Global);
+		entt::handle secondBox = CreateBody(registry, boxCollider, Nz::Vector3f(5.f, 0.f, 0.f), Nz::PhysicsReplication3D::Global);
+
+		physicsSystem.GetPhysWorld().RefreshBodies();
+
+		WHEN("We cast rays with a caller-provided scratch buffer")
+		{
+			std::array<Nz::Physics3DSystem::RaycastRequest, 3> requests;
+			requests[0] = { Nz::Vector3f(0.f, 10.f, 0.f), Nz::Vector3f(0.f, -10.f, 0.f) };
+			requests[1] = { Nz::Vector3f(2.5f, 10.f, 0.f), Nz::Vector3f(2.5f, -10.f, 0.f) };
+			requests[2] = { Nz::Vector3f(5.f, 10.f, 0.f), Nz::Vector3f(5.f, -10.f, 0.f) };
+
+			std::array<Nz::Physics3DSystem::RaycastHit, 3> hits;
+			hits[1].hitEntity = firstBox; //< must be reset
+
+			std::array<Nz::PhysWorld3D::RaycastHit, 3> scratchHits;
+			std::size_t hitCount = physicsSystem.RaycastQueryFirst(requests, hits, scratchHits);
+
+			THEN("Hits are resolved to entities")
+			{
+				CHECK(hitCount == 2);
+				CHECK(hits[0].hitEntity == firstBox);
+				CHECK_FALSE(hits[1].hitEntity);
+				CHECK(hits[2].hitEntity == secondBox);
+			}
+		}
+
+		WHEN("We test shapes collisions with a caller-provided scratch buffer")
+		{
+			Nz::SphereCollider3D sphereCollider(0.25f);
+
+			std::array<Nz::Physics3DSystem::CollisionRequest, 2> requests;
+			requests[0].collider = &sphereCollider;
+			requests[0].transform = Nz::Matrix4f::Translate(Nz::Vector3f(5.f, 0.5f, 0.f));
+			requests[1].collider = &sphereCollider;
+			requests[1].transform = Nz::Matrix4f::Translate(Nz::Vector3f(2.5f, 0.f, 0.f));
+
+			std::array<Nz::Physics3DSystem::ShapeCollisionInfo, 2> hits;
+			std::array<Nz::PhysWorld3D::ShapeCollisionInfo, 2> scratchHits;
+			std::size_t hitCount = physicsSystem.CollisionQuery(requests, hits, scratchHits);
+
+			THEN("Hits are resolved to entities")
+			{
+				CHECK(hitCount == 1);
+				CHECK(hits[0].hitEntity == secondBox);
+				CHECK_FALSE(hits[1].hitEntity);
+			}
+		}
+	}
+}
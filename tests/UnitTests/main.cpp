@@ -6,11 +6,12 @@
 #include <Nazara/Core/Modules.hpp>
 #include <Nazara/Network/Network.hpp>
 #include <Nazara/Physics2D/Physics2D.hpp>
+#include <Nazara/Physics3D/Physics3D.hpp>
 #include <Nazara/TextRenderer/TextRenderer.hpp>
 
 int main(int argc, char* argv[])
 {
-	Nz::Modules<Nz::Audio, Nz::Network, Nz::Physics2D, Nz::TextRenderer> nazaza;
+	Nz::Modules<Nz::Audio, Nz::Network, Nz::Physics2D, Nz::Physics3D, Nz::TextRenderer> nazaza;
 
 	return Catch::Session().run(argc, argv);
 }
@@ -0,0 +1,15 @@
+option("archivebuilder", { description = "Build ArchiveBuilder tool (packs assets into a single archive)", default = false })
+
+if has_config("archivebuilder") then
+	target("NazaraArchiveBuilder", function ()
+		set_group("Tools")
+		set_kind("binary")
+
+		add_deps("NazaraCore")
+		if not is_plat("windows") then
+			add_cxflags("-fPIC")
+		end
+
+		add_files("../src/ArchiveBuilder/**.cpp")
+	end)
+end
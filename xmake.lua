@@ -120,7 +120,7 @@ local modules = {
 				remove_files("src/Nazara/Core/Posix/TimeImpl.cpp")
 			end
 		end,
-		Packages = { "concurrentqueue", "entt", "frozen", "ordered_map", "stb", "utfcpp" },
+		Packages = { "concurrentqueue", "entt", "frozen", "lz4", "ordered_map", "stb", "utfcpp" },
 		PublicPackages = { "nazarautils" }
 	},
 	Graphics = {
@@ -141,6 +141,7 @@ local modules = {
 	Network = {
 		Option = "network",
 		Deps = {"NazaraCore"},
+		Packages = { "concurrentqueue" },
 		Custom = function ()
 			if not is_plat("wasm") then
 				if has_config("link_curl") then
@@ -301,6 +302,7 @@ add_requires(
 	"entt 3.14.0",
 	"fmt",
 	"frozen",
+	"lz4",
 	"ordered_map",
 	"nazarautils >=2024.11.23",
 	"stb",